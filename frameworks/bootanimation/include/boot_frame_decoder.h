@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FRAMEWORKS_BOOTANIMATION_INCLUDE_BOOT_FRAME_DECODER_H
+#define FRAMEWORKS_BOOTANIMATION_INCLUDE_BOOT_FRAME_DECODER_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "util.h"
+
+namespace OHOS {
+constexpr int32_t DEFAULT_DECODE_AHEAD_FRAMES = 3;
+
+/*
+ * Decodes the frames of a boot picture zip on a worker thread, a bounded window of frames ahead of playback.
+ * Open only indexes the zip entries and parses the frame rate config, so playback starts once the first frames
+ * are decoded instead of after the whole zip. Frames are decoded to raster images on the worker, so the draw thread
+ * does not pay for the decode, and handed over in file name order. Acquiring a frame never waits for the worker, a
+ * frame that is not decoded yet is replaced by the last one handed over. The player keeps only the frame it draws,
+ * so at most the decode window of decoded frames plus one is held in memory.
+ */
+class BootFrameDecoder {
+public:
+    explicit BootFrameDecoder(int32_t maxAheadFrames = DEFAULT_DECODE_AHEAD_FRAMES);
+    ~BootFrameDecoder();
+
+    bool Open(const std::string& zipPath, FrameRateConfig& frameConfig);
+    void Start();
+    void Stop();
+    // take frame index without waiting, frames before it are dropped, the last acquired frame if it is not decoded
+    // yet, nullptr if the decoder is not running or no frame has been decoded
+    std::shared_ptr<ImageStruct> AcquireFrame(int32_t index);
+
+    int32_t GetFrameCount() const
+    {
+        return static_cast<int32_t>(entries_.size());
+    }
+    // peak size of the decoded pixels held by the decode window and the frame being drawn
+    unsigned long GetPeakBufferedBytes() const;
+
+private:
+    struct FrameEntry {
+        std::string fileName;
+        unz_file_pos pos = {};
+        unsigned long fileSize = 0;
+    };
+    struct DecodedFrame {
+        int32_t index = 0;
+        std::shared_ptr<ImageStruct> frame;
+        unsigned long bytes = 0;
+    };
+
+    bool IndexZipEntries(FrameRateConfig& frameConfig);
+    bool ReadConfigEntry(const std::string& fileName, unsigned long fileSize, FrameRateConfig& frameConfig);
+    std::shared_ptr<ImageStruct> DecodeFrame(const FrameEntry& entry, unsigned long& bytes);
+    void DecodeLoop();
+    void CloseZip();
+
+    int32_t maxAheadFrames_;
+    unzFile zipFile_ = nullptr;
+    std::vector<FrameEntry> entries_;
+    std::thread decodeThread_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    std::deque<DecodedFrame> frames_;
+    bool running_ = false;
+    bool decodeFinished_ = false;
+    std::shared_ptr<ImageStruct> lastFrame_;
+    int32_t lastFrameIndex_ = -1;
+    unsigned long queuedBytes_ = 0;
+    unsigned long drawingBytes_ = 0;
+    unsigned long peakBytes_ = 0;
+};
+} // namespace OHOS
+
+#endif // FRAMEWORKS_BOOTANIMATION_INCLUDE_BOOT_FRAME_DECODER_H
@@ -16,6 +16,7 @@
 #ifndef FRAMEWORKS_BOOTANIMATION_INCLUDE_BOOT_PICTURE_PLAYER_H
 #define FRAMEWORKS_BOOTANIMATION_INCLUDE_BOOT_PICTURE_PLAYER_H
 
+#include "boot_frame_decoder.h"
 #include "boot_player.h"
 #include "util.h"
 #include <ui/rs_surface_extractor.h>
@@ -39,6 +40,7 @@ private:
     bool OnDraw(Rosen::Drawing::CoreCanvas* canvas, int32_t curNo);
     void InitPicCoordinates(Rosen::ScreenId screenId);
     bool ReadPicZipFile(ImageStructVec& imgVec, int32_t& freq);
+    bool OpenPicZipStream(int32_t& freq);
     bool CheckFrameRateValid(int32_t frameRate);
     std::string GetPicZipPath();
 
@@ -52,6 +54,11 @@ private:
     int32_t imgVecSize_ = 0;
     int32_t freq_ = 30;
     ImageStructVec imageVector_;
+    // decode frames while playing instead of reading the whole zip before the first frame
+    bool isStreamingDecode_ = false;
+    std::unique_ptr<BootFrameDecoder> frameDecoder_;
+    // the frame drawn last, drawn again when the next frame is not decoded in time
+    std::shared_ptr<ImageStruct> lastFrame_;
 
     std::shared_ptr<OHOS::Rosen::RSSurface> rsSurface_;
     std::unique_ptr<OHOS::Rosen::RSSurfaceFrame> rsSurfaceFrame_;
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "boot_frame_decoder.h"
+
+#include <algorithm>
+
+#include "log.h"
+#include "rs_trace.h"
+
+namespace OHOS {
+BootFrameDecoder::BootFrameDecoder(int32_t maxAheadFrames)
+    : maxAheadFrames_(std::max(maxAheadFrames, 1))
+{
+}
+
+BootFrameDecoder::~BootFrameDecoder()
+{
+    Stop();
+}
+
+bool BootFrameDecoder::Open(const std::string& zipPath, FrameRateConfig& frameConfig)
+{
+    if (zipFile_ != nullptr) {
+        LOGE("frame decoder is already opened");
+        return false;
+    }
+    zipFile_ = unzOpen2(zipPath.c_str(), nullptr);
+    if (zipFile_ == nullptr) {
+        LOGE("Open zipFile fail: %{public}s", zipPath.c_str());
+        return false;
+    }
+    if (!IndexZipEntries(frameConfig)) {
+        CloseZip();
+        return false;
+    }
+    std::sort(entries_.begin(), entries_.end(),
+        [](const FrameEntry& entry1, const FrameEntry& entry2) { return entry1.fileName < entry2.fileName; });
+    LOGI("frame decoder opened, pic num: %{public}d", GetFrameCount());
+    return true;
+}
+
+bool BootFrameDecoder::IndexZipEntries(FrameRateConfig& frameConfig)
+{
+    unz_global_info globalInfo;
+    if (unzGetGlobalInfo(zipFile_, &globalInfo) != UNZ_OK) {
+        LOGE("Get ZipGlobalInfo fail");
+        return false;
+    }
+    for (unsigned long i = 0; i < globalInfo.number_entry; ++i) {
+        unz_file_info fileInfo;
+        char filename[MAX_FILE_NAME] = {0};
+        if (unzGetCurrentFileInfo(zipFile_, &fileInfo, filename, MAX_FILE_NAME, nullptr, 0, nullptr, 0) != UNZ_OK) {
+            return false;
+        }
+        size_t length = strlen(filename);
+        if (length > MAX_FILE_NAME || length == 0) {
+            return false;
+        }
+        if (filename[length - 1] != '/') {
+            std::string name = std::string(filename);
+            size_t npos = name.find_last_of("//");
+            if (npos != std::string::npos) {
+                name = name.substr(npos + 1, name.length());
+            }
+            if (strstr(name.c_str(), BOOT_PIC_CONFIG_FILE.c_str()) != nullptr) {
+                // the config is small and needed before playback, read it right away
+                if (!ReadConfigEntry(name, fileInfo.uncompressed_size, frameConfig)) {
+                    return false;
+                }
+            } else if (fileInfo.uncompressed_size > 0) {
+                FrameEntry entry;
+                entry.fileName = name;
+                entry.fileSize = fileInfo.uncompressed_size;
+                if (unzGetFilePos(zipFile_, &entry.pos) != UNZ_OK) {
+                    return false;
+                }
+                entries_.push_back(entry);
+            }
+        }
+        if (i < (globalInfo.number_entry - 1) && unzGoToNextFile(zipFile_) != UNZ_OK) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BootFrameDecoder::ReadConfigEntry(const std::string& fileName, unsigned long fileSize,
+    FrameRateConfig& frameConfig)
+{
+    if (unzOpenCurrentFile(zipFile_) != UNZ_OK) {
+        return false;
+    }
+    ImageStructVec imgVec;
+    bool ret = ReadImageFile(zipFile_, fileName, imgVec, frameConfig, fileSize);
+    unzCloseCurrentFile(zipFile_);
+    return ret;
+}
+
+void BootFrameDecoder::Start()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (zipFile_ == nullptr || running_) {
+        return;
+    }
+    running_ = true;
+    decodeFinished_ = false;
+    decodeThread_ = std::thread([this] { this->DecodeLoop(); });
+}
+
+void BootFrameDecoder::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cond_.notify_all();
+    if (decodeThread_.joinable()) {
+        decodeThread_.join();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    frames_.clear();
+    lastFrame_ = nullptr;
+    lastFrameIndex_ = -1;
+    queuedBytes_ = 0;
+    drawingBytes_ = 0;
+    CloseZip();
+}
+
+void BootFrameDecoder::CloseZip()
+{
+    if (zipFile_ != nullptr) {
+        unzClose(zipFile_);
+        zipFile_ = nullptr;
+    }
+}
+
+std::shared_ptr<ImageStruct> BootFrameDecoder::DecodeFrame(const FrameEntry& entry, unsigned long& bytes)
+{
+    ROSEN_TRACE_BEGIN(HITRACE_TAG_GRAPHIC_AGP, "BootAnimation::DecodeFrame");
+    ImageStructVec imgVec;
+    FrameRateConfig frameConfig;
+    bool ret = unzGoToFilePos(zipFile_, const_cast<unz_file_pos*>(&entry.pos)) == UNZ_OK &&
+        unzOpenCurrentFile(zipFile_) == UNZ_OK;
+    if (ret) {
+        ret = ReadImageFile(zipFile_, entry.fileName, imgVec, frameConfig, entry.fileSize);
+        unzCloseCurrentFile(zipFile_);
+    }
+    if (!ret || imgVec.empty() || imgVec.back()->imageData == nullptr) {
+        ROSEN_TRACE_END(HITRACE_TAG_GRAPHIC_AGP);
+        LOGE("decode frame failed: %{public}s", entry.fileName.c_str());
+        return nullptr;
+    }
+    // the image made from the encoded data is decoded lazily on first draw, decode it here instead
+    auto frame = imgVec.back();
+    auto rasterImage = frame->imageData->MakeRasterImage();
+    ROSEN_TRACE_END(HITRACE_TAG_GRAPHIC_AGP);
+    if (rasterImage == nullptr) {
+        LOGE("decode frame to raster failed: %{public}s", entry.fileName.c_str());
+        return nullptr;
+    }
+    frame->imageData = rasterImage;
+    // the raster image owns its pixels, the encoded data is not needed anymore
+    frame->memPtr.data_ = nullptr;
+    frame->memPtr.memBuffer = nullptr;
+    bytes = static_cast<unsigned long>(rasterImage->GetImageInfo().GetBytesPerPixel()) *
+        static_cast<unsigned long>(rasterImage->GetWidth()) * static_cast<unsigned long>(rasterImage->GetHeight());
+    return frame;
+}
+
+void BootFrameDecoder::DecodeLoop()
+{
+    for (int32_t index = 0; index < GetFrameCount(); index++) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait(lock, [this] {
+                return !running_ || static_cast<int32_t>(frames_.size()) < maxAheadFrames_;
+            });
+            if (!running_) {
+                return;
+            }
+        }
+        unsigned long bytes = 0;
+        auto frame = DecodeFrame(entries_[index], bytes);
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (frame == nullptr) {
+            break;
+        }
+        frames_.push_back({ index, frame, bytes });
+        queuedBytes_ += bytes;
+        peakBytes_ = std::max(peakBytes_, queuedBytes_ + drawingBytes_);
+        cond_.notify_all();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    decodeFinished_ = true;
+    cond_.notify_all();
+}
+
+std::shared_ptr<ImageStruct> BootFrameDecoder::AcquireFrame(int32_t index)
+{
+    // called on the draw thread, a frame the worker is still decoding must not hold up the vsync
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_ || index < 0 || index >= GetFrameCount()) {
+        LOGE("acquire frame failed: %{public}d", index);
+        return nullptr;
+    }
+    bool dequeued = false;
+    while (!frames_.empty() && frames_.front().index <= index) {
+        DecodedFrame& decoded = frames_.front();
+        // the player keeps the frame until it acquires the next one
+        lastFrame_ = std::move(decoded.frame);
+        lastFrameIndex_ = decoded.index;
+        drawingBytes_ = decoded.bytes;
+        queuedBytes_ -= decoded.bytes;
+        frames_.pop_front();
+        dequeued = true;
+    }
+    if (dequeued) {
+        cond_.notify_all();
+    }
+    if (lastFrameIndex_ != index) {
+        LOGW("frame %{public}d is not decoded yet, repeat frame %{public}d", index, lastFrameIndex_);
+    }
+    return lastFrame_;
+}
+
+unsigned long BootFrameDecoder::GetPeakBufferedBytes() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return peakBytes_;
+}
+} // namespace OHOS
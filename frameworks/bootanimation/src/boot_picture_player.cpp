@@ -22,12 +22,14 @@
 namespace OHOS {
 namespace {
     const std::string BOOT_PIC_ZIP = "/system/etc/graphic/bootpic.zip";
+    constexpr const char* BOOT_PIC_STREAMING_DECODE = "const.bootanimation.streaming_decode.enabled";
 }
 
 BootPicturePlayer::BootPicturePlayer(const PlayerParams& params)
 {
     resPath_ = params.resPath;
     rsSurface_ = params.rsSurface;
+    isStreamingDecode_ = system::GetBoolParameter(BOOT_PIC_STREAMING_DECODE, false);
     InitPicCoordinates(params.screenId);
 }
 
@@ -56,7 +58,9 @@ void BootPicturePlayer::Play()
     }
 
     ROSEN_TRACE_BEGIN(HITRACE_TAG_GRAPHIC_AGP, "BootAnimation::preload");
-    if (ReadPicZipFile(imageVector_, freq_)) {
+    if (isStreamingDecode_ && OpenPicZipStream(freq_)) {
+        imgVecSize_ = frameDecoder_->GetFrameCount();
+    } else if (!isStreamingDecode_ && ReadPicZipFile(imageVector_, freq_)) {
         imgVecSize_ = static_cast<int32_t> (imageVector_.size());
     } else {
         LOGE("read pic zip failed");
@@ -121,6 +125,25 @@ bool BootPicturePlayer::ReadPicZipFile(ImageStructVec& imgVec, int32_t& freq)
     return true;
 }
 
+bool BootPicturePlayer::OpenPicZipStream(int32_t& freq)
+{
+    auto frameDecoder = std::make_unique<BootFrameDecoder>();
+    FrameRateConfig frameConfig;
+    if (!frameDecoder->Open(GetPicZipPath(), frameConfig)) {
+        LOGE("open pic zip failed");
+        return false;
+    }
+    if (CheckFrameRateValid(frameConfig.frameRate)) {
+        freq = frameConfig.frameRate;
+    } else {
+        LOGW("Only Support 30, 60 frame rate: %{public}d", frameConfig.frameRate);
+    }
+    LOGI("stream freq: %{public}d, pic num: %{public}d", freq, frameDecoder->GetFrameCount());
+    frameDecoder->Start();
+    frameDecoder_ = std::move(frameDecoder);
+    return true;
+}
+
 std::string BootPicturePlayer::GetPicZipPath()
 {
     if (!IsFileExisted(resPath_)) {
@@ -178,8 +201,23 @@ bool BootPicturePlayer::OnDraw(Rosen::Drawing::CoreCanvas* canvas, int32_t curNo
         Stop();
         return false;
     }
-    std::shared_ptr<ImageStruct> imgstruct = imageVector_[curNo];
-    std::shared_ptr<Rosen::Drawing::Image> image = imgstruct->imageData;
+    std::shared_ptr<ImageStruct> imgstruct = imageVector_.empty() ? nullptr : imageVector_[curNo];
+    if (frameDecoder_ != nullptr) {
+        imgstruct = frameDecoder_->AcquireFrame(curNo);
+        if (imgstruct == nullptr) {
+            // the decoder repeats a late frame itself, this only happens when it hands over no frame at all, the
+            // last frame stays on screen instead of ending the animation
+            LOGW("OnDraw frame %{public}d is not ready, repeat the last frame", curNo);
+            imgstruct = lastFrame_;
+        } else {
+            lastFrame_ = imgstruct;
+        }
+    }
+    if ((imgstruct == nullptr || imgstruct->imageData == nullptr) && frameDecoder_ == nullptr) {
+        LOGE("OnDraw frame %{public}d is not ready", curNo);
+        Stop();
+        return false;
+    }
 
     ROSEN_TRACE_BEGIN(HITRACE_TAG_GRAPHIC_AGP, "BootAnimation::OnDraw in drawRect");
     Rosen::Drawing::Brush brush;
@@ -189,17 +227,29 @@ bool BootPicturePlayer::OnDraw(Rosen::Drawing::CoreCanvas* canvas, int32_t curNo
     canvas->DrawRect(bgRect);
     canvas->DetachBrush();
     ROSEN_TRACE_END(HITRACE_TAG_GRAPHIC_AGP);
+    if (imgstruct == nullptr || imgstruct->imageData == nullptr) {
+        // no frame has been decoded yet, keep the black background
+        return true;
+    }
+    std::shared_ptr<Rosen::Drawing::Image> image = imgstruct->imageData;
+
     ROSEN_TRACE_BEGIN(HITRACE_TAG_GRAPHIC_AGP, "BootAnimation::OnDraw in drawImageRect");
     Rosen::Drawing::Rect rect(pointX_, pointY_, pointX_ + realWidth_, pointY_ + realHeight_);
     Rosen::Drawing::SamplingOptions samplingOptions;
     canvas->DrawImageRect(*image, rect, samplingOptions);
-    imageVector_[curNo].reset();
+    if (frameDecoder_ == nullptr) {
+        imageVector_[curNo].reset();
+    }
     ROSEN_TRACE_END(HITRACE_TAG_GRAPHIC_AGP);
     return true;
 }
 
 bool BootPicturePlayer::Stop()
 {
+    if (frameDecoder_ != nullptr) {
+        frameDecoder_->Stop();
+    }
+    lastFrame_ = nullptr;
     auto runner = AppExecFwk::EventRunner::Current();
     if (runner == nullptr) {
         LOGE("runner is null");
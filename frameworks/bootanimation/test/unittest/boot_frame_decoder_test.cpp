@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <gtest/gtest.h>
+
+#include "boot_frame_decoder.h"
+#include "boot_picture_player.h"
+#include "image/bitmap.h"
+#include "image/image.h"
+#include "draw/canvas.h"
+#include "zip.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Rosen {
+namespace {
+    constexpr const char* TEST_FRAME_ZIP_PATH = "/data/local/tmp/ba_frame_decoder_test.zip";
+    constexpr int32_t TEST_FRAME_COUNT = 6;
+    constexpr int32_t TEST_FRAME_RATE = 60;
+    constexpr int32_t TEST_FRAME_SIDE = 64;
+    constexpr int32_t PLAY_FRAME_COUNT = 30;
+    constexpr int32_t PERF_FRAME_COUNT = 120;
+    constexpr int32_t PERF_FRAME_SIDE = 256;
+    constexpr unsigned long PERF_DECODED_FRAME_BYTES = PERF_FRAME_SIDE * PERF_FRAME_SIDE * 4; // 4: rgba bytes
+    constexpr unsigned long DECODED_FRAME_BYTES = TEST_FRAME_SIDE * TEST_FRAME_SIDE * 4; // 4: rgba bytes per pixel
+    constexpr int32_t CANVAS_SIDE = 256;
+    constexpr int32_t WAIT_QUEUE_FULL_MS = 1000;
+
+    std::string GetFrameName(int32_t index)
+    {
+        return "frame_" + std::to_string(100 + index) + ".png"; // 100: keep the names sortable
+    }
+
+    std::shared_ptr<Drawing::Data> EncodeBitmap(const Drawing::Bitmap& bitmap)
+    {
+        auto image = bitmap.MakeImage();
+        return image == nullptr ? nullptr : image->EncodeToData(Drawing::EncodedImageFormat::PNG, 100); // 100: quality
+    }
+
+    std::shared_ptr<Drawing::Data> EncodeFrame(int32_t index)
+    {
+        Drawing::Bitmap bitmap;
+        Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_OPAQUE };
+        bitmap.Build(TEST_FRAME_SIDE, TEST_FRAME_SIDE, format);
+        bitmap.ClearWithColor(Drawing::Color::ColorQuadSetARGB(0xff, index * 8 % 0xff, 0x80, 0x40)); // 8: color step
+        return EncodeBitmap(bitmap);
+    }
+
+    // a noise frame does not compress, the zip entries have the size of a real boot animation frame
+    std::shared_ptr<Drawing::Data> EncodeNoiseFrame()
+    {
+        Drawing::Bitmap bitmap;
+        Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_OPAQUE };
+        bitmap.Build(PERF_FRAME_SIDE, PERF_FRAME_SIDE, format);
+        auto pixels = static_cast<uint32_t*>(bitmap.GetPixels());
+        if (pixels == nullptr) {
+            return nullptr;
+        }
+        uint32_t seed = 1;
+        for (int32_t i = 0; i < PERF_FRAME_SIDE * PERF_FRAME_SIDE; i++) {
+            seed = seed * 1103515245u + 12345u; // linear congruential generator
+            pixels[i] = seed | 0xff000000u; // keep the pixel opaque
+        }
+        return EncodeBitmap(bitmap);
+    }
+
+    void WriteZipEntry(zipFile zf, const std::string& name, const void* data, size_t size)
+    {
+        zip_fileinfo info = {};
+        ASSERT_EQ(zipOpenNewFileInZip(zf, name.c_str(), &info, nullptr, 0, nullptr, 0, nullptr,
+            Z_DEFLATED, Z_DEFAULT_COMPRESSION), ZIP_OK);
+        zipWriteInFileInZip(zf, data, size);
+        zipCloseFileInZip(zf);
+    }
+
+    void CreateNoiseFrameZip(const std::string& path, int32_t frameCount)
+    {
+        auto data = EncodeNoiseFrame();
+        ASSERT_NE(data, nullptr);
+        zipFile zf = zipOpen(path.c_str(), APPEND_STATUS_CREATE);
+        ASSERT_NE(zf, nullptr);
+        std::string config = "{\"FrameRate\": " + std::to_string(TEST_FRAME_RATE) + "}";
+        WriteZipEntry(zf, BOOT_PIC_CONFIG_FILE, config.data(), config.size());
+        for (int32_t index = 0; index < frameCount; index++) {
+            WriteZipEntry(zf, GetFrameName(index), data->GetData(), data->GetSize());
+        }
+        zipClose(zf, nullptr);
+    }
+
+    // acquiring does not wait, give the worker the time a vsync would before the frame is drawn
+    void WaitFrameDecoded(BootFrameDecoder& decoder, int32_t index)
+    {
+        std::unique_lock<std::mutex> lock(decoder.mutex_);
+        decoder.cond_.wait_for(lock, std::chrono::milliseconds(WAIT_QUEUE_FULL_MS), [&decoder, index] {
+            return !decoder.running_ || decoder.decodeFinished_ || decoder.lastFrameIndex_ >= index ||
+                (!decoder.frames_.empty() && decoder.frames_.back().index >= index);
+        });
+    }
+
+    void CreateFrameZip(const std::string& path, int32_t frameCount)
+    {
+        zipFile zf = zipOpen(path.c_str(), APPEND_STATUS_CREATE);
+        ASSERT_NE(zf, nullptr);
+        std::string config = "{\"FrameRate\": " + std::to_string(TEST_FRAME_RATE) + "}";
+        WriteZipEntry(zf, BOOT_PIC_CONFIG_FILE, config.data(), config.size());
+        // write the frames in reverse order, the decoder hands them over in name order
+        for (int32_t index = frameCount - 1; index >= 0; index--) {
+            auto data = EncodeFrame(index);
+            ASSERT_NE(data, nullptr);
+            WriteZipEntry(zf, GetFrameName(index), data->GetData(), data->GetSize());
+        }
+        zipClose(zf, nullptr);
+    }
+
+    double ElapsedMs(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::shared_ptr<BootPicturePlayer> CreateStreamingPlayer(const std::string& zipPath)
+    {
+        PlayerParams params;
+        auto player = std::make_shared<BootPicturePlayer>(params);
+        player->frameDecoder_ = std::make_unique<BootFrameDecoder>();
+        FrameRateConfig frameConfig;
+        if (!player->frameDecoder_->Open(zipPath, frameConfig)) {
+            return nullptr;
+        }
+        player->imgVecSize_ = player->frameDecoder_->GetFrameCount();
+        return player;
+    }
+}
+
+class BootFrameDecoderTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        bitmap_.Build(CANVAS_SIDE, CANVAS_SIDE,
+            Drawing::BitmapFormat { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_OPAQUE });
+        canvas_.Bind(bitmap_);
+    }
+
+    void TearDown() override
+    {
+        remove(TEST_FRAME_ZIP_PATH);
+    }
+
+    Drawing::Bitmap bitmap_;
+    Drawing::Canvas canvas_;
+};
+
+/**
+ * @tc.name: OpenAndAcquireFrame
+ * @tc.desc: Verify frames are decoded to raster images in name order and the frame rate config is parsed on open.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BootFrameDecoderTest, OpenAndAcquireFrame, TestSize.Level1)
+{
+    CreateFrameZip(TEST_FRAME_ZIP_PATH, TEST_FRAME_COUNT);
+    BootFrameDecoder decoder;
+    FrameRateConfig frameConfig;
+    EXPECT_FALSE(decoder.Open("/data/local/tmp/not_exist.zip", frameConfig));
+    ASSERT_TRUE(decoder.Open(TEST_FRAME_ZIP_PATH, frameConfig));
+    EXPECT_FALSE(decoder.Open(TEST_FRAME_ZIP_PATH, frameConfig));
+    EXPECT_EQ(frameConfig.frameRate, TEST_FRAME_RATE);
+    EXPECT_EQ(decoder.GetFrameCount(), TEST_FRAME_COUNT);
+
+    // nothing is decoded before Start
+    EXPECT_EQ(decoder.AcquireFrame(0), nullptr);
+    decoder.Start();
+    for (int32_t index = 0; index < TEST_FRAME_COUNT; index++) {
+        WaitFrameDecoded(decoder, index);
+        auto frame = decoder.AcquireFrame(index);
+        ASSERT_NE(frame, nullptr);
+        EXPECT_EQ(frame->fileName, GetFrameName(index));
+        // decoded on the worker, drawing does not decode again and the encoded data is released
+        ASSERT_NE(frame->imageData, nullptr);
+        EXPECT_FALSE(frame->imageData->IsLazyGenerated());
+        EXPECT_EQ(frame->imageData->GetWidth(), TEST_FRAME_SIDE);
+        EXPECT_EQ(frame->memPtr.memBuffer, nullptr);
+    }
+    EXPECT_EQ(decoder.AcquireFrame(TEST_FRAME_COUNT), nullptr);
+    decoder.Stop();
+    EXPECT_EQ(decoder.AcquireFrame(0), nullptr);
+}
+
+/**
+ * @tc.name: DecodeWindowIsBounded
+ * @tc.desc: Verify the decoder stops ahead of playback at the window size, skipped frames are dropped and the peak
+ *           counts the decoded pixels.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BootFrameDecoderTest, DecodeWindowIsBounded, TestSize.Level1)
+{
+    constexpr int32_t maxAheadFrames = 2;
+    CreateFrameZip(TEST_FRAME_ZIP_PATH, TEST_FRAME_COUNT);
+    BootFrameDecoder decoder(maxAheadFrames);
+    FrameRateConfig frameConfig;
+    ASSERT_TRUE(decoder.Open(TEST_FRAME_ZIP_PATH, frameConfig));
+    decoder.Start();
+    {
+        std::unique_lock<std::mutex> lock(decoder.mutex_);
+        decoder.cond_.wait_for(lock, std::chrono::milliseconds(WAIT_QUEUE_FULL_MS),
+            [&decoder] { return static_cast<int32_t>(decoder.frames_.size()) == maxAheadFrames; });
+        EXPECT_EQ(static_cast<int32_t>(decoder.frames_.size()), maxAheadFrames);
+        EXPECT_EQ(decoder.queuedBytes_, DECODED_FRAME_BYTES * maxAheadFrames);
+    }
+    // the window is full and the worker waits, the newest decoded frame stands in for the requested one
+    auto frame = decoder.AcquireFrame(TEST_FRAME_COUNT - 1);
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->fileName, GetFrameName(maxAheadFrames - 1));
+    // the window is free again, the worker decodes the next window behind the frame being drawn
+    constexpr int32_t lastWindowFrame = maxAheadFrames * 2 - 1;
+    WaitFrameDecoded(decoder, lastWindowFrame);
+    frame = decoder.AcquireFrame(TEST_FRAME_COUNT - 1);
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->fileName, GetFrameName(lastWindowFrame));
+    // a frame that was dropped is not handed over again, the last frame is repeated
+    frame = decoder.AcquireFrame(0);
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->fileName, GetFrameName(lastWindowFrame));
+    EXPECT_GE(decoder.GetPeakBufferedBytes(), DECODED_FRAME_BYTES * maxAheadFrames);
+    EXPECT_LE(decoder.GetPeakBufferedBytes(), DECODED_FRAME_BYTES * (maxAheadFrames + 1));
+}
+
+/**
+ * @tc.name: AcquireFrameDoesNotWait
+ * @tc.desc: Verify acquiring a frame the worker has not decoded yet returns at once with the last acquired frame.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BootFrameDecoderTest, AcquireFrameDoesNotWait, TestSize.Level1)
+{
+    CreateFrameZip(TEST_FRAME_ZIP_PATH, TEST_FRAME_COUNT);
+    BootFrameDecoder decoder;
+    FrameRateConfig frameConfig;
+    ASSERT_TRUE(decoder.Open(TEST_FRAME_ZIP_PATH, frameConfig));
+    // no worker is started, the test hands the decoded frames over itself
+    {
+        std::lock_guard<std::mutex> lock(decoder.mutex_);
+        decoder.running_ = true;
+    }
+    EXPECT_EQ(decoder.AcquireFrame(0), nullptr);
+
+    auto pushFrame = [&decoder](int32_t index) {
+        auto frame = std::make_shared<ImageStruct>();
+        frame->fileName = GetFrameName(index);
+        std::lock_guard<std::mutex> lock(decoder.mutex_);
+        decoder.frames_.push_back({ index, frame, DECODED_FRAME_BYTES });
+        decoder.queuedBytes_ += DECODED_FRAME_BYTES;
+    };
+    pushFrame(0);
+    auto frame = decoder.AcquireFrame(0);
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->fileName, GetFrameName(0));
+    EXPECT_EQ(decoder.AcquireFrame(1), frame);
+    EXPECT_EQ(decoder.lastFrameIndex_, 0);
+
+    // frames behind the requested one are dropped, the ones ahead stay queued
+    pushFrame(1);
+    pushFrame(2);
+    pushFrame(3);
+    frame = decoder.AcquireFrame(2);
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->fileName, GetFrameName(2));
+    EXPECT_EQ(decoder.frames_.size(), 1u);
+    EXPECT_EQ(decoder.queuedBytes_, DECODED_FRAME_BYTES);
+    EXPECT_EQ(decoder.drawingBytes_, DECODED_FRAME_BYTES);
+    decoder.Stop();
+    EXPECT_EQ(decoder.AcquireFrame(3), nullptr);
+    EXPECT_EQ(decoder.lastFrame_, nullptr);
+}
+
+/**
+ * @tc.name: StreamingDecodeIsOffByDefault
+ * @tc.desc: Verify the player reads the whole zip before playback unless streaming decode is enabled.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BootFrameDecoderTest, StreamingDecodeIsOffByDefault, TestSize.Level1)
+{
+    if (system::GetParameter("const.bootanimation.streaming_decode.enabled", "").empty()) {
+        PlayerParams params;
+        BootPicturePlayer player(params);
+        EXPECT_FALSE(player.isStreamingDecode_);
+        EXPECT_EQ(player.frameDecoder_, nullptr);
+    }
+}
+
+/**
+ * @tc.name: LateFrameRepeatsLastFrame
+ * @tc.desc: Verify a frame that is not decoded in time does not stop the animation, the last frame is drawn again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BootFrameDecoderTest, LateFrameRepeatsLastFrame, TestSize.Level1)
+{
+    CreateFrameZip(TEST_FRAME_ZIP_PATH, TEST_FRAME_COUNT);
+    auto player = CreateStreamingPlayer(TEST_FRAME_ZIP_PATH);
+    ASSERT_NE(player, nullptr);
+    // the decoder is not started, no frame is ready yet and only the background is drawn
+    EXPECT_TRUE(player->OnDraw(&canvas_, 0));
+    EXPECT_EQ(player->lastFrame_, nullptr);
+    EXPECT_NE(player->frameDecoder_->zipFile_, nullptr);
+
+    player->frameDecoder_->Start();
+    WaitFrameDecoded(*player->frameDecoder_, 1);
+    EXPECT_TRUE(player->OnDraw(&canvas_, 1));
+    ASSERT_NE(player->lastFrame_, nullptr);
+    EXPECT_EQ(player->lastFrame_->fileName, GetFrameName(1));
+
+    // a stopped decoder hands over no frame at all
+    std::unique_lock<std::mutex> lock(player->frameDecoder_->mutex_);
+    player->frameDecoder_->running_ = false;
+    lock.unlock();
+    EXPECT_TRUE(player->OnDraw(&canvas_, 2));
+    EXPECT_EQ(player->lastFrame_->fileName, GetFrameName(1));
+    player->frameDecoder_->Stop();
+}
+
+/**
+ * @tc.name: StreamingDecodePlayback
+ * @tc.desc: Play a generated zip to an offscreen canvas, every frame is drawn and the decoded pixels held stay
+ *           within the decode window instead of the whole animation.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BootFrameDecoderTest, StreamingDecodePlayback, TestSize.Level1)
+{
+    CreateFrameZip(TEST_FRAME_ZIP_PATH, PLAY_FRAME_COUNT);
+    auto player = CreateStreamingPlayer(TEST_FRAME_ZIP_PATH);
+    ASSERT_NE(player, nullptr);
+    player->frameDecoder_->Start();
+    for (int32_t index = 0; index < player->imgVecSize_; index++) {
+        WaitFrameDecoded(*player->frameDecoder_, index);
+        EXPECT_TRUE(player->OnDraw(&canvas_, index));
+        ASSERT_NE(player->lastFrame_, nullptr);
+        EXPECT_EQ(player->lastFrame_->fileName, GetFrameName(index));
+    }
+    unsigned long peakBytes = player->frameDecoder_->GetPeakBufferedBytes();
+    player->frameDecoder_->Stop();
+    EXPECT_GE(peakBytes, DECODED_FRAME_BYTES);
+    EXPECT_LE(peakBytes, DECODED_FRAME_BYTES * (DEFAULT_DECODE_AHEAD_FRAMES + 1));
+    EXPECT_LT(peakBytes, DECODED_FRAME_BYTES * PLAY_FRAME_COUNT);
+}
+
+/**
+ * @tc.name: StreamingDecodeStartupPerfTest
+ * @tc.desc: Play a zip of full size frames to an offscreen canvas, streaming decode draws the first frame before the
+ *           preload path has read the zip and holds the decoded pixels of the decode window instead of every
+ *           encoded frame.
+ * @tc.type: PERF
+ */
+HWTEST_F(BootFrameDecoderTest, StreamingDecodeStartupPerfTest, TestSize.Level1)
+{
+    CreateNoiseFrameZip(TEST_FRAME_ZIP_PATH, PERF_FRAME_COUNT);
+
+    // preload: every entry is read before playback, the first frame is decoded on the first draw
+    auto start = std::chrono::steady_clock::now();
+    ImageStructVec imgVec;
+    FrameRateConfig frameConfig;
+    ASSERT_TRUE(ReadZipFile(TEST_FRAME_ZIP_PATH, imgVec, frameConfig));
+    SortZipFile(imgVec);
+    ASSERT_EQ(static_cast<int32_t>(imgVec.size()), PERF_FRAME_COUNT);
+    ASSERT_NE(imgVec.front()->imageData, nullptr);
+    EXPECT_NE(imgVec.front()->imageData->MakeRasterImage(), nullptr);
+    double preloadFirstFrameMs = ElapsedMs(start);
+    unsigned long preloadBytes = 0;
+    for (const auto& img : imgVec) {
+        preloadBytes += img->memPtr.bufsize;
+    }
+    imgVec.clear();
+
+    // streaming: only the entries are indexed before the worker decodes the first frame
+    start = std::chrono::steady_clock::now();
+    auto player = CreateStreamingPlayer(TEST_FRAME_ZIP_PATH);
+    ASSERT_NE(player, nullptr);
+    player->frameDecoder_->Start();
+    WaitFrameDecoded(*player->frameDecoder_, 0);
+    EXPECT_TRUE(player->OnDraw(&canvas_, 0));
+    double streamFirstFrameMs = ElapsedMs(start);
+    ASSERT_NE(player->lastFrame_, nullptr);
+    EXPECT_EQ(player->lastFrame_->fileName, GetFrameName(0));
+    for (int32_t index = 1; index < player->imgVecSize_; index++) {
+        WaitFrameDecoded(*player->frameDecoder_, index);
+        EXPECT_TRUE(player->OnDraw(&canvas_, index));
+        ASSERT_NE(player->lastFrame_, nullptr);
+        EXPECT_EQ(player->lastFrame_->fileName, GetFrameName(index));
+    }
+    unsigned long streamBytes = player->frameDecoder_->GetPeakBufferedBytes();
+    player->frameDecoder_->Stop();
+
+    EXPECT_LT(streamFirstFrameMs, preloadFirstFrameMs);
+    EXPECT_GE(streamBytes, PERF_DECODED_FRAME_BYTES);
+    EXPECT_LE(streamBytes, PERF_DECODED_FRAME_BYTES * (DEFAULT_DECODE_AHEAD_FRAMES + 1));
+    EXPECT_LT(streamBytes, preloadBytes);
+}
+} // namespace OHOS::Rosen
@@ -31,6 +31,7 @@
 #include "utils/text_trace.h"
 
 #define INSTALL_FONT_CONFIG_FILE "/data/service/el1/public/for-all-app/fonts/install_fontconfig.json"
+#define SYSTEM_FONT_INDEX_FILE "/data/service/el1/public/for-all-app/fonts/system_font_descriptor.idx"
 
 namespace OHOS::Rosen {
 namespace {
@@ -57,18 +58,27 @@ void FontDescriptorCache::ClearFontFileCache()
     symbolicCache_.clear();
     stylishFullNameMap_.clear();
     dynamicFullNameMap_.clear();
+    systemFontIndex_.reset();
 }
 
 void FontDescriptorCache::ParserSystemFonts()
 {
     std::lock_guard guard(mutex_);
     // System fonts have already been parsed
-    if (!fullNameMap_.empty()) {
+    if (!fullNameMap_.empty() || systemFontIndex_ != nullptr) {
+        return;
+    }
+    systemFontIndex_ = FontDescriptorIndex::Load(SYSTEM_FONT_INDEX_FILE);
+    if (systemFontIndex_ != nullptr) {
+        TEXT_LOGD("System fonts loaded from index, count: %{public}u", systemFontIndex_->GetEntryCount());
         return;
     }
     for (auto& item : parser_.GetSystemFonts()) {
         FontDescriptorScatter(item);
     }
+    // Best effort, only processes that can write the font directory build the index for everyone else
+    FontDescriptorIndex::Build(SYSTEM_FONT_INDEX_FILE,
+        std::vector<FontDescSharedPtr>(allFontDescriptor_.begin(), allFontDescriptor_.end()));
     Dump();
 }
 
@@ -172,6 +182,12 @@ std::unordered_set<std::string> FontDescriptorCache::GetStylishFontList()
 std::unordered_set<std::string> FontDescriptorCache::GetGenericFontList()
 {
     std::unordered_set<std::string> fullNameList;
+    if (systemFontIndex_ != nullptr) {
+        for (uint32_t i = 0; i < systemFontIndex_->GetEntryCount(); ++i) {
+            fullNameList.emplace(systemFontIndex_->GetKey(i, FontDescriptorIndex::FULL_NAME));
+        }
+        return fullNameList;
+    }
     for (const auto& temp : allFontDescriptor_) {
         fullNameList.emplace(temp->fullName);
     }
@@ -359,11 +375,21 @@ void FontDescriptorCache::GetFontDescSharedPtrByFullName(const std::string& full
         }
         return false;
     };
+    auto tryFindSystemFontDescriptor = [this, &fullName, &result, &tryFindFontDescriptor]() -> bool {
+        if (systemFontIndex_ == nullptr) {
+            return tryFindFontDescriptor(fullNameMap_);
+        }
+        auto entries = systemFontIndex_->FindByKey(FontDescriptorIndex::FULL_NAME, fullName);
+        if (entries.empty()) {
+            return false;
+        }
+        result = systemFontIndex_->GetDescriptor(entries.front());
+        return result != nullptr;
+    };
 
     uint32_t  fontCategory = static_cast<uint32_t>(fontType);
     std::lock_guard guard(mutex_);
-    if ((fontCategory & TextEngine::FontParser::SystemFontType::GENERIC) &&
-        tryFindFontDescriptor(fullNameMap_)) {
+    if ((fontCategory & TextEngine::FontParser::SystemFontType::GENERIC) && tryFindSystemFontDescriptor()) {
         return;
     }
     if ((fontCategory & TextEngine::FontParser::SystemFontType::STYLISH) &&
@@ -582,6 +608,10 @@ void FontDescriptorCache::MatchFromFontDescriptor(FontDescSharedPtr desc, std::s
         return;
     }
     ParserSystemFonts();
+    if (systemFontIndex_ != nullptr) {
+        MatchFromSystemFontIndex(desc, result);
+        return;
+    }
     if (IsDefault(desc)) {
         result = std::set<FontDescSharedPtr>(allFontDescriptor_.begin(), allFontDescriptor_.end());
         return;
@@ -605,6 +635,29 @@ void FontDescriptorCache::MatchFromFontDescriptor(FontDescSharedPtr desc, std::s
     result = std::move(finishRet);
 }
 
+void FontDescriptorCache::MatchFromSystemFontIndex(FontDescSharedPtr desc, std::set<FontDescSharedPtr>& result)
+{
+    desc->weight = (desc->weight > 0) ? WeightAlignment(desc->weight) : desc->weight;
+    const std::string names[FontDescriptorIndex::KEY_COUNT] = {
+        desc->fontFamily, desc->fullName, desc->postScriptName, desc->fontSubfamily };
+    FontDescriptorIndex::StyleFilter style;
+    style.weight = desc->weight;
+    style.width = desc->width;
+    style.italic = desc->italic;
+    style.monoSpace = desc->monoSpace;
+    style.symbolic = desc->symbolic;
+    std::lock_guard guard(mutex_);
+    if (systemFontIndex_ == nullptr) {
+        return;
+    }
+    for (uint32_t entry : systemFontIndex_->Match(names, style)) {
+        auto item = systemFontIndex_->GetDescriptor(entry);
+        if (item != nullptr) {
+            result.emplace(item);
+        }
+    }
+}
+
 void FontDescriptorCache::Dump() const
 {
     TEXT_LOGD("allFontDescriptor size: %{public}zu, fontFamilyMap size: %{public}zu, fullNameMap size: %{public}zu \
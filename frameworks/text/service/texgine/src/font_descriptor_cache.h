@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "font_config.h"
+#include "font_descriptor_index.h"
 #include "font_parser.h"
 
 namespace OHOS::Rosen {
@@ -67,6 +68,7 @@ private:
         int32_t systemFontType, int32_t& fontType);
     void ParserFontsByFontType(int32_t fontType);
     static void CollectGenericFontPaths(std::unordered_set<std::string>& fontPaths);
+    void MatchFromSystemFontIndex(FontDescSharedPtr desc, std::set<FontDescSharedPtr>& result);
 
 private:
     TextEngine::FontParser parser_;
@@ -92,6 +94,8 @@ private:
     std::set<FontDescSharedPtr> monoSpaceCache_;
     std::set<FontDescSharedPtr> symbolicCache_;
     std::unordered_map<std::string, std::set<FontDescSharedPtr>> stylishFullNameMap_;
+    // when loaded, generic (system) fonts are queried here and the maps above stay empty for them
+    std::unique_ptr<FontDescriptorIndex> systemFontIndex_;
     std::mutex mutex_;
 };
 } // namespace OHOS::Rosen
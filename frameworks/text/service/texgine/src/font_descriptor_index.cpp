@@ -0,0 +1,621 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "font_descriptor_index.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <set>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+
+#include "utils/text_log.h"
+
+namespace OHOS::Rosen {
+namespace {
+using FontDescriptor = TextEngine::FontParser::FontDescriptor;
+constexpr size_t SECTION_ALIGN = 8;
+constexpr size_t MAX_INDEX_SIZE = 64 * 1024 * 1024; // 64MB
+constexpr uint32_t MAX_RECORD_ITEMS = 4096;
+
+size_t AlignUp(size_t size)
+{
+    return (size + SECTION_ALIGN - 1) & ~(SECTION_ALIGN - 1);
+}
+
+bool IsRangeValid(uint64_t offset, uint64_t length, uint64_t limit)
+{
+    return offset <= limit && length <= limit - offset;
+}
+
+int64_t GetMtimeNsec(const struct stat& st)
+{
+#ifdef __APPLE__
+    return st.st_mtimespec.tv_nsec;
+#else
+    return st.st_mtim.tv_nsec;
+#endif
+}
+
+// Full descriptor record: fixed-width scalars and length-prefixed strings and arrays, in field order.
+class RecordWriter {
+public:
+    explicit RecordWriter(std::string& out) : out_(out) {}
+
+    template<typename T>
+    void Put(const T& value)
+    {
+        out_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    void PutString(const std::string& value)
+    {
+        Put(static_cast<uint32_t>(value.size()));
+        out_.append(value);
+    }
+    void PutStrings(const std::vector<std::string>& values)
+    {
+        Put(static_cast<uint32_t>(values.size()));
+        for (const auto& value : values) {
+            PutString(value);
+        }
+    }
+
+private:
+    std::string& out_;
+};
+
+class RecordReader {
+public:
+    RecordReader(const char* data, size_t size) : data_(data), size_(size) {}
+
+    template<typename T>
+    bool Get(T& value)
+    {
+        if (sizeof(T) > size_ - pos_) {
+            return false;
+        }
+        std::memcpy(&value, data_ + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+    bool GetString(std::string& value)
+    {
+        uint32_t length = 0;
+        if (!Get(length) || length > size_ - pos_) {
+            return false;
+        }
+        value.assign(data_ + pos_, length);
+        pos_ += length;
+        return true;
+    }
+    bool GetCount(uint32_t& count)
+    {
+        return Get(count) && count <= MAX_RECORD_ITEMS;
+    }
+    bool GetStrings(std::vector<std::string>& values)
+    {
+        uint32_t count = 0;
+        if (!GetCount(count)) {
+            return false;
+        }
+        values.resize(count);
+        for (auto& value : values) {
+            if (!GetString(value)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    const char* data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+void WriteRecord(RecordWriter& writer, const FontDescriptor& desc)
+{
+    for (const auto* value : { &desc.path, &desc.postScriptName, &desc.fullName, &desc.fontFamily,
+        &desc.fontSubfamily, &desc.requestedFullname, &desc.localPostscriptName, &desc.localFullName,
+        &desc.localFamilyName, &desc.localSubFamilyName, &desc.version, &desc.manufacture, &desc.copyright,
+        &desc.trademark, &desc.license }) {
+        writer.PutString(*value);
+    }
+    for (auto value : { desc.postScriptNameLid, desc.fullNameLid, desc.fontFamilyLid, desc.fontSubfamilyLid,
+        desc.requestedLid }) {
+        writer.Put(static_cast<uint32_t>(value));
+    }
+    for (auto value : { desc.weight, desc.width, desc.italic, static_cast<int>(desc.monoSpace),
+        static_cast<int>(desc.symbolic), static_cast<int>(desc.index) }) {
+        writer.Put(static_cast<int32_t>(value));
+    }
+    writer.Put(static_cast<uint32_t>(desc.variationAxisRecords.size()));
+    for (const auto& axis : desc.variationAxisRecords) {
+        writer.PutString(axis.key);
+        writer.Put(axis.minValue);
+        writer.Put(axis.maxValue);
+        writer.Put(axis.defaultValue);
+        writer.Put(static_cast<int32_t>(axis.flags));
+        writer.PutString(axis.name);
+        writer.PutString(axis.localName);
+    }
+    writer.Put(static_cast<uint32_t>(desc.variationInstanceRecords.size()));
+    for (const auto& instance : desc.variationInstanceRecords) {
+        writer.PutString(instance.name);
+        writer.PutString(instance.localName);
+        writer.Put(static_cast<uint32_t>(instance.coordinates.size()));
+        for (const auto& coordinate : instance.coordinates) {
+            writer.PutString(coordinate.axis);
+            writer.Put(coordinate.value);
+        }
+    }
+    writer.PutStrings(desc.languages);
+    writer.PutStrings(desc.fontFeatures);
+}
+
+bool ReadVariations(RecordReader& reader, FontDescriptor& desc)
+{
+    uint32_t count = 0;
+    if (!reader.GetCount(count)) {
+        return false;
+    }
+    desc.variationAxisRecords.resize(count);
+    for (auto& axis : desc.variationAxisRecords) {
+        int32_t flags = 0;
+        if (!reader.GetString(axis.key) || !reader.Get(axis.minValue) || !reader.Get(axis.maxValue) ||
+            !reader.Get(axis.defaultValue) || !reader.Get(flags) || !reader.GetString(axis.name) ||
+            !reader.GetString(axis.localName)) {
+            return false;
+        }
+        axis.flags = flags;
+    }
+    if (!reader.GetCount(count)) {
+        return false;
+    }
+    desc.variationInstanceRecords.resize(count);
+    for (auto& instance : desc.variationInstanceRecords) {
+        uint32_t coordinateCount = 0;
+        if (!reader.GetString(instance.name) || !reader.GetString(instance.localName) ||
+            !reader.GetCount(coordinateCount)) {
+            return false;
+        }
+        instance.coordinates.resize(coordinateCount);
+        for (auto& coordinate : instance.coordinates) {
+            if (!reader.GetString(coordinate.axis) || !reader.Get(coordinate.value)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool ReadRecord(RecordReader& reader, FontDescriptor& desc)
+{
+    for (auto* value : { &desc.path, &desc.postScriptName, &desc.fullName, &desc.fontFamily,
+        &desc.fontSubfamily, &desc.requestedFullname, &desc.localPostscriptName, &desc.localFullName,
+        &desc.localFamilyName, &desc.localSubFamilyName, &desc.version, &desc.manufacture, &desc.copyright,
+        &desc.trademark, &desc.license }) {
+        if (!reader.GetString(*value)) {
+            return false;
+        }
+    }
+    for (auto* value : { &desc.postScriptNameLid, &desc.fullNameLid, &desc.fontFamilyLid, &desc.fontSubfamilyLid,
+        &desc.requestedLid }) {
+        uint32_t lid = 0;
+        if (!reader.Get(lid)) {
+            return false;
+        }
+        *value = lid;
+    }
+    int32_t values[6] = { 0 }; // weight, width, italic, monoSpace, symbolic, index
+    for (auto& value : values) {
+        if (!reader.Get(value)) {
+            return false;
+        }
+    }
+    size_t i = 0;
+    desc.weight = values[i++];
+    desc.width = values[i++];
+    desc.italic = values[i++];
+    desc.monoSpace = values[i++] != 0;
+    desc.symbolic = values[i++] != 0;
+    desc.index = values[i++];
+    return ReadVariations(reader, desc) && reader.GetStrings(desc.languages) && reader.GetStrings(desc.fontFeatures);
+}
+
+bool WriteFile(const std::string& path, const std::string& data)
+{
+    std::string tmpPath = path + ".tmp";
+    int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd < 0) {
+        TEXT_LOGD("Failed to create font descriptor index %{public}s", tmpPath.c_str());
+        return false;
+    }
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t ret = write(fd, data.data() + written, data.size() - written);
+        if (ret <= 0) {
+            break;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    bool ok = written == data.size() && fsync(fd) == 0;
+    close(fd);
+    if (!ok || rename(tmpPath.c_str(), path.c_str()) != 0) {
+        TEXT_LOGE("Failed to write font descriptor index %{public}s", path.c_str());
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+} // namespace
+
+FontDescriptorIndex::FontDescriptorIndex(void* base, size_t size) : base_(base), size_(size) {}
+
+FontDescriptorIndex::~FontDescriptorIndex()
+{
+    if (base_ != nullptr) {
+        munmap(base_, size_);
+    }
+}
+
+bool FontDescriptorIndex::Build(
+    const std::string& indexPath, const std::vector<std::shared_ptr<FontDescriptor>>& descriptors)
+{
+    auto slash = indexPath.find_last_of('/');
+    std::string indexDir = (slash == std::string::npos) ? "." : indexPath.substr(0, slash + 1);
+    if (access(indexDir.c_str(), W_OK) != 0) {
+        return false;
+    }
+    std::string strings;
+    std::unordered_map<std::string, StringRef> stringRefs;
+    auto addString = [&strings, &stringRefs](const std::string& value) {
+        auto iter = stringRefs.find(value);
+        if (iter != stringRefs.end()) {
+            return iter->second;
+        }
+        StringRef ref { static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(value.size()) };
+        strings.append(value);
+        stringRefs.emplace(value, ref);
+        return ref;
+    };
+
+    std::vector<std::shared_ptr<FontDescriptor>> valid;
+    std::set<std::string> sourcePaths;
+    for (const auto& desc : descriptors) {
+        if (desc == nullptr || desc->path.empty()) {
+            continue;
+        }
+        valid.push_back(desc);
+        sourcePaths.insert(desc->path);
+        auto slash = desc->path.find_last_of('/');
+        if (slash != std::string::npos) {
+            // a font added to or removed from a font directory changes the directory mtime
+            sourcePaths.insert(slash == 0 ? "/" : desc->path.substr(0, slash));
+        }
+    }
+    if (valid.empty()) {
+        return false;
+    }
+
+    std::vector<Source> sources;
+    for (const auto& path : sourcePaths) {
+        struct stat st {};
+        if (stat(path.c_str(), &st) != 0) {
+            TEXT_LOGD("Failed to stat font source %{public}s", path.c_str());
+            return false;
+        }
+        Source source {};
+        source.path = addString(path);
+        source.size = static_cast<uint64_t>(st.st_size);
+        source.mtimeSec = static_cast<int64_t>(st.st_mtime);
+        source.mtimeNsec = GetMtimeNsec(st);
+        sources.push_back(source);
+    }
+
+    std::string records;
+    RecordWriter writer(records);
+    std::vector<Entry> entries;
+    for (const auto& desc : valid) {
+        Entry entry {};
+        entry.keys[FONT_FAMILY] = addString(desc->fontFamily);
+        entry.keys[FULL_NAME] = addString(desc->fullName);
+        entry.keys[POSTSCRIPT_NAME] = addString(desc->postScriptName);
+        entry.keys[FONT_SUBFAMILY] = addString(desc->fontSubfamily);
+        entry.weight = desc->weight;
+        entry.width = desc->width;
+        entry.italic = desc->italic;
+        entry.flags = (desc->monoSpace ? FLAG_MONO_SPACE : 0) | (desc->symbolic ? FLAG_SYMBOLIC : 0);
+        entry.recordOffset = static_cast<uint32_t>(records.size());
+        WriteRecord(writer, *desc);
+        entry.recordSize = static_cast<uint32_t>(records.size()) - entry.recordOffset;
+        entries.push_back(entry);
+    }
+
+    Header header {};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.headerSize = sizeof(Header);
+    header.entryCount = static_cast<uint32_t>(entries.size());
+    header.sourceCount = static_cast<uint32_t>(sources.size());
+    size_t offset = AlignUp(sizeof(Header));
+    header.entriesOffset = static_cast<uint32_t>(offset);
+    offset = AlignUp(offset + entries.size() * sizeof(Entry));
+    header.sourcesOffset = static_cast<uint32_t>(offset);
+    offset = AlignUp(offset + sources.size() * sizeof(Source));
+    for (uint32_t type = 0; type < KEY_COUNT; ++type) {
+        header.keyIndexOffset[type] = static_cast<uint32_t>(offset);
+        offset = AlignUp(offset + entries.size() * sizeof(uint32_t));
+    }
+    header.recordsOffset = static_cast<uint32_t>(offset);
+    header.recordsSize = static_cast<uint32_t>(records.size());
+    offset = AlignUp(offset + records.size());
+    header.stringsOffset = static_cast<uint32_t>(offset);
+    header.stringsSize = static_cast<uint32_t>(strings.size());
+    offset = AlignUp(offset + strings.size());
+    if (offset > MAX_INDEX_SIZE) {
+        TEXT_LOGE("Font descriptor index too large: %{public}zu", offset);
+        return false;
+    }
+    header.fileSize = static_cast<uint32_t>(offset);
+
+    std::string data(offset, '\0');
+    auto put = [&data](size_t at, const void* src, size_t length) {
+        if (length > 0) {
+            std::memcpy(&data[at], src, length);
+        }
+    };
+    put(0, &header, sizeof(Header));
+    put(header.entriesOffset, entries.data(), entries.size() * sizeof(Entry));
+    put(header.sourcesOffset, sources.data(), sources.size() * sizeof(Source));
+    for (uint32_t type = 0; type < KEY_COUNT; ++type) {
+        std::vector<uint32_t> order(entries.size());
+        for (uint32_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs) {
+            const StringRef& l = entries[lhs].keys[type];
+            const StringRef& r = entries[rhs].keys[type];
+            return strings.compare(l.offset, l.length, strings, r.offset, r.length) < 0;
+        });
+        put(header.keyIndexOffset[type], order.data(), order.size() * sizeof(uint32_t));
+    }
+    put(header.recordsOffset, records.data(), records.size());
+    put(header.stringsOffset, strings.data(), strings.size());
+    return WriteFile(indexPath, data);
+}
+
+std::unique_ptr<FontDescriptorIndex> FontDescriptorIndex::Load(const std::string& indexPath)
+{
+    int fd = open(indexPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Header)) ||
+        static_cast<size_t>(st.st_size) > MAX_INDEX_SIZE) {
+        close(fd);
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    void* base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        TEXT_LOGE("Failed to map font descriptor index %{public}s", indexPath.c_str());
+        return nullptr;
+    }
+    std::unique_ptr<FontDescriptorIndex> index(new FontDescriptorIndex(base, size));
+    if (!index->Validate()) {
+        TEXT_LOGI("Font descriptor index %{public}s is invalid or out of date", indexPath.c_str());
+        return nullptr;
+    }
+    index->descriptors_.resize(index->GetEntryCount());
+    return index;
+}
+
+bool FontDescriptorIndex::Validate() const
+{
+    const Header& header = GetHeader();
+    if (header.magic != MAGIC || header.version != VERSION || header.headerSize != sizeof(Header) ||
+        header.fileSize != size_ || header.entryCount == 0) {
+        return false;
+    }
+    uint64_t entryCount = header.entryCount;
+    if (header.entriesOffset % alignof(Entry) != 0 || header.sourcesOffset % alignof(Source) != 0 ||
+        !IsRangeValid(header.entriesOffset, entryCount * sizeof(Entry), size_) ||
+        !IsRangeValid(header.sourcesOffset, static_cast<uint64_t>(header.sourceCount) * sizeof(Source), size_) ||
+        !IsRangeValid(header.recordsOffset, header.recordsSize, size_) ||
+        !IsRangeValid(header.stringsOffset, header.stringsSize, size_)) {
+        return false;
+    }
+    for (uint32_t type = 0; type < KEY_COUNT; ++type) {
+        if (header.keyIndexOffset[type] % alignof(uint32_t) != 0 ||
+            !IsRangeValid(header.keyIndexOffset[type], entryCount * sizeof(uint32_t), size_)) {
+            return false;
+        }
+        const uint32_t* order = GetKeyIndex(static_cast<KeyType>(type));
+        for (uint32_t i = 0; i < header.entryCount; ++i) {
+            if (order[i] >= header.entryCount) {
+                return false;
+            }
+        }
+    }
+    const Entry* entries = GetEntries();
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+        for (const auto& key : entries[i].keys) {
+            if (!IsStringValid(key)) {
+                return false;
+            }
+        }
+        if (!IsRangeValid(entries[i].recordOffset, entries[i].recordSize, header.recordsSize)) {
+            return false;
+        }
+    }
+    const Source* sources = GetSources();
+    for (uint32_t i = 0; i < header.sourceCount; ++i) {
+        if (!IsStringValid(sources[i].path) || !IsSourceUnchanged(sources[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FontDescriptorIndex::IsSourceUnchanged(const Source& source) const
+{
+    std::string path(GetStrings() + source.path.offset, source.path.length);
+    struct stat st {};
+    if (stat(path.c_str(), &st) != 0) {
+        return false;
+    }
+    return static_cast<uint64_t>(st.st_size) == source.size && static_cast<int64_t>(st.st_mtime) == source.mtimeSec &&
+        GetMtimeNsec(st) == source.mtimeNsec;
+}
+
+bool FontDescriptorIndex::IsStringValid(const StringRef& ref) const
+{
+    return IsRangeValid(ref.offset, ref.length, GetHeader().stringsSize);
+}
+
+const FontDescriptorIndex::Entry* FontDescriptorIndex::GetEntries() const
+{
+    return reinterpret_cast<const Entry*>(static_cast<const char*>(base_) + GetHeader().entriesOffset);
+}
+
+const FontDescriptorIndex::Source* FontDescriptorIndex::GetSources() const
+{
+    return reinterpret_cast<const Source*>(static_cast<const char*>(base_) + GetHeader().sourcesOffset);
+}
+
+const uint32_t* FontDescriptorIndex::GetKeyIndex(KeyType type) const
+{
+    return reinterpret_cast<const uint32_t*>(static_cast<const char*>(base_) + GetHeader().keyIndexOffset[type]);
+}
+
+const char* FontDescriptorIndex::GetStrings() const
+{
+    return static_cast<const char*>(base_) + GetHeader().stringsOffset;
+}
+
+uint32_t FontDescriptorIndex::GetEntryCount() const
+{
+    return GetHeader().entryCount;
+}
+
+std::string FontDescriptorIndex::GetKey(uint32_t entry, KeyType type) const
+{
+    if (entry >= GetEntryCount() || type >= KEY_COUNT) {
+        return "";
+    }
+    const StringRef& ref = GetEntries()[entry].keys[type];
+    return std::string(GetStrings() + ref.offset, ref.length);
+}
+
+int FontDescriptorIndex::CompareKey(uint32_t entry, KeyType type, const std::string& name) const
+{
+    const StringRef& ref = GetEntries()[entry].keys[type];
+    int ret = std::memcmp(GetStrings() + ref.offset, name.data(), std::min<size_t>(ref.length, name.size()));
+    if (ret != 0) {
+        return ret;
+    }
+    if (ref.length == name.size()) {
+        return 0;
+    }
+    return ref.length < name.size() ? -1 : 1;
+}
+
+std::vector<uint32_t> FontDescriptorIndex::FindByKey(KeyType type, const std::string& name) const
+{
+    std::vector<uint32_t> result;
+    if (type >= KEY_COUNT) {
+        return result;
+    }
+    const uint32_t* begin = GetKeyIndex(type);
+    const uint32_t* end = begin + GetEntryCount();
+    auto lower = std::lower_bound(begin, end, name,
+        [this, type](uint32_t entry, const std::string& key) { return CompareKey(entry, type, key) < 0; });
+    for (auto iter = lower; iter != end && CompareKey(*iter, type, name) == 0; ++iter) {
+        result.push_back(*iter);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+bool FontDescriptorIndex::MatchStyle(const Entry& entry, const StyleFilter& style) const
+{
+    return (style.weight == 0 || entry.weight == style.weight) && (style.width == 0 || entry.width == style.width) &&
+        (style.italic == 0 || entry.italic != 0) && (!style.monoSpace || (entry.flags & FLAG_MONO_SPACE) != 0) &&
+        (!style.symbolic || (entry.flags & FLAG_SYMBOLIC) != 0);
+}
+
+std::vector<uint32_t> FontDescriptorIndex::Match(const std::string names[KEY_COUNT], const StyleFilter& style) const
+{
+    std::vector<uint32_t> result;
+    if (style.weight < 0 || style.width < 0) {
+        return result;
+    }
+    // narrow down with the first given name, then check the other names and the style per entry
+    int firstKey = -1;
+    for (uint32_t type = 0; type < KEY_COUNT; ++type) {
+        if (!names[type].empty()) {
+            firstKey = static_cast<int>(type);
+            break;
+        }
+    }
+    std::vector<uint32_t> candidates;
+    if (firstKey >= 0) {
+        candidates = FindByKey(static_cast<KeyType>(firstKey), names[firstKey]);
+    } else {
+        candidates.resize(GetEntryCount());
+        for (uint32_t i = 0; i < candidates.size(); ++i) {
+            candidates[i] = i;
+        }
+    }
+    const Entry* entries = GetEntries();
+    for (uint32_t candidate : candidates) {
+        bool matched = MatchStyle(entries[candidate], style);
+        for (uint32_t type = static_cast<uint32_t>(firstKey + 1); matched && type < KEY_COUNT; ++type) {
+            matched = names[type].empty() || CompareKey(candidate, static_cast<KeyType>(type), names[type]) == 0;
+        }
+        if (matched) {
+            result.push_back(candidate);
+        }
+    }
+    return result;
+}
+
+std::shared_ptr<FontDescriptor> FontDescriptorIndex::GetDescriptor(uint32_t entry)
+{
+    if (entry >= descriptors_.size()) {
+        return nullptr;
+    }
+    if (descriptors_[entry] != nullptr) {
+        return descriptors_[entry];
+    }
+    const Entry& indexEntry = GetEntries()[entry];
+    const char* records = static_cast<const char*>(base_) + GetHeader().recordsOffset;
+    RecordReader reader(records + indexEntry.recordOffset, indexEntry.recordSize);
+    auto desc = std::make_shared<FontDescriptor>();
+    if (!ReadRecord(reader, *desc)) {
+        TEXT_LOGE("Failed to decode font descriptor %{public}u from index", entry);
+        return nullptr;
+    }
+    descriptors_[entry] = desc;
+    return desc;
+}
+} // namespace OHOS::Rosen
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ROSEN_FONT_DESCRIPTOR_INDEX_H
+#define OHOS_ROSEN_FONT_DESCRIPTOR_INDEX_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "font_parser.h"
+
+namespace OHOS::Rosen {
+/*
+ * On-disk index of the system font descriptors.
+ * The index is built once from parsed descriptors and is then mapped read-only by every process, so that
+ * system fonts can be queried by name and style without parsing any font file. Every font file and font
+ * directory the index was built from is recorded with its size and mtime; a change to any of them makes
+ * Load fail and the caller falls back to FontParser.
+ */
+class FontDescriptorIndex {
+public:
+    static constexpr uint32_t MAGIC = 0x58494446; // "FDIX"
+    static constexpr uint32_t VERSION = 1;
+
+    enum KeyType : uint32_t {
+        FONT_FAMILY = 0,
+        FULL_NAME,
+        POSTSCRIPT_NAME,
+        FONT_SUBFAMILY,
+        KEY_COUNT
+    };
+
+    struct StyleFilter {
+        int weight = 0;
+        int width = 0;
+        int italic = 0;
+        bool monoSpace = false;
+        bool symbolic = false;
+    };
+
+    ~FontDescriptorIndex();
+    FontDescriptorIndex(const FontDescriptorIndex&) = delete;
+    FontDescriptorIndex& operator=(const FontDescriptorIndex&) = delete;
+
+    // write descriptors (weights already aligned) to indexPath, atomically replacing any previous index
+    static bool Build(const std::string& indexPath,
+        const std::vector<std::shared_ptr<TextEngine::FontParser::FontDescriptor>>& descriptors);
+    // map and validate the index, nullptr if it is missing, malformed or out of date
+    static std::unique_ptr<FontDescriptorIndex> Load(const std::string& indexPath);
+
+    uint32_t GetEntryCount() const;
+    std::string GetKey(uint32_t entry, KeyType type) const;
+    // entries whose key equals name, in index order
+    std::vector<uint32_t> FindByKey(KeyType type, const std::string& name) const;
+    // same matching rules as FontDescriptorCache::MatchFromFontDescriptor: empty names and zero style
+    // values do not filter, any name that is not found or a negative weight/width matches nothing
+    std::vector<uint32_t> Match(const std::string names[KEY_COUNT], const StyleFilter& style) const;
+    // decode the full descriptor of an entry, the result is cached and shared between calls
+    std::shared_ptr<TextEngine::FontParser::FontDescriptor> GetDescriptor(uint32_t entry);
+
+private:
+    struct StringRef {
+        uint32_t offset;
+        uint32_t length;
+    };
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t headerSize;
+        uint32_t entryCount;
+        uint32_t sourceCount;
+        uint32_t entriesOffset;
+        uint32_t sourcesOffset;
+        uint32_t keyIndexOffset[KEY_COUNT];
+        uint32_t stringsOffset;
+        uint32_t stringsSize;
+        uint32_t recordsOffset;
+        uint32_t recordsSize;
+        uint32_t fileSize;
+    };
+    struct Entry {
+        StringRef keys[KEY_COUNT];
+        int32_t weight;
+        int32_t width;
+        int32_t italic;
+        uint32_t flags;
+        uint32_t recordOffset;
+        uint32_t recordSize;
+    };
+    struct Source {
+        StringRef path;
+        uint32_t reserved;
+        uint64_t size;
+        int64_t mtimeSec;
+        int64_t mtimeNsec;
+    };
+    static constexpr uint32_t FLAG_MONO_SPACE = 1 << 0;
+    static constexpr uint32_t FLAG_SYMBOLIC = 1 << 1;
+
+    FontDescriptorIndex(void* base, size_t size);
+    bool Validate() const;
+    bool IsSourceUnchanged(const Source& source) const;
+    bool IsStringValid(const StringRef& ref) const;
+    int CompareKey(uint32_t entry, KeyType type, const std::string& name) const;
+    bool MatchStyle(const Entry& entry, const StyleFilter& style) const;
+
+    const Header& GetHeader() const
+    {
+        return *static_cast<const Header*>(base_);
+    }
+    const Entry* GetEntries() const;
+    const Source* GetSources() const;
+    const uint32_t* GetKeyIndex(KeyType type) const;
+    const char* GetStrings() const;
+
+    void* base_ = nullptr;
+    size_t size_ = 0;
+    std::vector<std::shared_ptr<TextEngine::FontParser::FontDescriptor>> descriptors_;
+};
+} // namespace OHOS::Rosen
+
+#endif // OHOS_ROSEN_FONT_DESCRIPTOR_INDEX_H
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+#include "font_descriptor_index.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace fs = std::filesystem;
+using FontDescriptor = TextEngine::FontParser::FontDescriptor;
+
+namespace {
+const std::string INDEX_TEST_DIR = "/data/local/tmp/font_descriptor_index_test";
+const std::string INDEX_FILE = INDEX_TEST_DIR + "/font_descriptor.idx";
+const std::string FONT_FILE_A = INDEX_TEST_DIR + "/fonts/a.ttf";
+const std::string FONT_FILE_B = INDEX_TEST_DIR + "/fonts/b.ttc";
+constexpr int FONT_COUNT = 6;
+constexpr int WEIGHT_400 = 400;
+constexpr int WEIGHT_700 = 700;
+constexpr double AXIS_MAX = 900.0;
+constexpr double COORDINATE_VALUE = 350.5;
+} // namespace
+
+class FontDescriptorIndexTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        fs::create_directories(INDEX_TEST_DIR + "/fonts");
+        std::ofstream(FONT_FILE_A) << "font a";
+        std::ofstream(FONT_FILE_B) << "font b";
+        for (int i = 0; i < FONT_COUNT; i++) {
+            auto desc = std::make_shared<FontDescriptor>();
+            desc->path = (i % 2 == 0) ? FONT_FILE_A : FONT_FILE_B;
+            desc->fontFamily = (i < FONT_COUNT / 2) ? "Family A" : "Family B";
+            desc->fullName = "Full " + std::to_string(i);
+            desc->postScriptName = "PostScript" + std::to_string(i);
+            desc->fontSubfamily = (i % 3 == 0) ? "Bold" : "Regular";
+            desc->weight = (i % 3 == 0) ? WEIGHT_700 : WEIGHT_400;
+            desc->italic = (i == 4) ? 1 : 0;
+            desc->monoSpace = (i == 5);
+            desc->index = i;
+            desc->languages = { "en", "zh" };
+            TextEngine::FontParser::FontVariationAxis axis;
+            axis.key = "wght";
+            axis.maxValue = AXIS_MAX;
+            desc->variationAxisRecords.push_back(axis);
+            TextEngine::FontParser::FontVariationInstance instance;
+            instance.name = "Instance";
+            instance.coordinates.push_back({ "wght", COORDINATE_VALUE });
+            desc->variationInstanceRecords.push_back(instance);
+            descriptors_.push_back(desc);
+        }
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(INDEX_TEST_DIR);
+    }
+
+    std::vector<std::shared_ptr<FontDescriptor>> descriptors_;
+};
+
+/**
+ * @tc.name: BuildAndLoadTest
+ * @tc.desc: test that an index round-trips every descriptor field and can be queried by name
+ * @tc.type: FUNC
+ */
+HWTEST_F(FontDescriptorIndexTest, BuildAndLoadTest, TestSize.Level0)
+{
+    ASSERT_TRUE(FontDescriptorIndex::Build(INDEX_FILE, descriptors_));
+    auto index = FontDescriptorIndex::Load(INDEX_FILE);
+    ASSERT_NE(index, nullptr);
+    EXPECT_EQ(index->GetEntryCount(), static_cast<uint32_t>(FONT_COUNT));
+
+    EXPECT_EQ(index->FindByKey(FontDescriptorIndex::FONT_FAMILY, "Family A").size(), 3);
+    EXPECT_TRUE(index->FindByKey(FontDescriptorIndex::FONT_FAMILY, "Family").empty());
+    auto entries = index->FindByKey(FontDescriptorIndex::FULL_NAME, "Full 4");
+    ASSERT_EQ(entries.size(), 1);
+    auto desc = index->GetDescriptor(entries[0]);
+    ASSERT_NE(desc, nullptr);
+    EXPECT_EQ(desc->path, descriptors_[4]->path);
+    EXPECT_EQ(desc->postScriptName, "PostScript4");
+    EXPECT_EQ(desc->italic, 1);
+    EXPECT_EQ(desc->index, 4);
+    EXPECT_EQ(desc->languages, descriptors_[4]->languages);
+    ASSERT_EQ(desc->variationAxisRecords.size(), 1);
+    EXPECT_EQ(desc->variationAxisRecords[0].maxValue, AXIS_MAX);
+    ASSERT_EQ(desc->variationInstanceRecords.size(), 1);
+    EXPECT_EQ(desc->variationInstanceRecords[0].coordinates[0].value, COORDINATE_VALUE);
+    // decoded descriptors are shared between queries
+    EXPECT_EQ(index->GetDescriptor(entries[0]), desc);
+    EXPECT_EQ(index->GetDescriptor(FONT_COUNT), nullptr);
+}
+
+/**
+ * @tc.name: MatchTest
+ * @tc.desc: test that Match combines names and style like FontDescriptorCache::MatchFromFontDescriptor
+ * @tc.type: FUNC
+ */
+HWTEST_F(FontDescriptorIndexTest, MatchTest, TestSize.Level0)
+{
+    ASSERT_TRUE(FontDescriptorIndex::Build(INDEX_FILE, descriptors_));
+    auto index = FontDescriptorIndex::Load(INDEX_FILE);
+    ASSERT_NE(index, nullptr);
+
+    std::string names[FontDescriptorIndex::KEY_COUNT];
+    FontDescriptorIndex::StyleFilter style;
+    EXPECT_EQ(index->Match(names, style).size(), static_cast<size_t>(FONT_COUNT));
+
+    names[FontDescriptorIndex::FONT_FAMILY] = "Family B";
+    style.weight = WEIGHT_400;
+    EXPECT_EQ(index->Match(names, style).size(), 2);
+    style.italic = 1;
+    EXPECT_EQ(index->Match(names, style).size(), 1);
+    names[FontDescriptorIndex::FONT_SUBFAMILY] = "Bold";
+    EXPECT_TRUE(index->Match(names, style).empty());
+
+    std::string noNames[FontDescriptorIndex::KEY_COUNT];
+    FontDescriptorIndex::StyleFilter mono;
+    mono.monoSpace = true;
+    EXPECT_EQ(index->Match(noNames, mono).size(), 1);
+    mono.weight = -1;
+    EXPECT_TRUE(index->Match(noNames, mono).empty());
+}
+
+/**
+ * @tc.name: InvalidIndexTest
+ * @tc.desc: test that a changed font file or a corrupted index is rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(FontDescriptorIndexTest, InvalidIndexTest, TestSize.Level0)
+{
+    EXPECT_EQ(FontDescriptorIndex::Load(INDEX_FILE), nullptr);
+    EXPECT_FALSE(FontDescriptorIndex::Build(INDEX_FILE, {}));
+
+    ASSERT_TRUE(FontDescriptorIndex::Build(INDEX_FILE, descriptors_));
+    std::ofstream(FONT_FILE_B, std::ios::app) << "changed";
+    EXPECT_EQ(FontDescriptorIndex::Load(INDEX_FILE), nullptr);
+
+    ASSERT_TRUE(FontDescriptorIndex::Build(INDEX_FILE, descriptors_));
+    {
+        std::fstream file(INDEX_FILE, std::ios::in | std::ios::out | std::ios::binary);
+        uint32_t badVersion = FontDescriptorIndex::VERSION + 1;
+        file.seekp(sizeof(uint32_t));
+        file.write(reinterpret_cast<const char*>(&badVersion), sizeof(badVersion));
+    }
+    EXPECT_EQ(FontDescriptorIndex::Load(INDEX_FILE), nullptr);
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -598,6 +598,86 @@ OH_Drawing_ErrorCode OH_Drawing_CanvasDrawGlyphs(const OH_Drawing_Canvas* canvas
     int glyphIdCount, int glyphIdOffset, const OH_Drawing_Point2D* positions, int positionCount,
     int positionOffset, int glyphCount, const OH_Drawing_Font* font);
 
+/**
+ * @brief Draws all the rects of an array with the brush or pen attached to the canvas.
+ * The result is the same as calling {@link OH_Drawing_CanvasDrawRect} for each rect in order,
+ * but a recording canvas records the rects as a single drawing command.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @param canvas Indicates the pointer to an <b>OH_Drawing_Canvas</b> object.
+ * @param rects Indicates the array of rects created by {@link OH_Drawing_RectCreateArray}.
+ * @return Returns the error code.
+ * Returns {@link OH_DRAWING_SUCCESS} if the operation is successful.
+ * Returns {@link OH_DRAWING_ERROR_INCORRECT_PARAMETER} if canvas or rects is nullptr,
+ * or rects is not an array of rects.
+ * @since 26.0.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_CanvasDrawRects(OH_Drawing_Canvas* canvas, const OH_Drawing_Array* rects);
+
+/**
+ * @brief Draws the rects of an array, each with one of the given brushes. The brush and pen attached to the
+ * canvas are not used and are kept attached. Consecutive rects with the same brush index are drawn together,
+ * a recording canvas records each such run as a single drawing command.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @param canvas Indicates the pointer to an <b>OH_Drawing_Canvas</b> object.
+ * @param rects Indicates the array of rects created by {@link OH_Drawing_RectCreateArray}.
+ * @param brushes Indicates the array of brushes.
+ * @param brushCount Indicates the size of brushes array.
+ * @param brushIndices Indicates the index in brushes of the brush of each rect, the size is the size of rects.
+ * @return Returns the error code.
+ * Returns {@link OH_DRAWING_SUCCESS} if the operation is successful.
+ * Returns {@link OH_DRAWING_ERROR_INCORRECT_PARAMETER} if any of canvas, rects, brushes, brushIndices and the used
+ * brushes is nullptr, or rects is not an array of rects.
+ * Returns {@link OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE} if brushCount is 0 or any brush index is not less than
+ * brushCount.
+ * @since 26.0.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_CanvasDrawRectsWithBrushes(OH_Drawing_Canvas* canvas, const OH_Drawing_Array* rects,
+    const OH_Drawing_Brush* const brushes[], uint32_t brushCount, const uint32_t* brushIndices);
+
+/**
+ * @brief Draws roundRectCount roundrects with the brush or pen attached to the canvas.
+ * The result is the same as calling {@link OH_Drawing_CanvasDrawRoundRect} for each roundrect in order,
+ * but a recording canvas records the roundrects as a single drawing command.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @param canvas Indicates the pointer to an <b>OH_Drawing_Canvas</b> object.
+ * @param roundRects Indicates the array of pointers to <b>OH_Drawing_RoundRect</b> objects.
+ * @param roundRectCount Indicates the size of roundRects array.
+ * @return Returns the error code.
+ * Returns {@link OH_DRAWING_SUCCESS} if the operation is successful.
+ * Returns {@link OH_DRAWING_ERROR_INCORRECT_PARAMETER} if canvas, roundRects or any of the roundrects is nullptr.
+ * Returns {@link OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE} if roundRectCount is 0.
+ * @since 26.0.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_CanvasDrawRoundRects(OH_Drawing_Canvas* canvas,
+    const OH_Drawing_RoundRect* const roundRects[], uint32_t roundRectCount);
+
+/**
+ * @brief Draws roundRectCount roundrects, each with one of the given brushes. The brush and pen attached to the
+ * canvas are not used and are kept attached. Consecutive roundrects with the same brush index are drawn together,
+ * a recording canvas records each such run as a single drawing command.
+ *
+ * @syscap SystemCapability.Graphic.Graphic2D.NativeDrawing
+ * @param canvas Indicates the pointer to an <b>OH_Drawing_Canvas</b> object.
+ * @param roundRects Indicates the array of pointers to <b>OH_Drawing_RoundRect</b> objects.
+ * @param roundRectCount Indicates the size of roundRects array.
+ * @param brushes Indicates the array of brushes.
+ * @param brushCount Indicates the size of brushes array.
+ * @param brushIndices Indicates the index in brushes of the brush of each roundrect, the size is roundRectCount.
+ * @return Returns the error code.
+ * Returns {@link OH_DRAWING_SUCCESS} if the operation is successful.
+ * Returns {@link OH_DRAWING_ERROR_INCORRECT_PARAMETER} if any of canvas, roundRects, brushes, brushIndices,
+ * the roundrects and the used brushes is nullptr.
+ * Returns {@link OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE} if roundRectCount or brushCount is 0, or any brush index
+ * is not less than brushCount.
+ * @since 26.0.0
+ */
+OH_Drawing_ErrorCode OH_Drawing_CanvasDrawRoundRectsWithBrushes(OH_Drawing_Canvas* canvas,
+    const OH_Drawing_RoundRect* const roundRects[], uint32_t roundRectCount,
+    const OH_Drawing_Brush* const brushes[], uint32_t brushCount, const uint32_t* brushIndices);
+
 /**
  * @brief Enumerates clip op.
  *
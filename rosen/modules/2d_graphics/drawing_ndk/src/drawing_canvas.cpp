@@ -23,6 +23,7 @@
 #include "src/utils/SkUTF.h"
 #endif
 
+#include "array_mgr.h"
 #include "drawing_canvas_utils.h"
 #include "drawing_font_utils.h"
 #include "drawing_helper.h"
@@ -134,6 +135,15 @@ static const Font* CastToFont(const OH_Drawing_Font* cFont)
     return reinterpret_cast<const Font*>(cFont);
 }
 
+static const ObjectArray* CastToRectArray(const OH_Drawing_Array* cRects)
+{
+    const ObjectArray* rects = reinterpret_cast<const ObjectArray*>(cRects);
+    if (rects == nullptr || rects->type != ObjectType::DRAWING_RECT || rects->addr == nullptr) {
+        return nullptr;
+    }
+    return rects;
+}
+
 static Drawing::DrawingFontFeatures* CastToFontFeatures(OH_Drawing_FontFeatures* fontFeatures)
 {
     return reinterpret_cast<Drawing::DrawingFontFeatures*>(fontFeatures);
@@ -900,6 +910,144 @@ OH_Drawing_ErrorCode OH_Drawing_CanvasDrawGlyphs(const OH_Drawing_Canvas* cCanva
     return OH_DRAWING_SUCCESS;
 }
 
+static void MarkCanvasDirty(Canvas* canvas)
+{
+#ifdef OHOS_PLATFORM
+    auto iter = g_canvasMap.find(canvas);
+    if (iter != g_canvasMap.end() && iter->second != nullptr) {
+        iter->second->MarkDirty();
+    }
+#endif
+}
+
+static bool CheckBrushIndices(const OH_Drawing_Brush* const brushes[], uint32_t brushCount,
+    const uint32_t* brushIndices, size_t count, OH_Drawing_ErrorCode& errorCode)
+{
+    if (brushCount == 0) {
+        errorCode = OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE;
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (brushIndices[i] >= brushCount) {
+            errorCode = OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE;
+            return false;
+        }
+        if (brushes[brushIndices[i]] == nullptr) {
+            errorCode = OH_DRAWING_ERROR_INCORRECT_PARAMETER;
+            return false;
+        }
+    }
+    return true;
+}
+
+// draws each run of items sharing a brush index with one batch call, then restores the attached brush and pen
+template<typename T>
+static void DrawBatchWithBrushes(Canvas* canvas, const T items[], size_t count,
+    const OH_Drawing_Brush* const brushes[], const uint32_t* brushIndices, void (Canvas::*drawBatch)(const T[], size_t))
+{
+    Paint attachedBrush = canvas->GetMutableBrush();
+    Paint attachedPen = canvas->GetMutablePen();
+    canvas->DetachPen();
+    size_t runStart = 0;
+    for (size_t i = 1; i <= count; i++) {
+        if (i < count && brushIndices[i] == brushIndices[runStart]) {
+            continue;
+        }
+        canvas->AttachBrush(CastToBrush(*brushes[brushIndices[runStart]]));
+        (canvas->*drawBatch)(items + runStart, i - runStart);
+        runStart = i;
+    }
+    canvas->GetMutableBrush() = attachedBrush;
+    canvas->GetMutablePen() = attachedPen;
+}
+
+static bool CopyRoundRects(const OH_Drawing_RoundRect* const cRoundRects[], uint32_t count,
+    std::vector<RoundRect>& roundRects)
+{
+    roundRects.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        if (cRoundRects[i] == nullptr) {
+            return false;
+        }
+        roundRects.push_back(*CastToRoundRect(cRoundRects[i]));
+    }
+    return true;
+}
+
+OH_Drawing_ErrorCode OH_Drawing_CanvasDrawRects(OH_Drawing_Canvas* cCanvas, const OH_Drawing_Array* cRects)
+{
+    Canvas* canvas = CastToCanvas(cCanvas);
+    const ObjectArray* rects = CastToRectArray(cRects);
+    if (canvas == nullptr || rects == nullptr) {
+        return OH_DRAWING_ERROR_INCORRECT_PARAMETER;
+    }
+    canvas->DrawRects(reinterpret_cast<const Drawing::Rect*>(rects->addr), rects->num);
+    MarkCanvasDirty(canvas);
+    return OH_DRAWING_SUCCESS;
+}
+
+OH_Drawing_ErrorCode OH_Drawing_CanvasDrawRectsWithBrushes(OH_Drawing_Canvas* cCanvas, const OH_Drawing_Array* cRects,
+    const OH_Drawing_Brush* const brushes[], uint32_t brushCount, const uint32_t* brushIndices)
+{
+    Canvas* canvas = CastToCanvas(cCanvas);
+    const ObjectArray* rects = CastToRectArray(cRects);
+    if (canvas == nullptr || rects == nullptr || brushes == nullptr || brushIndices == nullptr) {
+        return OH_DRAWING_ERROR_INCORRECT_PARAMETER;
+    }
+    OH_Drawing_ErrorCode errorCode = OH_DRAWING_SUCCESS;
+    if (!CheckBrushIndices(brushes, brushCount, brushIndices, rects->num, errorCode)) {
+        return errorCode;
+    }
+    DrawBatchWithBrushes<Drawing::Rect>(canvas, reinterpret_cast<const Drawing::Rect*>(rects->addr), rects->num,
+        brushes, brushIndices, &Canvas::DrawRects);
+    MarkCanvasDirty(canvas);
+    return OH_DRAWING_SUCCESS;
+}
+
+OH_Drawing_ErrorCode OH_Drawing_CanvasDrawRoundRects(OH_Drawing_Canvas* cCanvas,
+    const OH_Drawing_RoundRect* const cRoundRects[], uint32_t roundRectCount)
+{
+    Canvas* canvas = CastToCanvas(cCanvas);
+    if (canvas == nullptr || cRoundRects == nullptr) {
+        return OH_DRAWING_ERROR_INCORRECT_PARAMETER;
+    }
+    if (roundRectCount == 0) {
+        return OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE;
+    }
+    std::vector<RoundRect> roundRects;
+    if (!CopyRoundRects(cRoundRects, roundRectCount, roundRects)) {
+        return OH_DRAWING_ERROR_INCORRECT_PARAMETER;
+    }
+    canvas->DrawRoundRects(roundRects.data(), roundRects.size());
+    MarkCanvasDirty(canvas);
+    return OH_DRAWING_SUCCESS;
+}
+
+OH_Drawing_ErrorCode OH_Drawing_CanvasDrawRoundRectsWithBrushes(OH_Drawing_Canvas* cCanvas,
+    const OH_Drawing_RoundRect* const cRoundRects[], uint32_t roundRectCount,
+    const OH_Drawing_Brush* const brushes[], uint32_t brushCount, const uint32_t* brushIndices)
+{
+    Canvas* canvas = CastToCanvas(cCanvas);
+    if (canvas == nullptr || cRoundRects == nullptr || brushes == nullptr || brushIndices == nullptr) {
+        return OH_DRAWING_ERROR_INCORRECT_PARAMETER;
+    }
+    if (roundRectCount == 0) {
+        return OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE;
+    }
+    OH_Drawing_ErrorCode errorCode = OH_DRAWING_SUCCESS;
+    if (!CheckBrushIndices(brushes, brushCount, brushIndices, roundRectCount, errorCode)) {
+        return errorCode;
+    }
+    std::vector<RoundRect> roundRects;
+    if (!CopyRoundRects(cRoundRects, roundRectCount, roundRects)) {
+        return OH_DRAWING_ERROR_INCORRECT_PARAMETER;
+    }
+    DrawBatchWithBrushes<RoundRect>(canvas, roundRects.data(), roundRects.size(), brushes, brushIndices,
+        &Canvas::DrawRoundRects);
+    MarkCanvasDirty(canvas);
+    return OH_DRAWING_SUCCESS;
+}
+
 void OH_Drawing_CanvasClipRect(OH_Drawing_Canvas* cCanvas, const OH_Drawing_Rect* cRect,
     OH_Drawing_CanvasClipOp cClipOp, bool doAntiAlias)
 {
@@ -353,6 +353,16 @@ public:
      */
     uint32_t GetOpCnt() const;
 
+    /*
+     * @brief  Records ops into a chunked arena instead of one growing buffer, see MemAllocator::SetChunkMode.
+     *         Switch it off when recording is finished, that flattens the op buffer once. GetData also flattens
+     *         the buffer and ends the mode, so the ops recorded so far are marshalled. ClearOp also ends the mode.
+     * @return true if the mode was switched.
+     */
+    bool SetChunkedRecording(bool enable, size_t chunkSize = MemAllocator::DEFAULT_CHUNK_SIZE);
+
+    bool IsChunkedRecording() const;
+
     CmdList(CmdList&&) = delete;
     CmdList(const CmdList&) = delete;
     CmdList& operator=(CmdList&&) = delete;
@@ -105,6 +105,8 @@ public:
         PARTICLE_OPITEM,
         RESET_CLIP_OPITEM,
         GLYPHS_OPITEM,
+        RECTS_OPITEM,
+        ROUND_RECTS_OPITEM,
     };
 
     static void BrushHandleToBrush(const BrushHandle& brushHandle, const DrawCmdList& cmdList, Brush& brush);
@@ -371,6 +373,51 @@ private:
     RoundRect rrect_;
 };
 
+class DrawRectsOpItem : public DrawWithPaintOpItem {
+public:
+    struct ConstructorHandle : public OpItem {
+        ConstructorHandle(const std::pair<size_t, size_t>& rects, const PaintHandle& paintHandle)
+            : OpItem(DrawOpItem::RECTS_OPITEM), rects(rects), paintHandle(paintHandle) {}
+        ~ConstructorHandle() override = default;
+        std::pair<size_t, size_t> rects;
+        PaintHandle paintHandle;
+    };
+    DrawRectsOpItem(const DrawCmdList& cmdList, ConstructorHandle* handle);
+    DrawRectsOpItem(const std::vector<Rect>& rects, const Paint& paint)
+        : DrawWithPaintOpItem(paint, DrawOpItem::RECTS_OPITEM), rects_(rects) {}
+    ~DrawRectsOpItem() override = default;
+
+    static std::shared_ptr<DrawOpItem> Unmarshalling(const DrawCmdList& cmdList, void* handle);
+    void Marshalling(DrawCmdList& cmdList) override;
+    void Playback(Canvas* canvas, const Rect* rect) override;
+    virtual void DumpItems(std::string& out) const override;
+    Rect GetOpItemCmdlistDrawRegion() override;
+private:
+    std::vector<Rect> rects_;
+};
+
+class DrawRoundRectsOpItem : public DrawWithPaintOpItem {
+public:
+    struct ConstructorHandle : public OpItem {
+        ConstructorHandle(const std::pair<size_t, size_t>& rrects, const PaintHandle& paintHandle)
+            : OpItem(DrawOpItem::ROUND_RECTS_OPITEM), rrects(rrects), paintHandle(paintHandle) {}
+        ~ConstructorHandle() override = default;
+        std::pair<size_t, size_t> rrects;
+        PaintHandle paintHandle;
+    };
+    DrawRoundRectsOpItem(const DrawCmdList& cmdList, ConstructorHandle* handle);
+    DrawRoundRectsOpItem(const std::vector<RoundRect>& rrects, const Paint& paint)
+        : DrawWithPaintOpItem(paint, DrawOpItem::ROUND_RECTS_OPITEM), rrects_(rrects) {}
+    ~DrawRoundRectsOpItem() override = default;
+
+    static std::shared_ptr<DrawOpItem> Unmarshalling(const DrawCmdList& cmdList, void* handle);
+    void Marshalling(DrawCmdList& cmdList) override;
+    void Playback(Canvas* canvas, const Rect* rect) override;
+    virtual void DumpItems(std::string& out) const override;
+private:
+    std::vector<RoundRect> rrects_;
+};
+
 class DrawNestedRoundRectOpItem : public DrawWithPaintOpItem {
 public:
     struct ConstructorHandle : public OpItem {
@@ -159,6 +159,16 @@ public:
      */
     void UnmarshallingDrawOps(uint32_t* opItemCount = nullptr);
 
+    /**
+     * @brief   Enable indexed playback, only takes effect in DEFERRED mode before UnmarshallingDrawOps is called.
+     * @detail  Geometry ops with known bounds are only indexed when unmarshalling and are unmarshalled on first
+     *          touch, playback skips the ops whose bounds are outside the local clip without unmarshalling them.
+     *          The contiguous buffer is kept until every indexed op has been unmarshalled.
+     */
+    void SetIndexedPlayback(bool indexedPlayback);
+
+    bool IsIndexedPlayback() const;
+
     /**
      * @brief   Change typeface ids adding 1 << (30 + 32) - used for profiler replay
      */
@@ -267,6 +277,12 @@ private:
 
     void PlaybackToDrawCmdList(std::shared_ptr<DrawCmdList> drawCmdList);
     void PlaybackByVector(Canvas& canvas, const Rect* rect = nullptr);
+    void PlaybackByIndex(Canvas& canvas, const Rect* rect = nullptr);
+    std::shared_ptr<DrawOpItem> UnmarshallingIndexedOp(size_t index) const;
+    std::shared_ptr<DrawOpItem> GetIndexedOp(size_t index);
+    void MaterializeIndexedOps();
+    std::vector<std::shared_ptr<DrawOpItem>> GetMaterializedDrawOpItems() const;
+    void ClearOpData();
     bool UnmarshallingDrawOpsSimple(std::vector<std::shared_ptr<DrawOpItem>>& drawOpItems, size_t& lastOpGenSize);
     void PlaybackByBuffer(Canvas& canvas, const Rect* rect = nullptr);
     void CaculatePerformanceOpType();
@@ -289,6 +305,15 @@ private:
     bool noNeedUICaptured_ = false;
     bool isReplayMode = false;
 
+    struct IndexedOpEntry {
+        size_t offset = 0; // offset of the op in the contiguous buffer, 0 if it is not unmarshalled lazily
+        bool hasBounds = false;
+        Rect bounds;
+    };
+    bool indexedPlayback_ = false;
+    std::vector<IndexedOpEntry> opIndex_;
+    size_t pendingIndexedOpCount_ = 0;
+
     DrawCmdList::HybridRenderType hybridRenderType_ = DrawCmdList::HybridRenderType::NONE;
 };
 
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 #include "utils/drawing_macros.h"
 
 namespace OHOS {
@@ -27,6 +28,8 @@ class DRAWING_API MemAllocator {
 public:
     static constexpr uint32_t MEMORY_EXPANSION_FACTOR = 2;
     static constexpr size_t ALIGN_SIZE = 4;
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 4096;
+    static constexpr size_t MAX_CHUNK_SIZE = 1024 * 1024;
 
     MemAllocator();
     ~MemAllocator();
@@ -60,6 +63,14 @@ public:
             return nullptr;
         }
 
+        if (chunkMode_) {
+            void* chunkAddr = AllocateFromChunk(sizeof(T), false);
+            if (chunkAddr == nullptr) {
+                return nullptr;
+            }
+            return new (chunkAddr) T{std::forward<Args>(args)...};
+        }
+
         if (capacity_ - size_ < sizeof(T)) {
             // The capacity is not enough, expand the capacity
             if (Resize((capacity_ + sizeof(T)) * MEMORY_EXPANSION_FACTOR) == false) {
@@ -89,6 +100,8 @@ public:
 
     /**
      * @brief Gets the address of the contiguous memory buffer held by MemAllocator.
+     * In chunked mode the data is only contiguous while it fits in one block, otherwise nullptr is
+     * returned until Flatten or SetChunkMode(false) is called at the end of recording.
      */
     const void* GetData() const;
 
@@ -108,18 +121,60 @@ public:
 
     void ClearData();
 
+    /**
+     * @brief Switches the allocator to chunked arena mode. Memory is then taken from a list of
+     * segmented blocks whose addresses stay stable while recording, instead of reallocating and
+     * copying one contiguous buffer. Offsets remain contiguous across blocks, the blocks are
+     * flattened into one buffer by Flatten or when the mode is switched off at the end of recording.
+     * Existing data is kept as the first block.
+     * @param enable     true to enable chunked mode, false to flatten and go back to contiguous mode.
+     * @param chunkSize  The size of the first block, later blocks grow up to MAX_CHUNK_SIZE.
+     * @return true if the mode was switched, false if the allocator is read-only.
+     */
+    bool SetChunkMode(bool enable, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+    bool IsChunkMode() const;
+
+    /**
+     * @brief Merges the blocks of chunked mode into one block, so that GetData returns the whole buffer.
+     * Addresses taken from the blocks before are invalid afterwards, call it once recording is finished.
+     * @return true if the data is contiguous.
+     */
+    bool Flatten();
+
+    /**
+     * @brief Gets the number of blocks currently held in chunked mode, 0 in contiguous mode.
+     */
+    size_t GetChunkCount() const;
+
     MemAllocator(MemAllocator&&) = delete;
-    MemAllocator(const MemAllocator&) = default;
+    MemAllocator(const MemAllocator& other);
     MemAllocator& operator=(MemAllocator&&) = delete;
-    MemAllocator& operator=(const MemAllocator&) = default;
+    MemAllocator& operator=(const MemAllocator& other);
 private:
+    struct Chunk {
+        char* data = nullptr;
+        size_t capacity = 0;    // The size of the block
+        size_t used = 0;        // The size already used in the block
+        size_t base = 0;        // The offset of the block in the flattened buffer
+    };
+
     bool Resize(size_t size);
     void Clear();
+    void* AllocateFromChunk(size_t size, bool align);
+    bool AppendChunk(size_t minSize);
+    const Chunk* FindChunk(size_t offset) const;
+    void ReleaseChunks();
+    void CopyFrom(const MemAllocator& other);
 
     bool isReadOnly_;
     size_t capacity_;   // The size of the memory block
     size_t size_;       // The size already used
     char* startPtr_;    // Points to the beginning of the memory block
+
+    bool chunkMode_ = false;
+    size_t chunkSize_ = DEFAULT_CHUNK_SIZE;
+    std::vector<Chunk> chunks_;
 };
 } // namespace Drawing
 } // namespace Rosen
@@ -67,6 +67,8 @@ public:
     void DrawLine(const Point& startPt, const Point& endPt) override;
     void DrawRect(const Rect& rect) override;
     void DrawRoundRect(const RoundRect& roundRect) override;
+    void DrawRects(const Rect rects[], size_t count) override;
+    void DrawRoundRects(const RoundRect roundRects[], size_t count) override;
     void DrawNestedRoundRect(const RoundRect& outer, const RoundRect& inner) override;
     void DrawArc(const Rect& oval, scalar startAngle, scalar sweepAngle) override;
     void DrawPie(const Rect& oval, scalar startAngle, scalar sweepAngle) override;
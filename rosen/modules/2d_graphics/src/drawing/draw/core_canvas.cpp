@@ -277,6 +277,26 @@ void CoreCanvas::DrawRoundRect(const RoundRect& roundRect)
     DRAW_API_WITH_PAINT(DrawRoundRect, roundRect);
 }
 
+void CoreCanvas::DrawRects(const Rect rects[], size_t count)
+{
+    if (rects == nullptr) {
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        DrawRect(rects[i]);
+    }
+}
+
+void CoreCanvas::DrawRoundRects(const RoundRect roundRects[], size_t count)
+{
+    if (roundRects == nullptr) {
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        DrawRoundRect(roundRects[i]);
+    }
+}
+
 void CoreCanvas::DrawNestedRoundRect(const RoundRect& outer, const RoundRect& inner)
 {
 #ifdef DRAWING_DISABLE_API
@@ -266,6 +266,22 @@ public:
      */
     virtual void DrawRoundRect(const RoundRect& roundRect);
 
+    /**
+     * @brief Draws count rectangles with the same pen or brush, as DrawRect does for each of them.
+     * A recording canvas records them as a single operation.
+     * @param rects array of rectangles to draw
+     * @param count number of rectangles in the array
+     */
+    virtual void DrawRects(const Rect rects[], size_t count);
+
+    /**
+     * @brief Draws count round rectangles with the same pen or brush, as DrawRoundRect does for each of them.
+     * A recording canvas records them as a single operation.
+     * @param roundRects array of round rectangles to draw
+     * @param count      number of round rectangles in the array
+     */
+    virtual void DrawRoundRects(const RoundRect roundRects[], size_t count);
+
     /**
      * @brief Outer must contain inner or the drawing is undefined. If RRect is stroked, use pen to stroke
      * width describes the line thickness. If stroked and RRect corner has zero length radii,
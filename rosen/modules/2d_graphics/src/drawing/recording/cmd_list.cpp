@@ -65,6 +65,14 @@ const void* CmdList::GetCmdListData(size_t offset, size_t size) const
 CmdListData CmdList::GetData() const
 {
     std::lock_guard<std::recursive_mutex> lock(mutex_);
+    if (opAllocator_.IsChunkMode()) {
+        // The ops are read to be marshalled, so recording is over: end it the way SetChunkedRecording(false) does.
+        // The writer holds the mutex too, so the blocks do not move under it.
+        if (!const_cast<MemAllocator&>(opAllocator_).SetChunkMode(false)) {
+            LOGE("CmdList GetData flatten chunked op buffer failed");
+            return std::make_pair(nullptr, 0);
+        }
+    }
     return std::make_pair(opAllocator_.GetData(), opAllocator_.GetSize());
 }
 
@@ -427,6 +435,21 @@ uint32_t CmdList::GetOpCnt() const
     return opCnt_;
 }
 
+bool CmdList::SetChunkedRecording(bool enable, size_t chunkSize)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    if (!opAllocator_.SetChunkMode(enable, chunkSize)) {
+        LOGD("CmdList SetChunkedRecording failed, op buffer is read-only");
+        return false;
+    }
+    return true;
+}
+
+bool CmdList::IsChunkedRecording() const
+{
+    return opAllocator_.IsChunkMode();
+}
+
 void CmdList::FlushImageCache()
 {
     {
@@ -103,6 +103,8 @@ std::unordered_map<uint32_t, std::string> typeOpDes = {
     { DrawOpItem::HYBRID_RENDER_PIXELMAP_SIZE_OPITEM, "HYBRID_RENDER_PIXELMAP_SIZE_OPITEM"},
     { DrawOpItem::UICOLOR_OPITEM, "UICOLOR_OPITEM"},
     { DrawOpItem::PARTICLE_OPITEM, "PARTICLE_OPITEM"},
+    { DrawOpItem::RECTS_OPITEM, "RECTS_OPITEM"},
+    { DrawOpItem::ROUND_RECTS_OPITEM, "ROUND_RECTS_OPITEM"},
 };
 
 namespace {
@@ -630,6 +632,90 @@ void DrawRoundRectOpItem::DumpItems(std::string& out) const
     rrect_.Dump(out);
 }
 
+/* DrawRectsOpItem */
+UNMARSHALLING_REGISTER(DrawRects, DrawOpItem::RECTS_OPITEM,
+    DrawRectsOpItem::Unmarshalling, sizeof(DrawRectsOpItem::ConstructorHandle));
+
+DrawRectsOpItem::DrawRectsOpItem(const DrawCmdList& cmdList, DrawRectsOpItem::ConstructorHandle* handle)
+    : DrawWithPaintOpItem(cmdList, handle->paintHandle, RECTS_OPITEM)
+{
+    rects_ = CmdListHelper::GetVectorFromCmdList<Rect>(cmdList, handle->rects);
+}
+
+std::shared_ptr<DrawOpItem> DrawRectsOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
+{
+    return std::make_shared<DrawRectsOpItem>(cmdList, static_cast<DrawRectsOpItem::ConstructorHandle*>(handle));
+}
+
+void DrawRectsOpItem::Marshalling(DrawCmdList& cmdList)
+{
+    PaintHandle paintHandle;
+    GenerateHandleFromPaint(cmdList, paint_, paintHandle);
+    auto rectsData = CmdListHelper::AddVectorToCmdList<Rect>(cmdList, rects_);
+    cmdList.AddOp<ConstructorHandle>(rectsData, paintHandle);
+}
+
+void DrawRectsOpItem::Playback(Canvas* canvas, const Rect* rect)
+{
+    canvas->AttachPaint(paint_);
+    canvas->DrawRects(rects_.data(), rects_.size());
+}
+
+void DrawRectsOpItem::DumpItems(std::string& out) const
+{
+    out += " rects count:" + std::to_string(rects_.size());
+}
+
+Rect DrawRectsOpItem::GetOpItemCmdlistDrawRegion()
+{
+    Rect bounds;
+    for (const auto& rect : rects_) {
+        if (!rect.IsEmpty()) {
+            bounds.Join(rect);
+        }
+    }
+    if (bounds.IsEmpty()) {
+        LOGD("GetOpItemCmdlistDrawRegion rects opItem's bounds is empty");
+        return { 0, 0, 0, 0 };
+    }
+    return bounds;
+}
+
+/* DrawRoundRectsOpItem */
+UNMARSHALLING_REGISTER(DrawRoundRects, DrawOpItem::ROUND_RECTS_OPITEM,
+    DrawRoundRectsOpItem::Unmarshalling, sizeof(DrawRoundRectsOpItem::ConstructorHandle));
+
+DrawRoundRectsOpItem::DrawRoundRectsOpItem(const DrawCmdList& cmdList, DrawRoundRectsOpItem::ConstructorHandle* handle)
+    : DrawWithPaintOpItem(cmdList, handle->paintHandle, ROUND_RECTS_OPITEM)
+{
+    rrects_ = CmdListHelper::GetVectorFromCmdList<RoundRect>(cmdList, handle->rrects);
+}
+
+std::shared_ptr<DrawOpItem> DrawRoundRectsOpItem::Unmarshalling(const DrawCmdList& cmdList, void* handle)
+{
+    return std::make_shared<DrawRoundRectsOpItem>(cmdList,
+        static_cast<DrawRoundRectsOpItem::ConstructorHandle*>(handle));
+}
+
+void DrawRoundRectsOpItem::Marshalling(DrawCmdList& cmdList)
+{
+    PaintHandle paintHandle;
+    GenerateHandleFromPaint(cmdList, paint_, paintHandle);
+    auto rrectsData = CmdListHelper::AddVectorToCmdList<RoundRect>(cmdList, rrects_);
+    cmdList.AddOp<ConstructorHandle>(rrectsData, paintHandle);
+}
+
+void DrawRoundRectsOpItem::Playback(Canvas* canvas, const Rect* rect)
+{
+    canvas->AttachPaint(paint_);
+    canvas->DrawRoundRects(rrects_.data(), rrects_.size());
+}
+
+void DrawRoundRectsOpItem::DumpItems(std::string& out) const
+{
+    out += " rrects count:" + std::to_string(rrects_.size());
+}
+
 /* DrawNestedRoundRectOpItem */
 UNMARSHALLING_REGISTER(DrawNestedRoundRect, DrawOpItem::NESTED_ROUND_RECT_OPITEM,
     DrawNestedRoundRectOpItem::Unmarshalling, sizeof(DrawNestedRoundRectOpItem::ConstructorHandle));
@@ -15,6 +15,8 @@
 
 #include "recording/draw_cmd_list.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <memory>
 #include <unordered_set>
@@ -28,6 +30,97 @@
 namespace OHOS {
 namespace Rosen {
 namespace Drawing {
+namespace {
+constexpr scalar INDEXED_BOUNDS_AA_OUTSET = 1.0f;
+constexpr scalar SQUARE_CAP_OUTSET_SCALE = 1.42f; // a little larger than sqrt(2)
+
+template<typename T>
+const T* GetIndexedOpHandle(const void* itemPtr, size_t availableSize)
+{
+    return availableSize < sizeof(T) ? nullptr : static_cast<const T*>(static_cast<const OpItem*>(itemPtr));
+}
+
+// local bounds of a geometry op, false if they are unknown or may be enlarged by an effect of the paint
+bool MakeIndexedOpBounds(scalar left, scalar top, scalar right, scalar bottom, const PaintHandle& paintHandle,
+    Rect& bounds)
+{
+    if (paintHandle.imageFilterHandle.size != 0 || paintHandle.maskFilterHandle.size != 0 ||
+        paintHandle.pathEffectHandle.size != 0 || paintHandle.blurDrawLooperHandle.size != 0) {
+        return false;
+    }
+    if (!std::isfinite(left) || !std::isfinite(top) || !std::isfinite(right) || !std::isfinite(bottom)) {
+        return false;
+    }
+    scalar outset = INDEXED_BOUNDS_AA_OUTSET;
+    if (paintHandle.style & Paint::PaintStyle::PAINT_STROKE) {
+        if (!std::isfinite(paintHandle.width) || !std::isfinite(paintHandle.miterLimit)) {
+            return false;
+        }
+        scalar scale = 1.0f;
+        if (paintHandle.joinStyle == Pen::JoinStyle::MITER_JOIN) {
+            scale = std::max(scale, paintHandle.miterLimit);
+        }
+        if (paintHandle.capStyle == Pen::CapStyle::SQUARE_CAP) {
+            scale = std::max(scale, SQUARE_CAP_OUTSET_SCALE);
+        }
+        outset += std::abs(paintHandle.width) * 0.5f * scale; // 0.5 for half of the stroke is outside the geometry
+    }
+    bounds = Rect(std::min(left, right) - outset, std::min(top, bottom) - outset,
+        std::max(left, right) + outset, std::max(top, bottom) + outset);
+    return true;
+}
+
+bool MakeIndexedOpBounds(const Rect& rect, const PaintHandle& paintHandle, Rect& bounds)
+{
+    return MakeIndexedOpBounds(rect.GetLeft(), rect.GetTop(), rect.GetRight(), rect.GetBottom(), paintHandle, bounds);
+}
+
+bool GetIndexedOpBounds(uint32_t type, const void* itemPtr, size_t availableSize, Rect& bounds)
+{
+    switch (type) {
+        case DrawOpItem::RECT_OPITEM: {
+            auto* handle = GetIndexedOpHandle<DrawRectOpItem::ConstructorHandle>(itemPtr, availableSize);
+            return handle && MakeIndexedOpBounds(handle->rect, handle->paintHandle, bounds);
+        }
+        case DrawOpItem::ROUND_RECT_OPITEM: {
+            auto* handle = GetIndexedOpHandle<DrawRoundRectOpItem::ConstructorHandle>(itemPtr, availableSize);
+            return handle && MakeIndexedOpBounds(handle->rrect.GetRect(), handle->paintHandle, bounds);
+        }
+        case DrawOpItem::NESTED_ROUND_RECT_OPITEM: {
+            auto* handle = GetIndexedOpHandle<DrawNestedRoundRectOpItem::ConstructorHandle>(itemPtr, availableSize);
+            return handle && MakeIndexedOpBounds(handle->outerRRect.GetRect(), handle->paintHandle, bounds);
+        }
+        case DrawOpItem::OVAL_OPITEM: {
+            auto* handle = GetIndexedOpHandle<DrawOvalOpItem::ConstructorHandle>(itemPtr, availableSize);
+            return handle && MakeIndexedOpBounds(handle->rect, handle->paintHandle, bounds);
+        }
+        case DrawOpItem::ARC_OPITEM: {
+            auto* handle = GetIndexedOpHandle<DrawArcOpItem::ConstructorHandle>(itemPtr, availableSize);
+            return handle && MakeIndexedOpBounds(handle->rect, handle->paintHandle, bounds);
+        }
+        case DrawOpItem::PIE_OPITEM: {
+            auto* handle = GetIndexedOpHandle<DrawPieOpItem::ConstructorHandle>(itemPtr, availableSize);
+            return handle && MakeIndexedOpBounds(handle->rect, handle->paintHandle, bounds);
+        }
+        case DrawOpItem::CIRCLE_OPITEM: {
+            auto* handle = GetIndexedOpHandle<DrawCircleOpItem::ConstructorHandle>(itemPtr, availableSize);
+            if (handle == nullptr) {
+                return false;
+            }
+            scalar radius = std::abs(handle->radius);
+            return MakeIndexedOpBounds(handle->centerPt.GetX() - radius, handle->centerPt.GetY() - radius,
+                handle->centerPt.GetX() + radius, handle->centerPt.GetY() + radius, handle->paintHandle, bounds);
+        }
+        case DrawOpItem::LINE_OPITEM: {
+            auto* handle = GetIndexedOpHandle<DrawLineOpItem::ConstructorHandle>(itemPtr, availableSize);
+            return handle && MakeIndexedOpBounds(handle->startPt.GetX(), handle->startPt.GetY(),
+                handle->endPt.GetX(), handle->endPt.GetY(), handle->paintHandle, bounds);
+        }
+        default:
+            return false;
+    }
+}
+} // namespace
 
 std::shared_ptr<DrawCmdList> DrawCmdList::CreateFromData(const CmdListData& data, bool isCopy)
 {
@@ -89,6 +182,8 @@ void DrawCmdList::ClearOp()
         imageMap_.clear();
         imageHandleVec_.clear();
         drawOpItems_.clear();
+        opIndex_.clear();
+        pendingIndexedOpCount_ = 0;
         lastOpGenSize_ = 0;
         lastOpItemOffset_ = std::nullopt;
         opCnt_ = 0;
@@ -157,7 +252,7 @@ size_t DrawCmdList::GetOpItemSize() const
 std::string DrawCmdList::GetOpsWithDesc() const
 {
     std::string desc;
-    for (auto& item : drawOpItems_) {
+    for (auto& item : GetMaterializedDrawOpItems()) {
         if (item == nullptr) {
             continue;
         }
@@ -172,6 +267,7 @@ void DrawCmdList::Dump(std::string& out)
 {
     bool found = false;
     std::lock_guard<std::recursive_mutex> lock(mutex_);
+    MaterializeIndexedOps();
     std::vector<std::shared_ptr<DrawOpItem>> dumpDrawOpItems;
     size_t lastOpGenSize = lastOpGenSize_;
     if (drawOpItems_.empty() && !IsEmpty()) {
@@ -200,6 +296,7 @@ void DrawCmdList::MarshallingDrawOps()
         return;
     }
     std::lock_guard<std::recursive_mutex> lock(mutex_);
+    MaterializeIndexedOps();
     if (replacedOpListForVector_.empty()) {
         for (auto& op : drawOpItems_) {
             if (op) {
@@ -238,7 +335,7 @@ void DrawCmdList::ProfilerMarshallingDrawOps(Drawing::DrawCmdList* cmdlist) cons
     }
 
     const std::lock_guard<std::recursive_mutex> lock(mutex_);
-    for (auto& op : drawOpItems_) {
+    for (auto& op : GetMaterializedDrawOpItems()) {
         if (op) {
             op->Marshalling(*cmdlist);
         }
@@ -292,6 +389,10 @@ void DrawCmdList::UnmarshallingDrawOps(uint32_t* opItemCount)
 
     UnmarshallingPlayer player = { *this };
     drawOpItems_.clear();
+    opIndex_.clear();
+    pendingIndexedOpCount_ = 0;
+    bool indexed = indexedPlayback_ && mode_ == DrawCmdList::UnmarshalMode::DEFERRED &&
+        replacedOpListForBuffer_.empty();
     lastOpGenSize_ = 0;
     uint32_t opReplaceIndex = 0;
     size_t offset = offset_;
@@ -309,6 +410,19 @@ void DrawCmdList::UnmarshallingDrawOps(uint32_t* opItemCount)
             break;
         }
         uint32_t type = curOpItemPtr->GetType();
+        Rect bounds;
+        if (indexed && GetIndexedOpBounds(type, itemPtr, opAllocator_.GetSize() - offset, bounds)) {
+            // only index the op here, it is unmarshalled on first touch in playback
+            opIndex_.resize(drawOpItems_.size());
+            opIndex_.push_back({ offset, true, bounds });
+            drawOpItems_.emplace_back(nullptr);
+            pendingIndexedOpCount_++;
+            if (curOpItemPtr->GetNextOpItemOffset() < offset + sizeof(OpItem)) {
+                break;
+            }
+            offset = curOpItemPtr->GetNextOpItemOffset();
+            continue;
+        }
         auto op = player.Unmarshalling(type, itemPtr, opAllocator_.GetSize() - offset, isReplayMode);
         if (!op) {
             if (curOpItemPtr->GetNextOpItemOffset() < offset + sizeof(OpItem)) {
@@ -349,15 +463,88 @@ void DrawCmdList::UnmarshallingDrawOps(uint32_t* opItemCount)
     } while (offset != 0 && count <= MAX_OPITEMSIZE);
     lastOpGenSize_ = opAllocator_.GetSize();
 
+    if (pendingIndexedOpCount_ > 0) {
+        // the indexed ops are unmarshalled from the contiguous buffer later, keep it
+        opIndex_.resize(drawOpItems_.size());
+    } else {
+        opIndex_.clear();
+        ClearOpData();
+    }
+
+    if (performanceCaculateOpType_ != 0) {
+        LOGI("Drawing Performance UnmarshallingDrawOps end %{public}lld", PerformanceCaculate::GetUpTime());
+    }
+}
+
+void DrawCmdList::ClearOpData()
+{
     opAllocator_.ClearData();
     imageAllocator_.ClearData();
     bitmapAllocator_.ClearData();
     opAllocator_.Add(&width_, sizeof(int32_t));
     opAllocator_.Add(&height_, sizeof(int32_t));
+}
 
-    if (performanceCaculateOpType_ != 0) {
-        LOGI("Drawing Performance UnmarshallingDrawOps end %{public}lld", PerformanceCaculate::GetUpTime());
+void DrawCmdList::SetIndexedPlayback(bool indexedPlayback)
+{
+    indexedPlayback_ = indexedPlayback;
+}
+
+bool DrawCmdList::IsIndexedPlayback() const
+{
+    return indexedPlayback_;
+}
+
+std::shared_ptr<DrawOpItem> DrawCmdList::UnmarshallingIndexedOp(size_t index) const
+{
+    if (index >= opIndex_.size() || opIndex_[index].offset == 0) {
+        return nullptr;
+    }
+    size_t offset = opIndex_[index].offset;
+    void* itemPtr = opAllocator_.OffsetToAddr(offset, sizeof(OpItem));
+    if (itemPtr == nullptr || opAllocator_.GetSize() <= offset) {
+        HILOG_COMM_ERROR("DrawCmdList::UnmarshallingIndexedOp failed, opItem is nullptr");
+        return nullptr;
+    }
+    UnmarshallingPlayer player = { *this };
+    return player.Unmarshalling(static_cast<OpItem*>(itemPtr)->GetType(), itemPtr,
+        opAllocator_.GetSize() - offset, isReplayMode);
+}
+
+std::shared_ptr<DrawOpItem> DrawCmdList::GetIndexedOp(size_t index)
+{
+    if (drawOpItems_[index] != nullptr || opIndex_[index].offset == 0) {
+        return drawOpItems_[index];
+    }
+    drawOpItems_[index] = UnmarshallingIndexedOp(index);
+    opIndex_[index].offset = 0;
+    if (--pendingIndexedOpCount_ == 0) {
+        ClearOpData();
+    }
+    return drawOpItems_[index];
+}
+
+void DrawCmdList::MaterializeIndexedOps()
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    for (size_t index = 0; index < opIndex_.size() && pendingIndexedOpCount_ > 0; ++index) {
+        GetIndexedOp(index);
+    }
+}
+
+std::vector<std::shared_ptr<DrawOpItem>> DrawCmdList::GetMaterializedDrawOpItems() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    std::vector<std::shared_ptr<DrawOpItem>> drawOpItems(drawOpItems_);
+    if (pendingIndexedOpCount_ == 0) {
+        return drawOpItems;
+    }
+    for (size_t index = 0; index < opIndex_.size(); ++index) {
+        if (drawOpItems[index] == nullptr) {
+            drawOpItems[index] = UnmarshallingIndexedOp(index);
+        }
     }
+    return drawOpItems;
 }
 
 void DrawCmdList::Playback(Canvas& canvas, const Rect* rect)
@@ -564,6 +751,7 @@ void DrawCmdList::PlaybackToDrawCmdList(std::shared_ptr<DrawCmdList> drawCmdList
     }
     std::lock_guard<std::recursive_mutex> lock(mutex_);
     if (mode_ == DrawCmdList::UnmarshalMode::DEFERRED) {
+        MaterializeIndexedOps();
         std::lock_guard<std::recursive_mutex> lock(drawCmdList->mutex_);
         drawCmdList->drawOpItems_.insert(drawCmdList->drawOpItems_.end(), drawOpItems_.begin(), drawOpItems_.end());
         return;
@@ -610,6 +798,10 @@ void DrawCmdList::PlaybackByVector(Canvas& canvas, const Rect* rect)
     if (drawOpItems_.empty()) {
         return;
     }
+    if (!opIndex_.empty()) {
+        PlaybackByIndex(canvas, rect);
+        return;
+    }
     for (auto op : drawOpItems_) {
         if (op) {
             op->Playback(&canvas, rect);
@@ -618,6 +810,33 @@ void DrawCmdList::PlaybackByVector(Canvas& canvas, const Rect* rect)
     canvas.DetachPaint();
 }
 
+void DrawCmdList::PlaybackByIndex(Canvas& canvas, const Rect* rect)
+{
+    // the local clip is only known for canvases which draw, others always play back every op
+    auto drawingType = canvas.GetDrawingType();
+    bool canSkip = drawingType == DrawingType::COMMON || drawingType == DrawingType::PAINT_FILTER;
+    std::optional<Rect> localClip;
+    for (size_t index = 0; index < drawOpItems_.size(); ++index) {
+        const auto& entry = opIndex_[index];
+        if (!entry.hasBounds) {
+            // ops without bounds may change the matrix or the clip
+            localClip.reset();
+        } else if (canSkip) {
+            if (!localClip.has_value()) {
+                localClip = canvas.GetLocalClipBounds();
+            }
+            if (!entry.bounds.IsIntersect(localClip.value())) {
+                continue;
+            }
+        }
+        auto op = GetIndexedOp(index);
+        if (op) {
+            op->Playback(&canvas, rect);
+        }
+    }
+    canvas.DetachPaint();
+}
+
 bool DrawCmdList::UnmarshallingDrawOpsSimple(
     std::vector<std::shared_ptr<DrawOpItem>>& drawOpItems, size_t& lastOpGenSize)
 {
@@ -784,8 +1003,7 @@ size_t DrawCmdList::GetSize()
 // LCOV_EXCL_START
 const std::vector<std::shared_ptr<DrawOpItem>> DrawCmdList::GetDrawOpItems() const
 {
-    std::vector<std::shared_ptr<DrawOpItem>> drawOpItems(drawOpItems_);
-    return drawOpItems;
+    return GetMaterializedDrawOpItems();
 }
 // LCOV_EXCL_STOP
 
@@ -795,6 +1013,7 @@ RectF DrawCmdList::GetCmdlistDrawRegion()
     Rect cmdlistDrawRegion;
     {
         std::lock_guard<std::recursive_mutex> lock(mutex_);
+        MaterializeIndexedOps();
         for (const auto& op : drawOpItems_) {
             if (!op) {
                 continue;
@@ -805,6 +1024,7 @@ RectF DrawCmdList::GetCmdlistDrawRegion()
                 case DrawOpItem::PATH_OPITEM:
                 case DrawOpItem::TEXT_BLOB_OPITEM:
                 case DrawOpItem::RECT_OPITEM:
+                case DrawOpItem::RECTS_OPITEM:
                     cmdlistDrawRegion.Join(op->GetOpItemCmdlistDrawRegion());
                     break;
                 // not dst opItem, but will appear in dst scene
@@ -15,6 +15,7 @@
 
 #include "recording/mem_allocator.h"
 
+#include <algorithm>
 #include <hilog/log.h>
 
 #include "securec.h"
@@ -25,6 +26,11 @@ namespace Rosen {
 namespace Drawing {
 namespace {
 constexpr size_t LARGE_MALLOC = 200000000;
+
+inline size_t AlignUp(size_t size, size_t align)
+{
+    return (size + align - 1) / align * align;
+}
 }
 static constexpr size_t MEM_SIZE_MAX = SIZE_MAX / 2;
 
@@ -35,6 +41,55 @@ MemAllocator::~MemAllocator()
     Clear();
 }
 
+MemAllocator::MemAllocator(const MemAllocator& other)
+    : isReadOnly_(true), capacity_(0), size_(0), startPtr_(nullptr)
+{
+    CopyFrom(other);
+}
+
+MemAllocator& MemAllocator::operator=(const MemAllocator& other)
+{
+    if (this != &other) {
+        Clear();
+        CopyFrom(other);
+    }
+    return *this;
+}
+
+void MemAllocator::CopyFrom(const MemAllocator& other)
+{
+    chunkSize_ = other.chunkSize_;
+    if (other.isReadOnly_) {
+        // A read-only buffer is not owned, both allocators just point to it.
+        isReadOnly_ = true;
+        startPtr_ = other.startPtr_;
+        capacity_ = other.capacity_;
+        size_ = other.size_;
+        return;
+    }
+    isReadOnly_ = false;
+    if (other.startPtr_ && other.capacity_ > 0) {
+        startPtr_ = new(std::nothrow) char[other.capacity_];
+        if (!startPtr_ || (other.size_ > 0 && memcpy_s(startPtr_, other.capacity_, other.startPtr_, other.size_))) {
+            delete[] startPtr_;
+            startPtr_ = nullptr;
+            return;
+        }
+        capacity_ = other.capacity_;
+        size_ = other.size_;
+    }
+    for (const auto& chunk : other.chunks_) {
+        char* data = new(std::nothrow) char[chunk.capacity];
+        if (!data || (chunk.used > 0 && memcpy_s(data, chunk.capacity, chunk.data, chunk.used))) {
+            delete[] data;
+            ReleaseChunks();
+            return;
+        }
+        chunks_.push_back({ data, chunk.capacity, chunk.used, chunk.base });
+    }
+    chunkMode_ = other.chunkMode_;
+}
+
 bool MemAllocator::BuildFromData(const void* data, size_t size)
 {
     if (!data || size == 0 || size > MEM_SIZE_MAX) {
@@ -65,6 +120,8 @@ bool MemAllocator::BuildFromDataWithCopy(const void* data, size_t size)
 
 void MemAllocator::Clear()
 {
+    ReleaseChunks();
+    chunkMode_ = false;
     if (!isReadOnly_ && startPtr_) {
         delete[] startPtr_;
     }
@@ -76,6 +133,8 @@ void MemAllocator::Clear()
 
 void MemAllocator::ClearData()
 {
+    ReleaseChunks();
+    chunkMode_ = false;
     if (!isReadOnly_ && startPtr_) {
         delete[] startPtr_;
     }
@@ -115,6 +174,13 @@ void* MemAllocator::Add(const void* data, size_t size)
     if (isReadOnly_ || !data || size == 0 || size > MEM_SIZE_MAX || size > MEM_SIZE_MAX - capacity_) {
         return nullptr;
     }
+    if (chunkMode_) {
+        void* addr = AllocateFromChunk(size, true);
+        if (addr == nullptr || memcpy_s(addr, size, data, size)) {
+            return nullptr;
+        }
+        return addr;
+    }
     auto current = startPtr_ + size_;
     if (auto mod = reinterpret_cast<uintptr_t>(current) % ALIGN_SIZE; mod != 0) {
         size_ += ALIGN_SIZE - mod;
@@ -136,11 +202,21 @@ void* MemAllocator::Add(const void* data, size_t size)
 
 size_t MemAllocator::GetSize() const
 {
+    if (chunkMode_) {
+        return chunks_.empty() ? 0 : chunks_.back().base + chunks_.back().used;
+    }
     return size_;
 }
 
 const void* MemAllocator::GetData() const
 {
+    if (chunkMode_) {
+        // Never flatten here, that would move the blocks under a reader or the recording thread.
+        if (chunks_.size() != 1) {
+            return nullptr;
+        }
+        return chunks_.front().data;
+    }
     return startPtr_;
 }
 
@@ -150,6 +226,17 @@ size_t MemAllocator::AddrToOffset(const void* addr) const
         return 0;
     }
 
+    if (chunkMode_) {
+        // The block just written to is the last one, so search backwards.
+        auto ptr = static_cast<const char*>(addr);
+        for (auto iter = chunks_.rbegin(); iter != chunks_.rend(); ++iter) {
+            if (ptr >= iter->data && ptr < iter->data + iter->used) {
+                return iter->base + static_cast<size_t>(ptr - iter->data);
+            }
+        }
+        return 0;
+    }
+
     size_t offset = static_cast<size_t>(static_cast<const char*>(addr) - startPtr_);
     if (offset >= size_) {
         return 0;
@@ -159,6 +246,20 @@ size_t MemAllocator::AddrToOffset(const void* addr) const
 
 void* MemAllocator::OffsetToAddr(size_t offset, size_t size) const
 {
+    if (chunkMode_) {
+        const Chunk* chunk = FindChunk(offset);
+        if (chunk == nullptr) {
+            LOGD("MemAllocator::OffsetToAddr return nullptr.");
+            return nullptr;
+        }
+        size_t localOffset = offset - chunk->base;
+        if (localOffset >= chunk->used || size > chunk->used - localOffset) {
+            LOGD("MemAllocator::OffsetToAddr return nullptr.");
+            return nullptr;
+        }
+        return static_cast<void*>(chunk->data + localOffset);
+    }
+
     if (offset >= size_ || size > size_ || offset > size_ - size) {
         LOGD("MemAllocator::OffsetToAddr return nullptr.");
         return nullptr;
@@ -166,6 +267,144 @@ void* MemAllocator::OffsetToAddr(size_t offset, size_t size) const
 
     return static_cast<void*>(startPtr_ + offset);
 }
+
+bool MemAllocator::SetChunkMode(bool enable, size_t chunkSize)
+{
+    if (isReadOnly_) {
+        return false;
+    }
+    if (!enable) {
+        if (!chunkMode_) {
+            return true;
+        }
+        if (!Flatten()) {
+            return false;
+        }
+        if (!chunks_.empty()) {
+            startPtr_ = chunks_.front().data;
+            capacity_ = chunks_.front().capacity;
+            size_ = chunks_.front().used;
+            chunks_.clear();
+        }
+        chunkMode_ = false;
+        return true;
+    }
+
+    chunkSize_ = chunkSize == 0 ? DEFAULT_CHUNK_SIZE : std::min(AlignUp(chunkSize, ALIGN_SIZE), MAX_CHUNK_SIZE);
+    if (chunkMode_) {
+        return true;
+    }
+    if (startPtr_) {
+        // Keep the existing contiguous buffer as the first block, so recorded offsets stay valid.
+        chunks_.push_back({ startPtr_, capacity_, size_, 0 });
+        startPtr_ = nullptr;
+        capacity_ = 0;
+        size_ = 0;
+    }
+    chunkMode_ = true;
+    return true;
+}
+
+bool MemAllocator::IsChunkMode() const
+{
+    return chunkMode_;
+}
+
+size_t MemAllocator::GetChunkCount() const
+{
+    return chunkMode_ ? chunks_.size() : 0;
+}
+
+void* MemAllocator::AllocateFromChunk(size_t size, bool align)
+{
+    if (size == 0 || size > MEM_SIZE_MAX) {
+        return nullptr;
+    }
+    size_t start = 0;
+    if (!chunks_.empty()) {
+        Chunk& current = chunks_.back();
+        start = align ? AlignUp(current.used, ALIGN_SIZE) : current.used;
+    }
+    if (chunks_.empty() || start > chunks_.back().capacity || chunks_.back().capacity - start < size) {
+        if (!AppendChunk(size)) {
+            return nullptr;
+        }
+        start = 0;
+    }
+    Chunk& chunk = chunks_.back();
+    chunk.used = start + size;
+    return static_cast<void*>(chunk.data + start);
+}
+
+bool MemAllocator::AppendChunk(size_t minSize)
+{
+    size_t base = 0;
+    size_t capacity = chunkSize_;
+    if (!chunks_.empty()) {
+        const Chunk& last = chunks_.back();
+        // Pad the base of the new block, so the alignment of offsets matches the flattened buffer.
+        base = last.base + AlignUp(last.used, ALIGN_SIZE);
+        capacity = std::max(chunkSize_, std::min(last.capacity * MEMORY_EXPANSION_FACTOR, MAX_CHUNK_SIZE));
+    }
+    capacity = std::max(capacity, AlignUp(minSize, ALIGN_SIZE));
+    if (base > MEM_SIZE_MAX - capacity) {
+        return false;
+    }
+    char* data = new(std::nothrow) char[capacity];
+    if (!data) {
+        return false;
+    }
+    chunks_.push_back({ data, capacity, 0, base });
+    return true;
+}
+
+const MemAllocator::Chunk* MemAllocator::FindChunk(size_t offset) const
+{
+    auto iter = std::upper_bound(chunks_.begin(), chunks_.end(), offset,
+        [](size_t value, const Chunk& chunk) { return value < chunk.base; });
+    if (iter == chunks_.begin()) {
+        return nullptr;
+    }
+    return &(*(--iter));
+}
+
+bool MemAllocator::Flatten()
+{
+    if (!chunkMode_ || chunks_.size() <= 1) {
+        return true;
+    }
+    size_t totalSize = chunks_.back().base + chunks_.back().used;
+    if (totalSize > LARGE_MALLOC) {
+        HILOG_COMM_WARN("MemAllocator::Flatten this time malloc large memory, size:%{public}zu", totalSize);
+    }
+    char* flatData = new(std::nothrow) char[totalSize];
+    if (!flatData) {
+        return false;
+    }
+    for (size_t i = 0; i < chunks_.size(); i++) {
+        const Chunk& chunk = chunks_[i];
+        if (chunk.used > 0 && memcpy_s(flatData + chunk.base, totalSize - chunk.base, chunk.data, chunk.used)) {
+            delete[] flatData;
+            return false;
+        }
+        size_t end = chunk.base + chunk.used;
+        size_t nextBase = (i + 1 < chunks_.size()) ? chunks_[i + 1].base : totalSize;
+        if (nextBase > end) {
+            memset_s(flatData + end, nextBase - end, 0, nextBase - end);
+        }
+    }
+    ReleaseChunks();
+    chunks_.push_back({ flatData, totalSize, totalSize, 0 });
+    return true;
+}
+
+void MemAllocator::ReleaseChunks()
+{
+    for (auto& chunk : chunks_) {
+        delete[] chunk.data;
+    }
+    chunks_.clear();
+}
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
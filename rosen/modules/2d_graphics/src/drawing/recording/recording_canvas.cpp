@@ -122,6 +122,34 @@ void RecordingCanvas::DrawRoundRect(const RoundRect& roundRect)
     AddDrawOpImmediate<DrawRoundRectOpItem::ConstructorHandle>(roundRect);
 }
 
+void RecordingCanvas::DrawRects(const Rect rects[], size_t count)
+{
+    if (rects == nullptr || count == 0) {
+        return;
+    }
+    std::vector<Rect> rectVec(rects, rects + count);
+    if (!addDrawOpImmediate_) {
+        AddDrawOpDeferred<DrawRectsOpItem>(rectVec);
+        return;
+    }
+    auto rectsData = CmdListHelper::AddVectorToCmdList<Rect>(*cmdList_, rectVec);
+    AddDrawOpImmediate<DrawRectsOpItem::ConstructorHandle>(rectsData);
+}
+
+void RecordingCanvas::DrawRoundRects(const RoundRect roundRects[], size_t count)
+{
+    if (roundRects == nullptr || count == 0) {
+        return;
+    }
+    std::vector<RoundRect> roundRectVec(roundRects, roundRects + count);
+    if (!addDrawOpImmediate_) {
+        AddDrawOpDeferred<DrawRoundRectsOpItem>(roundRectVec);
+        return;
+    }
+    auto roundRectsData = CmdListHelper::AddVectorToCmdList<RoundRect>(*cmdList_, roundRectVec);
+    AddDrawOpImmediate<DrawRoundRectsOpItem::ConstructorHandle>(roundRectsData);
+}
+
 void RecordingCanvas::DrawNestedRoundRect(const RoundRect& outer, const RoundRect& inner)
 {
     if (!addDrawOpImmediate_) {
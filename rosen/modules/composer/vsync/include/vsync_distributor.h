@@ -175,6 +175,8 @@ public:
     uint64_t GetRealTimeOffsetOfDvsync(int64_t time, int64_t& preTime);
     VsyncError SetNativeDVSyncSwitch(bool dvsyncSwitch, const sptr<VSyncConnection> &connection);
     void PrintConnectionsStatus();
+    // post vsync to all due connections in one pass instead of connection by connection
+    void SetBatchPostEventEnabled(bool enabled);
     void FirstRequestVsync();
     void NotifyPackageEvent(const std::vector<std::string>& packageList);
     void HandleTouchEvent(int32_t touchStatus, int32_t touchCnt);
@@ -260,6 +262,15 @@ private:
         uint32_t generatorRefreshRate, int64_t vsyncCount, bool isDvsyncController);
     void ConnPostEvent(sptr<VSyncConnection> con, int64_t now, int64_t period, int64_t vsyncCount);
     void TriggerNext(sptr<VSyncConnection> con);
+    void TriggerNextLocked(const sptr<VSyncConnection> &con);
+    struct PendingVSyncEvent {
+        sptr<VSyncConnection> conn;
+        int64_t timestamp;
+        int64_t period;
+    };
+    void ConnectionsBatchPostEvent(std::vector<sptr<VSyncConnection>> &conns, int64_t now, int64_t period,
+        uint32_t generatorRefreshRate, int64_t vsyncCount, bool isDvsyncController);
+    std::atomic<bool> batchPostEvent_ = false;
     // Start of DVSync
     void DisableDVSyncController();
     void OnDVSyncEvent(int64_t now, int64_t period,
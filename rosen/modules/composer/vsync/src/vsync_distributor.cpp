@@ -39,6 +39,7 @@
 #endif
 
 #include "dvsync_lib_manager.h"
+#include "parameters.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -55,6 +56,7 @@ constexpr std::string_view URGENT_SELF_DRAWING = "UrgentSelfdrawing";
 constexpr int64_t MAX_SIZE_OF_DIGIT_NUM_FOR_PID = 8;
 constexpr uint32_t MAX_VSYNC_QUEUE_SIZE = 30;
 constexpr int32_t MAX_PID = 65536;
+const bool VSYNC_BATCH_POST_EVENT = system::GetBoolParameter("persist.sys.graphic.vsyncBatchPostEvent.enabled", false);
 }
 
 VSyncConnection::VSyncConnectionDeathRecipient::VSyncConnectionDeathRecipient(
@@ -437,6 +439,7 @@ VSyncDistributor::VSyncDistributor(sptr<VSyncController> controller, std::string
     if (name == DEFAULT_RS_NAME) {
         isRs_ = true;
     }
+    batchPostEvent_ = VSYNC_BATCH_POST_EVENT;
     (void)dvsyncParam;
 }
 
@@ -650,6 +653,11 @@ void VSyncDistributor::OnVSyncTrigger(int64_t now, int64_t period,
 void VSyncDistributor::TriggerNext(sptr<VSyncConnection> con)
 {
     std::lock_guard<std::mutex> locker(mutex_);
+    TriggerNextLocked(con);
+}
+
+void VSyncDistributor::TriggerNextLocked(const sptr<VSyncConnection> &con)
+{
     // Trigger VSync Again for LTPO
     con->triggerThisTime_ = true;
     // Exclude SetVSyncRate for LTPS
@@ -674,6 +682,10 @@ void VSyncDistributor::ConnPostEvent(sptr<VSyncConnection> con, int64_t now, int
 void VSyncDistributor::ConnectionsPostEvent(std::vector<sptr<VSyncConnection>> &conns, int64_t now, int64_t period,
     uint32_t generatorRefreshRate, int64_t vsyncCount, bool isDvsyncController)
 {
+    if (batchPostEvent_) {
+        ConnectionsBatchPostEvent(conns, now, period, generatorRefreshRate, vsyncCount, isDvsyncController);
+        return;
+    }
     for (uint32_t i = 0; i < conns.size(); i++) {
         int64_t actualPeriod = period;
         int64_t timestamp = now;
@@ -698,6 +710,69 @@ void VSyncDistributor::ConnectionsPostEvent(std::vector<sptr<VSyncConnection>> &
     }
 }
 
+void VSyncDistributor::ConnectionsBatchPostEvent(std::vector<sptr<VSyncConnection>> &conns, int64_t now,
+    int64_t period, uint32_t generatorRefreshRate, int64_t vsyncCount, bool isDvsyncController)
+{
+    RS_TRACE_NAME_FMT("ConnectionsBatchPostEvent conns:%zu", conns.size());
+    std::vector<PendingVSyncEvent> events;
+    events.reserve(conns.size());
+    {
+        // the rate divisors of this tick are computed for every connection under one lock
+        std::lock_guard<std::mutex> locker(mutex_);
+        for (auto &conn : conns) {
+            int64_t actualPeriod = period;
+            if (!isDvsyncController && vsyncMode_ == VSYNC_MODE_LTPS && conn->highPriorityState_ &&
+                conn->highPriorityRate_ > 0) {
+                actualPeriod = period * conn->highPriorityRate_;
+            } else if (!isDvsyncController && (generatorRefreshRate > 0) && (conn->refreshRate_ > 0) &&
+                (generatorRefreshRate % conn->refreshRate_ == 0)) {
+                actualPeriod = period * static_cast<int64_t>(generatorRefreshRate / conn->refreshRate_);
+            }
+            events.push_back({ conn, now, actualPeriod });
+        }
+    }
+
+    std::vector<sptr<VSyncConnection>> triggerNextConns;
+    std::vector<sptr<VSyncConnection>> deadConns;
+    for (auto &event : events) {
+        // Start of DVSync
+        if (DVSyncCheckSkipAndUpdateTs(event.conn, event.timestamp)) {
+            triggerNextConns.push_back(event.conn);
+            continue;
+        }
+        // End of DVSync
+        if (!event.conn->CheckIsReadyByTime(event.timestamp)) {
+            RS_TRACE_NAME_FMT("conn name=%s, do not post this vsync(curtime=%" PRId64 ")",
+                event.conn->info_.name_.c_str(), event.timestamp);
+            continue;
+        }
+        DVSyncLibManager::Instance().SetAppRequestedStatus(event.conn, false);
+        int32_t ret = event.conn->PostEvent(event.timestamp, event.period, vsyncCount);
+        VLOGD("Distributor name: %{public}s, Conn name: %{public}s, ret: %{public}d",
+            name_.c_str(), event.conn->info_.name_.c_str(), ret);
+        if (ret == 0 || ret == ERRNO_OTHER) {
+            deadConns.push_back(event.conn);
+        } else if (ret == ERRNO_EAGAIN) {
+            triggerNextConns.push_back(event.conn);
+        }
+    }
+
+    if (!triggerNextConns.empty()) {
+        std::lock_guard<std::mutex> locker(mutex_);
+        for (auto &conn : triggerNextConns) {
+            TriggerNextLocked(conn);
+        }
+    }
+    for (auto &conn : deadConns) {
+        RemoveConnection(conn);
+    }
+}
+
+void VSyncDistributor::SetBatchPostEventEnabled(bool enabled)
+{
+    batchPostEvent_ = enabled;
+}
+
 void VSyncDistributor::ComputeActualPeriod(sptr<VSyncConnection> &con, int64_t period, int64_t &actualPeriod,
     bool isDvsyncController)
 {
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <array>
+#include <gtest/gtest.h>
+#include "vsync_distributor.h"
+#include "vsync_controller.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int64_t PERIOD = 8333333; // 120Hz in ns
+constexpr uint32_t GENERATOR_REFRESH_RATE = 120;
+constexpr uint32_t CONN_REFRESH_RATES[] = { 120, 60, 30, 0 };
+constexpr uint32_t FANOUT_CONNECTION_COUNT = 200;
+constexpr uint32_t FANOUT_TICK_COUNT = 30;
+constexpr uint32_t JITTER_TICK_COUNT = 300;
+
+// events received by every connection, per tick, -1 for a connection that received nothing
+using FanoutEvents = std::vector<std::vector<std::array<int64_t, 3>>>;
+}
+
+class VSyncDistributorFanoutTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+
+    static std::vector<sptr<VSyncConnection>> CreateConnections(uint32_t count);
+    static bool ReceiveEvent(const sptr<VSyncConnection>& conn, int64_t (&data)[3]);
+    static FanoutEvents RunFanout(bool batch, std::vector<sptr<VSyncConnection>>& conns,
+        uint32_t tickCount = FANOUT_TICK_COUNT);
+
+    static inline sptr<VSyncGenerator> vsyncGenerator = nullptr;
+    static inline sptr<VSyncController> vsyncController = nullptr;
+    static inline sptr<VSyncDistributor> vsyncDistributor = nullptr;
+};
+
+void VSyncDistributorFanoutTest::SetUpTestCase()
+{
+    vsyncGenerator = CreateVSyncGenerator();
+    vsyncController = new VSyncController(vsyncGenerator, 0);
+    vsyncDistributor = new VSyncDistributor(vsyncController, "VSyncFanout");
+}
+
+void VSyncDistributorFanoutTest::TearDownTestCase()
+{
+    vsyncDistributor = nullptr;
+    vsyncController = nullptr;
+    vsyncGenerator = nullptr;
+    DestroyVSyncGenerator();
+}
+
+std::vector<sptr<VSyncConnection>> VSyncDistributorFanoutTest::CreateConnections(uint32_t count)
+{
+    std::vector<sptr<VSyncConnection>> conns;
+    for (uint32_t i = 0; i < count; i++) {
+        sptr<VSyncConnection> conn = new VSyncConnection(vsyncDistributor, "fanout" + std::to_string(i));
+        conn->refreshRate_ = CONN_REFRESH_RATES[i % std::size(CONN_REFRESH_RATES)];
+        conns.push_back(conn);
+    }
+    return conns;
+}
+
+bool VSyncDistributorFanoutTest::ReceiveEvent(const sptr<VSyncConnection>& conn, int64_t (&data)[3])
+{
+    return conn->socketPair_ != nullptr && conn->socketPair_->ReceiveData(data, sizeof(data)) > 0;
+}
+
+FanoutEvents VSyncDistributorFanoutTest::RunFanout(bool batch, std::vector<sptr<VSyncConnection>>& conns,
+    uint32_t tickCount)
+{
+    vsyncDistributor->SetBatchPostEventEnabled(batch);
+    FanoutEvents events(tickCount);
+    for (uint32_t tick = 0; tick < tickCount; tick++) {
+        int64_t now = static_cast<int64_t>(tick + 1) * PERIOD;
+        vsyncDistributor->ConnectionsPostEvent(conns, now, PERIOD, GENERATOR_REFRESH_RATE, tick, false);
+        for (auto& conn : conns) {
+            int64_t data[3] = { -1, -1, -1 };
+            ReceiveEvent(conn, data);
+            events[tick].push_back({ data[0], data[1], data[2] });
+        }
+    }
+    return events;
+}
+
+namespace {
+/*
+* Function: BatchPostEvent001
+* Type: Function
+* Rank: Important(2)
+* EnvConditions: N/A
+* CaseDescription: 1. post one tick to connections of different refresh rates in batch mode
+*                  2. check every connection receives the same event as in the per-connection mode
+ */
+HWTEST_F(VSyncDistributorFanoutTest, BatchPostEvent001, Function | MediumTest| Level3)
+{
+    constexpr int64_t now = 1000000000;
+    constexpr int64_t vsyncCount = 7;
+    auto conns = CreateConnections(std::size(CONN_REFRESH_RATES));
+    for (bool batch : { false, true }) {
+        vsyncDistributor->SetBatchPostEventEnabled(batch);
+        vsyncDistributor->ConnectionsPostEvent(conns, now, PERIOD, GENERATOR_REFRESH_RATE, vsyncCount, false);
+        for (auto& conn : conns) {
+            int64_t data[3] = { 0 };
+            ASSERT_TRUE(ReceiveEvent(conn, data));
+            int64_t divisor = conn->refreshRate_ > 0 ? GENERATOR_REFRESH_RATE / conn->refreshRate_ : 1;
+            EXPECT_EQ(data[0], now);
+            EXPECT_EQ(data[1], PERIOD * divisor);
+            EXPECT_EQ(data[2], vsyncCount);
+        }
+    }
+    vsyncDistributor->SetBatchPostEventEnabled(false);
+}
+
+/*
+* Function: BatchPostEvent002
+* Type: Function
+* Rank: Important(2)
+* EnvConditions: N/A
+* CaseDescription: 1. post one tick in batch mode to a high priority connection and a dead connection
+*                  2. check the high priority period is used and the dead connection is removed
+ */
+HWTEST_F(VSyncDistributorFanoutTest, BatchPostEvent002, Function | MediumTest| Level3)
+{
+    constexpr int64_t now = 1000000000;
+    constexpr int32_t highPriorityRate = 3;
+    auto conns = CreateConnections(2);
+    conns[0]->highPriorityState_ = true;
+    conns[0]->highPriorityRate_ = highPriorityRate;
+    ASSERT_EQ(vsyncDistributor->AddConnection(conns[1]), VSYNC_ERROR_OK);
+    conns[1]->socketPair_ = nullptr;
+
+    vsyncDistributor->SetBatchPostEventEnabled(true);
+    vsyncDistributor->ConnectionsPostEvent(conns, now, PERIOD, GENERATOR_REFRESH_RATE, 1, false);
+    int64_t data[3] = { 0 };
+    ASSERT_TRUE(ReceiveEvent(conns[0], data));
+    EXPECT_EQ(data[1], PERIOD * highPriorityRate);
+    EXPECT_EQ(vsyncDistributor->RemoveConnection(conns[1]), VSYNC_ERROR_INVALID_ARGUMENTS);
+    vsyncDistributor->SetBatchPostEventEnabled(false);
+}
+
+/*
+* Function: BatchPostEvent003
+* Type: Function
+* Rank: Important(2)
+* EnvConditions: N/A
+* CaseDescription: 1. simulate hundreds of connections and post vsync ticks in both fan-out modes
+*                  2. check every connection receives the same event on every tick in both modes
+ */
+HWTEST_F(VSyncDistributorFanoutTest, BatchPostEvent003, Function | MediumTest| Level3)
+{
+    auto conns = CreateConnections(FANOUT_CONNECTION_COUNT);
+    auto single = RunFanout(false, conns);
+    auto batch = RunFanout(true, conns);
+    vsyncDistributor->SetBatchPostEventEnabled(false);
+    ASSERT_EQ(single.size(), batch.size());
+    for (uint32_t tick = 0; tick < FANOUT_TICK_COUNT; tick++) {
+        ASSERT_EQ(single[tick].size(), FANOUT_CONNECTION_COUNT);
+        ASSERT_EQ(batch[tick].size(), FANOUT_CONNECTION_COUNT);
+        for (uint32_t i = 0; i < FANOUT_CONNECTION_COUNT; i++) {
+            EXPECT_EQ(single[tick][i][0], static_cast<int64_t>(tick + 1) * PERIOD);
+            EXPECT_EQ(batch[tick][i], single[tick][i]);
+        }
+    }
+}
+
+/*
+* Function: BatchPostEventPerf001
+* Type: Performance
+* Rank: Important(2)
+* EnvConditions: N/A
+* CaseDescription: 1. post a few seconds of vsync ticks to hundreds of connections in both fan-out modes
+*                  2. check no connection sees jitter: every tick arrives on its own timestamp with a steady
+*                     period and count, and the batch mode cadence matches the per-connection mode
+ */
+HWTEST_F(VSyncDistributorFanoutTest, BatchPostEventPerf001, Function | MediumTest| Level3)
+{
+    auto conns = CreateConnections(FANOUT_CONNECTION_COUNT);
+    auto single = RunFanout(false, conns, JITTER_TICK_COUNT);
+    auto batch = RunFanout(true, conns, JITTER_TICK_COUNT);
+    vsyncDistributor->SetBatchPostEventEnabled(false);
+    ASSERT_EQ(batch.size(), JITTER_TICK_COUNT);
+    ASSERT_EQ(single.size(), JITTER_TICK_COUNT);
+    for (uint32_t tick = 1; tick < JITTER_TICK_COUNT; tick++) {
+        ASSERT_EQ(batch[tick].size(), FANOUT_CONNECTION_COUNT);
+        for (uint32_t i = 0; i < FANOUT_CONNECTION_COUNT; i++) {
+            EXPECT_EQ(batch[tick][i][0] - batch[tick - 1][i][0], PERIOD);
+            EXPECT_EQ(batch[tick][i][1], batch[tick - 1][i][1]);
+            EXPECT_EQ(batch[tick][i][2] - batch[tick - 1][i][2], 1);
+            EXPECT_EQ(batch[tick][i], single[tick][i]);
+        }
+    }
+}
+} // namespace
+} // namespace Rosen
+} // namespace OHOS
@@ -328,9 +328,6 @@ private:
     }; // VBox
 
 private:
-    static constexpr double RED_GRAY_RATIO = 0.299;
-    static constexpr double GREEN_GRAY_RATIO = 0.587;
-    static constexpr double BLUE_GRAY_RATIO = 0.114;
     static constexpr double RED_LUMINACE_RATIO = 0.2126;
     static constexpr double GREEN_LUMINACE_RATIO = 0.7152;
     static constexpr double BLUE_LUMINACE_RATIO = 0.0722;
@@ -343,6 +340,8 @@ private:
     static float NormalizeRgb(uint32_t val, const uint32_t& colorMax = RGB888_COLOR_MAX);
     static float CalcRelativeLum(uint32_t color, Media::PixelFormat format = Media::PixelFormat::RGBA_8888);
     float CalcContrastToWhite() const;
+    static void InitNormalizeTable(float* normalizeTable);
+    void CalcColorStats();
     std::vector<std::pair<uint32_t, uint32_t>> QuantizePixels(int colorNum);
     void SplitBoxes(std::priority_queue<VBox, std::vector<VBox>, std::less<VBox> > &queue, int maxSize);
     std::vector<std::pair<uint32_t, uint32_t>> GenerateAverageColors(std::priority_queue<VBox, \
@@ -20,6 +20,7 @@
 #include "hilog/log.h"
 #include "effect_utils.h"
 #include "common/rs_common_def.h"
+#include "render/rs_color_extract_kernel.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -46,8 +47,7 @@ ColorExtract::ColorExtract(std::shared_ptr<Media::PixelMap> pixmap)
     } else {
         InitColorValBy8888Color(pixmap, 0, 0, pixmap->GetWidth(), pixmap->GetHeight());
     }
-    grayMsd_ = CalcGrayMsd();
-    contrastToWhite_ = CalcContrastToWhite();
+    CalcColorStats();
     GetNFeatureColors(specifiedFeatureColorNum_);
 }
 
@@ -83,8 +83,7 @@ ColorExtract::ColorExtract(std::shared_ptr<Media::PixelMap> pixmap, double* coor
         InitColorValBy8888Color(pixmap, static_cast<uint32_t>(left), static_cast<uint32_t>(top),
             static_cast<uint32_t>(right), static_cast<uint32_t>(bottom));
     }
-    grayMsd_ = CalcGrayMsd();
-    contrastToWhite_ = CalcContrastToWhite();
+    CalcColorStats();
     GetNFeatureColors(specifiedFeatureColorNum_);
 }
 
@@ -309,7 +308,7 @@ uint8_t ColorExtract::Rgb2Gray(uint32_t color, Media::PixelFormat format)
         g = GetARGB32ColorG(color);
         b = GetARGB32ColorB(color);
     }
-    return static_cast<uint8_t>(r * RED_GRAY_RATIO + g * GREEN_GRAY_RATIO + b * BLUE_GRAY_RATIO);
+    return RSColorExtractKernel::Gray(r, g, b);
 }
 
 uint32_t ColorExtract::CalcGrayMsd() const
@@ -317,18 +316,9 @@ uint32_t ColorExtract::CalcGrayMsd() const
     if (colorValLen_ == 0) {
         return 0;
     }
-    uint32_t *colorVal = const_cast<uint32_t *>(colorVal_.data());
-    long long int graySum = 0;
-    long long int grayVar = 0;
-    for (uint32_t i = 0; i < colorValLen_; i++) {
-        graySum += Rgb2Gray(colorVal[i]);
-    }
-    uint32_t grayAve = graySum / colorValLen_;
-    for (uint32_t i = 0; i < colorValLen_; i++) {
-        grayVar += pow(static_cast<long long int>(Rgb2Gray(colorVal[i])) - grayAve, 2); // 2 is square
-    }
-    grayVar /= colorValLen_;
-    return static_cast<uint32_t>(grayVar);
+    RSColorExtractKernel::ColorStats stats;
+    RSColorExtractKernel::AccumulateARGB32(colorVal_.data(), colorValLen_, nullptr, &stats);
+    return RSColorExtractKernel::CalcGrayMsd(stats.grayHist, colorValLen_);
 }
 
 float ColorExtract::NormalizeRgb(uint32_t val, const uint32_t& colorMax)
@@ -368,7 +358,7 @@ float ColorExtract::CalcRelativeLum(uint32_t color, Media::PixelFormat format)
         gInFloat = NormalizeRgb(g, RGB888_COLOR_MAX);
         bInFloat = NormalizeRgb(b, RGB888_COLOR_MAX);
     }
-    return rInFloat * RED_LUMINACE_RATIO + gInFloat * GREEN_LUMINACE_RATIO + bInFloat * BLUE_LUMINACE_RATIO;
+    return RSColorExtractKernel::RelativeLum(rInFloat, gInFloat, bInFloat);
 }
 
 float ColorExtract::CalcContrastToWhite() const
@@ -376,16 +366,46 @@ float ColorExtract::CalcContrastToWhite() const
     if (colorValLen_ == 0) {
         return 0.0;
     }
-    uint32_t *colorVal = const_cast<uint32_t *>(colorVal_.data());
-    float lightDegree = 0;
+    if (format_ != Media::PixelFormat::RGBA_1010102) {
+        float normalizeTable[RSColorExtractKernel::CHANNEL_LEVEL_NUM];
+        InitNormalizeTable(normalizeTable);
+        RSColorExtractKernel::ColorStats stats;
+        RSColorExtractKernel::AccumulateARGB32(colorVal_.data(), colorValLen_, nullptr, &stats, normalizeTable);
+        return RSColorExtractKernel::CalcContrastToWhite(stats.luminanceSum, colorValLen_);
+    }
     float luminanceSum = 0;
     for (uint32_t i = 0; i < colorValLen_; i++) {
-        luminanceSum += CalcRelativeLum(colorVal[i], format_);
+        luminanceSum += CalcRelativeLum(colorVal_[i], format_);
     }
-    float luminanceAve = luminanceSum / colorValLen_;
-     // 0.05 is used to ensure denominator is not 0;
-    lightDegree = (1 + 0.05) / (luminanceAve + 0.05);
-    return lightDegree;
+    return RSColorExtractKernel::CalcContrastToWhite(luminanceSum, colorValLen_);
+}
+
+void ColorExtract::InitNormalizeTable(float* normalizeTable)
+{
+    // NormalizeRgb costs a pow per channel, look it up by channel level instead
+    for (uint32_t level = 0; level < RSColorExtractKernel::CHANNEL_LEVEL_NUM; level++) {
+        normalizeTable[level] = NormalizeRgb(level, RGB888_COLOR_MAX);
+    }
+}
+
+void ColorExtract::CalcColorStats()
+{
+    if (colorValLen_ == 0) {
+        return;
+    }
+    if (format_ == Media::PixelFormat::RGBA_1010102) {
+        grayMsd_ = CalcGrayMsd();
+        contrastToWhite_ = CalcContrastToWhite();
+        return;
+    }
+    // gray, luminance and the quantized histogram of 8888 pixels are collected in a single pass
+    float normalizeTable[RSColorExtractKernel::CHANNEL_LEVEL_NUM];
+    InitNormalizeTable(normalizeTable);
+    hist_.assign(RSColorExtractKernel::QUANTIZED_HIST_LEN, 0);
+    RSColorExtractKernel::ColorStats stats;
+    RSColorExtractKernel::AccumulateARGB32(colorVal_.data(), colorValLen_, hist_.data(), &stats, normalizeTable);
+    grayMsd_ = RSColorExtractKernel::CalcGrayMsd(stats.grayHist, colorValLen_);
+    contrastToWhite_ = RSColorExtractKernel::CalcContrastToWhite(stats.luminanceSum, colorValLen_);
 }
 
 void ColorExtract::GetNFeatureColors(int colorNum)
@@ -395,19 +415,19 @@ void ColorExtract::GetNFeatureColors(int colorNum)
     }
     uint32_t *colorVal = const_cast<uint32_t *>(colorVal_.data());
     uint32_t histLen = (1 << (QUANTIZE_WORD_WIDTH * 3));
-    hist_.resize(histLen);
-    uint32_t *hist = hist_.data();
-    if (format_ == Media::PixelFormat::RGBA_1010102) {
-        for (uint32_t i = 0; i < colorValLen_; i++) {
-            uint32_t quantizedColor = QuantizeFromRGB101010(colorVal[i]);
-            hist[quantizedColor]++;
-        }
-    } else {
-        for (uint32_t i = 0; i < colorValLen_; i++) {
-            uint32_t quantizedColor = QuantizeFromRGB888(colorVal[i]);
-            hist[quantizedColor]++;
+    // the histogram of 8888 pixels is already built by CalcColorStats
+    if (hist_.empty()) {
+        hist_.resize(histLen);
+        if (format_ == Media::PixelFormat::RGBA_1010102) {
+            for (uint32_t i = 0; i < colorValLen_; i++) {
+                uint32_t quantizedColor = QuantizeFromRGB101010(colorVal[i]);
+                hist_[quantizedColor]++;
+            }
+        } else {
+            RSColorExtractKernel::AccumulateARGB32(colorVal, colorValLen_, hist_.data(), nullptr);
         }
     }
+    uint32_t *hist = hist_.data();
 
     for (uint32_t color = 0; color < histLen; color++) {
         if (hist[color] > 0) {
@@ -2207,6 +2207,53 @@ HWTEST_F(ColorPickerUnittest, GetNFeatureColors, TestSize.Level1)
     EXPECT_EQ(pColorPicker->featureColors_.size(), 1); // Only one feature type
 }
 
+/**
+ * @tc.name: ColorExtract CalcColorStats
+ * @tc.desc: Test the single pass gray msd, contrast and histogram of 8888 pixels match the per-pixel scalar ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(ColorPickerUnittest, CalcColorStats, TestSize.Level1)
+{
+    constexpr int32_t width = 33; // 33: pixel num is not a multiple of the simd lanes
+    constexpr int32_t height = 31;
+    constexpr uint32_t colorStep = 2654435761u; // spread the colors over the whole range
+    Media::InitializationOptions opts;
+    opts.size.width = width;
+    opts.size.height = height;
+    opts.pixelFormat = PixelFormat::ARGB_8888;
+    opts.alphaType = AlphaType::IMAGE_ALPHA_TYPE_OPAQUE;
+    std::vector<uint32_t> colors(width * height);
+    for (uint32_t i = 0; i < colors.size(); i++) {
+        colors[i] = 0xFF000000 | ((i * colorStep) >> 8); // 8: keep the alpha opaque
+    }
+    std::shared_ptr<PixelMap> pixmap(PixelMap::Create(colors.data(), colors.size(), opts).release());
+    ASSERT_NE(pixmap, nullptr);
+    uint32_t errorCode = SUCCESS;
+    std::shared_ptr<ColorPicker> pColorPicker = ColorPicker::CreateColorPicker(pixmap, errorCode);
+    ASSERT_NE(pColorPicker, nullptr);
+    uint32_t len = pColorPicker->colorValLen_;
+    ASSERT_EQ(len, colors.size());
+
+    long long int graySum = 0;
+    float luminanceSum = 0;
+    std::vector<uint32_t> hist(1 << (ColorExtract::QUANTIZE_WORD_WIDTH * 3), 0); // 3: channels
+    for (uint32_t i = 0; i < len; i++) {
+        uint32_t color = pColorPicker->colorVal_[i];
+        graySum += ColorExtract::Rgb2Gray(color);
+        luminanceSum += ColorExtract::CalcRelativeLum(color);
+        hist[ColorExtract::QuantizeFromRGB888(color)]++;
+    }
+    uint32_t grayAve = graySum / len;
+    long long int grayVar = 0;
+    for (uint32_t i = 0; i < len; i++) {
+        grayVar += pow(static_cast<long long int>(ColorExtract::Rgb2Gray(pColorPicker->colorVal_[i])) - grayAve, 2);
+    }
+    float contrastToWhite = (1 + 0.05) / (luminanceSum / len + 0.05); // 0.05 is used to ensure denominator is not 0
+    EXPECT_EQ(pColorPicker->grayMsd_, static_cast<uint32_t>(grayVar / len));
+    EXPECT_EQ(pColorPicker->contrastToWhite_, contrastToWhite);
+    EXPECT_EQ(pColorPicker->hist_, hist);
+}
+
 /**
  * @tc.name: ColorExtract CreateColorExtract01
  * @tc.desc: Test ColorExtract CreateColorExtract01
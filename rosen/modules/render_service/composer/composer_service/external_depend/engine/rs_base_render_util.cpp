@@ -15,7 +15,10 @@
 
 #include "engine/rs_base_render_util.h"
 
+#include <cstring>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <parameters.h>
 #include <sys/stat.h>
 #include <sys/time.h>
@@ -31,6 +34,7 @@
 #include "drawable/rs_screen_render_node_drawable.h"
 #include "effect/color_filter.h"
 #include "effect/color_matrix.h"
+#include "ffrt.h"
 #include "include/utils/SkCamera.h"
 #include "params/rs_surface_render_params.h"
 #include "pipeline/rs_surface_handler.h"
@@ -45,6 +49,14 @@
 #include "utils/camera3d.h"
 #include "rs_profiler.h"
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RS_BASE_RENDER_UTIL_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define RS_BASE_RENDER_UTIL_SSE2
+#endif
+
 namespace OHOS {
 namespace Rosen {
 namespace {
@@ -77,6 +89,33 @@ const uint32_t STUB_PIXEL_FMT_RGBA_16161616 = 0X7fff0001;
 const uint32_t STUB_PIXEL_FMT_RGBA_1010102 = 0X7fff0002;
 constexpr uint32_t MATRIX_SIZE = 20; // colorMatrix size
 constexpr int BITMAP_DEPTH = 8;
+constexpr uint32_t CONVERT_MAX_TASK_NUM = 4;
+constexpr uint32_t YUV_CONVERT_MIN_ROWS_PER_TASK = 128;
+constexpr uint32_t GAMUT_CONVERT_MIN_PIXELS_PER_TASK = 128 * 1024;
+
+// Runs func(begin, end) over [0, count) in at most CONVERT_MAX_TASK_NUM bands of at least minBandSize, the first band
+// on the calling thread and the others as ffrt tasks, so small buffers do not pay for the task switches.
+template<typename Func>
+void ParallelForBands(uint32_t count, uint32_t minBandSize, const Func& func)
+{
+    uint32_t bandNum = std::clamp(count / std::max(minBandSize, 1u), 1u, CONVERT_MAX_TASK_NUM);
+    uint32_t bandSize = (count + bandNum - 1) / bandNum;
+    std::array<uint8_t, CONVERT_MAX_TASK_NUM> bandTags {}; // addresses the band tasks output, to wait for them
+    std::vector<ffrt::dependence> bandDeps;
+    for (uint32_t band = 1; band < bandNum; band++) {
+        uint32_t begin = band * bandSize;
+        uint32_t end = std::min(count, begin + bandSize);
+        if (begin >= end) {
+            break;
+        }
+        ffrt::submit([&func, begin, end]() { func(begin, end); }, {}, { &bandTags[band] });
+        bandDeps.emplace_back(&bandTags[band]);
+    }
+    func(0, std::min(count, bandSize));
+    if (!bandDeps.empty()) {
+        ffrt::wait(bandDeps);
+    }
+}
 
 inline constexpr float PassThrough(float v)
 {
@@ -393,6 +432,27 @@ public:
         return ApplyTransForm(FromLinear(xyzToRgb_ * xyz), clamper_);
     }
 
+    float ToLinear(float val) const
+    {
+        return transEOTF_(val);
+    }
+
+    // same as XYZToRGB for one channel of a linear value
+    float FromLinearClamped(float val) const
+    {
+        return clamper_(transOETF_(val));
+    }
+
+    const Matrix3f& GetRGBToXYZ() const
+    {
+        return rgbToXyz_;
+    }
+
+    const Matrix3f& GetXYZToRGB() const
+    {
+        return xyzToRgb_;
+    }
+
 private:
     Matrix3f rgbToXyz_;
     Matrix3f xyzToRgb_;
@@ -668,6 +728,203 @@ Offset ConvertColorGamut(uint8_t* dst, uint8_t* src, int32_t pixelFormat, Simple
     return len;
 }
 
+constexpr uint32_t CHANNEL_LEVEL_NUM = 256;
+constexpr uint32_t GAMUT_BLOCK_SIZE = 64;
+constexpr uint32_t GAMUT_ENCODE_INDEX_SIZE = 4096;
+constexpr float GAMUT_ENCODE_SEARCH_LIMIT = 2.0f; // linear values above 1 are all clamped to the max code
+
+struct GamutPixelLayout {
+    uint8_t bytesPerPixel = 4;
+    uint8_t redIndex = 0;
+    uint8_t blueIndex = 2;
+    bool hasAlpha = true;
+};
+
+// the 8 bit formats of RGBUintToFloat
+bool GetGamutPixelLayout(int32_t pixelFormat, GamutPixelLayout& layout)
+{
+    switch (static_cast<GraphicPixelFormat>(pixelFormat)) {
+        case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_RGBX_8888:
+        case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_RGBA_8888:
+            layout = { 4, 0, 2, true }; // 4 bytes per pixel, R: 0, B: 2
+            return true;
+        case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_RGB_888:
+            layout = { 3, 0, 2, false }; // 3 bytes per pixel, R: 0, B: 2
+            return true;
+        case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_BGRX_8888:
+        case GraphicPixelFormat::GRAPHIC_PIXEL_FMT_BGRA_8888:
+            layout = { 4, 2, 0, true }; // 4 bytes per pixel, R: 2, B: 0
+            return true;
+        default:
+            return false;
+    }
+}
+
+inline uint32_t FloatToBits(float val)
+{
+    uint32_t bits = 0;
+    std::memcpy(&bits, &val, sizeof(bits));
+    return bits;
+}
+
+inline float BitsToFloat(uint32_t bits)
+{
+    float val = 0.0f;
+    std::memcpy(&val, &bits, sizeof(val));
+    return val;
+}
+
+/*
+ * Table driven ConvertColorGamut for 8 bit channels. The source transfer is a table of the 256 channel levels and
+ * the destination transfer and quantization are folded into the smallest linear value of each output code, found
+ * through a coarse index and a binary search. The matrices are the ones of the color spaces applied in the same
+ * order, 4 pixels at a time, so the output equals ConvertColorGamut except for values that round to the other side
+ * of a code boundary, at most one code off.
+ */
+class GamutConvertTable {
+public:
+    GamutConvertTable(const SimpleColorSpace& srcColorSpace, const SimpleColorSpace& dstColorSpace)
+        : srcToXyz_(srcColorSpace.GetRGBToXYZ()), xyzToDst_(dstColorSpace.GetXYZToRGB())
+    {
+        for (uint32_t val = 0; val < CHANNEL_LEVEL_NUM; val++) {
+            decode_[val] = srcColorSpace.ToLinear(RGBUint8ToFloat(static_cast<uint8_t>(val)));
+        }
+        // the encoding is monotonic and the bit patterns of positive floats sort like their values, so bisect them
+        codeStart_[0] = 0.0f;
+        uint32_t low = 0;
+        for (uint32_t code = 1; code < CHANNEL_LEVEL_NUM; code++) {
+            uint32_t high = FloatToBits(GAMUT_ENCODE_SEARCH_LIMIT);
+            while (low < high) {
+                uint32_t mid = low + (high - low) / 2;
+                if (RGBFloatToUint8(dstColorSpace.FromLinearClamped(BitsToFloat(mid))) >= code) {
+                    high = mid;
+                } else {
+                    low = mid + 1;
+                }
+            }
+            codeStart_[code] = BitsToFloat(low);
+        }
+        codeStart_[CHANNEL_LEVEL_NUM] = std::numeric_limits<float>::infinity();
+        uint32_t code = 0;
+        for (uint32_t index = 0; index <= GAMUT_ENCODE_INDEX_SIZE; index++) {
+            float linear = static_cast<float>(index) / GAMUT_ENCODE_INDEX_SIZE;
+            while (code + 1 < CHANNEL_LEVEL_NUM && codeStart_[code + 1] <= linear) {
+                code++;
+            }
+            indexCode_[index] = static_cast<uint8_t>(code);
+        }
+    }
+
+    void ConvertPixels(uint8_t* dst, const uint8_t* src, uint32_t pixelCount, const GamutPixelLayout& layout) const
+    {
+        alignas(16) float red[GAMUT_BLOCK_SIZE];
+        alignas(16) float green[GAMUT_BLOCK_SIZE];
+        alignas(16) float blue[GAMUT_BLOCK_SIZE];
+        for (uint32_t start = 0; start < pixelCount; start += GAMUT_BLOCK_SIZE) {
+            uint32_t count = std::min(GAMUT_BLOCK_SIZE, pixelCount - start);
+            const uint8_t* srcPixel = src + static_cast<size_t>(start) * layout.bytesPerPixel;
+            for (uint32_t i = 0; i < count; i++, srcPixel += layout.bytesPerPixel) {
+                red[i] = decode_[srcPixel[layout.redIndex]];
+                green[i] = decode_[srcPixel[1]];
+                blue[i] = decode_[srcPixel[layout.blueIndex]];
+            }
+            Transform(srcToXyz_, red, green, blue, count);
+            Transform(xyzToDst_, red, green, blue, count);
+            srcPixel = src + static_cast<size_t>(start) * layout.bytesPerPixel;
+            uint8_t* dstPixel = dst + static_cast<size_t>(start) * layout.bytesPerPixel;
+            for (uint32_t i = 0; i < count; i++, srcPixel += layout.bytesPerPixel, dstPixel += layout.bytesPerPixel) {
+                dstPixel[layout.redIndex] = Encode(red[i]);
+                dstPixel[1] = Encode(green[i]);
+                dstPixel[layout.blueIndex] = Encode(blue[i]);
+                if (layout.hasAlpha) {
+                    dstPixel[3] = srcPixel[3]; // 3: alpha is copied
+                }
+            }
+        }
+    }
+
+private:
+    // x, y and z are transformed in place, the sums are in the order of Matrix3f::operator*
+    static void Transform(const Matrix3f& matrix, float* x, float* y, float* z, uint32_t count)
+    {
+        const float* m = matrix.GetConstData();
+        uint32_t i = 0;
+#if defined(RS_BASE_RENDER_UTIL_NEON)
+        constexpr uint32_t laneNum = 4;
+        for (; i + laneNum <= count; i += laneNum) {
+            float32x4_t vx = vld1q_f32(x + i);
+            float32x4_t vy = vld1q_f32(y + i);
+            float32x4_t vz = vld1q_f32(z + i);
+            // column major, 0 3 6 is the first row
+            vst1q_f32(x + i, vaddq_f32(vaddq_f32(vmulq_n_f32(vx, m[0]), vmulq_n_f32(vy, m[3])),
+                vmulq_n_f32(vz, m[6])));
+            vst1q_f32(y + i, vaddq_f32(vaddq_f32(vmulq_n_f32(vx, m[1]), vmulq_n_f32(vy, m[4])),
+                vmulq_n_f32(vz, m[7])));
+            vst1q_f32(z + i, vaddq_f32(vaddq_f32(vmulq_n_f32(vx, m[2]), vmulq_n_f32(vy, m[5])),
+                vmulq_n_f32(vz, m[8])));
+        }
+#elif defined(RS_BASE_RENDER_UTIL_SSE2)
+        constexpr uint32_t laneNum = 4;
+        for (; i + laneNum <= count; i += laneNum) {
+            __m128 vx = _mm_load_ps(x + i);
+            __m128 vy = _mm_load_ps(y + i);
+            __m128 vz = _mm_load_ps(z + i);
+            // column major, 0 3 6 is the first row
+            _mm_store_ps(x + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[0]), vx),
+                _mm_mul_ps(_mm_set1_ps(m[3]), vy)), _mm_mul_ps(_mm_set1_ps(m[6]), vz)));
+            _mm_store_ps(y + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[1]), vx),
+                _mm_mul_ps(_mm_set1_ps(m[4]), vy)), _mm_mul_ps(_mm_set1_ps(m[7]), vz)));
+            _mm_store_ps(z + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[2]), vx),
+                _mm_mul_ps(_mm_set1_ps(m[5]), vy)), _mm_mul_ps(_mm_set1_ps(m[8]), vz)));
+        }
+#endif
+        for (; i < count; i++) {
+            Vector3f out = matrix * Vector3f { x[i], y[i], z[i] };
+            x[i] = out.x_;
+            y[i] = out.y_;
+            z[i] = out.z_;
+        }
+    }
+
+    uint8_t Encode(float linear) const
+    {
+        // negative and NaN values go to 0 like Saturate does, without branches since they are frequent
+        linear = linear > 0.0f ? linear : 0.0f;
+        uint32_t index = std::min(static_cast<uint32_t>(std::min(linear, GAMUT_ENCODE_SEARCH_LIMIT) *
+            GAMUT_ENCODE_INDEX_SIZE), GAMUT_ENCODE_INDEX_SIZE);
+        uint32_t low = indexCode_[index];
+        uint32_t high = index < GAMUT_ENCODE_INDEX_SIZE ? indexCode_[index + 1] : CHANNEL_LEVEL_NUM - 1;
+        // the code is the number of code starts not above linear, the ones up to low are and mostly high <= low + 1
+        uint32_t code = low + (linear >= codeStart_[low + 1] ? 1 : 0);
+        while (code < high && linear >= codeStart_[code + 1]) {
+            code++;
+        }
+        return static_cast<uint8_t>(code);
+    }
+
+    Matrix3f srcToXyz_;
+    Matrix3f xyzToDst_;
+    std::array<float, CHANNEL_LEVEL_NUM> decode_ {};
+    // codeStart_[CHANNEL_LEVEL_NUM] is a sentinel no value reaches
+    std::array<float, CHANNEL_LEVEL_NUM + 1> codeStart_ {};
+    std::array<uint8_t, GAMUT_ENCODE_INDEX_SIZE + 1> indexCode_ {};
+};
+
+// the color spaces are static, so are the tables between them
+const GamutConvertTable& GetGamutConvertTable(const SimpleColorSpace& srcColorSpace,
+    const SimpleColorSpace& dstColorSpace)
+{
+    static std::mutex tablesMutex;
+    static std::map<std::pair<const SimpleColorSpace*, const SimpleColorSpace*>,
+        std::unique_ptr<GamutConvertTable>> tables;
+    std::lock_guard<std::mutex> lock(tablesMutex);
+    auto& table = tables[{ &srcColorSpace, &dstColorSpace }];
+    if (table == nullptr) {
+        table = std::make_unique<GamutConvertTable>(srcColorSpace, dstColorSpace);
+    }
+    return *table;
+}
+
 bool ConvertBufferColorGamut(std::vector<uint8_t>& dstBuf, const sptr<OHOS::SurfaceBuffer>& srcBuf,
     GraphicColorGamut srcGamut, GraphicColorGamut dstGamut, const std::vector<GraphicHDRMetaData>& metaDatas)
 {
@@ -703,6 +960,17 @@ bool ConvertBufferColorGamut(std::vector<uint8_t>& dstBuf, const sptr<OHOS::Surf
     uint32_t offsetSrc = 0;
     auto& srcColorSpace = GetColorSpaceOfCertainGamut(srcGamut, metaDatas);
     auto& dstColorSpace = GetColorSpaceOfCertainGamut(dstGamut, metaDatas);
+    GamutPixelLayout layout;
+    if (GetGamutPixelLayout(pixelFormat, layout)) {
+        const auto& table = GetGamutConvertTable(srcColorSpace, dstColorSpace);
+        uint8_t* dstStart = dstBuf.data();
+        ParallelForBands(bufferSize / layout.bytesPerPixel, GAMUT_CONVERT_MIN_PIXELS_PER_TASK,
+            [&table, &layout, dstStart, srcStart](uint32_t begin, uint32_t end) {
+                size_t offset = static_cast<size_t>(begin) * layout.bytesPerPixel;
+                table.ConvertPixels(dstStart + offset, srcStart + offset, end - begin, layout);
+            });
+        return true;
+    }
     while (offsetSrc < bufferSize) {
         uint8_t* dst = &dstBuf[offsetDst];
         uint8_t* src = srcStart + offsetSrc;
@@ -769,6 +1037,78 @@ static int Table_fu2[256] = { -227, -226, -224, -222, -220, -219, -217, -215, -2
     182, 184, 186, 187, 189, 191, 193, 195, 196, 198, 200, 202, 203, 205, 207, 209, 211, 212, 214, 216, 218,
     219, 221, 223, 225 };
 
+constexpr int32_t YUV_LANE_NUM = 8;
+constexpr uint8_t YUV_ALPHA = 255;
+
+inline uint8_t ClampYUVChannel(int val)
+{
+    return static_cast<uint8_t>(std::clamp(val, 0, 255)); // 255 is upper threshold
+}
+
+/*
+ * Converts one row of NV21, or of NV12 when uFirst is set. The table lookups are done once per chroma pair into
+ * chromaDiff, 3 * ((width + 1) / 2) entries, then the additions and clamps run on 8 pixels at a time. The results
+ * are the same as looking the tables up per pixel.
+ */
+void ConvertYUV420SPRow(const uint8_t* yRow, const uint8_t* uvRow, uint8_t* rgbaRow, int32_t width, bool uFirst,
+    int16_t* chromaDiff)
+{
+    int32_t chromaWidth = (width + 1) / 2;
+    int16_t* rDiff = chromaDiff;
+    int16_t* invgDiff = chromaDiff + chromaWidth;
+    int16_t* bDiff = chromaDiff + chromaWidth * 2; // 2: the third plane
+    for (int32_t c = 0; c < chromaWidth; c++) {
+        int U = static_cast<int>(uvRow[c * 2 + (uFirst ? 0 : 1)]); // 2 bytes per chroma pair
+        int V = static_cast<int>(uvRow[c * 2 + (uFirst ? 1 : 0)]); // 2 bytes per chroma pair
+        rDiff[c] = static_cast<int16_t>(Table_fv1[V]);
+        invgDiff[c] = static_cast<int16_t>(Table_fu1[U] + Table_fv2[V]);
+        bDiff[c] = static_cast<int16_t>(Table_fu2[U]);
+    }
+    int32_t j = 0;
+#if defined(RS_BASE_RENDER_UTIL_NEON)
+    uint8x8_t alpha = vdup_n_u8(YUV_ALPHA);
+    for (; j + YUV_LANE_NUM <= width; j += YUV_LANE_NUM) {
+        int16x8_t Y = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(yRow + j)));
+        // each chroma diff covers 2 pixels
+        int16x4x2_t r = vzip_s16(vld1_s16(rDiff + j / 2), vld1_s16(rDiff + j / 2));
+        int16x4x2_t g = vzip_s16(vld1_s16(invgDiff + j / 2), vld1_s16(invgDiff + j / 2));
+        int16x4x2_t b = vzip_s16(vld1_s16(bDiff + j / 2), vld1_s16(bDiff + j / 2));
+        uint8x8x4_t rgba;
+        rgba.val[0] = vqmovun_s16(vaddq_s16(Y, vcombine_s16(r.val[0], r.val[1])));
+        rgba.val[1] = vqmovun_s16(vsubq_s16(Y, vcombine_s16(g.val[0], g.val[1])));
+        rgba.val[2] = vqmovun_s16(vaddq_s16(Y, vcombine_s16(b.val[0], b.val[1]))); // 2: blue
+        rgba.val[3] = alpha; // 3: alpha
+        vst4_u8(rgbaRow + j * COLOR_CHANNEL_COUNT, rgba);
+    }
+#elif defined(RS_BASE_RENDER_UTIL_SSE2)
+    __m128i zero = _mm_setzero_si128();
+    __m128i alpha = _mm_set1_epi8(static_cast<char>(YUV_ALPHA));
+    for (; j + YUV_LANE_NUM <= width; j += YUV_LANE_NUM) {
+        __m128i Y = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(yRow + j)), zero);
+        // each chroma diff covers 2 pixels
+        __m128i r = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(rDiff + j / 2));
+        __m128i g = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(invgDiff + j / 2));
+        __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(bDiff + j / 2));
+        r = _mm_add_epi16(Y, _mm_unpacklo_epi16(r, r));
+        g = _mm_sub_epi16(Y, _mm_unpacklo_epi16(g, g));
+        b = _mm_add_epi16(Y, _mm_unpacklo_epi16(b, b));
+        __m128i rg = _mm_unpacklo_epi8(_mm_packus_epi16(r, r), _mm_packus_epi16(g, g));
+        __m128i ba = _mm_unpacklo_epi8(_mm_packus_epi16(b, b), alpha);
+        __m128i* dst = reinterpret_cast<__m128i*>(rgbaRow + j * COLOR_CHANNEL_COUNT);
+        _mm_storeu_si128(dst, _mm_unpacklo_epi16(rg, ba));
+        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(rg, ba));
+    }
+#endif
+    for (; j < width; j++) {
+        int Y = static_cast<int>(yRow[j]);
+        uint8_t* rgba = rgbaRow + j * COLOR_CHANNEL_COUNT;
+        rgba[0] = ClampYUVChannel(Y + rDiff[j / 2]);
+        rgba[1] = ClampYUVChannel(Y - invgDiff[j / 2]);
+        rgba[2] = ClampYUVChannel(Y + bDiff[j / 2]); // 2 is index
+        rgba[3] = YUV_ALPHA; // 3 is index
+    }
+}
+
 bool ConvertYUV420SPToRGBA(std::vector<uint8_t>& rgbaBuf, const sptr<OHOS::SurfaceBuffer>& srcBuf)
 {
     if (srcBuf == nullptr || rgbaBuf.empty()) {
@@ -816,41 +1156,21 @@ bool ConvertYUV420SPToRGBA(std::vector<uint8_t>& rgbaBuf, const sptr<OHOS::Surfa
             bufferWidth, srcBuf->GetHeight(), bufferStride, bufferSize, totalLen);
         return false;
     }
-    uint8_t* ybase = src;
-    uint8_t* ubase = &src[len];
-
-    int rgb[3] = {0, 0, 0};
-    int idx = 0;
-    int rdif = 0;
-    int invgdif = 0;
-    int bdif = 0;
-    for (int i = 0; i < bufferHeight; i++) {
-        if (i >= srcBuf->GetHeight()) {
-            continue;
-        }
-        for (int j = 0; j < bufferWidth; j++) {
-            int Y = static_cast<int>(ybase[i * bufferStride + j]);
-            int U = static_cast<int>(ubase[i / 2 * bufferStride + (j / 2) * 2 + 1]);
-            int V = static_cast<int>(ubase[i / 2 * bufferStride + (j / 2) * 2]);
-            if (srcBuf->GetFormat() == GRAPHIC_PIXEL_FMT_YCBCR_420_SP) {
-                std::swap(U, V);
+    const uint8_t* ybase = src;
+    const uint8_t* ubase = &src[len];
+    bool uFirst = srcBuf->GetFormat() == GRAPHIC_PIXEL_FMT_YCBCR_420_SP;
+    // the rows of the height padding are not converted
+    int32_t rowCount = std::min(bufferHeight, srcBuf->GetHeight());
+    ParallelForBands(static_cast<uint32_t>(rowCount), YUV_CONVERT_MIN_ROWS_PER_TASK,
+        [ybase, ubase, rgbaDst, bufferWidth, bufferStride, uFirst](uint32_t begin, uint32_t end) {
+            std::vector<int16_t> chromaDiff(static_cast<size_t>((bufferWidth + 1) / 2) * 3); // 3 channels
+            for (uint32_t i = begin; i < end; i++) {
+                ConvertYUV420SPRow(ybase + static_cast<size_t>(i) * bufferStride,
+                    ubase + static_cast<size_t>(i / 2) * bufferStride,
+                    rgbaDst + static_cast<size_t>(i) * bufferWidth * COLOR_CHANNEL_COUNT, bufferWidth, uFirst,
+                    chromaDiff.data());
             }
-            rdif = Table_fv1[V];
-            invgdif = Table_fu1[U] + Table_fv2[V];
-            bdif = Table_fu2[U];
-
-            rgb[0] = Y + rdif;
-            rgb[1] = Y - invgdif;
-            rgb[2] = Y + bdif; // 2 is index
-
-            for (int k = 0; k < 3; k++) { // 3 is index
-                idx = (i * bufferWidth + j) * 4 + k; // 4 is color channel
-                rgbaDst[idx] = static_cast<uint8_t>(std::clamp(rgb[k], 0, 255)); // 255 is upper threshold
-            }
-            ++idx;
-            rgbaDst[idx] = 255; // 255 is upper threshold
-        }
-    }
+        });
     return true;
 }
 } // namespace Detail
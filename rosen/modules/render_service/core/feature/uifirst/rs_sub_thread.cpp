@@ -31,6 +31,7 @@
 #include "pipeline/render_thread/rs_uni_render_util.h"
 #include "pipeline/main_thread/rs_main_thread.h"
 #include "pipeline/rs_surface_render_node.h"
+#include "render/rs_filter_result_cache.h"
 #include "pipeline/main_thread/rs_uni_render_visitor.h"
 #include "render_context/new_render_context/render_context_gl.h"
 #include "rs_trace.h"
@@ -47,6 +48,7 @@ RSSubThread::~RSSubThread()
 {
     RS_LOGI("~RSSubThread():%{public}u", threadIndex_);
     PostSyncTask([this]() {
+        RSFilterResultCache::Instance().ClearContext(RSFilterResultCache::GetContextId(grContext_.get()));
         renderContext_->DestroyShareContext();
     });
 }
@@ -400,6 +402,7 @@ void RSSubThread::ResetGrContext()
     if (grContext_ == nullptr) {
         return;
     }
+    RSFilterResultCache::Instance().ClearContext(RSFilterResultCache::GetContextId(grContext_.get()));
     grContext_->FlushAndSubmit(true);
     grContext_->FreeGpuResources();
 }
@@ -409,6 +412,7 @@ void RSSubThread::ThreadSafetyReleaseTexture()
     if (grContext_ == nullptr) {
         return;
     }
+    RSFilterResultCache::Instance().ClearContext(RSFilterResultCache::GetContextId(grContext_.get()));
     grContext_->FreeGpuResources();
 }
 
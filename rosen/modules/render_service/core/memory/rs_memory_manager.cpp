@@ -49,6 +49,7 @@
 #include "feature_cfg/feature_param/extend_feature/mem_param.h"
 #include "feature_cfg/graphic_feature_param_manager.h"
 #include "memory/rs_tag_tracker.h"
+#include "render/rs_image_cache.h"
 #include "render/rs_typeface_cache.h"
 #include "pipeline/main_thread/rs_main_thread.h"
 #include "pipeline/rs_surface_render_node.h"
@@ -615,6 +616,7 @@ void MemoryManager::DumpRenderServiceMemory(DfxString& log, bool isLite)
 {
     log.AppendFormat("\n----------\nRenderService caches:\n");
     RSTypefaceCache::Instance().Dump(log);
+    RSImageCache::Instance().Dump(log);
     if (isLite) {
         MemoryTrack::Instance().DumpMemoryStatistics(log, FindGeoByIdLite, isLite);
         RenderServiceAllSurfaceDump(log);
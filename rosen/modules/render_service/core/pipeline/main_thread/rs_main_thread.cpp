@@ -130,6 +130,7 @@
 #include "property/rs_properties_painter.h"
 #include "property/rs_property_trace.h"
 #include "property/rs_spatial_effect_manager.h"
+#include "render/rs_filter_result_cache.h"
 #include "render/rs_image_cache.h"
 #include "render/rs_pixel_map_util.h"
 #include "render/rs_typeface_cache.h"
@@ -741,6 +742,7 @@ void RSMainThread::Init(const std::shared_ptr<AppExecFwk::EventHandler>& handler
     RSSystemProperties::WatchSystemProperty(DRAWING_CACHE_DFX, OnDrawingCacheDfxSwitchCallback, nullptr);
     RSOpincManager::Instance().SetOPIncSwitch(OPIncParam::IsOPIncEnable());
     RSUifirstManager::Instance().ReadUIFirstCcmParam();
+    RSImageCache::Instance().SetReleasedImageBudget(RSSystemProperties::GetReleasedImageCacheBudget());
     auto PostTaskProxy = [](RSTaskMessage::RSTask task, const std::string& name, int64_t delayTime,
         AppExecFwk::EventQueue::Priority priority) {
         RSMainThread::Instance()->PostTask(task, name, delayTime, priority);
@@ -4935,6 +4937,9 @@ void RSMainThread::DumpMem(std::unordered_set<std::u16string>& argSets, std::str
     });
 
     dumpString.append(log.GetString());
+    if (type.empty() || type == MEM_GPU_TYPE) {
+        RSFilterResultCache::Instance().Dump(dumpString);
+    }
     if (!isLite) {
         RSUniRenderThread::Instance().DumpVkImageInfo(dumpString);
     }
@@ -5685,6 +5690,7 @@ void RSMainThread::HandleOnTrim(Memory::SystemMemoryLevel level)
                 RS_TRACE_NAME_FMT("System is low memory, HandleOnTrim Enter level:%d", level);
                 switch (level) {
                     case Memory::SystemMemoryLevel::MEMORY_LEVEL_CRITICAL:
+                        RSImageCache::Instance().PurgeReleasedDrawingImages();
                         if (isUniRender_) {
 #ifdef RS_ENABLE_GPU
                             RSUniRenderThread::Instance().ClearMemoryCache(ClearMemoryMoment::LOW_MEMORY, true);
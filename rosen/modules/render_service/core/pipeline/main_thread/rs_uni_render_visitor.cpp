@@ -16,6 +16,7 @@
 #include "pipeline/main_thread/rs_uni_render_visitor.h"
 
 #include <memory>
+#include "ffrt_inner.h"
 #include "rs_trace.h"
 
 #include "common/rs_common_def.h"
@@ -130,6 +131,8 @@ constexpr float EPSILON_SCALE = 0.00001f;
 constexpr uint64_t INPUT_HWC_LAYERS = 3;
 constexpr int TRACE_LEVEL_PRINT_NODEID = 6;
 constexpr uint32_t BUFFER_AVAILABLE_TIMEOUT_FRAMES = 40;
+constexpr size_t MIN_PARALLEL_PREPARE_WINDOWS = 2;
+constexpr int WINDOW_PREPARE_MAX_CONCURRENCY = 3;
 
 std::string VisibleDataToString(const VisibleData& val)
 {
@@ -143,6 +146,58 @@ std::string VisibleDataToString(const VisibleData& val)
     return ss.str();
 }
 
+std::shared_ptr<ffrt::queue> GetWindowPrepareQueue()
+{
+    static auto windowPrepareQueue = std::make_shared<ffrt::queue>(ffrt::queue_concurrent, "RSWindowPrepare",
+        ffrt::queue_attr().qos(ffrt::qos_user_interactive).max_concurrency(WINDOW_PREPARE_MAX_CONCURRENCY));
+    return windowPrepareQueue;
+}
+
+// collect the top-level leash or main windows with dirty subtree, in z-order
+void CollectDirtyWindows(const RSRenderNode& node, std::vector<std::shared_ptr<RSRenderNode>>& windows)
+{
+    if (!node.GetIsFullChildrenListValid()) {
+        return;
+    }
+    for (const auto& child : *node.GetSortedChildren()) {
+        if (child == nullptr || !child->IsSubTreeDirty()) {
+            continue;
+        }
+        auto surfaceNode = RSBaseRenderNode::ReinterpretCast<RSSurfaceRenderNode>(child);
+        if (surfaceNode && surfaceNode->IsLeashOrMainWindow()) {
+            windows.emplace_back(child);
+            continue;
+        }
+        CollectDirtyWindows(*child, windows);
+    }
+}
+
+// Apply modifiers of the nodes in one window subtree which only touch themselves. Nodes of other types are left to
+// QuickPrepare, and ApplyModifiers of the applied nodes is a no-op there since their dirty types are reset.
+void ApplyModifiersOfWindowSubTree(const std::shared_ptr<RSRenderNode>& window,
+    std::vector<RSRenderNode::DeferredDirtyEvent>& events)
+{
+    RSRenderNode::SetDeferredDirtyEvents(&events);
+    std::vector<std::shared_ptr<RSRenderNode>> nodes = { window };
+    while (!nodes.empty()) {
+        auto node = std::move(nodes.back());
+        nodes.pop_back();
+        if (node->CanApplyModifiersInParallel()) {
+            node->ApplyModifiers();
+        } else if (!node->GetIsFullChildrenListValid()) {
+            continue;
+        }
+        if (!node->IsSubTreeDirty()) {
+            continue;
+        }
+        for (const auto& child : *node->GetSortedChildren()) {
+            if (child != nullptr) {
+                nodes.emplace_back(child);
+            }
+        }
+    }
+    RSRenderNode::SetDeferredDirtyEvents(nullptr);
+}
 } // namespace
 
 std::unordered_set<NodeId> RSUniRenderVisitor::allBlackList_;
@@ -179,6 +234,7 @@ RSUniRenderVisitor::RSUniRenderVisitor()
     isUIFirstDebugEnable_ = RSSystemProperties::GetUIFirstDebugEnabled();
     isCrossNodeOffscreenOn_ = RSSystemProperties::GetCrossNodeOffScreenStatus();
     isDumpRsTreeDetailEnabled_ = RSSystemProperties::GetDumpRsTreeDetailEnabled();
+    isParallelWindowPrepareEnabled_ = RSSystemProperties::GetParallelWindowPrepareEnabled();
     dynamicLayerSkipController_ = std::make_shared<RSDynamicLayerSkipController>();
 }
 
@@ -949,6 +1005,7 @@ void RSUniRenderVisitor::QuickPrepareLogicalDisplayRenderNode(RSLogicalDisplayRe
 
     hasAccumulatedClip_ = node.SetAccumulatedClipFlag(hasAccumulatedClip_);
     node.ClearAllHwcNodeAndFilterNode();
+    ApplyWindowModifiersInParallel(node);
     QuickPrepareChildren(node);
 
     PostPrepare(node, isParentPrepareInReverseOrder);
@@ -964,6 +1021,37 @@ void RSUniRenderVisitor::QuickPrepareLogicalDisplayRenderNode(RSLogicalDisplayRe
     node.RenderTraceDebug();
 }
 
+void RSUniRenderVisitor::ApplyWindowModifiersInParallel(RSLogicalDisplayRenderNode& node)
+{
+    if (!isParallelWindowPrepareEnabled_ || !node.IsSubTreeDirty()) {
+        return;
+    }
+    std::vector<std::shared_ptr<RSRenderNode>> windows;
+    CollectDirtyWindows(node, windows);
+    if (windows.size() < MIN_PARALLEL_PREPARE_WINDOWS) {
+        return;
+    }
+    RS_TRACE_NAME_FMT("RSUniRenderVisitor::ApplyWindowModifiersInParallel windows:%zu", windows.size());
+    auto queue = GetWindowPrepareQueue();
+    std::vector<std::vector<RSRenderNode::DeferredDirtyEvent>> events(windows.size());
+    std::vector<ffrt::task_handle> handles;
+    handles.reserve(windows.size() - 1);
+    for (size_t i = 1; i < windows.size(); ++i) {
+        handles.emplace_back(queue->submit_h([&windows, &events, i]() {
+                ApplyModifiersOfWindowSubTree(windows[i], events[i]);
+            }, ffrt::task_attr().name("RSWindowPrepare")
+                .priority(static_cast<ffrt_queue_priority_t>(ffrt_inner_queue_priority_immediate))));
+    }
+    ApplyModifiersOfWindowSubTree(windows[0], events[0]);
+    for (auto& handle : handles) {
+        queue->wait(handle);
+    }
+    // replay in z-order, geometry, dirty region, occlusion and hwc are still calculated by the serial prepare
+    for (auto& windowEvents : events) {
+        RSRenderNode::FlushDeferredDirtyEvents(windowEvents);
+    }
+}
+
 void RSUniRenderVisitor::CheckFilterCacheNeedForceClearOrSave(RSRenderNode& node)
 {
     if (!node.HasBlurFilter()) {
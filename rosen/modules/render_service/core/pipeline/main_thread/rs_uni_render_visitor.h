@@ -183,6 +183,8 @@ private:
     void CalculateOpaqueAndTransparentRegion(RSSurfaceRenderNode& node);
 
     void CheckFilterCacheNeedForceClearOrSave(RSRenderNode& node);
+    // apply modifiers of the dirty window subtrees under the display in parallel before they are prepared
+    void ApplyWindowModifiersInParallel(RSLogicalDisplayRenderNode& node);
     Occlusion::Region GetSurfaceTransparentFilterRegion(const RSSurfaceRenderNode& surfaceNode) const;
     void CollectTopOcclusionSurfacesInfo(RSSurfaceRenderNode& node, bool isParticipateInOcclusion);
     void PartialRenderOptionInit();
@@ -612,6 +614,8 @@ void ProcessGpuOfflineForTopLayer(
 
     // used for check whether anco has dimmer
     bool hasAncoDimmer_ = false;
+
+    bool isParallelWindowPrepareEnabled_ = false;
 };
 
 class RSSubTreePrepareController {
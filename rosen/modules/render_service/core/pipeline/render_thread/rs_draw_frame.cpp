@@ -15,9 +15,13 @@
 
 #include "rs_draw_frame.h"
 
+#include <algorithm>
+#include <chrono>
 #include <hitrace_meter.h>
 #include <parameters.h>
 
+#include "ffrt_inner.h"
+
 #include "rs_trace.h"
 
 #include "drawable/rs_canvas_drawing_render_node_drawable.h"
@@ -53,13 +57,39 @@ namespace Rosen {
 namespace {
     constexpr int RENDER_TIMEOUT = 2500; // 2500ms: render timeout threshold
     constexpr int RENDER_TIMEOUT_ABORT = 12; // 12: render 12 consecutive frames are too long
+    // below this many deferred nodes the task hand-off costs more than syncing the params on the calling thread
+    constexpr size_t MIN_PARALLEL_PARAMS_SYNC_NODES = 64;
+    constexpr size_t MIN_PARAMS_SYNC_CHUNK = 32;
+    constexpr size_t MAX_PARAMS_SYNC_TASKS = 4;
+    constexpr int PARAMS_SYNC_MAX_CONCURRENCY = 3; // the calling thread runs one more chunk itself
+
+    int64_t GetElapsedUs(const std::chrono::steady_clock::time_point& start)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+            .count();
+    }
 }
 RSDrawFrame::RSDrawFrame()
     : unirenderInstance_(RSUniRenderThread::Instance()),
     rsParallelType_(RSSystemParameters::GetRsParallelType())
-{}
+{
+    SetParallelParamsSyncEnabled(RSSystemProperties::GetParallelParamsSyncEnabled());
+}
+
+RSDrawFrame::~RSDrawFrame() noexcept
+{
+    paramsSyncQueue_ = nullptr;
+}
 
-RSDrawFrame::~RSDrawFrame() noexcept {}
+void RSDrawFrame::SetParallelParamsSyncEnabled(bool enabled)
+{
+    parallelParamsSyncEnabled_ = enabled;
+    if (enabled && paramsSyncQueue_ == nullptr) {
+        paramsSyncQueue_ = std::make_shared<ffrt::queue>(
+            ffrt::queue_concurrent, "RSParamsSync",
+            ffrt::queue_attr().qos(ffrt::qos_user_interactive).max_concurrency(PARAMS_SYNC_MAX_CONCURRENCY));
+    }
+}
 
 void RSDrawFrame::SetRenderThreadParams(std::unique_ptr<RSRenderThreadParams>& stagingRenderThreadParams)
 {
@@ -151,6 +181,12 @@ void RSDrawFrame::EndCheck()
     exceptionCheck_.exceptionPoint_ = "render_pipeline_timeout";
 
     if (timer_->GetDuration() >= RENDER_TIMEOUT) {
+        if (parallelParamsSyncEnabled_) {
+            RS_LOGW("RSDrawFrame::EndCheck long frame, sync nodes:%{public}zu, deferred:%{public}zu, "
+                "tasks:%{public}zu, nodeSync:%{public}" PRId64 "us, paramsSync:%{public}" PRId64 "us",
+                lastSyncStats_.syncNodeCount, lastSyncStats_.deferredNodeCount, lastSyncStats_.paramsSyncTaskCount,
+                lastSyncStats_.nodeSyncCostUs, lastSyncStats_.paramsSyncCostUs);
+        }
         if (++longFrameCount_ == 6) { // 6: render 6 consecutive frames are too long
             RS_LOGE("Render Six consecutive frames are too long.");
             exceptionCheck_.exceptionCnt_ = longFrameCount_;
@@ -332,6 +368,15 @@ void RSDrawFrame::Sync()
     }
     stagingSyncCanvasDrawingNodes_.clear();
     RSLayerCacheManagerBase::layerDrawables_.clear();
+    // the stats are only collected while parallel params sync is on, a plain frame pays nothing for them
+    lastSyncStats_ = SyncStats();
+    std::chrono::steady_clock::time_point syncStart;
+    if (parallelParamsSyncEnabled_) {
+        lastSyncStats_.syncNodeCount = pendingSyncNodes.size();
+        syncStart = std::chrono::steady_clock::now();
+    }
+    bool parallelParamsSync = parallelParamsSyncEnabled_ && pendingSyncNodes.size() >= MIN_PARALLEL_PARAMS_SYNC_NODES;
+    std::vector<std::shared_ptr<RSRenderNode>> deferredNodes;
     for (auto& [id, weakPtr] : pendingSyncNodes) {
         if (auto node = weakPtr.lock()) {
             if (!CheckCanvasSkipSync(node)) {
@@ -339,13 +384,24 @@ void RSDrawFrame::Sync()
                 continue;
             }
             if (!RSUifirstManager::Instance().CollectSkipSyncNode(node)) {
+                node->SetRenderParamsSyncDeferred(parallelParamsSync && node->IsRenderParamsSyncDeferrable());
                 node->Sync();
+                if (node->IsRenderParamsSyncDeferred()) {
+                    deferredNodes.emplace_back(std::move(node));
+                }
             } else {
                 node->SkipSync();
             }
         }
     }
     pendingSyncNodes.clear();
+    if (parallelParamsSyncEnabled_) {
+        lastSyncStats_.nodeSyncCostUs = GetElapsedUs(syncStart);
+        SyncDeferredRenderParams(deferredNodes);
+        RS_TRACE_NAME_FMT("RSDrawFrame::SyncStats nodes:%zu deferred:%zu tasks:%zu nodeSync:%" PRId64 "us "
+            "paramsSync:%" PRId64 "us", lastSyncStats_.syncNodeCount, lastSyncStats_.deferredNodeCount,
+            lastSyncStats_.paramsSyncTaskCount, lastSyncStats_.nodeSyncCostUs, lastSyncStats_.paramsSyncCostUs);
+    }
     HveFilter::GetHveFilter().Sync();
 
     virtualExpandThreadParams_ = std::make_unique<RSRenderThreadParams>(*stagingRenderThreadParams_);
@@ -357,6 +413,43 @@ void RSDrawFrame::Sync()
     RSLayerSplitManager::GetInstance()->Sync();
 }
 
+// params of different nodes are independent, chunks are synced on the queue and the calling thread runs the first
+// one itself, everything has finished when this returns
+void RSDrawFrame::SyncDeferredRenderParams(std::vector<std::shared_ptr<RSRenderNode>>& nodes)
+{
+    if (nodes.empty()) {
+        return;
+    }
+    auto paramsSyncStart = std::chrono::steady_clock::now();
+    size_t taskCount = std::clamp((nodes.size() + MIN_PARAMS_SYNC_CHUNK - 1) / MIN_PARAMS_SYNC_CHUNK,
+        static_cast<size_t>(1), MAX_PARAMS_SYNC_TASKS);
+    if (paramsSyncQueue_ == nullptr) {
+        taskCount = 1;
+    }
+    size_t chunkSize = (nodes.size() + taskCount - 1) / taskCount;
+    RS_TRACE_NAME_FMT("RSDrawFrame::ParallelParamsSync nodes:%zu tasks:%zu", nodes.size(), taskCount);
+    auto syncChunk = [&nodes](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            nodes[i]->SyncDeferredRenderParams();
+        }
+    };
+    std::vector<ffrt::task_handle> handles;
+    handles.reserve(taskCount - 1);
+    for (size_t begin = chunkSize; begin < nodes.size(); begin += chunkSize) {
+        size_t end = std::min(begin + chunkSize, nodes.size());
+        handles.emplace_back(paramsSyncQueue_->submit_h([&syncChunk, begin, end]() { syncChunk(begin, end); },
+            ffrt::task_attr().name("RSParamsSync")
+                .priority(static_cast<ffrt_queue_priority_t>(ffrt_inner_queue_priority_immediate))));
+    }
+    syncChunk(0, std::min(chunkSize, nodes.size()));
+    for (auto& handle : handles) {
+        paramsSyncQueue_->wait(handle);
+    }
+    lastSyncStats_.deferredNodeCount = nodes.size();
+    lastSyncStats_.paramsSyncTaskCount = handles.size() + 1;
+    lastSyncStats_.paramsSyncCostUs = GetElapsedUs(paramsSyncStart);
+}
+
 void RSDrawFrame::UnblockMainThread()
 {
     RS_TRACE_NAME_FMT("UnlockMainThread");
@@ -20,6 +20,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "system/rs_system_parameters.h"
 
@@ -29,6 +30,10 @@
 #include "platform/ohos/rs_jank_stats_helper.h"
 #include "rs_uni_render_thread.h"
 
+namespace ffrt {
+class queue;
+}
+
 namespace OHOS {
 namespace Rosen {
 class RSDrawFrame {
@@ -48,6 +53,10 @@ public:
     void ClearDrawableResource();
     void ClearDrawableMemory(bool highPriority);
 
+    // when enabled, render params of pending sync nodes are synced in chunks on a worker queue after the other
+    // parts of node sync have run on the calling thread
+    void SetParallelParamsSyncEnabled(bool enabled);
+
 private:
     void RenderFrame();
     void SetEarlyZEnabled(Drawing::GPUContext* gpuContext);
@@ -57,6 +66,7 @@ private:
     void ReleaseSelfDrawingNodeBuffer();
     void NotifyClearGpuCache();
     bool CheckCanvasSkipSync(std::shared_ptr<RSRenderNode>);
+    void SyncDeferredRenderParams(std::vector<std::shared_ptr<RSRenderNode>>& nodes);
     void StartCheck();
     void EndCheck();
 
@@ -73,6 +83,18 @@ private:
     int longFrameCount_ = 0;
     ExceptionCheck exceptionCheck_;
     std::unique_ptr<RSRenderThreadParams> virtualExpandThreadParams_ = nullptr;
+
+    // timing of the last Sync while parallel params sync is on, reported in its trace and with long frames
+    struct SyncStats {
+        size_t syncNodeCount = 0;
+        size_t deferredNodeCount = 0;
+        size_t paramsSyncTaskCount = 0;
+        int64_t nodeSyncCostUs = 0;
+        int64_t paramsSyncCostUs = 0;
+    };
+    bool parallelParamsSyncEnabled_ = false;
+    std::shared_ptr<ffrt::queue> paramsSyncQueue_ = nullptr;
+    SyncStats lastSyncStats_;
 };
 } // namespace Rosen
 } // namespace OHOS
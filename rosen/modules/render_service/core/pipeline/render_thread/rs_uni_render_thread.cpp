@@ -47,6 +47,7 @@
 #include "pipeline/rs_surface_handler.h"
 #include "pipeline/rs_task_dispatcher.h"
 #include "pipeline/sk_resource_manager.h"
+#include "render/rs_filter_result_cache.h"
 #include "platform/common/rs_log.h"
 #include "platform/ohos/rs_jank_stats.h"
 #include "platform/ohos/rs_node_stats.h"
@@ -903,6 +904,7 @@ void RSUniRenderThread::PostClearMemoryTask(ClearMemoryMoment moment, bool deepl
         RS_TRACE_NAME_FMT("Clear memory cache, cause the moment [%d] happen", moment);
         std::lock_guard<std::mutex> lock(clearMemoryMutex_);
         SKResourceManager::Instance().ReleaseResource();
+        RSFilterResultCache::Instance().ClearContext(RSFilterResultCache::GetContextId(grContext));
         grContext->Flush();
         SkGraphics::PurgeAllCaches(); // clear cpu cache
         bool noExitedApp = this->exitedPidSet_.empty() ||
@@ -69,11 +69,36 @@ void RSUnmarshalThread::Start()
             ffrt::queue_concurrent, "RSUnmarshalThreadParallel",
             ffrt::queue_attr().qos(ffrt::qos_user_interactive).max_concurrency(MAX_CONCURRENCY));
     }
+    if (RSSystemProperties::GetParallelApplyEnabled()) {
+        applyQueue_ = std::make_shared<ffrt::queue>(
+            ffrt::queue_concurrent, "RSParallelApply",
+            ffrt::queue_attr().qos(ffrt::qos_user_interactive).max_concurrency(MAX_CONCURRENCY));
+        RSTransactionData::SetParallelApplyFunc(
+            [this](std::vector<std::function<void()>>& tasks) { RunParallelApplyTasks(tasks); });
+    }
     queue_ = std::make_shared<ffrt::queue>(
         static_cast<ffrt::queue_type>(ffrt_inner_queue_type_t::ffrt_queue_eventhandler_adapter), "RSUnmarshalThread",
         ffrt::queue_attr().qos(ffrt::qos_user_interactive));
 }
 
+// called on the main thread; the last task runs inline so the main thread does not idle while waiting
+void RSUnmarshalThread::RunParallelApplyTasks(std::vector<std::function<void()>>& tasks)
+{
+    if (tasks.empty()) {
+        return;
+    }
+    std::vector<ffrt::task_handle> handles;
+    handles.reserve(tasks.size() - 1);
+    for (size_t i = 0; i + 1 < tasks.size(); ++i) {
+        handles.emplace_back(applyQueue_->submit_h(tasks[i], ffrt::task_attr().name("RSParallelApply")
+            .priority(static_cast<ffrt_queue_priority_t>(ffrt_inner_queue_priority_immediate))));
+    }
+    tasks.back()();
+    for (auto& handle : handles) {
+        applyQueue_->wait(handle);
+    }
+}
+
 void RSUnmarshalThread::PostTask(const std::function<void()>& task, const std::string& name)
 {
     if (queue_) {
@@ -55,6 +55,7 @@ private:
     ~RSUnmarshalThread()
     {
         queue_ = nullptr;
+        applyQueue_ = nullptr;
     }
     RSUnmarshalThread(const RSUnmarshalThread&);
     RSUnmarshalThread(const RSUnmarshalThread&&);
@@ -62,6 +63,7 @@ private:
     RSUnmarshalThread& operator=(const RSUnmarshalThread&&);
 
     bool IsHaveCmdList(const std::unique_ptr<RSCommand>& cmd) const;
+    void RunParallelApplyTasks(std::vector<std::function<void()>>& tasks);
     static constexpr uint32_t MIN_PENDING_REQUEST_SYNC_DATA_SIZE = 32 * 1024;
 
     std::mutex transactionDataMutex_;
@@ -75,6 +77,7 @@ private:
 
     std::shared_ptr<ffrt::queue> queue_ = nullptr;
     std::shared_ptr<ffrt::queue> parallelQueue_ = nullptr;
+    std::shared_ptr<ffrt::queue> applyQueue_ = nullptr;
     std::vector<ffrt::task_handle> cachedHandles_;
 };
 }
@@ -42,6 +42,7 @@
 #include "ipc_callbacks/surface_capture_callback_stub.h"
 #include "transaction/rs_marshalling_helper.h"
 #include "transaction/rs_ashmem_helper.h"
+#include "transaction/rs_transaction_ring.h"
 #include "transaction/rs_unmarshal_thread.h"
 #include "transaction/rs_render_service_client_info.h"
 #include "render/rs_typeface_cache.h"
@@ -365,6 +366,24 @@ int RSClientToRenderConnectionStub::OnRemoteRequest(
                     CommitTransaction(transactionData);
                     break;
                 }
+            } else if (readData == RSTransactionRing::RING_PARCEL_FLAG) {
+                // indicate ring parcel, the slot is copied out of this connection's transaction ring
+                {
+                    std::lock_guard<std::mutex> lock(transactionRingMutex_);
+                    parsedParcel = RSTransactionRing::ParseFromRingParcel(&data, transactionRing_,
+                        ashmemFlowControlUnit, callingPid);
+                }
+                if (parsedParcel) {
+                    parcelNumber = RS_PROFILER_ON_REMOTE_REQUEST(this, code, *parsedParcel, reply, option);
+                }
+            } else if (readData == RSTransactionRing::RING_ATTACH_PARCEL_FLAG) {
+                // indicate ring attach parcel, it carries the ring fd only and no transaction
+                std::lock_guard<std::mutex> lock(transactionRingMutex_);
+                if (!RSTransactionRing::AttachFromParcel(&data, transactionRing_)) {
+                    RS_LOGE("RSClientToRenderConnectionStub::COMMIT_TRANSACTION attach transaction ring failed");
+                    return ERR_INVALID_DATA;
+                }
+                break;
             } else {
                 // indicate ashmem parcel
                 // should be parsed to normal parcel before Unmarshalling
@@ -25,6 +25,7 @@
 #include "platform/ohos/transaction/rs_iclient_to_render_connection_ipc_interface_code_access_verifier.h"
 #include "ipc_security/rs_ipc_interface_code_security_manager.h"
 #include "transaction/rs_render_service_security_utils.h"
+#include "transaction/rs_transaction_ring.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -48,6 +49,8 @@ private:
     RSRenderServiceSecurityUtils securityUtils_;
     std::unordered_set<int> tids_;
     std::mutex mutex_;
+    std::unique_ptr<RSTransactionRing> transactionRing_;
+    std::mutex transactionRingMutex_;
 };
 } // namespace Rosen
 } // namespace OHOS
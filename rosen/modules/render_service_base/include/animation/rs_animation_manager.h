@@ -34,6 +34,7 @@ class RSDirtyRegionManager;
 class RSPaintFilterCanvas;
 class RSProperties;
 class RSRenderAnimation;
+class RSRenderAnimationBatch;
 class RSRenderNode;
 
 class RSB_EXPORT RSAnimationManager {
@@ -88,6 +89,11 @@ public:
 
 private:
     void OnAnimationFinished(const std::shared_ptr<RSRenderAnimation>& animation);
+    bool IsAnimateSuspended(const std::shared_ptr<RSRenderAnimation>& animation, bool nodeIsOnTheTree,
+        RSSurfaceNodeAbilityState abilityState) const;
+    // adds the batchable animations in the order of animations_ and evaluates them, nullptr if none is added
+    RSRenderAnimationBatch* BatchAnimate(
+        int64_t time, int64_t& minLeftDelayTime, bool nodeIsOnTheTree, RSSurfaceNodeAbilityState abilityState);
 
     std::unordered_map<AnimationId, std::shared_ptr<RSRenderAnimation>> animations_;
     std::unordered_map<PropertyId, AnimationId> springAnimations_;
@@ -107,6 +113,9 @@ private:
     RSAnimationRateDecider rateDecider_;
     FrameRateGetFunc frameRateGetFunc_;
     std::thread::id creationTid_;
+    std::unique_ptr<RSRenderAnimationBatch> batch_;
+    // evaluate the curve animations of a node by value type in RSRenderAnimationBatch instead of one by one
+    bool isBatchAnimateEnabled_ = false;
 };
 } // namespace Rosen
 } // namespace OHOS
@@ -16,6 +16,7 @@
 #ifndef RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_CUBIC_BEZIER_INTERPOLATOR_H
 #define RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_CUBIC_BEZIER_INTERPOLATOR_H
 
+#include <array>
 #include <cinttypes>
 
 #include "animation/rs_interpolator.h"
@@ -34,18 +35,30 @@ public:
     [[nodiscard]] static RSCubicBezierInterpolator* Unmarshalling(Parcel& parcel);
 
     InterpolatorType GetType() override { return InterpolatorType::CUBIC_BEZIER; }
+    bool IsSameCurve(RSInterpolator& other) const override;
 private:
     RSCubicBezierInterpolator(uint64_t id, float ctlX1, float ctlY1, float ctlX2, float ctlY2);
 
-    int BinarySearch(float key) const;
+    void InterpolateBatchImpl(const float* inputs, float* outputs, size_t count) const override;
 
-    constexpr static int MAX_RESOLUTION = 4000;
-    constexpr static float SEARCH_STEP = 1.0f / MAX_RESOLUTION;
+    // x(t) of the curve at SAMPLE_TABLE_SIZE evenly spaced t, built at creation
+    void InitSampleTable();
+    // solves x(t) == x for t from the sample table with Newton steps, bisection in the sample interval where the
+    // curve is too flat for them; t is within SOLVE_PRECISION of the root up to float precision, which keeps the
+    // output within 1e-5 of the exact curve unless x(t) has a flat inflection (e.g. control points 1, 0, 0, 1)
+    float SolveCurveX(float x) const;
+    float InterpolateInput(float input) const;
+
+    constexpr static size_t SAMPLE_TABLE_SIZE = 11;
+    constexpr static float SAMPLE_STEP = 1.0f / (SAMPLE_TABLE_SIZE - 1);
+    constexpr static float SOLVE_PRECISION = 1e-6f;
 
     float controlX1_ { 0.0 };
     float controlY1_ { 0.0 };
     float controlX2_ { 0.0 };
     float controlY2_ { 0.0 };
+    bool isLinear_ = false;
+    std::array<float, SAMPLE_TABLE_SIZE> sampleTable_ {};
 };
 } // namespace Rosen
 } // namespace OHOS
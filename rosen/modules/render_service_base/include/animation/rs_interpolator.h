@@ -49,7 +49,14 @@ public:
     [[nodiscard]] static RSB_EXPORT std::shared_ptr<RSInterpolator> Unmarshalling(Parcel& parcel);
 
     float Interpolate(float input);
+    // interpolates count inputs into outputs, same values as Interpolate without touching its last result cache
+    void Interpolate(const float* inputs, float* outputs, size_t count) const;
     virtual InterpolatorType GetType() = 0;
+    // true if other gives the same output as this for every input, so their inputs can be interpolated in one batch
+    virtual bool IsSameCurve(RSInterpolator& other) const
+    {
+        return &other == this;
+    }
     static void Init();
 protected:
     RSInterpolator();
@@ -58,6 +65,7 @@ protected:
 
 private:
     virtual float InterpolateImpl(float input) const = 0;
+    virtual void InterpolateBatchImpl(const float* inputs, float* outputs, size_t count) const;
     static uint64_t GenerateId();
     [[nodiscard]] static RSInterpolator* UnmarshallingFromParcel(Parcel& parcel);
     float prevInput_ { -1.0f };
@@ -73,6 +81,10 @@ public:
     [[nodiscard]] static LinearInterpolator* Unmarshalling(Parcel& parcel);
 
     InterpolatorType GetType() override { return InterpolatorType::LINEAR; }
+    bool IsSameCurve(RSInterpolator& other) const override
+    {
+        return other.GetType() == InterpolatorType::LINEAR;
+    }
 private:
     LinearInterpolator(uint64_t id) : RSInterpolator(id) {}
     float InterpolateImpl(float input) const override
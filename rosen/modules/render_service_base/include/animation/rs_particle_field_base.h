@@ -17,6 +17,7 @@
 #define ROSEN_ENGINE_CORE_ANIMATION_RS_PARTICLE_FIELD_BASE_H
 
 #include <cmath>
+#include <cstddef>
 #include <string>
 
 #include "animation/rs_render_particle.h"
@@ -41,6 +42,9 @@ public:
 
     virtual ParticleFieldType GetType() const = 0;
     virtual Vector2f Apply(const Vector2f& position, float deltaTime) = 0;
+    // accumulates the force on count particles stored as separate x/y arrays into forceX/forceY
+    virtual void ApplyBatch(const float* posX, const float* posY, float* forceX, float* forceY, size_t count,
+        float deltaTime);
     virtual bool Equals(const ParticleFieldBase& rhs) const = 0;
     virtual void Dump(std::string& out) const = 0;
     virtual bool MarshalSpecific(Parcel& parcel) const = 0;
@@ -41,6 +41,9 @@ public:
     void RemoveByType(ParticleFieldType type);
 
     Vector2f ApplyAll(const Vector2f& position, float deltaTime);
+    // batched ApplyAll: forceX/forceY are overwritten with the summed force of every field
+    void ApplyAllBatch(const float* posX, const float* posY, float* forceX, float* forceY, size_t count,
+        float deltaTime);
     void UpdateAll(float deltaTime);
 
     bool operator==(const ParticleFieldCollection& rhs) const;
@@ -52,6 +52,8 @@ public:
 
     ParticleFieldType GetType() const override { return ParticleFieldType::RIPPLE; }
     Vector2f Apply(const Vector2f& position, float deltaTime) override;
+    void ApplyBatch(const float* posX, const float* posY, float* forceX, float* forceY, size_t count,
+        float deltaTime) override;
     bool Equals(const ParticleFieldBase& rhs) const override;
     void Dump(std::string& out) const override;
     bool MarshalSpecific(Parcel& parcel) const override;
@@ -61,6 +63,18 @@ public:
     Vector2f ApplyRippleField(const Vector2f& particlePos, float deltaTime);
     void UpdateRipple(float deltaTime);
     float CalculateForceStrength(float distance);
+
+    // terms of CalculateForceStrength that only depend on the field and its lifetime
+    struct WaveTerms {
+        float ct;
+        float gateWidth;
+        float decay;
+        float sigma;
+        float tailW;
+        float recoilCoeff;
+    };
+    WaveTerms CalculateWaveTerms() const;
+    float CalculateForceStrength(float distance, const WaveTerms& terms) const;
     bool IsPointInRegion(const Vector2f& point) const override;
 
     bool operator==(const ParticleRippleField& rhs) const
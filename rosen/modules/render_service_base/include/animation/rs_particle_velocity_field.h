@@ -43,6 +43,8 @@ public:
 
     ParticleFieldType GetType() const override { return ParticleFieldType::VELOCITY; }
     Vector2f Apply(const Vector2f& position, float deltaTime) override;
+    void ApplyBatch(const float* posX, const float* posY, float* forceX, float* forceY, size_t count,
+        float deltaTime) override;
     bool Equals(const ParticleFieldBase& rhs) const override;
     void Dump(std::string& out) const override;
     bool MarshalSpecific(Parcel& parcel) const override;
@@ -25,6 +25,7 @@
 
 namespace OHOS {
 namespace Rosen {
+class RSRenderAnimationBatch;
 class RSRenderNode;
 class RSRenderTimeDrivenGroupAnimator;
 
@@ -178,6 +179,9 @@ protected:
 
     virtual void ProcessOnRepeatFinish();
 
+    // true if the value of every frame can be evaluated by RSRenderAnimationBatch instead of OnAnimate
+    virtual bool IsBatchable() const { return false; }
+
     void FinishOnCurrentPosition();
 
     void SetToken(uint64_t token) { token_ = token; }
@@ -192,6 +196,21 @@ protected:
     std::pair<bool, float> fractionChangeInfo_ = { false, 0.0f };
 
 private:
+    // state of one frame between the fraction and the value update of Animate
+    struct AnimateFrame {
+        float fraction = 0.0f;
+        double frameInterval = 0.0;
+        bool isInStartDelay = false;
+        bool isFinished = false;
+        bool isRepeatFinished = false;
+    };
+
+    // true if Animate goes straight to the fraction at time, without any state change before it
+    bool CanBeginAnimateFrame(int64_t time) const;
+    AnimateFrame BeginAnimateFrame(int64_t time, int64_t& minLeftDelayTime, bool isCustom);
+    // the part of Animate after the value of the frame is updated, returns the finish state of Animate
+    bool EndAnimateFrame(int64_t time, const AnimateFrame& frame, bool isAnimateFinished);
+
     void ProcessFillModeOnStart(float startFraction);
 
     void ProcessFillModeOnFinish(float endFraction);
@@ -215,6 +234,7 @@ private:
     float currentFraction_ { 0.f };
 
     friend class RSAnimation;
+    friend class RSRenderAnimationBatch;
     friend class RSRenderCurveAnimation;
     friend class RSRenderTimeDrivenGroupAnimator;
     friend class RSModifierManager;
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_ANIMATION_BATCH_H
+#define RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_ANIMATION_BATCH_H
+
+#include <cstdint>
+#include <vector>
+
+#include "animation/rs_render_animation.h"
+#include "animation/rs_value_estimator.h"
+#include "common/rs_macros.h"
+
+namespace OHOS {
+namespace Rosen {
+class RSRenderCurveAnimation;
+
+// Evaluates one frame of a set of render animations grouped by value type.
+// Add computes the fraction of an animation and puts the curve animations of one value type (all float curves,
+// all Vector4f curves, ...) into contiguous arrays, Evaluate interpolates the fractions of each curve in one call and
+// runs the value interpolation of each group in a loop, and Apply writes the value of one animation to its property
+// and finishes its frame.
+// Apply does what RSRenderAnimation::Animate does after the fraction, so calling it for the animations in the order
+// they would have been animated gives exactly the same property values, velocities and callbacks; additive values
+// are read from the property in Apply, so several animations of one property still accumulate in order.
+class RSB_EXPORT RSRenderAnimationBatch {
+public:
+    RSRenderAnimationBatch() = default;
+    ~RSRenderAnimationBatch() = default;
+
+    static bool IsSupportedType(RSPropertyType type);
+
+    // computes the fraction of animation at time and adds it to the batch, returns false and leaves the animation
+    // untouched if it is not batchable or Animate would not go straight to the fraction at time
+    bool Add(RSRenderAnimation& animation, int64_t time, int64_t& minLeftDelayTime);
+    void Evaluate();
+    // index of animation in the batch, GetSize() if it has not been added
+    size_t Find(const RSRenderAnimation* animation);
+    // finishes the frame of the animation added at index, returns the same as RSRenderAnimation::Animate; an animation
+    // that stopped running since Add, e.g. paused by the callback of another one, is left to Animate
+    bool Apply(size_t index, int64_t time, int64_t& minLeftDelayTime);
+    void Clear();
+
+    size_t GetSize() const
+    {
+        return items_.size();
+    }
+    const RSRenderAnimation* GetAnimation(size_t index) const
+    {
+        return index < items_.size() ? items_[index].animation : nullptr;
+    }
+
+private:
+    template<typename T>
+    struct CurveGroup {
+        std::vector<RSCurveValueEstimator<T>*> estimators;
+        // index of the fraction of each animation in fractions_
+        std::vector<size_t> fractionIndices;
+        std::vector<T> startValues;
+        std::vector<T> endValues;
+        std::vector<T> values;
+
+        size_t Add(RSCurveValueEstimator<T>* estimator, size_t fractionIndex);
+        void Evaluate(const std::vector<float>& fractions);
+        void Clear();
+    };
+
+    struct Item {
+        RSRenderCurveAnimation* animation = nullptr;
+        RSPropertyType type = RSPropertyType::INVALID;
+        // index in the group of type, unused in start delay
+        size_t slot = 0;
+        RSRenderAnimation::AnimateFrame frame;
+    };
+
+    template<typename T>
+    size_t AddCurve(CurveGroup<T>& group, RSRenderCurveAnimation& animation, float fraction);
+    template<typename T>
+    void ApplyValue(CurveGroup<T>& group, const Item& item);
+    void InterpolateFractions();
+
+    std::vector<Item> items_;
+    // time fractions of the animations not in start delay when added, interpolated fractions after Evaluate
+    std::vector<float> fractions_;
+    std::vector<RSInterpolator*> interpolators_;
+    // scratch buffers of InterpolateFractions
+    std::vector<uint8_t> isInterpolated_;
+    std::vector<size_t> curveIndices_;
+    std::vector<float> curveInputs_;
+    std::vector<float> curveOutputs_;
+    // the animations are applied in the order they are added, so Find starts after the last one found
+    size_t findStart_ = 0;
+    CurveGroup<float> floatCurves_;
+    CurveGroup<Vector2f> vector2fCurves_;
+    CurveGroup<Vector4f> vector4fCurves_;
+    CurveGroup<Color> colorCurves_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_ANIMATION_BATCH_H
@@ -54,6 +54,8 @@ protected:
 
     void OnAttach() override;
 
+    bool IsBatchable() const override;
+
 private:
     bool ParseParam(Parcel& parcel) override;
     RSRenderCurveAnimation() = default;
@@ -65,6 +67,8 @@ private:
     inline static RS_HIDDEN std::shared_ptr<RSInterpolator> linearInterpolator_ {
         std::make_shared<LinearInterpolator>()
     };
+
+    friend class RSRenderAnimationBatch;
 };
 } // namespace Rosen
 } // namespace OHOS
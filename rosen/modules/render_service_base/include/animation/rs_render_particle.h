@@ -413,6 +413,7 @@ public:
     const Vector2f& GetImageSize();
     const ParticleType& GetParticleType();
     int64_t GetActiveTime();
+    int64_t GetLifeTime() const;
     const std::shared_ptr<ParticleRenderParams>& GetParticleRenderParams();
 
     size_t GetImageIndex() const;
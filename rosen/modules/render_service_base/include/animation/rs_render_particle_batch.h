@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_PARTICLE_BATCH_H
+#define RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_PARTICLE_BATCH_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "rs_render_particle_effector.h"
+
+namespace OHOS {
+namespace Rosen {
+// Structure-of-arrays storage for the particles of one emitter.
+// All particles of an emitter share one ParticleRenderParams, so the updator of every attribute is resolved
+// once per frame and each attribute is advanced by a loop over a contiguous array, instead of going through
+// the particle and its params for every attribute of every particle.
+// The RSRenderParticle objects remain the interface to drawing: the batch reads a particle once when it is
+// adopted and writes the simulated state back once per frame.
+class RSB_EXPORT RSRenderParticleBatch {
+public:
+    explicit RSRenderParticleBatch(const std::shared_ptr<ParticleRenderParams>& particleParams);
+    ~RSRenderParticleBatch() = default;
+
+    // takes over newly emitted particles of the emitter
+    void Adopt(const std::vector<std::shared_ptr<RSRenderParticle>>& particles);
+    // drops the particles that died in the previous frame, then advances the rest by deltaTime (ns);
+    // same semantics as RSRenderParticleEffector::Update on every particle
+    void Update(int64_t deltaTime, const std::shared_ptr<ParticleFieldCollection>& fields);
+    void Clear();
+
+    size_t GetParticleCount() const
+    {
+        return particles_.size();
+    }
+    const std::vector<std::shared_ptr<RSRenderParticle>>& GetParticles() const
+    {
+        return particles_;
+    }
+    const std::shared_ptr<ParticleRenderParams>& GetParticleParams() const
+    {
+        return particleParams_;
+    }
+
+private:
+    void RemoveDeadParticles();
+    void UpdateFloatAttribute(std::vector<float>& values, const std::vector<float>& speeds,
+        ParticleUpdator updator, const std::vector<std::shared_ptr<ChangeInOverLife<float>>>& curves, float dt);
+    void UpdateColor(float dt);
+    void UpdateOpacity(float dt);
+    void UpdateScale(float dt);
+    void UpdatePosition(const std::shared_ptr<ParticleFieldCollection>& fields, float dt);
+    void WriteBack();
+
+    std::shared_ptr<ParticleRenderParams> particleParams_;
+    RSRenderParticleEffector effector_;
+    bool infiniteLife_ = false;
+
+    std::vector<std::shared_ptr<RSRenderParticle>> particles_;
+    std::vector<float> positionX_;
+    std::vector<float> positionY_;
+    std::vector<float> velocityX_;
+    std::vector<float> velocityY_;
+    std::vector<float> accelerationX_;
+    std::vector<float> accelerationY_;
+    std::vector<float> accelerationValue_;
+    std::vector<float> accelerationValueSpeed_;
+    std::vector<float> accelerationAngle_;
+    std::vector<float> accelerationAngleSpeed_;
+    std::vector<float> opacity_;
+    std::vector<float> opacitySpeed_;
+    std::vector<float> scale_;
+    std::vector<float> scaleSpeed_;
+    std::vector<float> spin_;
+    std::vector<float> spinSpeed_;
+    // color channels as in RSRenderParticleEffector::UpdateColor: value, fraction and speed
+    std::vector<Color> color_;
+    std::vector<float> colorF_[4];
+    std::vector<float> colorSpeed_[4];
+    std::vector<int64_t> activeTime_;
+    std::vector<int64_t> lifeTime_;
+    std::vector<uint8_t> dead_;
+    // per frame scratch
+    std::vector<float> forceX_;
+    std::vector<float> forceY_;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_PARTICLE_BATCH_H
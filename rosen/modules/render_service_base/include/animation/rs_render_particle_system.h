@@ -16,6 +16,7 @@
 #ifndef RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_PARTICLE_SYSTEM_H
 #define RENDER_SERVICE_CLIENT_CORE_ANIMATION_RS_RENDER_PARTICLE_SYSTEM_H
 
+#include "rs_render_particle_batch.h"
 #include "rs_render_particle_emitter.h"
 #include "rs_particle_field_collection.h"
 namespace OHOS {
@@ -39,6 +40,10 @@ public:
         bool isIncrementalUpdate = true);
     void UpdateVelocityField(const std::shared_ptr<ParticleVelocityFields>& particleVelocityFields);
     void UpdateFields(const std::shared_ptr<ParticleFieldCollection>& fields);
+    // Updates the particles of an emitter as one structure-of-arrays batch instead of one by one. Batched
+    // particles stay in activeParticles for drawing, as one block after the individually updated ones.
+    void SetEmitterBatchUpdate(size_t emitterIndex, bool enable);
+    bool IsEmitterBatchUpdate(size_t emitterIndex) const;
     const std::vector<std::shared_ptr<RSRenderParticleEmitter>>& GetParticleEmitter() const
     {
         return emitters_;
@@ -65,6 +70,9 @@ public:
 
 private:
     void WarmupFields(int64_t totalTimeNs);
+    void DetachBatchParticles(std::vector<std::shared_ptr<RSRenderParticle>>& activeParticles);
+    void UpdateBatches(int64_t deltaTime, std::vector<std::shared_ptr<RSRenderParticle>>& activeParticles);
+    void ClearBatches();
     void WarmupEmitter(const std::shared_ptr<RSRenderParticleEmitter>& emitter, int64_t totalTimeNs,
         std::vector<std::shared_ptr<RSRenderParticle>>& activeParticles);
     std::vector<std::shared_ptr<ParticleRenderParams>> particlesRenderParams_ = {};
@@ -74,6 +82,14 @@ private:
     std::shared_ptr<ParticleVelocityFields> particleVelocityFields_;
     std::shared_ptr<ParticleFieldCollection> particleFields_;
     std::vector<std::shared_ptr<RSImage>> imageVector_;
+    // indexed like emitters_, nullptr for an emitter whose particles are updated one by one
+    std::vector<std::shared_ptr<RSRenderParticleBatch>> batches_;
+    // particles of a batch that was switched off, handed back to activeParticles on the next update
+    std::vector<std::shared_ptr<RSRenderParticle>> releasedParticles_;
+    // where the batched particles were put into activeParticles by the last update
+    size_t batchBlockBegin_ = 0;
+    size_t batchBlockSize_ = 0;
+    const RSRenderParticle* batchBlockFront_ = nullptr;
 };
 } // namespace Rosen
 } // namespace OHOS
@@ -37,7 +37,7 @@ namespace Rosen {
 class RSB_EXPORT RSValueEstimator {
 public:
     template<typename T>
-    T Estimate(float fraction, const T& startValue, const T& endValue)
+    static T Estimate(float fraction, const T& startValue, const T& endValue)
     {
         return startValue * (1.0f - fraction) + endValue * fraction;
     }
@@ -108,7 +108,21 @@ public:
 
     T GetAnimationValue(const float fraction, const bool isAdditive)
     {
-        auto interpolationValue = RSValueEstimator::Estimate(fraction, startValue_, endValue_);
+        return GetAnimationValueByInterpolation(RSValueEstimator::Estimate(fraction, startValue_, endValue_),
+            isAdditive);
+    }
+
+    // same as UpdateAnimationValue, with the interpolation value of the fraction evaluated by the caller
+    void UpdateAnimationValueByInterpolation(const T& interpolationValue, const bool isAdditive)
+    {
+        auto animationValue = GetAnimationValueByInterpolation(interpolationValue, isAdditive);
+        if (property_ != nullptr) {
+            property_->Set(animationValue);
+        }
+    }
+
+    T GetAnimationValueByInterpolation(const T& interpolationValue, const bool isAdditive)
+    {
         auto animationValue = interpolationValue;
         if (isAdditive && property_ != nullptr) {
             animationValue = property_->Get() + (interpolationValue - lastValue_);
@@ -178,6 +192,16 @@ public:
         property_->Set(interpolationValue);
     }
 
+    const T& GetStartValue() const
+    {
+        return startValue_;
+    }
+
+    const T& GetEndValue() const
+    {
+        return endValue_;
+    }
+
 private:
     T startValue_ {};
     T endValue_ {};
@@ -28,6 +28,7 @@ namespace Rosen {
 namespace Drawing {
 class DrawCmdList;
 }
+enum PropertyUpdateType : uint8_t;
 
 //Each command HAVE TO have UNIQUE ID in ALL HISTORY
 //If a command is not used and you want to delete it,
@@ -126,6 +127,13 @@ public:
         return 0;
     }
 
+    // Returns true if this command updates the value of a node property,
+    // and outputs the updated property id and the update type.
+    virtual bool GetPropertyUpdate(PropertyId& propertyId, PropertyUpdateType& updateType) const
+    {
+        return false;
+    }
+
     std::string PrintType() const
     {
         return "commandType:[" + std::to_string(GetType()) + ", " + std::to_string(GetSubType()) + "], ";
@@ -149,6 +149,22 @@ public:
         return 0; // invalidId
     }
 
+    bool GetPropertyUpdate(PropertyId& propertyId, PropertyUpdateType& updateType) const override
+    {
+        // property update commands carry (NodeId, value, PropertyId, PropertyUpdateType)
+        if constexpr (commandType == RSCommandType::RS_NODE && std::tuple_size<decltype(params_)>::value == 4) {
+            using idType = typename std::tuple_element<2, decltype(params_)>::type;         // 2:propertyId
+            using updateTypeType = typename std::tuple_element<3, decltype(params_)>::type; // 3:updateType
+            if constexpr (std::is_same<PropertyId, idType>::value &&
+                std::is_same<PropertyUpdateType, updateTypeType>::value) {
+                propertyId = std::get<2>(params_); // 2:propertyId
+                updateType = std::get<3>(params_); // 3:updateType
+                return true;
+            }
+        }
+        return false;
+    }
+
     void Process(RSContext& context) override
     {
         // expand the tuple to function parameters
@@ -38,9 +38,11 @@ public:
 class Assembler {
 public:
     explicit Assembler(Region &r)
-        : storage_(r.GetRegionRectsRef()), bound_(r.GetBoundRef()), lastRectRowBegin_(), end_(), cur_()
+        : storage_(r.GetRegionRectsRef()), bound_(r.GetBoundRef()), rectsRow_(GetRowBuffer()), lastRectRowBegin_(),
+          end_(), cur_()
     {
         storage_.clear();
+        rectsRow_.clear();
         bound_ = Rect{INT_MAX, INT_MAX, INT_MIN, INT_MIN, false};
     }
     void Insert(const Rect &r); // insert a Rect into span
@@ -49,9 +51,10 @@ public:
     void MergeSpanVertically();
     ~Assembler();
 private:
+    static std::vector<Rect>& GetRowBuffer();
     std::vector<Rect> &storage_;            // current all rects storage
     Rect &bound_;                           // current bound
-    std::vector<Rect> rectsRow_;            // current span rects; will be dumped into storage every otter loop
+    std::vector<Rect> &rectsRow_;           // current span rects; will be dumped into storage every otter loop
     std::vector<Rect>::iterator lastRectRowBegin_;
     std::vector<Rect>::iterator end_;
     std::vector<Rect>::iterator cur_;
@@ -15,6 +15,8 @@
 #ifndef MEMORY_TRACK
 #define MEMORY_TRACK
 
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <vector>
 
@@ -126,18 +128,42 @@ private:
     void DumpMemoryNodeStatistics(DfxString& log, bool isLite = false);
     void DumpMemoryPicStatistics(DfxString& log,
         std::function<std::tuple<uint64_t, std::string, RectI, bool>(uint64_t)> func, bool isLite = false);
+    // the caller holds the lock of the node shard of id
     bool RemoveNodeFromMap(const NodeId id, pid_t& pid, size_t& size);
     void RemoveNodeOfPidFromMap(const pid_t pid, const size_t size, const NodeId id);
-    std::mutex mutex_;
-    std::unordered_map<NodeId, MemoryInfo> memNodeMap_;
-    std::unordered_map<const void*, MemoryInfo> memPicRecord_;
 
-    RSPixelMapFdTrack pixelMapFdTracker_;
+    // Records are sharded so that node creation and destruction bursts of different processes do not serialize on
+    // one lock, statistics over all shards are only aggregated for dump and report.
+    static constexpr uint32_t SHARD_COUNT = 16;
+    struct NodeShard {
+        std::mutex mutex;
+        // node records whose node id belongs to a pid of the shard
+        std::unordered_map<NodeId, MemoryInfo> memNodeMap;
+        // Data to statistic information of Pid, kept in the shard of the node id
+        std::unordered_map<pid_t, std::vector<MemoryNodeOfPid>> memNodeOfPidMap;
+        // RS Node Size [pid, RenderNodeMemSize, DrawableNodeMemSize]
+        std::unordered_map<pid_t, std::pair<size_t, size_t>> nodeMemOfPid;
+    };
+    struct PicShard {
+        std::mutex mutex;
+        std::unordered_map<const void*, MemoryInfo> memPicRecord;
+    };
+    NodeShard& GetNodeShard(pid_t pid)
+    {
+        return nodeShards_[static_cast<uint32_t>(pid) % SHARD_COUNT];
+    }
+    PicShard& GetPicShard(const void* addr)
+    {
+        return picShards_[std::hash<const void*>()(addr) % SHARD_COUNT];
+    }
+    std::unordered_map<const void*, MemoryInfo> CollectPictureRecords();
+
+    std::array<NodeShard, SHARD_COUNT> nodeShards_;
+    std::array<PicShard, SHARD_COUNT> picShards_;
+    // total size of the picture records, read without locking the shards
+    std::atomic<uint64_t> picTotalSize_ { 0 };
 
-    // Data to statistic information of Pid
-    std::unordered_map<pid_t, std::vector<MemoryNodeOfPid>> memNodeOfPidMap_;
-    // RS Node Size [pid, RenderNodeMemSize, DrawableNodeMemSize]
-    std::unordered_map<pid_t, std::pair<size_t, size_t>> nodeMemOfPid_;
+    RSPixelMapFdTrack pixelMapFdTracker_;
 
 #ifdef RS_MEMORY_INFO_MANAGER
     std::atomic<bool> globalRootNodeStatusChangeFlag{false};
@@ -334,6 +334,7 @@ private:
     friend class RSSurfaceCaptureTaskParallel;
 #ifdef RS_PROFILER_ENABLED
     friend class RSProfiler;
+    friend class RSProfilerReplayBench;
 #endif
 };
 
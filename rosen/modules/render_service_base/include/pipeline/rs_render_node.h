@@ -471,6 +471,23 @@ public:
     void UpdateCurCornerInfo(Vector4f& curCornerRadius, RectI& curCornerRect);
     void SetDirty(bool forceAddToActiveList = false);
 
+    // Cross-node side effects of SetDirty/MarkParentNeedRegenerateChildren/AddToPendingSyncList. While commands or
+    // modifiers of different nodes are applied in parallel, they are recorded into the calling thread's list instead
+    // of touching the parent chain and the context, and replayed in order on the main thread by
+    // FlushDeferredDirtyEvents.
+    struct DeferredDirtyEvent {
+        enum class Type : uint8_t {
+            PARENT_SUBTREE_DIRTY,
+            CHILDREN_UNSORTED,
+            PENDING_SYNC,
+        };
+        std::shared_ptr<RSRenderNode> node;
+        Type type;
+    };
+    // nullptr restores immediate handling on the calling thread
+    static void SetDeferredDirtyEvents(std::vector<DeferredDirtyEvent>* events);
+    static void FlushDeferredDirtyEvents(std::vector<DeferredDirtyEvent>& events);
+
     void ResetDirtyFlag()
     {
         SetClean();
@@ -868,6 +885,10 @@ public:
     void MarkNonGeometryChanged();
 
     virtual void ApplyModifiers();
+    // Applying modifiers of these nodes only writes the node itself and its children list, the cross-node side
+    // effects are recorded as DeferredDirtyEvent, so subtrees of different windows can be applied in parallel.
+    // Only nodes whose dirty modifiers are all of the known node-local types qualify, the others stay on the main thread.
+    bool CanApplyModifiersInParallel();
     void ApplyPositionZModifier();
     virtual void UpdateRenderParams();
 
@@ -934,6 +955,19 @@ public:
     {
         OnSync();
     }
+    // Render params of these nodes only copy fields of the node itself on sync, so the params of different nodes can
+    // be synced in parallel. When deferred, the next Sync() leaves the params to SyncDeferredRenderParams().
+    bool IsRenderParamsSyncDeferrable();
+    void SetRenderParamsSyncDeferred(bool deferred)
+    {
+        renderParamsSyncDeferred_ = deferred;
+    }
+    // true after Sync() if the params still need SyncDeferredRenderParams()
+    bool IsRenderParamsSyncDeferred() const
+    {
+        return renderParamsSyncDeferred_;
+    }
+    void SyncDeferredRenderParams();
     void AddToPendingSyncList();
     const std::weak_ptr<RSContext> GetContext() const
     {
@@ -1268,6 +1302,7 @@ private:
     bool isOnlyBasicGeoTransform_ = true;
     // Test pipeline
     bool addedToPendingSyncList_ = false;
+    bool renderParamsSyncDeferred_ = false;
     bool drawCmdListNeedSync_ = false;
     bool unobscuredUECChildrenNeedSync_ = false;
     // accumulate all children's region rect for dirty merging when any child has been removed
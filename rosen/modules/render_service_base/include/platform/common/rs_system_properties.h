@@ -335,6 +335,7 @@ public:
     static bool GetLayerEnabled();
     static bool GetLayerDebugEnabled();
     static bool GetFilterCacheMemThresholdEnabled();
+    static int GetFilterResultCacheBudgetKB();
     static bool GetSkipDisplayIfScreenOffEnabled();
     static bool GetBatchRemovingOnRemoteDiedEnabled();
 
@@ -398,6 +399,16 @@ public:
     static bool GetPreparePhaseQuickSkipEnabled();
     static bool GetUnmarshalParallelEnabled();
     static uint32_t GetUnmarshalParallelMinDataSize();
+    static bool GetTransactionRingEnabled();
+    static uint32_t GetTransactionRingCapacity();
+    static bool GetParallelApplyEnabled();
+    static int GetParticleBatchUpdateMinCount();
+    static size_t GetReleasedImageCacheBudget();
+    static bool GetDrawCmdListIndexedPlaybackEnabled();
+    static bool GetTransactionCoalescingEnabled();
+    static bool GetParallelParamsSyncEnabled();
+    static bool GetParallelWindowPrepareEnabled();
+    static bool GetBatchAnimateEnabled();
     static bool GetBootCompleted();
     static bool GetClipRRectOptimizationEnabled();
     static bool GetNodeMemClearEnabled();
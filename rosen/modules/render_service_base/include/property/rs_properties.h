@@ -971,6 +971,9 @@ private:
         bool useEffect_ = false;
         bool haveEffectRegion_ = false;
         std::shared_ptr<ParticleNoiseFields> particleNoiseFields_ = nullptr;
+        std::shared_ptr<ParticleRippleFields> particleRippleFields_ = nullptr;
+        std::shared_ptr<ParticleVelocityFields> particleVelocityFields_ = nullptr;
+        std::shared_ptr<ParticleFieldCollection> particleFields_ = nullptr;
         std::vector<std::shared_ptr<EmitterUpdater>> emitterUpdater_;
         RSRenderParticleVector particles_;
         float lightUpEffectDegree_ = 1.0f;
@@ -1004,6 +1007,7 @@ private:
         std::unique_ptr<RSBackgroundBlurPara> backgroundBlurPara_ = nullptr;
         std::unique_ptr<RSForegroundBlurPara> foregroundBlurPara_ = nullptr;
         std::optional<RSDynamicBrightnessPara> fgBrightnessParams_;
+        std::optional<RSDynamicBrightnessPara> bgBrightnessParams_;
         float foregroundEffectRadius_ = 0.f;
         int colorBlendMode_ = 0;
         int colorBlendApplyType_ = 0;
@@ -1030,6 +1034,12 @@ private:
         std::optional<std::vector<Drawing::Point>> spatialEffectDstPoints_ = std::nullopt;
         bool useUnion_ = false;
         float unionSpacing_ = 0.f;
+        float gravityPullStrength_ = 0.0f;
+        float gravityHotZone_ = 0.0f;
+        bool isGravityPullModeCenter_ = false; // true, current node is gravity pull center
+        int uniModeUC_ = 0; // 1 GravityPull Mode, 0 SmoothUnion.
+        std::optional<Matrix3f> sublayerTransform_;
+        std::shared_ptr<ColorPickerParam> colorPicker_;
     };
     inline float DecreasePrecision(float value)
     {
@@ -1096,6 +1106,8 @@ private:
         return *effect_;
     }
 
+    // Hot state read by every node in apply modifiers and prepare, the bools are kept together to avoid padding.
+    // Rarely used effect state lives in CommonEffectParams above.
     bool isDirty_ = false;
     bool geoDirty_ = false;
     bool contentDirty_ = false;
@@ -1122,31 +1134,24 @@ private:
     bool hasHarmonium_ = false;
     bool hasSpatialGlassEffect_ = false;
     bool useUnion_ = false;
-    float gravityPullStrength_ = 0.0f;
-    float gravityHotZone_ = 0.0f;
-    bool isGravityPullModeCenter_ = false; // true, current node is gravity pull center
-    int uniModeUC_ = 0; // 1 GravityPull Mode, 0 SmoothUnion.
     bool alphaOffscreen_ = false;
-    std::unique_ptr<RRect> clipRRect_;
     bool alphaNeedApply_ = false;
     bool localMagnificationCap_ = false;
-    float hdrBrightnessFactor_ = 1.0f; // for displayNode
-    float canvasNodeHDRBrightnessFactor_ = 1.0f; // for canvasNode
+    Gravity frameGravity_ = Gravity::DEFAULT;
+    int cornerApplyType_ = 0;
+    float alpha_ = 1.f;
     float frameOffsetX_ = 0.f;
     float frameOffsetY_ = 0.f;
-    float alpha_ = 1.f;
-    Gravity frameGravity_ = Gravity::DEFAULT;
+    float hdrBrightnessFactor_ = 1.0f; // for displayNode
+    float canvasNodeHDRBrightnessFactor_ = 1.0f; // for canvasNode
     float hdrUIBrightness_ = 1.0f;
     float hdrColorHeadroom_ = 1.0f;
     float hdrColorMaxHeadroom_ = 1.0f;
-    std::shared_ptr<ColorPickerParam> colorPicker_;
+    std::unique_ptr<RRect> clipRRect_;
     // filter property
     std::shared_ptr<RSObjAbsGeometry> boundsGeo_;
     std::shared_ptr<RSNGRenderShapeBase> renderSDFShape_ = nullptr;
     std::shared_ptr<RectF> drawRegion_ = nullptr;
-    std::shared_ptr<ParticleRippleFields> particleRippleFields_ = nullptr;
-    std::shared_ptr<ParticleVelocityFields> particleVelocityFields_ = nullptr;
-    std::shared_ptr<ParticleFieldCollection> particleFields_ = nullptr;
     std::shared_ptr<RSBorder> border_ = nullptr;
     std::shared_ptr<RSBorder> outline_ = nullptr;
     std::shared_ptr<RSPath> clipPath_ = nullptr;
@@ -1158,11 +1163,8 @@ private:
     std::unique_ptr<Sandbox> sandbox_ = nullptr;
     RSObjGeometry frameGeo_;
     std::optional<Vector4f> cornerRadius_;
-    std::optional<RSDynamicBrightnessPara> bgBrightnessParams_;
-    int cornerApplyType_ = 0;
 
     std::unique_ptr<Decoration> decoration_;
-    std::optional<Matrix3f> sublayerTransform_;
 
     std::optional<RectI> lastRect_;
 
@@ -283,12 +283,6 @@ private:
     }; // VBox
 
 private:
-    static constexpr double RED_GRAY_RATIO = 0.299;
-    static constexpr double GREEN_GRAY_RATIO = 0.587;
-    static constexpr double BLUE_GRAY_RATIO = 0.114;
-    static constexpr double RED_LUMINACE_RATIO = 0.2126;
-    static constexpr double GREEN_LUMINACE_RATIO = 0.7152;
-    static constexpr double BLUE_LUMINACE_RATIO = 0.0722;
     static uint8_t Rgb2Gray(uint32_t color);
     uint32_t CalcGrayMsd() const;
     static float NormalizeRgb(uint32_t val);
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RS_COLOR_EXTRACT_KERNEL_H
+#define RS_COLOR_EXTRACT_KERNEL_H
+
+#include <cstdint>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RS_COLOR_EXTRACT_KERNEL_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define RS_COLOR_EXTRACT_KERNEL_SSE2
+#endif
+
+namespace OHOS {
+namespace Rosen {
+/*
+ * Pixel kernels shared by RSColorExtract and the color picker ColorExtract. A single pass over the ARGB32 pixels
+ * builds the quantized color histogram, the gray level histogram and the relative luminance sum. Channel
+ * unpacking and quantization run four pixels at a time with NEON or SSE2, the floating point gray and luminance
+ * expressions stay scalar and are the ones the per-pixel helpers of both classes call, so the results are bit
+ * exact with them. The gray mean square deviation is derived from the gray histogram instead of a second pass.
+ */
+class RSColorExtractKernel {
+public:
+    static constexpr uint32_t QUANTIZE_WORD_WIDTH = 5;
+    static constexpr uint32_t QUANTIZED_HIST_LEN = 1 << (QUANTIZE_WORD_WIDTH * 3); // 3 channels
+    static constexpr uint32_t GRAY_LEVEL_NUM = 256;
+    static constexpr uint32_t CHANNEL_LEVEL_NUM = 256;
+
+    struct ColorStats {
+        uint32_t grayHist[GRAY_LEVEL_NUM] = { 0 };
+        float luminanceSum = 0.0f;
+    };
+
+    static inline uint8_t Gray(uint32_t r, uint32_t g, uint32_t b)
+    {
+        return static_cast<uint8_t>(r * RED_GRAY_RATIO + g * GREEN_GRAY_RATIO + b * BLUE_GRAY_RATIO);
+    }
+
+    // r, g and b are the normalized channels
+    static inline float RelativeLum(float r, float g, float b)
+    {
+        return r * RED_LUMINACE_RATIO + g * GREEN_LUMINACE_RATIO + b * BLUE_LUMINACE_RATIO;
+    }
+
+    static inline uint32_t QuantizeRGB888(uint32_t r, uint32_t g, uint32_t b)
+    {
+        return ((r >> QUANTIZE_SHIFT) << (QUANTIZE_WORD_WIDTH + QUANTIZE_WORD_WIDTH)) |
+            ((g >> QUANTIZE_SHIFT) << QUANTIZE_WORD_WIDTH) | (b >> QUANTIZE_SHIFT);
+    }
+
+    /*
+     * hist: nullptr or QUANTIZED_HIST_LEN counters, the quantized colors are added to it.
+     * stats: nullptr or the gray histogram and luminance sum to add to.
+     * normalizeTable: nullptr to skip the luminance, or the normalized value of each of the 256 channel levels.
+     */
+    static void AccumulateARGB32(const uint32_t* colors, uint32_t len, uint32_t* hist, ColorStats* stats,
+        const float* normalizeTable = nullptr)
+    {
+        if (colors == nullptr) {
+            return;
+        }
+        bool withStats = stats != nullptr;
+        bool withLum = withStats && normalizeTable != nullptr;
+        if (hist != nullptr) {
+            if (withLum) {
+                Accumulate<true, true, true>(colors, len, hist, stats, normalizeTable);
+            } else if (withStats) {
+                Accumulate<true, true, false>(colors, len, hist, stats, normalizeTable);
+            } else {
+                Accumulate<true, false, false>(colors, len, hist, stats, normalizeTable);
+            }
+        } else if (withLum) {
+            Accumulate<false, true, true>(colors, len, hist, stats, normalizeTable);
+        } else if (withStats) {
+            Accumulate<false, true, false>(colors, len, hist, stats, normalizeTable);
+        }
+    }
+
+    static uint32_t CalcGrayMsd(const uint32_t* grayHist, uint32_t pixelNum)
+    {
+        if (pixelNum == 0) {
+            return 0;
+        }
+        unsigned long long int graySum = 0;
+        for (uint32_t gray = 0; gray < GRAY_LEVEL_NUM; gray++) {
+            graySum += static_cast<unsigned long long int>(grayHist[gray]) * gray;
+        }
+        long long int grayAve = static_cast<long long int>(graySum / pixelNum);
+        unsigned long long int grayVar = 0;
+        for (uint32_t gray = 0; gray < GRAY_LEVEL_NUM; gray++) {
+            long long int diff = static_cast<long long int>(gray) - grayAve;
+            grayVar += static_cast<unsigned long long int>(grayHist[gray]) *
+                static_cast<unsigned long long int>(diff * diff);
+        }
+        return static_cast<uint32_t>(grayVar / pixelNum);
+    }
+
+    static float CalcContrastToWhite(float luminanceSum, uint32_t pixelNum)
+    {
+        if (pixelNum == 0) {
+            return 0.0f;
+        }
+        float luminanceAve = luminanceSum / pixelNum;
+        // 0.05 is used to ensure denominator is not 0;
+        return (1 + 0.05) / (luminanceAve + 0.05);
+    }
+
+private:
+    static constexpr double RED_GRAY_RATIO = 0.299;
+    static constexpr double GREEN_GRAY_RATIO = 0.587;
+    static constexpr double BLUE_GRAY_RATIO = 0.114;
+    static constexpr double RED_LUMINACE_RATIO = 0.2126;
+    static constexpr double GREEN_LUMINACE_RATIO = 0.7152;
+    static constexpr double BLUE_LUMINACE_RATIO = 0.0722;
+    static constexpr uint32_t QUANTIZE_SHIFT = 8 - QUANTIZE_WORD_WIDTH;
+    static constexpr uint32_t ARGB_MASK = 0xFF;
+    static constexpr uint32_t ARGB_R_SHIFT = 16;
+    static constexpr uint32_t ARGB_G_SHIFT = 8;
+    static constexpr uint32_t LANE_NUM = 4;
+
+    template<bool withHist, bool withGray, bool withLum>
+    static inline void AccumulateLane(uint32_t r, uint32_t g, uint32_t b, uint32_t quantized, uint32_t* hist,
+        ColorStats* stats, const float* normalizeTable)
+    {
+        if constexpr (withHist) {
+            hist[quantized]++;
+        }
+        if constexpr (withGray) {
+            stats->grayHist[Gray(r, g, b)]++;
+        }
+        if constexpr (withLum) {
+            // keep the pixel order of the sum, float addition is not associative
+            stats->luminanceSum += RelativeLum(normalizeTable[r], normalizeTable[g], normalizeTable[b]);
+        }
+    }
+
+    template<bool withHist, bool withGray, bool withLum>
+    static void Accumulate(const uint32_t* colors, uint32_t len, uint32_t* hist, ColorStats* stats,
+        const float* normalizeTable)
+    {
+        uint32_t i = 0;
+#if defined(RS_COLOR_EXTRACT_KERNEL_NEON) || defined(RS_COLOR_EXTRACT_KERNEL_SSE2)
+        alignas(16) uint32_t red[LANE_NUM];
+        alignas(16) uint32_t green[LANE_NUM];
+        alignas(16) uint32_t blue[LANE_NUM];
+        alignas(16) uint32_t quantized[LANE_NUM];
+        for (; i + LANE_NUM <= len; i += LANE_NUM) {
+#if defined(RS_COLOR_EXTRACT_KERNEL_NEON)
+            uint32x4_t mask = vdupq_n_u32(ARGB_MASK);
+            uint32x4_t pixels = vld1q_u32(colors + i);
+            uint32x4_t r = vandq_u32(vshrq_n_u32(pixels, ARGB_R_SHIFT), mask);
+            uint32x4_t g = vandq_u32(vshrq_n_u32(pixels, ARGB_G_SHIFT), mask);
+            uint32x4_t b = vandq_u32(pixels, mask);
+            uint32x4_t q = vorrq_u32(
+                vorrq_u32(vshlq_n_u32(vshrq_n_u32(r, QUANTIZE_SHIFT), QUANTIZE_WORD_WIDTH + QUANTIZE_WORD_WIDTH),
+                    vshlq_n_u32(vshrq_n_u32(g, QUANTIZE_SHIFT), QUANTIZE_WORD_WIDTH)),
+                vshrq_n_u32(b, QUANTIZE_SHIFT));
+            vst1q_u32(red, r);
+            vst1q_u32(green, g);
+            vst1q_u32(blue, b);
+            vst1q_u32(quantized, q);
+#else
+            __m128i mask = _mm_set1_epi32(ARGB_MASK);
+            __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors + i));
+            __m128i r = _mm_and_si128(_mm_srli_epi32(pixels, ARGB_R_SHIFT), mask);
+            __m128i g = _mm_and_si128(_mm_srli_epi32(pixels, ARGB_G_SHIFT), mask);
+            __m128i b = _mm_and_si128(pixels, mask);
+            __m128i q = _mm_or_si128(_mm_or_si128(
+                _mm_slli_epi32(_mm_srli_epi32(r, QUANTIZE_SHIFT), QUANTIZE_WORD_WIDTH + QUANTIZE_WORD_WIDTH),
+                _mm_slli_epi32(_mm_srli_epi32(g, QUANTIZE_SHIFT), QUANTIZE_WORD_WIDTH)),
+                _mm_srli_epi32(b, QUANTIZE_SHIFT));
+            _mm_store_si128(reinterpret_cast<__m128i*>(red), r);
+            _mm_store_si128(reinterpret_cast<__m128i*>(green), g);
+            _mm_store_si128(reinterpret_cast<__m128i*>(blue), b);
+            _mm_store_si128(reinterpret_cast<__m128i*>(quantized), q);
+#endif
+            for (uint32_t lane = 0; lane < LANE_NUM; lane++) {
+                AccumulateLane<withHist, withGray, withLum>(red[lane], green[lane], blue[lane], quantized[lane],
+                    hist, stats, normalizeTable);
+            }
+        }
+#endif
+        for (; i < len; i++) {
+            uint32_t r = (colors[i] >> ARGB_R_SHIFT) & ARGB_MASK;
+            uint32_t g = (colors[i] >> ARGB_G_SHIFT) & ARGB_MASK;
+            uint32_t b = colors[i] & ARGB_MASK;
+            AccumulateLane<withHist, withGray, withLum>(r, g, b, QuantizeRGB888(r, g, b), hist, stats,
+                normalizeTable);
+        }
+    }
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // RS_COLOR_EXTRACT_KERNEL_H
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RENDER_SERVICE_BASE_RENDER_RENDER_RS_FILTER_RESULT_CACHE_H
+#define RENDER_SERVICE_BASE_RENDER_RENDER_RS_FILTER_RESULT_CACHE_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "common/rs_macros.h"
+#include "image/image.h"
+#include "utils/rect.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+class GPUContext;
+} // namespace Drawing
+
+/*
+ * Filter results shared across render nodes. RSFilterCacheManager caches the result of one node only, so nodes
+ * applying the same filter to the same content (list items, repeated cards) each run the filter. Results here are
+ * keyed by the filter hash, a hash of the input snapshot pixels and the input and output sizes, and evicted least
+ * recently used first once the byte budget is exceeded. Hashing the input reads the snapshot back, which stalls on
+ * a texture backed image, so the cache is off unless a budget is set.
+ * Results are partitioned by gpu context, each partition is owned by the thread that first put a result for the
+ * context, and only that thread gets, evicts or releases its textures. Other threads asking to clear a partition
+ * mark it, and the owner drops the results on its next access.
+ */
+class RSB_EXPORT RSFilterResultCache {
+public:
+    struct Key {
+        uint32_t filterHash = 0;
+        uint64_t contentHash = 0;
+        int32_t srcWidth = 0;
+        int32_t srcHeight = 0;
+        int32_t dstWidth = 0;
+        int32_t dstHeight = 0;
+        // textures can not be shared across gpu contexts, 0 for raster results
+        uint64_t contextId = 0;
+
+        bool operator==(const Key& other) const
+        {
+            return filterHash == other.filterHash && contentHash == other.contentHash &&
+                srcWidth == other.srcWidth && srcHeight == other.srcHeight &&
+                dstWidth == other.dstWidth && dstHeight == other.dstHeight && contextId == other.contextId;
+        }
+    };
+
+    static RSFilterResultCache& Instance();
+
+    // byte budget of each gpu context, 0 disables the cache and drops the cached results
+    void SetByteBudget(size_t byteBudget);
+    size_t GetByteBudget() const;
+    bool IsEnabled() const;
+
+    // hash the pixels of input, false if they can not be read back
+    static bool MakeKey(uint32_t filterHash, const std::shared_ptr<Drawing::Image>& input,
+        const Drawing::RectI& dstRect, uint64_t contextId, Key& key);
+    static uint64_t GetContextId(const Drawing::GPUContext* gpuContext);
+    std::shared_ptr<Drawing::Image> Get(const Key& key);
+    void Put(const Key& key, const std::shared_ptr<Drawing::Image>& result);
+    // drop the results of a gpu context when it purges its resources or before it is destroyed, called on the
+    // thread using the context
+    void ClearContext(uint64_t contextId);
+    void Clear();
+
+    size_t GetCachedBytes() const;
+    size_t GetEntryCount() const;
+    void Dump(std::string& dumpString) const;
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+    using Entry = std::pair<Key, std::shared_ptr<Drawing::Image>>;
+    struct Partition {
+        std::thread::id ownerThread;
+        // most recently used first
+        std::list<Entry> lruList;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> entries;
+        size_t cachedBytes = 0;
+        // set by other threads, the owner drops the results on its next access
+        bool needClear = false;
+    };
+
+    RSFilterResultCache();
+    ~RSFilterResultCache() = default;
+    RSFilterResultCache(const RSFilterResultCache&) = delete;
+    RSFilterResultCache(RSFilterResultCache&&) = delete;
+    RSFilterResultCache& operator=(const RSFilterResultCache&) = delete;
+    RSFilterResultCache& operator=(RSFilterResultCache&&) = delete;
+
+    static size_t GetImageBytes(const std::shared_ptr<Drawing::Image>& image);
+    // the partition of the context if the calling thread owns it, pending clears and budget changes are applied
+    Partition* GetOwnedPartitionLocked(uint64_t contextId, bool create);
+    // drop the partitions owned by the calling thread and mark the others
+    void ClearPartitionsLocked();
+    void EvictLocked(Partition& partition, size_t byteBudget);
+
+    mutable std::mutex mutex_;
+    std::unordered_map<uint64_t, Partition> partitions_;
+    size_t byteBudget_ = 0;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+    uint64_t evictCount_ = 0;
+};
+} // namespace Rosen
+} // namespace OHOS
+#endif // RENDER_SERVICE_BASE_RENDER_RENDER_RS_FILTER_RESULT_CACHE_H
@@ -16,8 +16,11 @@
 #ifndef RENDER_SERVICE_BASE_RENDER_RENDER_RS_IMAGE_CACHE_H
 #define RENDER_SERVICE_BASE_RENDER_RENDER_RS_IMAGE_CACHE_H
 
+#include <array>
+#include <atomic>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include "image/image.h"
@@ -39,6 +42,73 @@ class RSImageBase;
 class RSRenderParams;
 class RSRenderNodeDrawableAdapter;
 class RSImage;
+
+// unordered_map keyed by uniqueId and split into independently locked shards, so that threads touching
+// different images do not contend on a single lock. Visit runs a functor on the shard owning the key with
+// that shard locked; the std-like helpers lock every shard they touch.
+template<typename Value>
+class RSImageCacheShardedMap {
+public:
+    using Map = std::unordered_map<uint64_t, Value>;
+    static constexpr size_t SHARD_COUNT = 16;
+
+    template<typename Func>
+    auto Visit(uint64_t key, Func&& func) const -> decltype(func(std::declval<Map&>()))
+    {
+        auto& shard = shards_[GetShardIndex(key)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return func(shard.map);
+    }
+
+    template<typename... Args>
+    bool emplace(uint64_t key, Args&&... args)
+    {
+        return Visit(key, [&](Map& map) { return map.emplace(key, std::forward<Args>(args)...).second; });
+    }
+
+    size_t erase(uint64_t key)
+    {
+        return Visit(key, [key](Map& map) { return map.erase(key); });
+    }
+
+    size_t size() const
+    {
+        size_t count = 0;
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            count += shard.map.size();
+        }
+        return count;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    void clear()
+    {
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.map.clear();
+        }
+    }
+
+private:
+    struct Shard {
+        std::mutex mutex;
+        Map map;
+    };
+
+    static size_t GetShardIndex(uint64_t key)
+    {
+        // uniqueId is pid << 32 | per-process counter, mix both halves so one process still spreads out
+        return static_cast<size_t>((key ^ (key >> 32)) % SHARD_COUNT);
+    }
+
+    mutable std::array<Shard, SHARD_COUNT> shards_;
+};
+
 class RSB_EXPORT RSImageCache {
 public:
     static RSImageCache& Instance();
@@ -65,6 +135,11 @@ public:
     void CacheRenderDrawingImageByPixelMapId(uint64_t uniqueId, std::shared_ptr<Drawing::Image> img, pid_t tid = -1);
     std::shared_ptr<Drawing::Image> GetRenderDrawingImageCacheByPixelMapId(uint64_t uniqueId, pid_t tid = -1) const;
 
+    // images whose ref count drops to 0 are kept in a LRU list up to this many bytes, 0 disables it
+    void SetReleasedImageBudget(size_t bytes);
+    void PurgeReleasedDrawingImages();
+    void Dump(DfxString& log) const;
+
     RSImageCache() = default;
     ~RSImageCache() = default;
     bool CheckUniqueIdIsEmpty();
@@ -81,16 +156,33 @@ private:
     RSImageCache& operator=(const RSImageCache&&) = delete;
     void ReleaseDrawingImageCacheByPixelMapId(uint64_t uniqueId);
     static bool IsCacheAccessAllowed(uint64_t uniqueId, pid_t callingPid);
+    void RetainReleasedDrawingImage(uint64_t uniqueId, std::shared_ptr<Drawing::Image> img);
+    std::shared_ptr<Drawing::Image> TakeReleasedDrawingImage(uint64_t uniqueId) const;
+    void TrimReleasedDrawingImages(std::vector<std::shared_ptr<Drawing::Image>>& evicted);
 
-    mutable std::mutex mutex_;
     // the second element of pair indicates ref count of skImage/pixelMap by RSImage
     // ref count +1 in RSImage Unmarshalling func and -1 in RSImage destruction func
     // skImage/pixelMap will be removed from cache if ref count decreases to 0
-    std::unordered_map<uint64_t, std::pair<std::shared_ptr<Drawing::Image>, uint64_t>> drawingImageCache_;
-    std::unordered_map<uint64_t, std::pair<std::shared_ptr<Media::PixelMap>, uint64_t>> pixelMapCache_;
-    mutable std::mutex mapMutex_;
-    std::unordered_map<uint64_t, std::unordered_map<pid_t, std::shared_ptr<Drawing::Image>>>
+    RSImageCacheShardedMap<std::pair<std::shared_ptr<Drawing::Image>, uint64_t>> drawingImageCache_;
+    RSImageCacheShardedMap<std::pair<std::shared_ptr<Media::PixelMap>, uint64_t>> pixelMapCache_;
+    RSImageCacheShardedMap<std::unordered_map<pid_t, std::shared_ptr<Drawing::Image>>>
         pixelMapIdRelatedDrawingImageCache_;
+
+    struct ReleasedImage {
+        uint64_t uniqueId = 0;
+        std::shared_ptr<Drawing::Image> image;
+        size_t bytes = 0;
+    };
+    // most recently released image at the front, guarded by releasedImageMutex_
+    mutable std::mutex releasedImageMutex_;
+    mutable std::list<ReleasedImage> releasedImageLru_;
+    mutable std::unordered_map<uint64_t, std::list<ReleasedImage>::iterator> releasedImageIndex_;
+    mutable size_t releasedImageBytes_ = 0;
+    std::atomic<size_t> releasedImageBudget_ = 0;
+    mutable std::atomic<uint64_t> drawingImageHitCount_ = 0;
+    mutable std::atomic<uint64_t> releasedImageHitCount_ = 0;
+    mutable std::atomic<uint64_t> drawingImageMissCount_ = 0;
+    mutable std::atomic<uint64_t> releasedImageEvictionCount_ = 0;
     mutable std::mutex editablePixelMapCacheMutex_;
     std::unordered_map<uint64_t, std::pair<std::shared_ptr<Media::PixelMap>, uint64_t>> editablePixelMapCache_;
     mutable std::mutex editablePixelMapCacheToReleaseMutex_;
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "common/rs_macros.h"
 #include "common/rs_matrix3.h"
@@ -46,13 +47,49 @@ public:
     void SetDrawingPath(const Drawing::Path& path);
     const Drawing::Path& GetDrawingPath() const;
 
+    // Max distance in px between two samples of the position and tangent table used by GetPosTan, 0 to query the
+    // path on every call. With a precision GetPosTan queries the path until it has been called as many times as the
+    // table has samples, then builds the table once and interpolates the two samples around the distance, so a path
+    // sampled for a few frames costs at most twice the direct queries. Between two samples where the path breaks or
+    // turns a corner GetPosTan queries the path instead, and the table is exact at both ends of the path.
+    void SetPosTanPrecision(float precision);
+    float GetPosTanPrecision() const
+    {
+        return posTanPrecision_;
+    }
+
+    // precision the render service uses for path animations
+    static constexpr float DEFAULT_POS_TAN_PRECISION = 0.5f;
+
 private:
     RSPath(const RSPath&) = delete;
     RSPath(const RSPath&&) = delete;
     RSPath& operator=(const RSPath&) = delete;
     RSPath& operator=(const RSPath&&) = delete;
 
+    struct PosTanSample {
+        float x = 0.0f;
+        float y = 0.0f;
+        float tangentX = 0.0f;
+        float tangentY = 0.0f;
+        // false if the path breaks or turns a corner between this sample and the next one
+        bool isContinuous = true;
+    };
+
+    bool GetPosTanByTable(float distance, Vector2f& pos, float& degrees) const;
+    size_t GetPosTanSampleCount() const;
+    bool BuildPosTanTable() const;
+    void ResetPosTanTable();
+
     Drawing::Path* drPath_ = nullptr;
+    float posTanPrecision_ = 0.0f;
+    // lazily built from drPath_, reset when the path or the precision changes
+    mutable bool isDistanceValid_ = false;
+    mutable float distance_ = 0.0f;
+    mutable size_t posTanQueryCount_ = 0;
+    mutable bool isPosTanTableBuilt_ = false;
+    mutable float posTanStep_ = 0.0f;
+    mutable std::vector<PosTanSample> posTanTable_;
 };
 
 template<>
@@ -16,9 +16,11 @@
 #ifndef ROSEN_RENDER_SERVICE_BASE_RS_TRANSACTION_DATA_H
 #define ROSEN_RENDER_SERVICE_BASE_RS_TRANSACTION_DATA_H
 
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <parcel.h>
+#include <unordered_map>
 #include <vector>
 
 #include "common/rs_macros.h"
@@ -61,6 +63,11 @@ public:
     void ProcessBySingleFrameComposer(RSContext& context);
     static void AddAlarmLog(std::function<void(uint64_t, int, int)> func);
 
+    // Runs all tasks and returns once every one of them has finished. When set, runs of node-local
+    // property updates inside a transaction are applied in parallel, grouped by target node.
+    using ParallelApplyFunc = std::function<void(std::vector<std::function<void()>>&)>;
+    static void SetParallelApplyFunc(ParallelApplyFunc func);
+
     void Clear();
 
     uint64_t GetTimestamp() const
@@ -232,9 +239,29 @@ private:
     void MoveCommandByNodeId(std::unique_ptr<RSTransactionData>& transactionData, NodeId nodeId);
     void MoveCommandByNodeIdExcludeTreeCommands(std::unique_ptr<RSTransactionData>& transactionData, NodeId nodeId);
     void MoveAllCommand(std::unique_ptr<RSTransactionData>& transactionData);
+    // replace the command at index with a command of the same type and node, keeping its position in payload
+    bool ReplaceCommand(size_t index, std::unique_ptr<RSCommand>& command);
+
+    // Index in payload of the latest coalescible property update of each node property of one transaction data.
+    struct PropertyUpdateCoalescingState {
+        const RSTransactionData* transactionData = nullptr;
+        unsigned long commandCount = 0;
+        std::unordered_map<NodeId, std::unordered_map<PropertyId, size_t>> lastUpdateIndex;
+    };
+    // An UPDATE_TYPE_OVERWRITE property update replaces the pending update of the same node property, unless another
+    // kind of command was added in between. Returns true when the command replaced one instead of being added.
+    bool AddCommandWithCoalescing(PropertyUpdateCoalescingState& state, std::unique_ptr<RSCommand>& command,
+        NodeId nodeId, FollowType followType);
 
     static bool IsTreeHierarchyCommand(uint16_t commandType, uint16_t commandSubType);
     static const std::set<uint16_t>& GetTreeHierarchyCommandSubTypes();
+    static bool IsNodeLocalCommand(uint16_t commandType, uint16_t commandSubType);
+    static const std::set<uint16_t>& GetNodeLocalCommandSubTypes();
+    static bool CanProcessInParallel(const RSCommand& command);
+
+    void ProcessCommand(RSContext& context, RSCommand* command);
+    void ProcessParallel(RSContext& context);
+    void ProcessStageParallel(RSContext& context, size_t begin, size_t end);
 
     bool UnmarshallingCommand(Parcel& parcel);
 
@@ -258,6 +285,7 @@ private:
     uint64_t syncId_ { 0 };
     uint32_t parcelNumber_ { 0 };
     static std::function<void(uint64_t, int, int)> alarmLogFunc;
+    static ParallelApplyFunc parallelApplyFunc_;
     mutable std::mutex commandMutex_;
     std::vector<uint32_t> commandOffsets_;
     bool dvsyncTimeUpdate_ = false;
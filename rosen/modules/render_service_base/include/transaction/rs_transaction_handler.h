@@ -40,10 +40,8 @@ using CommitTransactionCallback = std::function<void(
     std::shared_ptr<RSRenderPipelineClient>&, std::unique_ptr<RSTransactionData>&&, std::atomic<uint32_t>&)>;
 class RSB_EXPORT RSTransactionHandler : public std::enable_shared_from_this<RSTransactionHandler> {
 public:
-    RSTransactionHandler() = default;
-    RSTransactionHandler(uint64_t token, std::shared_ptr<RSRenderPipelineClient> renderPipelineClient)
-        : token_(token), renderPipelineClient_(renderPipelineClient)
-    {}
+    RSTransactionHandler();
+    RSTransactionHandler(uint64_t token, std::shared_ptr<RSRenderPipelineClient> renderPipelineClient);
     virtual ~RSTransactionHandler() = default;
     void SetRenderThreadClient(std::unique_ptr<RSIRenderClient>& renderThreadClient);
 
@@ -99,6 +97,11 @@ public:
 
     void DumpCommand(std::string& out);
 
+    // When enabled, an UPDATE_TYPE_OVERWRITE property update replaces the pending update of the same node property
+    // in the transaction, unless another kind of command was added in between.
+    void SetPropertyUpdateCoalescingEnabled(bool enabled);
+    uint64_t GetCoalescedCommandCount() const;
+
 private:
     RSTransactionHandler(const RSTransactionHandler&) = delete;
     RSTransactionHandler(const RSTransactionHandler&&) = delete;
@@ -115,6 +118,12 @@ private:
     void ProcessSyncTransactionStack(std::stack<std::unique_ptr<RSTransactionData>>& stack,
         RSIRenderClient& client, uint64_t syncId, uint64_t timestamp, pid_t tid, const std::string& abilityName);
     void SetRSTransactionDataScene(RSTransactionDataScenes scene);
+
+    void AddCommandWithCoalescing(std::unique_ptr<RSTransactionData>& transactionData,
+        RSTransactionData::PropertyUpdateCoalescingState& state, std::unique_ptr<RSCommand>& command, NodeId nodeId,
+        FollowType followType);
+    void ResetPropertyUpdateCoalescing();
+
     // Command Transaction Triggered by UI Thread.
     mutable std::mutex mutex_;
     std::unique_ptr<RSTransactionData> implicitCommonTransactionData_ { std::make_unique<RSTransactionData>() };
@@ -139,6 +148,11 @@ private:
     std::atomic<uint32_t> transactionDataIndex_ = 0;
     TaskRunner taskRunner_ = TaskRunner();
 
+    bool propertyUpdateCoalescingEnabled_ { false };
+    RSTransactionData::PropertyUpdateCoalescingState commonCoalescingState_;
+    RSTransactionData::PropertyUpdateCoalescingState remoteCoalescingState_;
+    std::atomic<uint64_t> coalescedCommandCount_ = 0;
+
     friend class RSUIDirector;
 };
 
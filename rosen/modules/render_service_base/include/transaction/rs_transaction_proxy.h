@@ -86,6 +86,10 @@ public:
         renderPipelineClient_ = rsRenderPipelineClient;
     }
 
+    // Same property update coalescing as RSTransactionHandler, for nodes without an RSUIContext.
+    void SetPropertyUpdateCoalescingEnabled(bool enabled);
+    uint64_t GetCoalescedCommandCount() const;
+
 private:
     RSTransactionProxy();
     virtual ~RSTransactionProxy();
@@ -99,6 +103,10 @@ private:
 
     void AddCommonCommand(std::unique_ptr<RSCommand>& command);
     void AddRemoteCommand(std::unique_ptr<RSCommand>& command, NodeId nodeId, FollowType followType);
+    void AddCommandWithCoalescing(std::unique_ptr<RSTransactionData>& transactionData,
+        RSTransactionData::PropertyUpdateCoalescingState& state, std::unique_ptr<RSCommand>& command, NodeId nodeId,
+        FollowType followType);
+    void ResetPropertyUpdateCoalescing();
 
     // Command Transaction Triggered by UI Thread.
     mutable std::mutex mutex_;
@@ -125,6 +133,11 @@ private:
     uint32_t transactionDataIndex_ = 0;
     std::queue<std::string> taskNames_ {};
     std::mutex closeSyncFallBackMutex_;
+
+    bool propertyUpdateCoalescingEnabled_ { false };
+    RSTransactionData::PropertyUpdateCoalescingState commonCoalescingState_;
+    RSTransactionData::PropertyUpdateCoalescingState remoteCoalescingState_;
+    std::atomic<uint64_t> coalescedCommandCount_ = 0;
 };
 } // namespace Rosen
 } // namespace OHOS
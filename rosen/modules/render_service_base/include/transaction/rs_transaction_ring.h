@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RENDER_SERVICE_BASE_TRANSACTION_RS_TRANSACTION_RING_H
+#define RENDER_SERVICE_BASE_TRANSACTION_RS_TRANSACTION_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <message_parcel.h>
+#include "common/rs_macros.h"
+#include "memory/rs_memory_flow_control.h"
+
+namespace OHOS {
+namespace Rosen {
+// Persistent per-connection single-producer/single-consumer ring on a memfd.
+// It replaces the fresh sealed memfd of ashmem parcels: the client copies a transaction
+// parcel over the ashmem threshold into a slot of the ring and only sends the slot
+// position over binder, and the service copies the slot out once, like an ashmem parcel. The memfd is sent in attach parcels, which carry no
+// transaction, until the service acknowledges the attach in the ring header; until
+// then transactions keep the normal/ashmem parcel path, so none is lost if the
+// service never attaches. Positions are monotonic byte counters, a slot never wraps
+// (the tail of a lap is skipped as padding), and only readPos and the attach
+// acknowledgement live in shared memory: the consumer never trusts anything else the
+// producer can modify.
+class RSB_EXPORT RSTransactionRing {
+public:
+    static constexpr uint32_t RING_MAGIC = 0x52535452; // "RSTR"
+    static constexpr uint32_t RING_VERSION = 1;
+    static constexpr size_t MIN_CAPACITY = 64 * 1024; // 64KB
+    static constexpr size_t MAX_CAPACITY = 64 * 1024 * 1024; // 64MB
+    static constexpr size_t SLOT_ALIGN = 8;
+    static constexpr int32_t RING_PARCEL_FLAG = 2; // 0: normal parcel, 1: ashmem parcel, 2: ring parcel
+    static constexpr int32_t RING_ATTACH_PARCEL_FLAG = 3; // 3: ring fd only, no transaction
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t capacity;
+        std::atomic<uint64_t> readPos;
+        std::atomic<uint32_t> attached; // set by the consumer once it has validated and mapped the ring
+    };
+
+    // producer side: create, map and seal (SEAL|SHRINK|GROW) a ring of the given data capacity
+    static std::unique_ptr<RSTransactionRing> Create(size_t capacity);
+    // consumer side: validate the seals and size of a received memfd, map it and acknowledge the attach,
+    // takes fd ownership
+    static std::unique_ptr<RSTransactionRing> Attach(int fd);
+
+    ~RSTransactionRing();
+
+    // producer: copy size bytes into the next free slot, false if the ring has no room
+    bool Write(const void* data, size_t size, uint64_t& pos);
+    // consumer: copy the slot [pos, pos + size) into a newly malloc'd buffer (caller owns it)
+    // and release it. The slot is copied exactly once so the producer cannot modify the
+    // data after it has been validated.
+    void* CopyOutAndRelease(uint64_t pos, size_t size);
+
+    size_t GetCapacity() const
+    {
+        return capacity_;
+    }
+    uint64_t GetWritePos() const
+    {
+        return localPos_;
+    }
+    uint64_t GetReadPos() const;
+    size_t GetFreeSize() const;
+    // producer: whether the consumer has attached the ring, slots are only sent after that
+    bool IsAttached() const;
+    uint32_t GetAttachRequestCount() const
+    {
+        return attachRequestCount_;
+    }
+    int GetFd() const
+    {
+        return fd_;
+    }
+
+    // producer side: wrap the ring fd into an attach parcel, sent until the consumer acknowledges the attach
+    std::shared_ptr<MessageParcel> CreateAttachParcel();
+    // producer side: wrap the transaction parcel into a ring parcel, nullptr if the ring cannot take it
+    // (not attached yet, binder objects inside, too large, or no room); the caller then keeps the
+    // normal/ashmem parcel
+    std::shared_ptr<MessageParcel> CreateRingParcel(std::shared_ptr<MessageParcel>& dataParcel);
+    // consumer side: attach the ring carried by an attach parcel, a new ring replaces the old one
+    static bool AttachFromParcel(MessageParcel* attachParcel, std::unique_ptr<RSTransactionRing>& ring);
+    // consumer side: parse a ring parcel into a normal parcel
+    static std::shared_ptr<MessageParcel> ParseFromRingParcel(MessageParcel* ringParcel,
+        std::unique_ptr<RSTransactionRing>& ring, std::shared_ptr<AshmemFlowControlUnit>& ashmemFlowControlUnit,
+        pid_t callingPid);
+
+private:
+    RSTransactionRing(int fd, void* base, size_t capacity);
+    static size_t AlignUp(size_t size)
+    {
+        return (size + SLOT_ALIGN - 1) & ~(SLOT_ALIGN - 1);
+    }
+
+    int fd_ = -1;
+    void* base_ = nullptr;
+    Header* header_ = nullptr;
+    uint8_t* data_ = nullptr;
+    size_t capacity_ = 0;
+    // producer: next free position; consumer: end of the last released slot
+    uint64_t localPos_ = 0;
+    uint32_t attachRequestCount_ = 0;
+};
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // RENDER_SERVICE_BASE_TRANSACTION_RS_TRANSACTION_RING_H
@@ -22,6 +22,7 @@
 
 #include "animation/rs_animation_trace_utils.h"
 #include "animation/rs_render_animation.h"
+#include "animation/rs_render_animation_batch.h"
 #include "animation/rs_render_particle_animation.h"
 #include "animation/rs_render_property_animation.h"
 #include "command/rs_animation_command.h"
@@ -32,13 +33,21 @@
 #include "pipeline/rs_paint_filter_canvas.h"
 #include "pipeline/rs_render_node.h"
 #include "platform/common/rs_log.h"
+#include "platform/common/rs_system_properties.h"
 #include "rs_trace.h"
 
 namespace OHOS {
 namespace Rosen {
 class RSRootRenderNode;
 
-RSAnimationManager::RSAnimationManager() : creationTid_(std::this_thread::get_id()) {}
+namespace {
+// with fewer animations on a node the grouping costs more than the calls it saves
+constexpr size_t BATCH_ANIMATE_MIN_COUNT = 4;
+}
+
+RSAnimationManager::RSAnimationManager()
+    : creationTid_(std::this_thread::get_id()), isBatchAnimateEnabled_(RSSystemProperties::GetBatchAnimateEnabled())
+{}
 
 RSAnimationManager::~RSAnimationManager()
 {
@@ -169,13 +178,13 @@ std::tuple<bool, bool, bool> RSAnimationManager::Animate(
     bool isCalculateAnimationValue = false;
     rsRange_.Reset();
     rateDecider_.Reset();
+    auto batch = BatchAnimate(time, minLeftDelayTime, nodeIsOnTheTree, abilityState);
     // iterate and execute all animations, remove finished animations
     EraseIf(animations_, [this, &hasRunningAnimation, time, &needRequestNextVsync, nodeIsOnTheTree,
-        &isCalculateAnimationValue, abilityState, &minLeftDelayTime](auto& iter) -> bool {
+        &isCalculateAnimationValue, abilityState, &minLeftDelayTime, batch](auto& iter) -> bool {
         auto& animation = iter.second;
         // infinite iteration animation out of the tree or in the background does not request vsync
-        if ((!nodeIsOnTheTree || abilityState == RSSurfaceNodeAbilityState::BACKGROUND) &&
-            animation->GetRepeatCount() == -1) {
+        if (IsAnimateSuspended(animation, nodeIsOnTheTree, abilityState)) {
             RS_TRACE_NAME_FMT("InfiniteAnim Suspend animId:%llu nodeId:%llu pid:%d onTree:%d abilityState:%d",
                 animation->GetAnimationId(), animation->GetTargetId(), GetAnimationPid(), nodeIsOnTheTree,
                 static_cast<int>(abilityState));
@@ -193,7 +202,14 @@ std::tuple<bool, bool, bool> RSAnimationManager::Animate(
             animation->Finish();
             animation->RemoveFromGroupAnimator();
         }
-        bool isFinished = animation->Animate(time, minLeftDelayTime, false);
+        // a batched animation has begun its frame already, Animate would take it as animated at time and skip it
+        size_t batchIndex = batch != nullptr ? batch->Find(animation.get()) : 0;
+        bool isFinished = false;
+        if (batch != nullptr && batchIndex < batch->GetSize()) {
+            isFinished = batch->Apply(batchIndex, time, minLeftDelayTime);
+        } else {
+            isFinished = animation->Animate(time, minLeftDelayTime, false);
+        }
         if (isFinished) {
             isCalculateAnimationValue = true;
             OnAnimationFinished(animation);
@@ -213,11 +229,48 @@ std::tuple<bool, bool, bool> RSAnimationManager::Animate(
         }
         return isFinished;
     });
+    if (batch != nullptr) {
+        batch->Clear();
+    }
     rateDecider_.MakeDecision(frameRateGetFunc_);
     isCalculateAnimationValue = isCalculateAnimationValue && nodeIsOnTheTree;
     return { hasRunningAnimation, needRequestNextVsync, isCalculateAnimationValue };
 }
 
+bool RSAnimationManager::IsAnimateSuspended(const std::shared_ptr<RSRenderAnimation>& animation,
+    bool nodeIsOnTheTree, RSSurfaceNodeAbilityState abilityState) const
+{
+    return (!nodeIsOnTheTree || abilityState == RSSurfaceNodeAbilityState::BACKGROUND) &&
+        animation->GetRepeatCount() == -1;
+}
+
+RSRenderAnimationBatch* RSAnimationManager::BatchAnimate(
+    int64_t time, int64_t& minLeftDelayTime, bool nodeIsOnTheTree, RSSurfaceNodeAbilityState abilityState)
+{
+    // animations in the background are finished one by one
+    if (!isBatchAnimateEnabled_ || abilityState == RSSurfaceNodeAbilityState::BACKGROUND ||
+        animations_.size() < BATCH_ANIMATE_MIN_COUNT) {
+        return nullptr;
+    }
+    if (batch_ == nullptr) {
+        batch_ = std::make_unique<RSRenderAnimationBatch>();
+    }
+    batch_->Clear();
+    // the fraction only depends on the animation itself, the values are written in the order of animations_ later
+    for (const auto& [id, animation] : animations_) {
+        if (!IsAnimateSuspended(animation, nodeIsOnTheTree, abilityState)) {
+            batch_->Add(*animation, time, minLeftDelayTime);
+        }
+    }
+    if (batch_->GetSize() == 0) {
+        return nullptr;
+    }
+    RS_OPTIONAL_TRACE_NAME_FMT("RSAnimationManager::BatchAnimate batched %zu of %zu animations", batch_->GetSize(),
+        animations_.size());
+    batch_->Evaluate();
+    return batch_.get();
+}
+
 void RSAnimationManager::SetRateDeciderSize(float width, float height)
 {
     rateDecider_.SetNodeSize(width, height);
@@ -31,6 +31,7 @@
 #include "animation/rs_spring_interpolator.h"
 #include "animation/rs_steps_interpolator.h"
 #include "platform/common/rs_log.h"
+#include "render/rs_path.h"
 #include "transaction/rs_marshalling_helper.h"
 
 namespace OHOS {
@@ -652,6 +653,10 @@ bool RSRenderPathAnimation::ParseParam(Parcel& parcel)
         ROSEN_LOGE("RSRenderPathAnimation::ParseParam, Parse values failed");
         return false;
     }
+    if (animationPath_ != nullptr) {
+        // the unmarshalled path is only used by this animation, sample it once instead of measuring every frame
+        animationPath_->SetPosTanPrecision(RSPath::DEFAULT_POS_TAN_PRECISION);
+    }
     SetInterpolator(interpolator);
     SetRotationMode(static_cast<RotationMode>(rotationMode));
     SetIsNeedPath(isNeedPath);
@@ -15,6 +15,7 @@
 
 #include "animation/rs_cubic_bezier_interpolator.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "platform/common/rs_log.h"
@@ -40,6 +41,21 @@ inline float GetCubicBezierValue(const float time, const float ctl1, const float
     return three * oneMinusTime * oneMinusTime * time * ctl1 + three * oneMinusTime * time * time * ctl2 +
            time * time * time;
 }
+
+// derivative of GetCubicBezierValue with respect to time
+inline float GetCubicBezierSlope(const float time, const float ctl1, const float ctl2)
+{
+    constexpr float three = 3.0f;
+    constexpr float six = 6.0f;
+    const float oneMinusTime = 1.0f - time;
+    return three * oneMinusTime * oneMinusTime * ctl1 + six * oneMinusTime * time * (ctl2 - ctl1) +
+           three * time * time * (1.0f - ctl2);
+}
+
+// below this slope a Newton step may jump out of the sample interval, bisection is used instead
+constexpr float NEWTON_MIN_SLOPE = 0.02f;
+constexpr int NEWTON_ITERATIONS = 4;
+constexpr int BISECTION_MAX_ITERATIONS = 20;
 } // namespace
 
 RSCubicBezierInterpolator::RSCubicBezierInterpolator(float ctlX1, float ctlY1, float ctlX2, float ctlY2)
@@ -52,41 +68,105 @@ RSCubicBezierInterpolator::RSCubicBezierInterpolator(float ctlX1, float ctlY1, f
         controlX2_ = DEFAULT_BEZIER_CTL_X2;
         controlY2_ = DEFAULT_BEZIER_CTL_Y2;
     }
+    InitSampleTable();
 }
 
 RSCubicBezierInterpolator::RSCubicBezierInterpolator(uint64_t id, float ctlX1, float ctlY1, float ctlX2, float ctlY2)
     : RSInterpolator(id), controlX1_(ctlX1), controlY1_(ctlY1), controlX2_(ctlX2), controlY2_(ctlY2)
-{}
+{
+    InitSampleTable();
+}
 
-float RSCubicBezierInterpolator::InterpolateImpl(float input) const
+void RSCubicBezierInterpolator::InitSampleTable()
 {
-    constexpr float ONE = 1.0f;
-    if (ROSEN_EQ(input, ONE, 1e-6f)) {
-        return ONE;
+    isLinear_ = controlX1_ == controlY1_ && controlX2_ == controlY2_;
+    for (size_t i = 0; i < SAMPLE_TABLE_SIZE; i++) {
+        sampleTable_[i] = GetCubicBezierValue(SAMPLE_STEP * i, controlX1_, controlX2_);
     }
-    return GetCubicBezierValue(SEARCH_STEP * BinarySearch(input), controlY1_, controlY2_);
 }
 
-int RSCubicBezierInterpolator::BinarySearch(float key) const
+float RSCubicBezierInterpolator::SolveCurveX(float x) const
 {
-    int low = 0;
-    int high = MAX_RESOLUTION;
-    int middle = 0;
-    float approximation = 0.0;
-    constexpr float epsilon = 1e-6f;
-    while (low <= high) {
-        middle = (static_cast<unsigned int>(low + high)) >> 1;
-        approximation = GetCubicBezierValue(SEARCH_STEP * middle, controlX1_, controlX2_);
-        if (ROSEN_EQ(approximation, key, epsilon)) {
-            // Early exit if the key is found within an acceptable error range
+    // last sample interval whose start is not after x, x(t) is increasing for control x in [0, 1]
+    size_t index = 0;
+    while (index + 2 < SAMPLE_TABLE_SIZE && sampleTable_[index + 1] <= x) {
+        index++;
+    }
+    float intervalStart = SAMPLE_STEP * index;
+    float sampleDelta = sampleTable_[index + 1] - sampleTable_[index];
+    float guess = intervalStart;
+    if (sampleDelta > 0.0f) {
+        guess += std::clamp((x - sampleTable_[index]) / sampleDelta, 0.0f, 1.0f) * SAMPLE_STEP;
+    }
+
+    if (GetCubicBezierSlope(guess, controlX1_, controlX2_) >= NEWTON_MIN_SLOPE) {
+        for (int i = 0; i < NEWTON_ITERATIONS; i++) {
+            float slope = GetCubicBezierSlope(guess, controlX1_, controlX2_);
+            if (slope < NEWTON_MIN_SLOPE) {
+                break;
+            }
+            float step = (GetCubicBezierValue(guess, controlX1_, controlX2_) - x) / slope;
+            guess = std::clamp(guess - step, 0.0f, 1.0f);
+            if (std::fabs(step) <= SOLVE_PRECISION) {
+                return guess;
+            }
+        }
+    }
+
+    float low = intervalStart;
+    float high = intervalStart + SAMPLE_STEP;
+    for (int i = 0; i < BISECTION_MAX_ITERATIONS && high - low > SOLVE_PRECISION; i++) {
+        float middle = low + (high - low) / 2.0f;
+        float diff = GetCubicBezierValue(middle, controlX1_, controlX2_) - x;
+        if (diff == 0.0f) {
             return middle;
-        } else if (approximation < key) {
-            low = middle + 1;
+        }
+        if (diff < 0.0f) {
+            low = middle;
         } else {
-            high = middle - 1;
+            high = middle;
         }
     }
-    return low;
+    return low + (high - low) / 2.0f;
+}
+
+float RSCubicBezierInterpolator::InterpolateInput(float input) const
+{
+    constexpr float ONE = 1.0f;
+    if (ROSEN_EQ(input, ONE, 1e-6f) || input > ONE) {
+        return ONE;
+    }
+    // also maps NaN to the start of the curve
+    if (!(input > 0.0f)) {
+        return 0.0f;
+    }
+    if (isLinear_) {
+        return input;
+    }
+    return GetCubicBezierValue(SolveCurveX(input), controlY1_, controlY2_);
+}
+
+bool RSCubicBezierInterpolator::IsSameCurve(RSInterpolator& other) const
+{
+    if (other.GetType() != InterpolatorType::CUBIC_BEZIER) {
+        return false;
+    }
+    // the output only depends on the control points, so they have to be exactly equal
+    const auto& curve = static_cast<const RSCubicBezierInterpolator&>(other);
+    return controlX1_ == curve.controlX1_ && controlY1_ == curve.controlY1_ && controlX2_ == curve.controlX2_ &&
+        controlY2_ == curve.controlY2_;
+}
+
+float RSCubicBezierInterpolator::InterpolateImpl(float input) const
+{
+    return InterpolateInput(input);
+}
+
+void RSCubicBezierInterpolator::InterpolateBatchImpl(const float* inputs, float* outputs, size_t count) const
+{
+    for (size_t i = 0; i < count; i++) {
+        outputs[i] = InterpolateInput(inputs[i]);
+    }
 }
 } // namespace Rosen
 } // namespace OHOS
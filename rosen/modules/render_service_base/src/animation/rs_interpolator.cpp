@@ -68,6 +68,21 @@ float RSInterpolator::Interpolate(float input)
     return prevOutput_;
 }
 
+void RSInterpolator::Interpolate(const float* inputs, float* outputs, size_t count) const
+{
+    if (inputs == nullptr || outputs == nullptr) {
+        return;
+    }
+    InterpolateBatchImpl(inputs, outputs, count);
+}
+
+void RSInterpolator::InterpolateBatchImpl(const float* inputs, float* outputs, size_t count) const
+{
+    for (size_t i = 0; i < count; i++) {
+        outputs[i] = InterpolateImpl(inputs[i]);
+    }
+}
+
 RSCustomInterpolator::RSCustomInterpolator(
     uint64_t id, const std::vector<float>&& times, const std::vector<float>&& values)
     : RSInterpolator(id), times_(times), values_(values)
@@ -25,6 +25,16 @@ namespace Rosen {
 
 ParticleFieldBase::~ParticleFieldBase() = default;
 
+void ParticleFieldBase::ApplyBatch(const float* posX, const float* posY, float* forceX, float* forceY,
+    size_t count, float deltaTime)
+{
+    for (size_t i = 0; i < count; ++i) {
+        Vector2f force = Apply(Vector2f(posX[i], posY[i]), deltaTime);
+        forceX[i] += force.x_;
+        forceY[i] += force.y_;
+    }
+}
+
 bool ParticleFieldBase::IsPointInRegion(const Vector2f& point) const
 {
     return false;
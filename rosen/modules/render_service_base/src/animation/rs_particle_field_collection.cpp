@@ -71,6 +71,18 @@ Vector2f ParticleFieldCollection::ApplyAll(const Vector2f& position, float delta
     return total;
 }
 
+void ParticleFieldCollection::ApplyAllBatch(const float* posX, const float* posY, float* forceX, float* forceY,
+    size_t count, float deltaTime)
+{
+    std::fill(forceX, forceX + count, 0.0f);
+    std::fill(forceY, forceY + count, 0.0f);
+    for (const auto& field : fields_) {
+        if (field != nullptr) {
+            field->ApplyBatch(posX, posY, forceX, forceY, count, deltaTime);
+        }
+    }
+}
+
 void ParticleFieldCollection::UpdateAll(float deltaTime)
 {
     for (const auto& field : fields_) {
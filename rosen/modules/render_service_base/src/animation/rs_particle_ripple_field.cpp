@@ -50,10 +50,32 @@ void ParticleRippleField::UpdateRipple(float deltaTime)
 
 float ParticleRippleField::CalculateForceStrength(float distance)
 {
+    return CalculateForceStrength(distance, CalculateWaveTerms());
+}
+
+ParticleRippleField::WaveTerms ParticleRippleField::CalculateWaveTerms() const
+{
+    WaveTerms terms;
     const float t  = std::max(0.0f, lifeTime_);
-    const float ct = waveSpeed_ * t;
+    terms.ct = waveSpeed_ * t;
+    terms.gateWidth = std::max(1.0f, 0.05f * wavelength_);
+    terms.decay = std::exp(-attenuation_ * std::min(t, K_MAX_EXP_TIME));
+    terms.sigma = std::max(1.0f, 0.15f * wavelength_);
+    terms.tailW = 0.25f * wavelength_;
+
+    const float residual  = 0.50f;
+    const float areaRatio = 1.0f - residual;
+    terms.recoilCoeff = areaRatio * terms.sigma * (static_cast<float>(M_PI) * 0.5f)
+                        / std::max(1e-3f, terms.tailW);
+    const float dtTail = 0.5f * terms.tailW / std::max(1e-3f, waveSpeed_);
+    terms.recoilCoeff *= std::exp(attenuation_ * dtTail);
+    return terms;
+}
 
-    const float gateWidth = std::max(1.0f, 0.05f * wavelength_);
+float ParticleRippleField::CalculateForceStrength(float distance, const WaveTerms& terms) const
+{
+    const float ct = terms.ct;
+    const float gateWidth = terms.gateWidth;
     float gate = 0.0f;
     if (distance <= ct - gateWidth) {
         gate = 1.0f;
@@ -64,11 +86,9 @@ float ParticleRippleField::CalculateForceStrength(float distance)
         gate = x * x * (3.0f - 2.0f * x);
     }
 
-    const float decay = std::exp(-attenuation_ * std::min(t, K_MAX_EXP_TIME));
-
     const float radialAtten = 1.0f / (1.0f + 0.002f * distance);
 
-    const float sigma = std::max(1.0f, 0.15f * wavelength_);
+    const float sigma = terms.sigma;
     const float d = distance - ct;
 
     float band = 0.0f;
@@ -77,23 +97,14 @@ float ParticleRippleField::CalculateForceStrength(float distance)
         band = 0.5f * (1.0f + std::cos(static_cast<float>(M_PI) * x));
     }
 
-    const float tailW     = 0.25f * wavelength_;
-    const float residual  = 0.50f;
-    const float areaRatio = 1.0f - residual;
-
-    float recoilCoeff = areaRatio * sigma * (static_cast<float>(M_PI) * 0.5f)
-                        / std::max(1e-3f, tailW);
-
-    const float dtTail = 0.5f * tailW / std::max(1e-3f, waveSpeed_);
-    recoilCoeff *= std::exp(attenuation_ * dtTail);
-
+    const float tailW = terms.tailW;
     float tail = 0.0f;
     if (d < 0.0f && d >= -tailW) {
         float u = (-d) / std::max(1e-6f, tailW);
-        tail = recoilCoeff * std::sin(static_cast<float>(M_PI) * u);
+        tail = terms.recoilCoeff * std::sin(static_cast<float>(M_PI) * u);
     }
 
-    float disp = amplitude_ * decay * radialAtten * (band - tail);
+    float disp = amplitude_ * terms.decay * radialAtten * (band - tail);
 
     return gate * disp;
 }
@@ -132,6 +143,28 @@ Vector2f ParticleRippleField::Apply(const Vector2f& position, float deltaTime)
     return ApplyRippleField(position, deltaTime);
 }
 
+// The wave terms are shared by all particles of one frame, so they are evaluated once per batch.
+void ParticleRippleField::ApplyBatch(const float* posX, const float* posY, float* forceX, float* forceY,
+    size_t count, float deltaTime)
+{
+    const WaveTerms terms = CalculateWaveTerms();
+    for (size_t i = 0; i < count; ++i) {
+        Vector2f particlePos(posX[i], posY[i]);
+        if (!ParticleRippleField::IsPointInRegion(particlePos)) {
+            continue;
+        }
+        Vector2f to = particlePos - center_;
+        float r = std::sqrt(to.x_ * to.x_ + to.y_ * to.y_);
+        if (ROSEN_EQ(r, 0.0f)) {
+            continue;
+        }
+        float disp = CalculateForceStrength(r, terms);
+        if (!std::isfinite(disp)) disp = 0.0f;
+        forceX[i] += to.x_ / r * disp;
+        forceY[i] += to.y_ / r * disp;
+    }
+}
+
 void ParticleRippleField::Update(float deltaTime)
 {
     UpdateRipple(deltaTime);
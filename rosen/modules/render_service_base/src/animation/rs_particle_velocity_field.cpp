@@ -73,6 +73,56 @@ Vector2f ParticleVelocityField::Apply(const Vector2f& position, float deltaTime)
     return ApplyVelocityField(position, deltaTime);
 }
 
+// Same region test as IsPointInRegion with the shape switch hoisted out of the loop, so that each case
+// is a branch-free loop over the position arrays.
+void ParticleVelocityField::ApplyBatch(const float* posX, const float* posY, float* forceX, float* forceY,
+    size_t count, float deltaTime)
+{
+    const float vx = velocity_.x_;
+    const float vy = velocity_.y_;
+    const float cx = regionPosition_.x_;
+    const float cy = regionPosition_.y_;
+    const float radiusX = regionSize_.x_ / 2.0f;
+    const float radiusY = regionSize_.y_ / 2.0f;
+    switch (regionShape_) {
+        case ShapeType::RECT:
+            for (size_t i = 0; i < count; ++i) {
+                bool inside = std::abs(posX[i] - cx) <= radiusX && std::abs(posY[i] - cy) <= radiusY;
+                forceX[i] += inside ? vx : 0.0f;
+                forceY[i] += inside ? vy : 0.0f;
+            }
+            break;
+        case ShapeType::CIRCLE: {
+            const float radiusSquared = radiusX * radiusX;
+            for (size_t i = 0; i < count; ++i) {
+                float dx = posX[i] - cx;
+                float dy = posY[i] - cy;
+                bool inside = dx * dx + dy * dy <= radiusSquared;
+                forceX[i] += inside ? vx : 0.0f;
+                forceY[i] += inside ? vy : 0.0f;
+            }
+            break;
+        }
+        case ShapeType::ELLIPSE: {
+            if (radiusX < 1e-6f || radiusY < 1e-6f) {
+                break;
+            }
+            const float radiusXSquared = radiusX * radiusX;
+            const float radiusYSquared = radiusY * radiusY;
+            for (size_t i = 0; i < count; ++i) {
+                float dx = posX[i] - cx;
+                float dy = posY[i] - cy;
+                bool inside = (dx * dx) / radiusXSquared + (dy * dy) / radiusYSquared <= 1.0f;
+                forceX[i] += inside ? vx : 0.0f;
+                forceY[i] += inside ? vy : 0.0f;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
 bool ParticleVelocityField::Equals(const ParticleFieldBase& rhs) const
 {
     const auto& other = static_cast<const ParticleVelocityField&>(rhs);
@@ -15,6 +15,8 @@
 
 #include "animation/rs_render_animation.h"
 
+#include <tuple>
+
 #include "animation/rs_render_interactive_implict_animator.h"
 #include "command/rs_animation_command.h"
 #include "common/rs_optional_trace.h"
@@ -378,32 +380,48 @@ bool RSRenderAnimation::Animate(int64_t time, int64_t& minLeftDelayTime, bool is
         OnInitialize(time, isCustom);
     }
 
-    // calculate frame time interval in seconds
-    double frameInterval = (time - animationFraction_.GetLastFrameTime()) * 1.0 / NS_TO_S;
-
-    // convert time to fraction
-    auto [fraction, isInStartDelay, isFinished, isRepeatFinished] =
-        animationFraction_.GetAnimationFraction(time, minLeftDelayTime, isCustom);
-    currentFraction_ = fraction;
-    if (isInStartDelay) {
+    auto frame = BeginAnimateFrame(time, minLeftDelayTime, isCustom);
+    if (frame.isInStartDelay) {
         calculateAnimationValue_ = false;
-        ProcessFillModeOnStart(fraction);
+        ProcessFillModeOnStart(frame.fraction);
         return false;
     }
 
     RecordLastAnimateValue();
-    if (OnAnimate(fraction)) {
-        isFinished = true;
-    }
-    DumpFraction(fraction, time);
-    UpdateAnimateVelocity(frameInterval);
+    return EndAnimateFrame(time, frame, OnAnimate(frame.fraction));
+}
+
+bool RSRenderAnimation::CanBeginAnimateFrame(int64_t time) const
+{
+    return IsRunning() && !needUpdateStartTime_ && !needInitialize_ && time != animationFraction_.GetLastFrameTime();
+}
+
+RSRenderAnimation::AnimateFrame RSRenderAnimation::BeginAnimateFrame(
+    int64_t time, int64_t& minLeftDelayTime, bool isCustom)
+{
+    AnimateFrame frame;
+    // calculate frame time interval in seconds
+    frame.frameInterval = (time - animationFraction_.GetLastFrameTime()) * 1.0 / NS_TO_S;
+
+    // convert time to fraction
+    std::tie(frame.fraction, frame.isInStartDelay, frame.isFinished, frame.isRepeatFinished) =
+        animationFraction_.GetAnimationFraction(time, minLeftDelayTime, isCustom);
+    currentFraction_ = frame.fraction;
+    return frame;
+}
+
+bool RSRenderAnimation::EndAnimateFrame(int64_t time, const AnimateFrame& frame, bool isAnimateFinished)
+{
+    bool isFinished = frame.isFinished || isAnimateFinished;
+    DumpFraction(frame.fraction, time);
+    UpdateAnimateVelocity(frame.frameInterval);
 
-    if (isRepeatFinished) {
+    if (frame.isRepeatFinished) {
         ProcessOnRepeatFinish();
     }
     if (isFinished) {
         RS_PROFILER_ANIMATION_DURATION_STOP(id_, time);
-        ProcessFillModeOnFinish(fraction);
+        ProcessFillModeOnFinish(frame.fraction);
         if (isGroupAnimationChild_) {
             RS_TRACE_NAME_FMT("RSRenderAnimation::Animate Animation[%llu] animate state change to GROUP_WAITING", id_);
             state_ = AnimationState::GROUP_WAITING;
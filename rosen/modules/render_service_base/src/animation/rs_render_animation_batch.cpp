@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "animation/rs_render_animation_batch.h"
+
+#include "animation/rs_render_curve_animation.h"
+
+namespace OHOS {
+namespace Rosen {
+bool RSRenderAnimationBatch::IsSupportedType(RSPropertyType type)
+{
+    switch (type) {
+        case RSPropertyType::FLOAT:
+        case RSPropertyType::VECTOR2F:
+        case RSPropertyType::VECTOR4F:
+        case RSPropertyType::RS_COLOR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+template<typename T>
+size_t RSRenderAnimationBatch::CurveGroup<T>::Add(RSCurveValueEstimator<T>* estimator, size_t fractionIndex)
+{
+    estimators.push_back(estimator);
+    fractionIndices.push_back(fractionIndex);
+    startValues.push_back(estimator->GetStartValue());
+    endValues.push_back(estimator->GetEndValue());
+    return estimators.size() - 1;
+}
+
+template<typename T>
+void RSRenderAnimationBatch::CurveGroup<T>::Evaluate(const std::vector<float>& fractions)
+{
+    size_t size = estimators.size();
+    values.resize(size);
+    for (size_t i = 0; i < size; i++) {
+        values[i] = RSValueEstimator::Estimate(fractions[fractionIndices[i]], startValues[i], endValues[i]);
+    }
+}
+
+template<typename T>
+void RSRenderAnimationBatch::CurveGroup<T>::Clear()
+{
+    estimators.clear();
+    fractionIndices.clear();
+    startValues.clear();
+    endValues.clear();
+    values.clear();
+}
+
+template<typename T>
+size_t RSRenderAnimationBatch::AddCurve(CurveGroup<T>& group, RSRenderCurveAnimation& animation, float fraction)
+{
+    fractions_.push_back(fraction);
+    interpolators_.push_back(animation.interpolator_.get());
+    // the estimator of a curve animation is the RSCurveValueEstimator of its property type
+    return group.Add(static_cast<RSCurveValueEstimator<T>*>(animation.valueEstimator_.get()), fractions_.size() - 1);
+}
+
+bool RSRenderAnimationBatch::Add(RSRenderAnimation& animation, int64_t time, int64_t& minLeftDelayTime)
+{
+    if (!animation.CanBeginAnimateFrame(time) || !animation.IsBatchable()) {
+        return false;
+    }
+    // only RSRenderCurveAnimation is batchable
+    Item item;
+    item.animation = static_cast<RSRenderCurveAnimation*>(&animation);
+    item.type = item.animation->property_->GetPropertyType();
+    // calculateAnimationValue_ is embedded modify for stat animate frame drop
+    animation.calculateAnimationValue_ = true;
+    item.frame = animation.BeginAnimateFrame(time, minLeftDelayTime, false);
+    if (!item.frame.isInStartDelay) {
+        switch (item.type) {
+            case RSPropertyType::FLOAT:
+                item.slot = AddCurve(floatCurves_, *item.animation, item.frame.fraction);
+                break;
+            case RSPropertyType::VECTOR2F:
+                item.slot = AddCurve(vector2fCurves_, *item.animation, item.frame.fraction);
+                break;
+            case RSPropertyType::VECTOR4F:
+                item.slot = AddCurve(vector4fCurves_, *item.animation, item.frame.fraction);
+                break;
+            default:
+                item.slot = AddCurve(colorCurves_, *item.animation, item.frame.fraction);
+                break;
+        }
+    }
+    items_.push_back(item);
+    return true;
+}
+
+void RSRenderAnimationBatch::InterpolateFractions()
+{
+    // animations started together mostly share their curve, so the fractions of one curve are gathered and
+    // interpolated in one call instead of one virtual call per animation
+    size_t size = fractions_.size();
+    isInterpolated_.assign(size, 0);
+    for (size_t first = 0; first < size; first++) {
+        if (isInterpolated_[first] != 0) {
+            continue;
+        }
+        auto curve = interpolators_[first];
+        curveIndices_.clear();
+        curveInputs_.clear();
+        for (size_t i = first; i < size; i++) {
+            if (isInterpolated_[i] == 0 && (i == first || curve->IsSameCurve(*interpolators_[i]))) {
+                isInterpolated_[i] = 1;
+                curveIndices_.push_back(i);
+                curveInputs_.push_back(fractions_[i]);
+            }
+        }
+        curveOutputs_.resize(curveInputs_.size());
+        curve->Interpolate(curveInputs_.data(), curveOutputs_.data(), curveInputs_.size());
+        for (size_t i = 0; i < curveIndices_.size(); i++) {
+            fractions_[curveIndices_[i]] = curveOutputs_[i];
+        }
+    }
+}
+
+void RSRenderAnimationBatch::Evaluate()
+{
+    InterpolateFractions();
+    floatCurves_.Evaluate(fractions_);
+    vector2fCurves_.Evaluate(fractions_);
+    vector4fCurves_.Evaluate(fractions_);
+    colorCurves_.Evaluate(fractions_);
+}
+
+size_t RSRenderAnimationBatch::Find(const RSRenderAnimation* animation)
+{
+    size_t size = items_.size();
+    for (size_t i = 0; i < size; i++) {
+        size_t index = (findStart_ + i) % size;
+        if (items_[index].animation == animation) {
+            findStart_ = index + 1;
+            return index;
+        }
+    }
+    return size;
+}
+
+template<typename T>
+void RSRenderAnimationBatch::ApplyValue(CurveGroup<T>& group, const Item& item)
+{
+    // same as RSRenderCurveAnimation::OnAnimateInner with the interpolator and the estimate done in Evaluate
+    item.animation->SetValueFraction(fractions_[group.fractionIndices[item.slot]]);
+    group.estimators[item.slot]->UpdateAnimationValueByInterpolation(group.values[item.slot],
+        item.animation->GetAdditive());
+}
+
+bool RSRenderAnimationBatch::Apply(size_t index, int64_t time, int64_t& minLeftDelayTime)
+{
+    if (index >= items_.size()) {
+        return false;
+    }
+    const auto& item = items_[index];
+    auto animation = item.animation;
+    if (!animation->IsRunning()) {
+        return animation->Animate(time, minLeftDelayTime, false);
+    }
+    if (item.frame.isInStartDelay) {
+        animation->calculateAnimationValue_ = false;
+        animation->ProcessFillModeOnStart(item.frame.fraction);
+        return false;
+    }
+
+    animation->RecordLastAnimateValue();
+    switch (item.type) {
+        case RSPropertyType::FLOAT:
+            ApplyValue(floatCurves_, item);
+            break;
+        case RSPropertyType::VECTOR2F:
+            ApplyValue(vector2fCurves_, item);
+            break;
+        case RSPropertyType::VECTOR4F:
+            ApplyValue(vector4fCurves_, item);
+            break;
+        default:
+            ApplyValue(colorCurves_, item);
+            break;
+    }
+    return animation->EndAnimateFrame(time, item.frame, false);
+}
+
+void RSRenderAnimationBatch::Clear()
+{
+    items_.clear();
+    fractions_.clear();
+    interpolators_.clear();
+    findStart_ = 0;
+    floatCurves_.Clear();
+    vector2fCurves_.Clear();
+    vector4fCurves_.Clear();
+    colorCurves_.Clear();
+}
+} // namespace Rosen
+} // namespace OHOS
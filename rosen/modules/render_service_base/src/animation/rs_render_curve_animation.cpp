@@ -16,6 +16,7 @@
 #include "animation/rs_render_curve_animation.h"
 
 #include "animation/rs_animation_trace_utils.h"
+#include "animation/rs_render_animation_batch.h"
 #include "animation/rs_value_estimator.h"
 #include "pipeline/rs_render_node.h"
 #include "platform/common/rs_log.h"
@@ -93,6 +94,13 @@ void RSRenderCurveAnimation::OnAnimateInner(float fraction, const std::shared_pt
     valueEstimator_->UpdateAnimationValue(interpolatorValue, GetAdditive());
 }
 
+bool RSRenderCurveAnimation::IsBatchable() const
+{
+    // the estimator is the RSCurveValueEstimator of the property type, created in InitValueEstimator
+    return GetPropertyId() != 0 && interpolator_ != nullptr && valueEstimator_ != nullptr && property_ != nullptr &&
+        RSRenderAnimationBatch::IsSupportedType(property_->GetPropertyType());
+}
+
 void RSRenderCurveAnimation::InitValueEstimator()
 {
     if (valueEstimator_ == nullptr) {
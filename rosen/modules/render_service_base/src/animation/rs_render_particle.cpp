@@ -608,6 +608,11 @@ int64_t RSRenderParticle::GetActiveTime()
     return activeTime_;
 }
 
+int64_t RSRenderParticle::GetLifeTime() const
+{
+    return lifeTime_;
+}
+
 const std::shared_ptr<ParticleRenderParams>& RSRenderParticle::GetParticleRenderParams()
 {
     return particleParams_;
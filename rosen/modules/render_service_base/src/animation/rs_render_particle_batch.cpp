@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "animation/rs_render_particle_batch.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "common/rs_common_def.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr float DEGREE_TO_RADIAN = M_PI / 180;
+constexpr size_t COLOR_CHANNEL_COUNT = 4;
+
+// stable in-place removal of the entries whose keep flag is 0
+template<typename T>
+void CompactArray(std::vector<T>& values, const std::vector<uint8_t>& keep, size_t keptCount)
+{
+    size_t write = 0;
+    for (size_t read = 0; read < values.size(); ++read) {
+        if (keep[read] == 0) {
+            continue;
+        }
+        if (write != read) {
+            values[write] = std::move(values[read]);
+        }
+        ++write;
+    }
+    values.resize(keptCount);
+}
+} // namespace
+
+RSRenderParticleBatch::RSRenderParticleBatch(const std::shared_ptr<ParticleRenderParams>& particleParams)
+    : particleParams_(particleParams)
+{
+    if (particleParams_ != nullptr) {
+        infiniteLife_ = particleParams_->GetLifeTimeStartValue() == (-1 * NS_PER_MS) &&
+            particleParams_->GetLifeTimeEndValue() == (-1 * NS_PER_MS);
+    }
+}
+
+void RSRenderParticleBatch::Adopt(const std::vector<std::shared_ptr<RSRenderParticle>>& particles)
+{
+    for (const auto& particle : particles) {
+        if (particle == nullptr) {
+            continue;
+        }
+        particles_.push_back(particle);
+        const auto& position = particle->GetPosition();
+        positionX_.push_back(position.x_);
+        positionY_.push_back(position.y_);
+        const auto& velocity = particle->GetVelocity();
+        velocityX_.push_back(velocity.x_);
+        velocityY_.push_back(velocity.y_);
+        const auto& acceleration = particle->GetAcceleration();
+        accelerationX_.push_back(acceleration.x_);
+        accelerationY_.push_back(acceleration.y_);
+        accelerationValue_.push_back(particle->GetAccelerationValue());
+        accelerationValueSpeed_.push_back(particle->GetAccelerationValueSpeed());
+        accelerationAngle_.push_back(particle->GetAccelerationAngle());
+        accelerationAngleSpeed_.push_back(particle->GetAccelerationAngleSpeed());
+        opacity_.push_back(particle->GetOpacity());
+        opacitySpeed_.push_back(particle->GetOpacitySpeed());
+        scale_.push_back(particle->GetScale());
+        scaleSpeed_.push_back(particle->GetScaleSpeed());
+        spin_.push_back(particle->GetSpin());
+        spinSpeed_.push_back(particle->GetSpinSpeed());
+        color_.push_back(particle->GetColor());
+        colorF_[0].push_back(particle->GetRedF());
+        colorF_[1].push_back(particle->GetGreenF());
+        colorF_[2].push_back(particle->GetBlueF());
+        colorF_[3].push_back(particle->GetAlphaF());
+        colorSpeed_[0].push_back(particle->GetRedSpeed());
+        colorSpeed_[1].push_back(particle->GetGreenSpeed());
+        colorSpeed_[2].push_back(particle->GetBlueSpeed());
+        colorSpeed_[3].push_back(particle->GetAlphaSpeed());
+        activeTime_.push_back(particle->GetActiveTime());
+        lifeTime_.push_back(particle->GetLifeTime());
+        dead_.push_back(particle->IsAlive() ? 0 : 1);
+    }
+}
+
+void RSRenderParticleBatch::Clear()
+{
+    particles_.clear();
+    for (auto* values : { &positionX_, &positionY_, &velocityX_, &velocityY_, &accelerationX_, &accelerationY_,
+        &accelerationValue_, &accelerationValueSpeed_, &accelerationAngle_, &accelerationAngleSpeed_, &opacity_,
+        &opacitySpeed_, &scale_, &scaleSpeed_, &spin_, &spinSpeed_, &forceX_, &forceY_ }) {
+        values->clear();
+    }
+    for (size_t channel = 0; channel < COLOR_CHANNEL_COUNT; ++channel) {
+        colorF_[channel].clear();
+        colorSpeed_[channel].clear();
+    }
+    color_.clear();
+    activeTime_.clear();
+    lifeTime_.clear();
+    dead_.clear();
+}
+
+void RSRenderParticleBatch::RemoveDeadParticles()
+{
+    size_t count = dead_.size();
+    std::vector<uint8_t> keep(count, 0);
+    size_t keptCount = 0;
+    if (particles_.size() == count) {
+        for (size_t i = 0; i < count; ++i) {
+            keep[i] = dead_[i] == 0 && (infiniteLife_ || activeTime_[i] < lifeTime_[i]);
+            keptCount += keep[i];
+        }
+    }
+    if (keptCount == count) {
+        return;
+    }
+    CompactArray(particles_, keep, keptCount);
+    for (auto* values : { &positionX_, &positionY_, &velocityX_, &velocityY_, &accelerationX_, &accelerationY_,
+        &accelerationValue_, &accelerationValueSpeed_, &accelerationAngle_, &accelerationAngleSpeed_, &opacity_,
+        &opacitySpeed_, &scale_, &scaleSpeed_, &spin_, &spinSpeed_ }) {
+        CompactArray(*values, keep, keptCount);
+    }
+    for (size_t channel = 0; channel < COLOR_CHANNEL_COUNT; ++channel) {
+        CompactArray(colorF_[channel], keep, keptCount);
+        CompactArray(colorSpeed_[channel], keep, keptCount);
+    }
+    CompactArray(color_, keep, keptCount);
+    CompactArray(activeTime_, keep, keptCount);
+    CompactArray(lifeTime_, keep, keptCount);
+    CompactArray(dead_, keep, keptCount);
+}
+
+void RSRenderParticleBatch::Update(int64_t deltaTime, const std::shared_ptr<ParticleFieldCollection>& fields)
+{
+    RemoveDeadParticles();
+    if (particles_.empty() || particleParams_ == nullptr) {
+        return;
+    }
+    float dt = static_cast<float>(deltaTime) / NS_TO_S;
+    UpdateFloatAttribute(accelerationValue_, accelerationValueSpeed_,
+        particleParams_->GetAccelerationValueUpdator(), particleParams_->GetAcceValChangeOverLife(), dt);
+    UpdateFloatAttribute(accelerationAngle_, accelerationAngleSpeed_,
+        particleParams_->GetAccelerationAngleUpdator(), particleParams_->GetAcceAngChangeOverLife(), dt);
+    UpdateColor(dt);
+    UpdateOpacity(dt);
+    UpdateScale(dt);
+    UpdateFloatAttribute(spin_, spinSpeed_, particleParams_->GetSpinUpdator(),
+        particleParams_->GetSpinChangeOverLife(), dt);
+    UpdatePosition(fields, dt);
+    size_t count = activeTime_.size();
+    for (size_t i = 0; i < count; ++i) {
+        activeTime_[i] += deltaTime;
+    }
+    WriteBack();
+}
+
+void RSRenderParticleBatch::UpdateFloatAttribute(std::vector<float>& values, const std::vector<float>& speeds,
+    ParticleUpdator updator, const std::vector<std::shared_ptr<ChangeInOverLife<float>>>& curves, float dt)
+{
+    size_t count = values.size();
+    if (updator == ParticleUpdator::RANDOM) {
+        float* value = values.data();
+        const float* speed = speeds.data();
+        for (size_t i = 0; i < count; ++i) {
+            value[i] += speed[i] * dt;
+        }
+    } else if (updator == ParticleUpdator::CURVE) {
+        for (size_t i = 0; i < count; ++i) {
+            effector_.UpdateCurveValue(values[i], curves, activeTime_[i] / NS_PER_MS);
+        }
+    }
+}
+
+// RANDOM: same per channel stepping as RSRenderParticleEffector::CalculateColorInt, which persists the
+// fraction of the last stepped channel as the red fraction
+void RSRenderParticleBatch::UpdateColor(float dt)
+{
+    if (particleParams_->GetParticleType() == ParticleType::IMAGES) {
+        return;
+    }
+    size_t count = color_.size();
+    auto colorUpdator = particleParams_->GetColorUpdator();
+    if (colorUpdator == ParticleUpdator::RANDOM) {
+        for (size_t i = 0; i < count; ++i) {
+            Color& color = color_[i];
+            int16_t channels[COLOR_CHANNEL_COUNT] = {
+                color.GetRed(), color.GetGreen(), color.GetBlue(), color.GetAlpha() };
+            float lastF = colorF_[0][i];
+            for (size_t channel = 0; channel < COLOR_CHANNEL_COUNT; ++channel) {
+                float speed = colorSpeed_[channel][i];
+                if ((channels[channel] <= 0 && speed <= 0.f) || (channels[channel] >= UINT8_MAX && speed >= 0.f)) {
+                    continue;
+                }
+                float colorF = colorF_[channel][i] + speed * dt;
+                if (std::abs(colorF) >= 1.f) {
+                    channels[channel] += static_cast<int16_t>(colorF);
+                    colorF -= std::floor(colorF);
+                }
+                lastF = colorF;
+                channels[channel] = std::clamp<int16_t>(channels[channel], 0, UINT8_MAX);
+            }
+            colorF_[0][i] = lastF;
+            color.SetRed(channels[0]);
+            color.SetGreen(channels[1]);
+            color.SetBlue(channels[2]);
+            color.SetAlpha(channels[3]);
+        }
+    } else if (colorUpdator == ParticleUpdator::CURVE) {
+        auto& curves = particleParams_->GetColorChangeOverLife();
+        for (size_t i = 0; i < count; ++i) {
+            effector_.UpdateColorCurveValue(color_[i], curves, activeTime_[i] / NS_PER_MS);
+        }
+    }
+}
+
+void RSRenderParticleBatch::UpdateOpacity(float dt)
+{
+    auto opacityUpdator = particleParams_->GetOpacityUpdator();
+    size_t count = opacity_.size();
+    if (opacityUpdator == ParticleUpdator::RANDOM) {
+        float* opacity = opacity_.data();
+        const float* speed = opacitySpeed_.data();
+        uint8_t* dead = dead_.data();
+        for (size_t i = 0; i < count; ++i) {
+            bool fadedOut = opacity[i] <= 0 && speed[i] <= 0;
+            bool saturated = opacity[i] >= 1.0 && speed[i] >= 0.f;
+            float stepped = std::clamp<float>(opacity[i] + speed[i] * dt, 0.f, 1.f);
+            dead[i] |= fadedOut ? 1 : 0;
+            opacity[i] = (fadedOut || saturated) ? opacity[i] : stepped;
+        }
+    } else if (opacityUpdator == ParticleUpdator::CURVE) {
+        auto& curves = particleParams_->GetOpacityChangeOverLife();
+        for (size_t i = 0; i < count; ++i) {
+            effector_.UpdateCurveValue(opacity_[i], curves, activeTime_[i] / NS_PER_MS);
+        }
+    }
+}
+
+void RSRenderParticleBatch::UpdateScale(float dt)
+{
+    auto scaleUpdator = particleParams_->GetScaleUpdator();
+    size_t count = scale_.size();
+    if (scaleUpdator == ParticleUpdator::RANDOM) {
+        float* scale = scale_.data();
+        const float* speed = scaleSpeed_.data();
+        uint8_t* dead = dead_.data();
+        for (size_t i = 0; i < count; ++i) {
+            bool shrunk = scale[i] <= 0 && speed[i] <= 0;
+            dead[i] |= shrunk ? 1 : 0;
+            scale[i] = shrunk ? scale[i] : scale[i] + speed[i] * dt;
+        }
+    } else if (scaleUpdator == ParticleUpdator::CURVE) {
+        auto& curves = particleParams_->GetScaleChangeOverLife();
+        for (size_t i = 0; i < count; ++i) {
+            effector_.UpdateCurveValue(scale_[i], curves, activeTime_[i] / NS_PER_MS);
+        }
+    }
+}
+
+void RSRenderParticleBatch::UpdatePosition(const std::shared_ptr<ParticleFieldCollection>& fields, float dt)
+{
+    size_t count = positionX_.size();
+    forceX_.resize(count);
+    forceY_.resize(count);
+    if (fields != nullptr) {
+        fields->ApplyAllBatch(positionX_.data(), positionY_.data(), forceX_.data(), forceY_.data(), count, dt);
+    } else {
+        std::fill(forceX_.begin(), forceX_.end(), 0.f);
+        std::fill(forceY_.begin(), forceY_.end(), 0.f);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        float angle = accelerationAngle_[i] * DEGREE_TO_RADIAN;
+        float accelerationX = accelerationValue_[i] * std::cos(angle);
+        float accelerationY = accelerationValue_[i] * std::sin(angle);
+        accelerationX_[i] = accelerationX;
+        accelerationY_[i] = accelerationY;
+        if (!(ROSEN_EQ(accelerationX, 0.f) && ROSEN_EQ(accelerationY, 0.f))) {
+            velocityX_[i] += accelerationX * dt;
+            velocityY_[i] += accelerationY * dt;
+        }
+        float velocityX = velocityX_[i] + forceX_[i];
+        float velocityY = velocityY_[i] + forceY_[i];
+        if (!(ROSEN_EQ(velocityX, 0.f) && ROSEN_EQ(velocityY, 0.f))) {
+            positionX_[i] += velocityX * dt;
+            positionY_[i] += velocityY * dt;
+        }
+    }
+}
+
+void RSRenderParticleBatch::WriteBack()
+{
+    size_t count = particles_.size();
+    for (size_t i = 0; i < count; ++i) {
+        auto& particle = particles_[i];
+        particle->SetPosition(Vector2f(positionX_[i], positionY_[i]));
+        particle->SetVelocity(Vector2f(velocityX_[i], velocityY_[i]));
+        particle->SetAcceleration(Vector2f(accelerationX_[i], accelerationY_[i]));
+        particle->SetAccelerationValue(accelerationValue_[i]);
+        particle->SetAccelerationAngle(accelerationAngle_[i]);
+        particle->SetOpacity(opacity_[i]);
+        particle->SetScale(scale_[i]);
+        particle->SetSpin(spin_[i]);
+        particle->SetColor(color_[i]);
+        particle->SetRedF(colorF_[0][i]);
+        particle->SetActiveTime(activeTime_[i]);
+        if (dead_[i] != 0) {
+            particle->SetIsDead();
+        }
+    }
+}
+} // namespace Rosen
+} // namespace OHOS
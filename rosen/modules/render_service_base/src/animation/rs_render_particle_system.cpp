@@ -20,6 +20,7 @@
 
 #include "animation/rs_particle_ripple_field.h"
 #include "platform/common/rs_log.h"
+#include "platform/common/rs_system_properties.h"
 namespace OHOS {
 namespace Rosen {
 RSRenderParticleSystem::RSRenderParticleSystem(
@@ -32,6 +33,7 @@ RSRenderParticleSystem::RSRenderParticleSystem(
 void RSRenderParticleSystem::CreateEmitter()
 {
     size_t index = 0;
+    int batchUpdateMinCount = RSSystemProperties::GetParticleBatchUpdateMinCount();
     for (size_t iter = 0; iter < particlesRenderParams_.size(); iter++) {
         auto& particleRenderParams = particlesRenderParams_[iter];
         if (particleRenderParams != nullptr) {
@@ -41,6 +43,10 @@ void RSRenderParticleSystem::CreateEmitter()
                 imageVector_.push_back(image);
             }
             emitters_.push_back(std::make_shared<RSRenderParticleEmitter>(particleRenderParams));
+            bool batchUpdate = batchUpdateMinCount > 0 &&
+                std::max(particleRenderParams->GetParticleCount(), particleRenderParams->GetEmitRate()) >=
+                batchUpdateMinCount;
+            batches_.push_back(batchUpdate ? std::make_shared<RSRenderParticleBatch>(particleRenderParams) : nullptr);
         }
     }
 }
@@ -48,6 +54,34 @@ void RSRenderParticleSystem::CreateEmitter()
 void RSRenderParticleSystem::ClearEmitter()
 {
     emitters_.clear();
+    for (auto& batch : batches_) {
+        if (batch != nullptr) {
+            auto& particles = batch->GetParticles();
+            releasedParticles_.insert(releasedParticles_.end(), particles.begin(), particles.end());
+        }
+    }
+    batches_.clear();
+}
+
+void RSRenderParticleSystem::SetEmitterBatchUpdate(size_t emitterIndex, bool enable)
+{
+    if (emitterIndex >= emitters_.size() || emitters_[emitterIndex] == nullptr) {
+        return;
+    }
+    batches_.resize(emitters_.size());
+    auto& batch = batches_[emitterIndex];
+    if (enable && batch == nullptr) {
+        batch = std::make_shared<RSRenderParticleBatch>(emitters_[emitterIndex]->GetParticleParams());
+    } else if (!enable && batch != nullptr) {
+        auto& particles = batch->GetParticles();
+        releasedParticles_.insert(releasedParticles_.end(), particles.begin(), particles.end());
+        batch = nullptr;
+    }
+}
+
+bool RSRenderParticleSystem::IsEmitterBatchUpdate(size_t emitterIndex) const
+{
+    return emitterIndex < batches_.size() && batches_[emitterIndex] != nullptr;
 }
 
 void RSRenderParticleSystem::Emit(int64_t deltaTime, std::vector<std::shared_ptr<RSRenderParticle>>& activeParticles,
@@ -57,7 +91,11 @@ void RSRenderParticleSystem::Emit(int64_t deltaTime, std::vector<std::shared_ptr
         if (emitters_[iter] != nullptr) {
             emitters_[iter]->EmitParticle(deltaTime);
             auto& particles = emitters_[iter]->GetParticles();
-            activeParticles.insert(activeParticles.end(), particles.begin(), particles.end());
+            if (iter < batches_.size() && batches_[iter] != nullptr) {
+                batches_[iter]->Adopt(particles);
+            } else {
+                activeParticles.insert(activeParticles.end(), particles.begin(), particles.end());
+            }
         }
     }
     imageVector = imageVector_;
@@ -66,7 +104,14 @@ void RSRenderParticleSystem::Emit(int64_t deltaTime, std::vector<std::shared_ptr
 void RSRenderParticleSystem::UpdateParticle(
     int64_t deltaTime, std::vector<std::shared_ptr<RSRenderParticle>>& activeParticles)
 {
-    if (activeParticles.empty()) {
+    DetachBatchParticles(activeParticles);
+    if (!releasedParticles_.empty()) {
+        activeParticles.insert(activeParticles.end(), releasedParticles_.begin(), releasedParticles_.end());
+        releasedParticles_.clear();
+    }
+    bool hasBatchParticles = std::any_of(batches_.begin(), batches_.end(),
+        [](const auto& batch) { return batch != nullptr && batch->GetParticleCount() > 0; });
+    if (activeParticles.empty() && !hasBatchParticles) {
         return;
     }
     // Prefer unified particleFields_ if available, fall back to old separate fields
@@ -93,6 +138,73 @@ void RSRenderParticleSystem::UpdateParticle(
             }
         }
     }
+    if (hasBatchParticles) {
+        UpdateBatches(deltaTime, activeParticles);
+    }
+}
+
+void RSRenderParticleSystem::DetachBatchParticles(std::vector<std::shared_ptr<RSRenderParticle>>& activeParticles)
+{
+    if (batchBlockSize_ == 0) {
+        return;
+    }
+    if (batchBlockBegin_ + batchBlockSize_ <= activeParticles.size() &&
+        activeParticles[batchBlockBegin_].get() == batchBlockFront_) {
+        auto begin = activeParticles.begin() + static_cast<std::ptrdiff_t>(batchBlockBegin_);
+        activeParticles.erase(begin, begin + static_cast<std::ptrdiff_t>(batchBlockSize_));
+    } else {
+        // activeParticles was rebuilt by the owner, the batched particles went with it
+        ClearBatches();
+    }
+    batchBlockBegin_ = 0;
+    batchBlockSize_ = 0;
+    batchBlockFront_ = nullptr;
+}
+
+void RSRenderParticleSystem::UpdateBatches(
+    int64_t deltaTime, std::vector<std::shared_ptr<RSRenderParticle>>& activeParticles)
+{
+    auto fields = particleFields_;
+    if (fields == nullptr && HasAnyField()) {
+        // same field order as the deprecated bridge in RSRenderParticleEffector::Update
+        fields = std::make_shared<ParticleFieldCollection>();
+        if (particleNoiseFields_) {
+            for (auto& f : particleNoiseFields_->fields_) {
+                fields->Add(f);
+            }
+        }
+        if (particleRippleFields_) {
+            for (auto& f : particleRippleFields_->rippleFields_) {
+                fields->Add(f);
+            }
+        }
+        if (particleVelocityFields_) {
+            for (auto& f : particleVelocityFields_->velocityFields_) {
+                fields->Add(f);
+            }
+        }
+    }
+    batchBlockBegin_ = activeParticles.size();
+    for (auto& batch : batches_) {
+        if (batch == nullptr) {
+            continue;
+        }
+        batch->Update(deltaTime, fields);
+        auto& particles = batch->GetParticles();
+        activeParticles.insert(activeParticles.end(), particles.begin(), particles.end());
+    }
+    batchBlockSize_ = activeParticles.size() - batchBlockBegin_;
+    batchBlockFront_ = batchBlockSize_ > 0 ? activeParticles[batchBlockBegin_].get() : nullptr;
+}
+
+void RSRenderParticleSystem::ClearBatches()
+{
+    for (auto& batch : batches_) {
+        if (batch != nullptr) {
+            batch->Clear();
+        }
+    }
+    releasedParticles_.clear();
 }
 
 void RSRenderParticleSystem::Warmup(int64_t totalTimeNs,
@@ -101,6 +213,7 @@ void RSRenderParticleSystem::Warmup(int64_t totalTimeNs,
     if (totalTimeNs <= 0) {
         return;
     }
+    ClearBatches();
     WarmupFields(totalTimeNs);
     for (auto& emitter : emitters_) {
         WarmupEmitter(emitter, totalTimeNs, activeParticles);
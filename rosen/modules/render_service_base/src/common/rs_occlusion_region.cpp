@@ -353,6 +353,8 @@ void Region::RegionOpAccelate(Region& r1, const Region& r2, Region& res, Region:
 {
     RectsPtr lhs(r1.CBegin(), r1.Size());
     RectsPtr rhs(r2.CBegin(), r2.Size());
+    // the result usually has about as many rects as both inputs, reserve them before the first span is flushed
+    res.GetRegionRectsRef().reserve(r1.Size() + r2.Size());
     Assembler assembler(res);
     OuterLooper outer(lhs, rhs);
     Rect current(0, 0, 0, 0); // init value is irrelevant
@@ -379,8 +381,17 @@ void Region::RegionOpAccelate(Region& r1, const Region& r2, Region& res, Region:
 
 Region& Region::OperationSelf(const Region& r, Region::OP op)
 {
-    Region r1(*this);
-    RegionOp(r1, r, *this, op);
+    if (&r == this) {
+        Region r1(*this);
+        RegionOp(r1, r, *this, op);
+        return *this;
+    }
+    // Move the current rects to a per-thread lhs instead of copying them. The lhs gives back its old buffer, so
+    // the result is assembled into memory kept from earlier ops and no vector is allocated per op.
+    thread_local Region lhs;
+    std::swap(lhs.rects_, rects_);
+    std::swap(lhs.bound_, bound_);
+    RegionOp(lhs, r, *this, op);
     return *this;
 }
 
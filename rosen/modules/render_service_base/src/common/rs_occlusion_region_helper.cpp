@@ -17,6 +17,13 @@
 namespace OHOS {
 namespace Rosen {
 namespace Occlusion {
+std::vector<Rect>& Assembler::GetRowBuffer()
+{
+    // region ops never nest, so one span buffer per thread serves every op and keeps its capacity
+    thread_local std::vector<Rect> rowBuffer;
+    return rowBuffer;
+}
+
 
 void Assembler::Insert(const Rect&r)
 {
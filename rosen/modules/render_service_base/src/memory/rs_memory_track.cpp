@@ -93,14 +93,14 @@ MemoryTrack& MemoryTrack::Instance()
 
 void MemoryTrack::RegisterNodeMem(const pid_t pid, size_t size, MEMORY_TYPE type)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     if (pid == 0) {
         return;
     }
-
-    RS_LOGD("MemoryTrack::RegisterNodeMem: nodeMemOfPid_ map size = %s",
-        std::to_string(nodeMemOfPid_.size()).c_str());
-    auto& memData = nodeMemOfPid_[pid];
+    auto& shard = GetNodeShard(pid);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    RS_LOGD("MemoryTrack::RegisterNodeMem: nodeMemOfPid map size = %s",
+        std::to_string(shard.nodeMemOfPid.size()).c_str());
+    auto& memData = shard.nodeMemOfPid[pid];
     switch (type) {
         case MEMORY_TYPE::MEM_RENDER_NODE:
             memData.first += size;
@@ -118,9 +118,10 @@ void MemoryTrack::RegisterNodeMem(const pid_t pid, size_t size, MEMORY_TYPE type
 
 void MemoryTrack::UnRegisterNodeMem(const pid_t pid, size_t size, MEMORY_TYPE type)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = nodeMemOfPid_.find(pid);
-    if (it != nodeMemOfPid_.end()) {
+    auto& shard = GetNodeShard(pid);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.nodeMemOfPid.find(pid);
+    if (it != shard.nodeMemOfPid.end()) {
         auto& memData = it->second;
         switch (type) {
             case MEMORY_TYPE::MEM_RENDER_NODE:
@@ -147,16 +148,17 @@ void MemoryTrack::UnRegisterNodeMem(const pid_t pid, size_t size, MEMORY_TYPE ty
         }
         // remove no exist pid
         if (memData.first == 0 && memData.second == 0) {
-            nodeMemOfPid_.erase(it);
+            shard.nodeMemOfPid.erase(it);
         }
     }
 }
 
 size_t MemoryTrack::GetNodeMemoryOfPid(const pid_t pid, MEMORY_TYPE type)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto itr = nodeMemOfPid_.find(pid);
-    if (itr == nodeMemOfPid_.end()) {
+    auto& shard = GetNodeShard(pid);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto itr = shard.nodeMemOfPid.find(pid);
+    if (itr == shard.nodeMemOfPid.end()) {
         return 0;
     }
     switch (type) {
@@ -177,12 +179,14 @@ size_t MemoryTrack::GetNodeMemoryOfPid(const pid_t pid, MEMORY_TYPE type)
 
 void MemoryTrack::AddNodeRecord(const NodeId id, const MemoryInfo& info)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    auto& shard = GetNodeShard(ExtractPid(id));
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto& memNodeOfPidMap = shard.memNodeOfPidMap;
     MemoryNodeOfPid nodeInfoOfPid(info.size, id);
-    auto itr = memNodeMap_.find(id);
-    if (itr == memNodeMap_.end()) {
-        memNodeMap_.emplace(id, info);
-        memNodeOfPidMap_[info.pid].push_back(nodeInfoOfPid);
+    auto itr = shard.memNodeMap.find(id);
+    if (itr == shard.memNodeMap.end()) {
+        shard.memNodeMap.emplace(id, info);
+        memNodeOfPidMap[info.pid].push_back(nodeInfoOfPid);
         return;
     } else if (info.size > itr->second.size) {
         nodeInfoOfPid.SetMemSize(itr->second.size);
@@ -191,49 +195,52 @@ void MemoryTrack::AddNodeRecord(const NodeId id, const MemoryInfo& info)
         return;
     }
     
-    if (memNodeOfPidMap_.find(info.pid) != memNodeOfPidMap_.end()) {
-        auto pidMemItr = std::find(memNodeOfPidMap_[info.pid].begin(),
-            memNodeOfPidMap_[info.pid].end(), nodeInfoOfPid);
-        if (pidMemItr != memNodeOfPidMap_[info.pid].end()) {
+    if (memNodeOfPidMap.find(info.pid) != memNodeOfPidMap.end()) {
+        auto pidMemItr = std::find(memNodeOfPidMap[info.pid].begin(),
+            memNodeOfPidMap[info.pid].end(), nodeInfoOfPid);
+        if (pidMemItr != memNodeOfPidMap[info.pid].end()) {
             pidMemItr->SetMemSize(info.size);
         } else {
             nodeInfoOfPid.SetMemSize(info.size);
-            memNodeOfPidMap_[info.pid].push_back(nodeInfoOfPid);
+            memNodeOfPidMap[info.pid].push_back(nodeInfoOfPid);
         }
     } else {
         nodeInfoOfPid.SetMemSize(info.size);
-        memNodeOfPidMap_[info.pid].push_back(nodeInfoOfPid);
+        memNodeOfPidMap[info.pid].push_back(nodeInfoOfPid);
     }
 }
 
 bool MemoryTrack::RemoveNodeFromMap(const NodeId id, pid_t& pid, size_t& size)
 {
-    auto itr = memNodeMap_.find(id);
-    if (itr == memNodeMap_.end()) {
+    auto& memNodeMap = GetNodeShard(ExtractPid(id)).memNodeMap;
+    auto itr = memNodeMap.find(id);
+    if (itr == memNodeMap.end()) {
         RS_LOGD("MemoryTrack::RemoveNodeFromMap no this nodeId = %{public}" PRIu64, id);
         return false;
     }
-    pid = static_cast<pid_t>(memNodeMap_[id].pid);
-    size = memNodeMap_[id].size;
-    memNodeMap_.erase(itr);
+    pid = static_cast<pid_t>(itr->second.pid);
+    size = itr->second.size;
+    memNodeMap.erase(itr);
     return true;
 }
 
 void MemoryTrack::RemoveNodeOfPidFromMap(const pid_t pid, const size_t size, const NodeId id)
 {
-    if (memNodeOfPidMap_.find(pid) == memNodeOfPidMap_.end()) {
+    auto& memNodeOfPidMap = GetNodeShard(ExtractPid(id)).memNodeOfPidMap;
+    auto pidItr = memNodeOfPidMap.find(pid);
+    if (pidItr == memNodeOfPidMap.end()) {
         return;
     }
     MemoryNodeOfPid nodeInfoOfPid = {size, id};
-    auto itr = std::find(memNodeOfPidMap_[pid].begin(), memNodeOfPidMap_[pid].end(), nodeInfoOfPid);
-    if (itr != memNodeOfPidMap_[pid].end()) {
-        memNodeOfPidMap_[pid].erase(itr);
+    auto itr = std::find(pidItr->second.begin(), pidItr->second.end(), nodeInfoOfPid);
+    if (itr != pidItr->second.end()) {
+        pidItr->second.erase(itr);
     }
 }
 
 void MemoryTrack::RemoveNodeRecord(const NodeId id)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> lock(GetNodeShard(ExtractPid(id)).mutex);
     pid_t pid = 0;
     size_t size = 0;
     bool isSuccess = RemoveNodeFromMap(id, pid, size);
@@ -245,63 +252,78 @@ void MemoryTrack::RemoveNodeRecord(const NodeId id)
 
 MemoryGraphic MemoryTrack::CountRSMemory(const pid_t pid)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     MemoryGraphic memoryGraphic;
-    auto itr = memNodeOfPidMap_.find(pid);
-    if (itr == memNodeOfPidMap_.end()) {
+    bool hasNodeOfPid = false;
+    uint64_t totalMemSize = 0;
+    // the nodes of pid are kept in the shards of their node ids
+    for (auto& shard : nodeShards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto itr = shard.memNodeOfPidMap.find(pid);
+        if (itr == shard.memNodeOfPidMap.end()) {
+            continue;
+        }
+        if (itr->second.empty()) {
+            shard.memNodeOfPidMap.erase(itr);
+            continue;
+        }
+        hasNodeOfPid = true;
+        for (auto& info : itr->second) {
+            totalMemSize += static_cast<uint64_t>(info.GetMemSize());
+        }
+    }
+    if (!hasNodeOfPid) {
         return memoryGraphic;
     }
-    auto nodeInfoOfPid = memNodeOfPidMap_[pid];
-    if (nodeInfoOfPid.empty()) {
-        memNodeOfPidMap_.erase(pid);
-    } else {
-        uint64_t totalMemSize = 0;
-        std::for_each(nodeInfoOfPid.begin(), nodeInfoOfPid.end(), [&totalMemSize](MemoryNodeOfPid& info) {
-            totalMemSize += static_cast<uint64_t>(info.GetMemSize());
-        });
-
-        for (auto it = memPicRecord_.begin(); it != memPicRecord_.end(); it++) {
+    for (auto& shard : picShards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto it = shard.memPicRecord.begin(); it != shard.memPicRecord.end(); it++) {
             pid_t picPid = static_cast<pid_t>(it->second.pid);
             if (pid == picPid) {
                 totalMemSize += static_cast<uint64_t>(it->second.size);
             }
         }
-        memoryGraphic.SetPid(pid);
-        memoryGraphic.SetCpuMemorySize(totalMemSize);
     }
+    memoryGraphic.SetPid(pid);
+    memoryGraphic.SetCpuMemorySize(totalMemSize);
     return memoryGraphic;
 }
 
 float MemoryTrack::GetAppMemorySizeInMB()
 {
-    float total = 0.f;
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (auto& [_, memInfo] : memPicRecord_) {
-        total += static_cast<float>(memInfo.size);
-    }
+    float total = static_cast<float>(picTotalSize_.load(std::memory_order_relaxed));
     return total / BYTE_CONVERT / BYTE_CONVERT / 2; // app mem account for 50%
 }
 
 void MemoryTrack::DumpMemoryStatistics(DfxString& log,
     std::function<std::tuple<uint64_t, std::string, RectI, bool> (uint64_t)> func, bool isLite)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     DumpMemoryPicStatistics(log, func, isLite);
     DumpMemoryNodeStatistics(log, isLite);
 }
 
+std::unordered_map<const void*, MemoryInfo> MemoryTrack::CollectPictureRecords()
+{
+    std::unordered_map<const void*, MemoryInfo> memPicRecord;
+    for (auto& shard : picShards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        memPicRecord.insert(shard.memPicRecord.begin(), shard.memPicRecord.end());
+    }
+    return memPicRecord;
+}
+
 void MemoryTrack::DumpMemoryNodeStatistics(DfxString& log, bool isLite)
 {
     if (!isLite) {
         return;
     }
-    RS_TRACE_NAME_FMT("MemoryTrack::DumpMemoryNodeStatistics record size:%d", memNodeMap_.size());
+    auto memNodeMap = GetMemNodeMap();
+    RS_TRACE_NAME_FMT("MemoryTrack::DumpMemoryNodeStatistics record size:%d", memNodeMap.size());
     log.AppendFormat("\nRSRenderNode:\n");
     uint64_t totalSize = 0;
     int count = 0;
     std::unordered_map<int, int> pidCountMap; // replace getNodeInfo
     // calculate by byte
-    for (auto& [nodeId, info] : memNodeMap_) {
+    for (auto& [nodeId, info] : memNodeMap) {
         // total of all
         totalSize += static_cast<uint64_t>(info.size);
         count++;
@@ -318,15 +340,18 @@ void MemoryTrack::DumpMemoryNodeStatistics(DfxString& log, bool isLite)
 
 void MemoryTrack::RemovePidRecord(const pid_t pid)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    memNodeOfPidMap_.erase(pid);
+    for (auto& shard : nodeShards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.memNodeOfPidMap.erase(pid);
+    }
 }
 
 void MemoryTrack::UpdatePictureInfo(const void* addr, NodeId nodeId, pid_t pid)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto itr = memPicRecord_.find(addr);
-    if (itr != memPicRecord_.end()) {
+    auto& shard = GetPicShard(addr);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto itr = shard.memPicRecord.find(addr);
+    if (itr != shard.memPicRecord.end()) {
         itr->second.pid = static_cast<uint32_t>(pid);
         itr->second.nid = nodeId;
     }
@@ -467,11 +492,13 @@ std::string MemoryTrack::GenerateDetail(MemoryInfo info, uint64_t wId, std::stri
 void MemoryTrack::DumpMemoryPicStatistics(DfxString& log,
     std::function<std::tuple<uint64_t, std::string, RectI, bool>(uint64_t)> func, bool isLite)
 {
-    RS_TRACE_NAME_FMT("MemoryTrack::DumpMemoryPicStatistics memPicRecord_ size:%d", memPicRecord_.size());
+    // func looks up render nodes, call it on a snapshot instead of under the shard locks
+    auto memPicRecord = CollectPictureRecords();
+    RS_TRACE_NAME_FMT("MemoryTrack::DumpMemoryPicStatistics memPicRecord_ size:%d", memPicRecord.size());
     log.AppendFormat("RSImageCache:\n");
     MemoryStats stats;
     if (!isLite) log.AppendFormat("%s:\n", GenerateDumpTitle().c_str());
-    for (auto& [addr, info] : memPicRecord_) {
+    for (auto& [addr, info] : memPicRecord) {
         int64_t size = static_cast<int64_t>(info.size / BYTE_CONVERT);
         stats.arrTotal[info.type] += size;
         stats.arrCount[info.type]++;
@@ -516,8 +543,12 @@ void MemoryTrack::DumpMemoryPicStatistics(DfxString& log,
 
 void MemoryTrack::AddPictureRecord(const void* addr, MemoryInfo info)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    memPicRecord_.emplace(addr, info);
+    auto& shard = GetPicShard(addr);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.memPicRecord.emplace(addr, info).second) {
+        return;
+    }
+    picTotalSize_.fetch_add(info.size, std::memory_order_relaxed);
     if (info.type == MEM_PIXELMAP) {
         pixelMapFdTracker_.AddFdRecord(static_cast<int32_t>(info.pid), addr, info.allocType);
     }
@@ -525,13 +556,15 @@ void MemoryTrack::AddPictureRecord(const void* addr, MemoryInfo info)
 
 void MemoryTrack::RemovePictureRecord(const void* addr)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = memPicRecord_.find(addr);
-    if (it != memPicRecord_.end()) {
+    auto& shard = GetPicShard(addr);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.memPicRecord.find(addr);
+    if (it != shard.memPicRecord.end()) {
         if (it->second.type == MEM_PIXELMAP) {
             pixelMapFdTracker_.RemoveFdRecord(static_cast<int32_t>(it->second.pid), addr, it->second.allocType);
         }
-        memPicRecord_.erase(it);
+        picTotalSize_.fetch_sub(it->second.size, std::memory_order_relaxed);
+        shard.memPicRecord.erase(it);
     }
 }
 
@@ -553,16 +586,21 @@ bool MemoryTrack::GetGlobalRootNodeStatusChangeFlag()
 
 NODE_ON_TREE_STATUS MemoryTrack::GetNodeOnTreeStatus(const void* address)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    auto picRecordIt = memPicRecord_.find(address);
-    if (picRecordIt == memPicRecord_.end()) {
-        return NODE_ON_TREE_STATUS::STATUS_INVALID;
+    NodeId nodeId = 0;
+    {
+        auto& picShard = GetPicShard(address);
+        std::lock_guard<std::mutex> lock(picShard.mutex);
+        auto picRecordIt = picShard.memPicRecord.find(address);
+        if (picRecordIt == picShard.memPicRecord.end()) {
+            return NODE_ON_TREE_STATUS::STATUS_INVALID;
+        }
+        nodeId = picRecordIt->second.nid;
     }
 
-    NodeId nodeId = picRecordIt->second.nid;
-    auto nodeInfoIt = memNodeMap_.find(nodeId);
-    if (nodeInfoIt == memNodeMap_.end()) {
+    auto& nodeShard = GetNodeShard(ExtractPid(nodeId));
+    std::lock_guard<std::mutex> lock(nodeShard.mutex);
+    auto nodeInfoIt = nodeShard.memNodeMap.find(nodeId);
+    if (nodeInfoIt == nodeShard.memNodeMap.end()) {
         return NODE_ON_TREE_STATUS::STATUS_INVALID;
     }
 
@@ -580,10 +618,11 @@ NODE_ON_TREE_STATUS MemoryTrack::GetNodeOnTreeStatus(const void* address)
 
 void MemoryTrack::SetNodeOnTreeStatus(NodeId nodeId, bool rootNodeStatusChangeFlag, bool isOnTree)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    auto& shard = GetNodeShard(ExtractPid(nodeId));
+    std::lock_guard<std::mutex> lock(shard.mutex);
 
-    auto itr = memNodeMap_.find(nodeId);
-    if (itr == memNodeMap_.end()) {
+    auto itr = shard.memNodeMap.find(nodeId);
+    if (itr == shard.memNodeMap.end()) {
         return;
     }
     itr->second.rootNodeStatusChangeFlag = rootNodeStatusChangeFlag;
@@ -593,10 +632,10 @@ void MemoryTrack::SetNodeOnTreeStatus(NodeId nodeId, bool rootNodeStatusChangeFl
 
 void MemoryTrack::DumpMemoryPicStatisticsForReport(DfxString& log, const pid_t pid)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    auto memPicRecord = CollectPictureRecords();
     log.AppendFormat("\nRSImageCache:\n");
     log.AppendFormat("Size        Pid        NodeId        Type,Format");
-    for (auto& [addr, info] : memPicRecord_) {
+    for (auto& [addr, info] : memPicRecord) {
         if (static_cast<pid_t>(info.pid) != pid) {
             continue;
         }
@@ -608,19 +647,26 @@ void MemoryTrack::DumpMemoryPicStatisticsForReport(DfxString& log, const pid_t p
 
 size_t MemoryTrack::GetNodeNumOfPid(const pid_t pid)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto itr = memNodeOfPidMap_.find(pid);
-    if (itr == memNodeOfPidMap_.end()) {
-        return 0;
+    size_t nodeNum = 0;
+    for (auto& shard : nodeShards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto itr = shard.memNodeOfPidMap.find(pid);
+        if (itr != shard.memNodeOfPidMap.end()) {
+            nodeNum += itr->second.size();
+        }
     }
-    return itr->second.size();
+    return nodeNum;
 }
 
 std::unordered_map<NodeId, MemoryInfo> MemoryTrack::GetMemNodeMap()
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     RS_TRACE_NAME_FMT("MemoryTrack::GetMemNodeMap");
-    return memNodeMap_;
+    std::unordered_map<NodeId, MemoryInfo> memNodeMap;
+    for (auto& shard : nodeShards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        memNodeMap.insert(shard.memNodeMap.begin(), shard.memNodeMap.end());
+    }
+    return memNodeMap;
 }
 }
 }
\ No newline at end of file
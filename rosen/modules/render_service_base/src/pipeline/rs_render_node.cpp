@@ -108,6 +108,25 @@ const std::unordered_set<RSDrawableSlot> edrDrawableSlots = {
     RSDrawableSlot::BLENDER,
     RSDrawableSlot::COVERAGE_NG_SHADER,
 };
+// Modifier types whose apply only writes the properties of the node itself. Every other type may register the node
+// to a manager shared by all nodes (filter cache, HDR, color picker, point light, spatial effect, particles), so a
+// node with any of them dirty is applied on the main thread.
+const ModifierNG::ModifierDirtyTypes parallelApplyModifierTypes = [] {
+    ModifierNG::ModifierDirtyTypes types;
+    for (auto type : { ModifierNG::RSModifierType::BOUNDS, ModifierNG::RSModifierType::FRAME,
+        ModifierNG::RSModifierType::TRANSFORM, ModifierNG::RSModifierType::ALPHA,
+        ModifierNG::RSModifierType::FOREGROUND_COLOR, ModifierNG::RSModifierType::BACKGROUND_COLOR,
+        ModifierNG::RSModifierType::BACKGROUND_SHADER, ModifierNG::RSModifierType::BACKGROUND_IMAGE,
+        ModifierNG::RSModifierType::BORDER, ModifierNG::RSModifierType::OUTLINE,
+        ModifierNG::RSModifierType::CLIP_TO_BOUNDS, ModifierNG::RSModifierType::CLIP_TO_FRAME,
+        ModifierNG::RSModifierType::VISIBILITY, ModifierNG::RSModifierType::TRANSITION_STYLE,
+        ModifierNG::RSModifierType::BACKGROUND_STYLE, ModifierNG::RSModifierType::CONTENT_STYLE,
+        ModifierNG::RSModifierType::FOREGROUND_STYLE, ModifierNG::RSModifierType::OVERLAY_STYLE,
+        ModifierNG::RSModifierType::ENV_FOREGROUND_COLOR, ModifierNG::RSModifierType::CHILDREN }) {
+        types.set(static_cast<size_t>(type));
+    }
+    return types;
+}();
 
 // ensure the corresponding drawable type inherits from RSFilterDrawable.
 static const std::unordered_set<RSDrawableSlot> filterDrawableSlotsSupportGetRect = {
@@ -118,6 +137,8 @@ static const std::unordered_set<RSDrawableSlot> filterDrawableSlotsSupportGetRec
 
 constexpr uint32_t SET_IS_ON_THE_TREE_THRESHOLD = 50;
 static uint32_t g_setIsOntheTreeCnt = 0;
+// non-null only on threads applying commands in parallel, see RSTransactionData::Process
+thread_local std::vector<RSRenderNode::DeferredDirtyEvent>* g_deferredDirtyEvents = nullptr;
 constexpr size_t CACHE_FILTER_DRAWABLE_SIZE = 3;
 
 #ifndef ROSEN_ARKUI_X
@@ -1619,11 +1640,44 @@ void RSRenderNode::SetDirty(bool forceAddToActiveList)
         }
     }
     isParentTreeDirty_ = true;
-    SetParentSubTreeDirty();
+    if (g_deferredDirtyEvents != nullptr) {
+        g_deferredDirtyEvents->push_back({ shared_from_this(), DeferredDirtyEvent::Type::PARENT_SUBTREE_DIRTY });
+    } else {
+        SetParentSubTreeDirty();
+    }
     dirtyStatus_ = NodeDirty::DIRTY;
     layerContentBits_[LayerDrawContent::UPDATE] = true;
 }
 
+void RSRenderNode::SetDeferredDirtyEvents(std::vector<DeferredDirtyEvent>* events)
+{
+    g_deferredDirtyEvents = events;
+}
+
+void RSRenderNode::FlushDeferredDirtyEvents(std::vector<DeferredDirtyEvent>& events)
+{
+    for (auto& [node, type] : events) {
+        if (node == nullptr) {
+            continue;
+        }
+        switch (type) {
+            case DeferredDirtyEvent::Type::PARENT_SUBTREE_DIRTY:
+                node->SetParentSubTreeDirty();
+                break;
+            case DeferredDirtyEvent::Type::CHILDREN_UNSORTED:
+                node->isChildrenSorted_ = false;
+                break;
+            case DeferredDirtyEvent::Type::PENDING_SYNC:
+                node->addedToPendingSyncList_ = false;
+                node->AddToPendingSyncList();
+                break;
+            default:
+                break;
+        }
+    }
+    events.clear();
+}
+
 void RSRenderNode::CollectSurface(
     const std::shared_ptr<RSRenderNode>& node, std::vector<RSRenderNode::SharedPtr>& vec, bool isUniRender,
     bool onlyFirstLevel)
@@ -3475,12 +3529,34 @@ CM_INLINE void RSRenderNode::ApplyModifiers()
     }
 }
 
+bool RSRenderNode::CanApplyModifiersInParallel()
+{
+    // surface and canvas drawing nodes have their own apply hooks, display nodes touch screen state
+    switch (GetType()) {
+        case RSRenderNodeType::RS_NODE:
+        case RSRenderNodeType::CANVAS_NODE:
+        case RSRenderNodeType::EFFECT_NODE:
+            break;
+        default:
+            return false;
+    }
+    // shared transition, behind window, union and cmdlist draw region update global managers
+    if (GetSharedTransitionParam() != nullptr || GetNeedUseCmdlistDrawRegion()) {
+        return false;
+    }
+    return (dirtyTypesNG_ & ~parallelApplyModifierTypes).none();
+}
+
 void RSRenderNode::MarkParentNeedRegenerateChildren() const
 {
     auto parent = GetParent().lock();
     if (parent == nullptr) {
         return;
     }
+    if (g_deferredDirtyEvents != nullptr) {
+        g_deferredDirtyEvents->push_back({ parent, DeferredDirtyEvent::Type::CHILDREN_UNSORTED });
+        return;
+    }
     parent->isChildrenSorted_ = false;
 }
 
@@ -4890,9 +4966,50 @@ bool RSRenderNode::IsNodeParentHasUIFirstCache()
     return false;
 }
 
+bool RSRenderNode::IsRenderParamsSyncDeferrable()
+{
+    // surface, screen, display and depth params touch buffers and screen state shared between nodes, and canvas
+    // drawing nodes sync their params together with the canvas, so they always stay on the serial path
+    switch (GetType()) {
+        case RSRenderNodeType::RS_NODE:
+        case RSRenderNodeType::CANVAS_NODE:
+        case RSRenderNodeType::EFFECT_NODE:
+        case RSRenderNodeType::ROOT_NODE:
+            break;
+        default:
+            return false;
+    }
+    // partial sync reads the synced params, and clear surface runs a task with them, both within OnSync
+    return renderDrawable_ != nullptr && stagingRenderParams_ != nullptr && !IsUifirstSkipPartialSync() &&
+        !ShouldClearSurface();
+}
+
+void RSRenderNode::SyncDeferredRenderParams()
+{
+    if (!renderParamsSyncDeferred_) {
+        return;
+    }
+    renderParamsSyncDeferred_ = false;
+#ifdef RS_ENABLE_GPU
+    if (renderDrawable_ == nullptr || stagingRenderParams_ == nullptr) {
+        return;
+    }
+    DrawableV2::RSRenderNodeSingleDrawableLocker singleLocker(renderDrawable_.get());
+    if (UNLIKELY(!singleLocker.IsLocked())) {
+        singleLocker.DrawableOnDrawMultiAccessEventReport(__func__);
+        HILOG_COMM_ERROR("Drawable try to Sync params when node %{public}" PRIu64 " onDraw!!!", GetId());
+        if (RSSystemProperties::GetSingleDrawableLockerEnabled()) {
+            return;
+        }
+    }
+    stagingRenderParams_->OnSync(renderDrawable_->renderParams_);
+#endif
+}
+
 void RSRenderNode::OnSync()
 {
     addedToPendingSyncList_ = false;
+    bool deferRenderParamsSync = std::exchange(renderParamsSyncDeferred_, false);
     bool isLeashWindowPartialSkip = false;
 
     if (renderDrawable_ == nullptr) {
@@ -4950,7 +5067,11 @@ void RSRenderNode::OnSync()
         GetFilterDrawable(RSDrawableSlot::BACKGROUND_FILTER),
         GetFilterDrawable(RSDrawableSlot::COMPOSITING_FILTER)};
     if (stagingRenderParams_->NeedSync()) {
-        stagingRenderParams_->OnSync(renderDrawable_->renderParams_);
+        if (deferRenderParamsSync) {
+            renderParamsSyncDeferred_ = true;
+        } else {
+            stagingRenderParams_->OnSync(renderDrawable_->renderParams_);
+        }
     }
 #endif
     if (unobscuredUECChildrenNeedSync_) {
@@ -5115,6 +5236,11 @@ void RSRenderNode::AddToPendingSyncList()
     if (addedToPendingSyncList_) {
         return;
     }
+    if (g_deferredDirtyEvents != nullptr) {
+        g_deferredDirtyEvents->push_back({ shared_from_this(), DeferredDirtyEvent::Type::PENDING_SYNC });
+        addedToPendingSyncList_ = true;
+        return;
+    }
 
     if (auto context = GetContext().lock()) {
         context->AddPendingSyncNode(shared_from_this());
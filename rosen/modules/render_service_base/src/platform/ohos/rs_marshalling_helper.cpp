@@ -57,6 +57,7 @@
 #include "modifier_ng/rs_render_modifier_ng.h"
 #include "pipeline/rs_draw_cmd.h"
 #include "platform/common/rs_log.h"
+#include "platform/common/rs_system_properties.h"
 #include "platform/ohos/transaction/zidl/rs_iclient_to_service_connection.h"
 #include "render/rs_gradient_blur_para.h"
 #include "render/rs_image.h"
@@ -2886,6 +2887,7 @@ bool RSMarshallingHelper::SafeUnmarshallingDrawCmdList(Parcel& parcel, std::shar
     }
     RS_PROFILER_PATCH_TYPEFACE_ID(parcel, val);
     val->SetIsReplayMode(RS_PROFILER_IS_PARCEL_MOCK(parcel));
+    val->SetIndexedPlayback(RSSystemProperties::GetDrawCmdListIndexedPlaybackEnabled());
     val->UnmarshallingDrawOps(opItemCount);
     if (opItemCount && (*opItemCount) > Drawing::MAX_OPITEMSIZE) {
         return false;
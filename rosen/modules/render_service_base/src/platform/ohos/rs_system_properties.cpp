@@ -1347,6 +1347,14 @@ bool RSSystemProperties::GetFilterCacheMemThresholdEnabled()
     return filterCacheMemThresholdEnabled;
 }
 
+int RSSystemProperties::GetFilterResultCacheBudgetKB()
+{
+    // Byte budget in KB of the filter result cache shared across nodes. The default value is 0, which means that the
+    // cache is disabled, since keying a result by its input content reads the snapshot pixels back.
+    static int filterResultCacheBudgetKB = system::GetIntParameter("persist.rosen.filter.resultCacheBudgetKB", 0);
+    return filterResultCacheBudgetKB;
+}
+
 DdgrOpincDfxType RSSystemProperties::GetDdgrOpincDfxType()
 {
     return ddgrOpincDfxType_;
@@ -1808,6 +1816,76 @@ uint32_t RSSystemProperties::GetUnmarshalParallelMinDataSize()
     return unmarshalParallelMinDataSize;
 }
 
+bool RSSystemProperties::GetTransactionRingEnabled()
+{
+    static bool transactionRingEnabled =
+        system::GetBoolParameter("persist.sys.graphic.transactionRing.enabled", false);
+    return transactionRingEnabled;
+}
+
+uint32_t RSSystemProperties::GetTransactionRingCapacity()
+{
+    static uint32_t transactionRingCapacity = static_cast<uint32_t>(
+        system::GetIntParameter("persist.sys.graphic.transactionRing.capacity", 4194304)); // 4MB
+    return transactionRingCapacity;
+}
+
+bool RSSystemProperties::GetParallelApplyEnabled()
+{
+    static bool parallelApply =
+        std::atoi((system::GetParameter("persist.sys.graphic.parallelApply.enabled", "0")).c_str()) != 0;
+    return parallelApply;
+}
+
+int RSSystemProperties::GetParticleBatchUpdateMinCount()
+{
+    static int particleBatchUpdateMinCount =
+        system::GetIntParameter("persist.sys.graphic.particleBatchUpdate.minCount", 0);
+    return particleBatchUpdateMinCount;
+}
+
+size_t RSSystemProperties::GetReleasedImageCacheBudget()
+{
+    constexpr size_t KB = 1024;
+    static int releasedImageCacheBudgetKB =
+        system::GetIntParameter("persist.sys.graphic.releasedImageCacheBudgetKB", 0);
+    return releasedImageCacheBudgetKB > 0 ? static_cast<size_t>(releasedImageCacheBudgetKB) * KB : 0;
+}
+
+bool RSSystemProperties::GetDrawCmdListIndexedPlaybackEnabled()
+{
+    static bool indexedPlaybackEnabled =
+        system::GetBoolParameter("persist.sys.graphic.drawCmdListIndexedPlayback.enabled", false);
+    return indexedPlaybackEnabled;
+}
+
+bool RSSystemProperties::GetTransactionCoalescingEnabled()
+{
+    static bool coalescingEnabled =
+        system::GetBoolParameter("persist.sys.graphic.transactionCoalescing.enabled", false);
+    return coalescingEnabled;
+}
+
+bool RSSystemProperties::GetParallelParamsSyncEnabled()
+{
+    static bool parallelParamsSyncEnabled =
+        system::GetBoolParameter("persist.sys.graphic.parallelParamsSync.enabled", false);
+    return parallelParamsSyncEnabled;
+}
+
+bool RSSystemProperties::GetParallelWindowPrepareEnabled()
+{
+    static bool parallelWindowPrepareEnabled =
+        system::GetBoolParameter("persist.sys.graphic.parallelWindowPrepare.enabled", false);
+    return parallelWindowPrepareEnabled;
+}
+
+bool RSSystemProperties::GetBatchAnimateEnabled()
+{
+    static bool batchAnimateEnabled = system::GetBoolParameter("persist.sys.graphic.batchAnimate.enabled", false);
+    return batchAnimateEnabled;
+}
+
 bool RSSystemProperties::GetSceneBoardIsPcMode()
 {
     static CachedHandle g_Handle = CachedParameterCreate("persist.sceneboard.ispcmode", "false");
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "transaction/rs_transaction_ring.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "platform/common/rs_log.h"
+#include "rs_trace.h"
+#include "securec.h"
+#include "sandbox_utils.h"
+#include "platform/ohos/transaction/zidl/rs_iclient_to_render_connection.h"
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+#ifndef MFD_ALLOW_SEALING
+#define MFD_ALLOW_SEALING 0x0002U
+#endif
+#ifndef F_ADD_SEALS
+#define F_ADD_SEALS 1033
+#endif
+#ifndef F_GET_SEALS
+#define F_GET_SEALS 1034
+#endif
+#ifndef F_SEAL_SEAL
+#define F_SEAL_SEAL 0x0001
+#endif
+#ifndef F_SEAL_SHRINK
+#define F_SEAL_SHRINK 0x0002
+#endif
+#ifndef F_SEAL_GROW
+#define F_SEAL_GROW 0x0004
+#endif
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+// the ring stays writable for the producer (it is reused), but its size is frozen so that
+// the consumer mapping can never be truncated under it (which would raise SIGBUS)
+constexpr int REQUIRED_RING_SEALS = F_SEAL_SEAL | F_SEAL_SHRINK | F_SEAL_GROW;
+constexpr size_t RING_HEADER_SIZE = 64; // keep the data region cache line aligned
+static_assert(sizeof(RSTransactionRing::Header) <= RING_HEADER_SIZE, "ring header too large");
+}
+
+std::unique_ptr<RSTransactionRing> RSTransactionRing::Create(size_t capacity)
+{
+    capacity = AlignUp(capacity);
+    if (capacity < MIN_CAPACITY || capacity > MAX_CAPACITY) {
+        ROSEN_LOGE("RSTransactionRing::Create invalid capacity:%{public}zu", capacity);
+        return nullptr;
+    }
+    static pid_t pid_ = GetRealPid();
+    std::string name = "RSRing" + std::to_string(pid_);
+    int fd = memfd_create(name.c_str(), MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0) {
+        ROSEN_LOGE("RSTransactionRing::Create memfd_create failed, errno:%{public}d", errno);
+        return nullptr;
+    }
+    size_t mapSize = RING_HEADER_SIZE + capacity;
+    if (::ftruncate(fd, static_cast<off_t>(mapSize)) < 0) {
+        ROSEN_LOGE("RSTransactionRing::Create ftruncate failed, errno:%{public}d", errno);
+        ::close(fd);
+        return nullptr;
+    }
+    if (::fcntl(fd, F_ADD_SEALS, REQUIRED_RING_SEALS) < 0) {
+        ROSEN_LOGE("RSTransactionRing::Create fcntl F_ADD_SEALS failed, errno:%{public}d", errno);
+        ::close(fd);
+        return nullptr;
+    }
+    void* base = ::mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        ROSEN_LOGE("RSTransactionRing::Create mmap failed, errno:%{public}d", errno);
+        ::close(fd);
+        return nullptr;
+    }
+    auto ring = std::unique_ptr<RSTransactionRing>(new RSTransactionRing(fd, base, capacity));
+    ring->header_->magic = RING_MAGIC;
+    ring->header_->version = RING_VERSION;
+    ring->header_->capacity = capacity;
+    ring->header_->readPos.store(0, std::memory_order_release);
+    ring->header_->attached.store(0, std::memory_order_release);
+    return ring;
+}
+
+std::unique_ptr<RSTransactionRing> RSTransactionRing::Attach(int fd)
+{
+    if (fd < 0) {
+        ROSEN_LOGE("RSTransactionRing::Attach fd < 0");
+        return nullptr;
+    }
+    // check the seals before the size, same as AshmemAllocator::ValidateSealedMemfd
+    int seals = ::fcntl(fd, F_GET_SEALS);
+    if (seals < 0 || (seals & REQUIRED_RING_SEALS) != REQUIRED_RING_SEALS) {
+        ROSEN_LOGE("RSTransactionRing::Attach ring is not sealed, seals:%{public}d", seals);
+        ::close(fd);
+        return nullptr;
+    }
+    off_t fileSize = ::lseek(fd, 0, SEEK_END);
+    if (fileSize < 0 || static_cast<uint64_t>(fileSize) < RING_HEADER_SIZE + MIN_CAPACITY ||
+        static_cast<uint64_t>(fileSize) > RING_HEADER_SIZE + MAX_CAPACITY ||
+        AlignUp(static_cast<size_t>(fileSize)) != static_cast<size_t>(fileSize)) {
+        ROSEN_LOGE("RSTransactionRing::Attach invalid ring size:%{public}" PRId64, static_cast<int64_t>(fileSize));
+        ::close(fd);
+        return nullptr;
+    }
+    size_t mapSize = static_cast<size_t>(fileSize);
+    void* base = ::mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        ROSEN_LOGE("RSTransactionRing::Attach mmap failed, errno:%{public}d", errno);
+        ::close(fd);
+        return nullptr;
+    }
+    // the capacity is derived from the sealed file size, the header copy is only cross-checked
+    size_t capacity = mapSize - RING_HEADER_SIZE;
+    auto ring = std::unique_ptr<RSTransactionRing>(new RSTransactionRing(fd, base, capacity));
+    if (ring->header_->magic != RING_MAGIC || ring->header_->version != RING_VERSION ||
+        ring->header_->capacity != capacity) {
+        ROSEN_LOGE("RSTransactionRing::Attach invalid ring header");
+        return nullptr;
+    }
+    ring->localPos_ = ring->header_->readPos.load(std::memory_order_acquire);
+    // acknowledge the attach, the producer keeps transactions on the parcel path until it sees this
+    ring->header_->attached.store(1, std::memory_order_release);
+    return ring;
+}
+
+RSTransactionRing::RSTransactionRing(int fd, void* base, size_t capacity)
+    : fd_(fd), base_(base), header_(reinterpret_cast<Header*>(base)),
+      data_(reinterpret_cast<uint8_t*>(base) + RING_HEADER_SIZE), capacity_(capacity)
+{
+}
+
+RSTransactionRing::~RSTransactionRing()
+{
+    if (base_ != nullptr) {
+        ::munmap(base_, RING_HEADER_SIZE + capacity_);
+        base_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+uint64_t RSTransactionRing::GetReadPos() const
+{
+    return header_->readPos.load(std::memory_order_acquire);
+}
+
+bool RSTransactionRing::IsAttached() const
+{
+    return header_->attached.load(std::memory_order_acquire) != 0;
+}
+
+size_t RSTransactionRing::GetFreeSize() const
+{
+    uint64_t used = localPos_ - GetReadPos();
+    return used > capacity_ ? 0 : capacity_ - static_cast<size_t>(used);
+}
+
+bool RSTransactionRing::Write(const void* data, size_t size, uint64_t& pos)
+{
+    size_t alignedSize = AlignUp(size);
+    if (data == nullptr || size == 0 || alignedSize > capacity_) {
+        return false;
+    }
+    uint64_t start = localPos_;
+    size_t offset = static_cast<size_t>(start % capacity_);
+    if (offset + alignedSize > capacity_) {
+        // slots never wrap, skip the tail of this lap
+        start += capacity_ - offset;
+        offset = 0;
+    }
+    uint64_t readPos = GetReadPos();
+    if (readPos > localPos_ || start + alignedSize - readPos > capacity_) {
+        return false;
+    }
+    if (memcpy_s(data_ + offset, capacity_ - offset, data, size) != EOK) {
+        ROSEN_LOGE("RSTransactionRing::Write memcpy_s failed, size:%{public}zu", size);
+        return false;
+    }
+    pos = start;
+    localPos_ = start + alignedSize;
+    return true;
+}
+
+void* RSTransactionRing::CopyOutAndRelease(uint64_t pos, size_t size)
+{
+    // pos and size come from the producer: the slot must lie after the last released slot,
+    // inside the window the producer may have written, and must not cross the end of the ring
+    if (size == 0 || size > capacity_ || pos < localPos_ || pos - localPos_ > capacity_ - size) {
+        ROSEN_LOGE("RSTransactionRing::CopyOutAndRelease invalid slot, pos:%{public}" PRIu64
+            " size:%{public}zu released:%{public}" PRIu64, pos, size, localPos_);
+        return nullptr;
+    }
+    size_t offset = static_cast<size_t>(pos % capacity_);
+    if (offset + size > capacity_) {
+        ROSEN_LOGE("RSTransactionRing::CopyOutAndRelease slot crosses ring end, pos:%{public}" PRIu64, pos);
+        return nullptr;
+    }
+    void* out = malloc(size);
+    if (out == nullptr) {
+        ROSEN_LOGE("RSTransactionRing::CopyOutAndRelease malloc failed, size:%{public}zu", size);
+        return nullptr;
+    }
+    if (memcpy_s(out, size, data_ + offset, size) != EOK) {
+        ROSEN_LOGE("RSTransactionRing::CopyOutAndRelease memcpy_s failed, size:%{public}zu", size);
+        free(out);
+        return nullptr;
+    }
+    localPos_ = pos + AlignUp(size);
+    header_->readPos.store(localPos_, std::memory_order_release);
+    return out;
+}
+
+std::shared_ptr<MessageParcel> RSTransactionRing::CreateAttachParcel()
+{
+    auto attachParcel = std::make_shared<MessageParcel>();
+    if (!attachParcel->WriteInterfaceToken(RSIClientToRenderConnection::GetDescriptor()) ||
+        !attachParcel->WriteInt32(RING_ATTACH_PARCEL_FLAG) || !attachParcel->WriteFileDescriptor(fd_)) {
+        ROSEN_LOGE("CreateAttachParcel: write ring fd failed");
+        return nullptr;
+    }
+    attachRequestCount_++;
+    return attachParcel;
+}
+
+std::shared_ptr<MessageParcel> RSTransactionRing::CreateRingParcel(std::shared_ptr<MessageParcel>& dataParcel)
+{
+    if (dataParcel == nullptr || dataParcel->GetOffsetsSize() > 0) {
+        // binder objects need the kernel to translate them, keep the normal/ashmem parcel
+        return nullptr;
+    }
+    if (!IsAttached()) {
+        // a slot the service cannot read would drop the transaction, keep the normal/ashmem parcel
+        return nullptr;
+    }
+    size_t dataSize = dataParcel->GetDataSize();
+    uint64_t pos = 0;
+    if (dataSize > UINT32_MAX || !Write(reinterpret_cast<void*>(dataParcel->GetData()), dataSize, pos)) {
+        return nullptr;
+    }
+    RS_TRACE_NAME_FMT("CreateRingParcel data size:%zu pos:%" PRIu64, dataSize, pos);
+    auto ringParcel = std::make_shared<MessageParcel>();
+    ringParcel->WriteInterfaceToken(RSIClientToRenderConnection::GetDescriptor());
+    ringParcel->WriteInt32(RING_PARCEL_FLAG);
+    ringParcel->WriteUint64(pos);
+    ringParcel->WriteUint32(static_cast<uint32_t>(dataSize));
+    return ringParcel;
+}
+
+bool RSTransactionRing::AttachFromParcel(MessageParcel* attachParcel, std::unique_ptr<RSTransactionRing>& ring)
+{
+    if (!attachParcel) {
+        ROSEN_LOGE("AttachFromParcel attachParcel is nullptr");
+        return false;
+    }
+    // the client resends the ring until the attach is acknowledged, attaching the same memfd again is harmless
+    auto newRing = Attach(attachParcel->ReadFileDescriptor());
+    if (newRing == nullptr) {
+        ROSEN_LOGE("AttachFromParcel attach ring failed");
+        return false;
+    }
+    ring = std::move(newRing);
+    return true;
+}
+
+std::shared_ptr<MessageParcel> RSTransactionRing::ParseFromRingParcel(MessageParcel* ringParcel,
+    std::unique_ptr<RSTransactionRing>& ring, std::shared_ptr<AshmemFlowControlUnit>& ashmemFlowControlUnit,
+    pid_t callingPid)
+{
+    if (!ringParcel) {
+        ROSEN_LOGE("ParseFromRingParcel ringParcel is nullptr");
+        return nullptr;
+    }
+    uint64_t pos = 0;
+    uint32_t dataSize = 0;
+    if (ring == nullptr || !ringParcel->ReadUint64(pos) || !ringParcel->ReadUint32(dataSize)) {
+        ROSEN_LOGE("ParseFromRingParcel no ring attached or read slot failed");
+        return nullptr;
+    }
+    RS_TRACE_NAME("ParseFromRingParcel data size:" + std::to_string(dataSize));
+    // the copied out slot goes to the unmarshal thread like an ashmem parcel, apply the same flow control
+    ashmemFlowControlUnit = AshmemFlowControlUnit::CheckOverflowAndCreateInstance(callingPid, dataSize);
+    if (ashmemFlowControlUnit == nullptr) {
+        ROSEN_LOGE("ParseFromRingParcel reject ring slot size %{public}" PRIu32 " from pid %{public}d",
+            dataSize, static_cast<int>(callingPid));
+        return nullptr;
+    }
+    // copy the slot out once: unmarshalling straight from the shared mapping would let the client
+    // rewrite commands after they were validated
+    void* data = ring->CopyOutAndRelease(pos, dataSize);
+    if (data == nullptr) {
+        return nullptr;
+    }
+    // the parcel owns the buffer via DefaultAllocator (freed on destruction)
+    auto dataParcel = std::make_shared<MessageParcel>();
+    dataParcel->ParseFrom(reinterpret_cast<uintptr_t>(data), dataSize);
+
+    auto token = dataParcel->ReadInterfaceToken();
+    if (token != RSIClientToRenderConnection::GetDescriptor()) {
+        return nullptr;
+    }
+    if (dataParcel->ReadInt32() != 0) { // identify normal parcel
+        ROSEN_LOGE("RSTransactionRing::ParseFromRingParcel failed");
+        return nullptr;
+    }
+    return dataParcel;
+}
+} // namespace Rosen
+} // namespace OHOS
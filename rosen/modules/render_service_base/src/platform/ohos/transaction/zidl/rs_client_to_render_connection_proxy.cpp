@@ -35,6 +35,7 @@ namespace OHOS {
 namespace Rosen {
 namespace {
 static constexpr size_t ASHMEM_SIZE_THRESHOLD = 200 * 1024; // cannot > 500K in TF_ASYNC mode
+static constexpr uint32_t MAX_RING_ATTACH_REQUEST_COUNT = 8; // give up the ring if the service never attaches it
 static constexpr int MAX_RETRY_COUNT = 20;
 static constexpr int RETRY_WAIT_TIME_US = 1000; // wait 1ms before retry SendRequest
 static constexpr int MAX_SECURITY_EXEMPTION_LIST_NUMBER = 1024; // securityExemptionList size not exceed 1024
@@ -66,6 +67,12 @@ ErrCode RSClientToRenderConnectionProxy::CommitTransaction(std::unique_ptr<RSTra
     }
     bool isUniMode = RSSystemProperties::GetUniRenderEnabled();
     transactionData->SetSendingPid(pid_);
+    // ring slots must reach the service in the order they were written
+    std::unique_lock<std::mutex> ringLock(transactionRingMutex_, std::defer_lock);
+    if (RSSystemProperties::GetTransactionRingEnabled()) {
+        ringLock.lock();
+        RequestTransactionRingAttach();
+    }
 
     // split to several parcels if parcel size > PARCEL_SPLIT_THRESHOLD during marshalling
     std::vector<std::shared_ptr<MessageParcel>> parcelVector;
@@ -90,6 +97,10 @@ ErrCode RSClientToRenderConnectionProxy::CommitTransaction(std::unique_ptr<RSTra
     } else {
         while (transactionData->GetMarshallingIndex() < transactionData->GetCommandCount()) {
             if (!func()) {
+                if (ringLock.owns_lock()) {
+                    // ring slots filled so far are never sent, start over with a new ring
+                    transactionRing_.reset();
+                }
                 return ERR_INVALID_VALUE;
             }
         }
@@ -111,6 +122,10 @@ ErrCode RSClientToRenderConnectionProxy::CommitTransaction(std::unique_ptr<RSTra
                 ROSEN_LOGE("RSClientToRenderConnectionProxy::CommitTransaction SendRequest failed, "
                     "err = %{public}d, retryCount = %{public}d, data size:%{public}zu", err, retryCount,
                     parcel->GetDataSize());
+                if (ringLock.owns_lock()) {
+                    // the service may have lost the ring, attach a new one before sending slots again
+                    transactionRing_.reset();
+                }
                 return ERR_INVALID_VALUE;
             }
         } while (err != NO_ERROR);
@@ -164,9 +179,17 @@ bool RSClientToRenderConnectionProxy::FillParcelWithTransactionData(
         }
     }
 
-    // 2. convert data to new ashmem parcel if size over threshold
+    // 2. move data into the transaction ring, or convert it to new ashmem parcel if size over threshold.
+    // Below the threshold the parcel goes inline, binder copies it once, the ring would copy it in and out.
     std::shared_ptr<MessageParcel> ashmemParcel = nullptr;
     if (data->GetDataSize() > ASHMEM_SIZE_THRESHOLD) {
+        if (RSSystemProperties::GetTransactionRingEnabled()) {
+            auto ringParcel = CreateTransactionRingParcel(data);
+            if (ringParcel != nullptr) {
+                data = ringParcel;
+                return true;
+            }
+        }
         ashmemParcel = RSAshmemHelper::CreateAshmemParcel(data);
     }
     if (ashmemParcel != nullptr) {
@@ -175,6 +198,53 @@ bool RSClientToRenderConnectionProxy::FillParcelWithTransactionData(
     return true;
 }
 
+void RSClientToRenderConnectionProxy::RequestTransactionRingAttach()
+{
+    // caller holds transactionRingMutex_
+    if (transactionRing_ == nullptr && !transactionRingFailed_) {
+        transactionRing_ = RSTransactionRing::Create(RSSystemProperties::GetTransactionRingCapacity());
+        if (transactionRing_ == nullptr) {
+            // do not retry memfd creation on every commit, stay on the parcel path
+            ROSEN_LOGE("RequestTransactionRingAttach create ring failed, fall back to parcel");
+            transactionRingFailed_ = true;
+        }
+    }
+    if (transactionRing_ == nullptr || transactionRing_->IsAttached()) {
+        return;
+    }
+    if (transactionRing_->GetAttachRequestCount() >= MAX_RING_ATTACH_REQUEST_COUNT) {
+        ROSEN_LOGE("RequestTransactionRingAttach ring never attached, fall back to parcel");
+        transactionRing_.reset();
+        transactionRingFailed_ = true;
+        return;
+    }
+    // transactions keep the parcel path until the service acknowledges the attach, resend the fd until then
+    auto attachParcel = transactionRing_->CreateAttachParcel();
+    if (attachParcel == nullptr) {
+        return;
+    }
+    MessageParcel reply;
+    MessageOption option;
+    option.SetFlags(MessageOption::TF_ASYNC);
+    uint32_t code = static_cast<uint32_t>(RSIClientToRenderConnectionInterfaceCode::COMMIT_TRANSACTION);
+    int32_t err = SendRequest(code, *attachParcel, reply, option);
+    if (err != NO_ERROR) {
+        ROSEN_LOGE("RequestTransactionRingAttach SendRequest failed, err = %{public}d", err);
+    }
+}
+
+std::shared_ptr<MessageParcel> RSClientToRenderConnectionProxy::CreateTransactionRingParcel(
+    std::shared_ptr<MessageParcel>& data)
+{
+    // caller holds transactionRingMutex_
+    if (transactionRing_ == nullptr) {
+        return nullptr;
+    }
+    // nullptr when the ring is not attached yet, is full or the parcel carries binder objects,
+    // the caller keeps the parcel path
+    return transactionRing_->CreateRingParcel(data);
+}
+
 ErrCode RSClientToRenderConnectionProxy::ExecuteSynchronousTask(const std::shared_ptr<RSSyncTask>& task)
 {
     if (task == nullptr) {
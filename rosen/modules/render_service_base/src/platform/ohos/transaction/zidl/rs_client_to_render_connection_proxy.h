@@ -19,9 +19,11 @@
 #include "command/rs_node_showing_command.h"
 #include <iremote_proxy.h>
 #include <memory>
+#include <mutex>
 #include <platform/ohos/transaction/zidl/rs_iclient_to_render_connection.h>
 #include <platform/ohos/transaction/rs_iclient_to_render_connection_ipc_interface_code.h>
 #include "sandbox_utils.h"
+#include "transaction/rs_transaction_ring.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -35,6 +37,8 @@ public:
 
     bool FillParcelWithTransactionData(std::unique_ptr<RSTransactionData>& transactionData,
         std::shared_ptr<MessageParcel>& data);
+    std::shared_ptr<MessageParcel> CreateTransactionRingParcel(std::shared_ptr<MessageParcel>& data);
+    void RequestTransactionRingAttach();
 
     ErrCode CreateDisplayNode(const RSDisplayNodeConfig& displayNodeConfig, NodeId nodeId,
         bool& success) override;
@@ -189,6 +193,10 @@ public:
 
     pid_t pid_ = GetRealPid();
     std::atomic<uint32_t> transactionDataIndex_ = 0;
+    // guards transactionRing_ and keeps ring slots in send order across committing threads
+    std::mutex transactionRingMutex_;
+    std::unique_ptr<RSTransactionRing> transactionRing_;
+    bool transactionRingFailed_ = false;
     OnRemoteDiedCallback OnRemoteDiedCallback_;
 
     bool SetDelegateMode(NodeId id, bool isSetDelegateMode, pid_t pid) override;
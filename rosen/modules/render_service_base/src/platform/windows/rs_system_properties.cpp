@@ -679,6 +679,11 @@ bool RSSystemProperties::GetFilterCacheMemThresholdEnabled()
     return false;
 }
 
+int RSSystemProperties::GetFilterResultCacheBudgetKB()
+{
+    return 0;
+}
+
 bool RSSystemProperties::GetSurfaceOffscreenEnadbled()
 {
     return true;
@@ -834,6 +839,56 @@ uint32_t RSSystemProperties::GetUnmarshalParallelMinDataSize()
     return 0;
 }
 
+bool RSSystemProperties::GetTransactionRingEnabled()
+{
+    return false;
+}
+
+uint32_t RSSystemProperties::GetTransactionRingCapacity()
+{
+    return 0;
+}
+
+bool RSSystemProperties::GetParallelApplyEnabled()
+{
+    return false;
+}
+
+int RSSystemProperties::GetParticleBatchUpdateMinCount()
+{
+    return 0;
+}
+
+size_t RSSystemProperties::GetReleasedImageCacheBudget()
+{
+    return 0;
+}
+
+bool RSSystemProperties::GetDrawCmdListIndexedPlaybackEnabled()
+{
+    return false;
+}
+
+bool RSSystemProperties::GetTransactionCoalescingEnabled()
+{
+    return false;
+}
+
+bool RSSystemProperties::GetParallelParamsSyncEnabled()
+{
+    return false;
+}
+
+bool RSSystemProperties::GetParallelWindowPrepareEnabled()
+{
+    return false;
+}
+
+bool RSSystemProperties::GetBatchAnimateEnabled()
+{
+    return false;
+}
+
 bool RSSystemProperties::GetSceneBoardIsPcMode()
 {
     return false;
@@ -1035,13 +1035,21 @@ void RSProperties::SetLocalMagnificationCap(bool localMagnificationCap)
 
 void RSProperties::SetSublayerTransform(const std::optional<Matrix3f>& sublayerTransform)
 {
-    sublayerTransform_ = sublayerTransform;
+    if (sublayerTransform.has_value()) {
+        GetEffect().sublayerTransform_ = sublayerTransform;
+    } else {
+        WITH_EFFECT(sublayerTransform_ = std::nullopt);
+    }
     SetDirty();
 }
 
 const std::optional<Matrix3f>& RSProperties::GetSublayerTransform() const
 {
-    return sublayerTransform_;
+    static const std::optional<Matrix3f> defaultValue = std::nullopt;
+    if (effect_) {
+        return effect_->sublayerTransform_;
+    }
+    return defaultValue;
 }
 
 // foreground properties
@@ -1551,8 +1559,12 @@ void RSProperties::SetParticleNoiseFields(const std::shared_ptr<ParticleNoiseFie
 
 void RSProperties::SetParticleRippleFields(const std::shared_ptr<ParticleRippleFields>& para)
 {
-    particleRippleFields_ = para;
-    if (particleRippleFields_) {
+    if (para) {
+        GetEffect().particleRippleFields_ = para;
+    } else {
+        WITH_EFFECT(particleRippleFields_ = nullptr);
+    }
+    if (para) {
         isDrawn_ = true;
         auto renderNode = backref_.lock();
         if (renderNode == nullptr) {
@@ -1568,7 +1580,7 @@ void RSProperties::SetParticleRippleFields(const std::shared_ptr<ParticleRippleF
         }
         auto particleAnimation = std::static_pointer_cast<RSRenderParticleAnimation>(animation);
         if (particleAnimation) {
-            particleAnimation->UpdateRippleField(particleRippleFields_);
+            particleAnimation->UpdateRippleField(para);
         }
     }
     filterNeedUpdate_ = true;
@@ -1578,8 +1590,12 @@ void RSProperties::SetParticleRippleFields(const std::shared_ptr<ParticleRippleF
 
 void RSProperties::SetParticleVelocityFields(const std::shared_ptr<ParticleVelocityFields>& para)
 {
-    particleVelocityFields_ = para;
-    if (particleVelocityFields_) {
+    if (para) {
+        GetEffect().particleVelocityFields_ = para;
+    } else {
+        WITH_EFFECT(particleVelocityFields_ = nullptr);
+    }
+    if (para) {
         isDrawn_ = true;
         auto renderNode = backref_.lock();
         if (renderNode == nullptr) {
@@ -1595,7 +1611,7 @@ void RSProperties::SetParticleVelocityFields(const std::shared_ptr<ParticleVeloc
         }
         auto particleAnimation = std::static_pointer_cast<RSRenderParticleAnimation>(animation);
         if (particleAnimation) {
-            particleAnimation->UpdateVelocityField(particleVelocityFields_);
+            particleAnimation->UpdateVelocityField(para);
         }
     }
     filterNeedUpdate_ = true;
@@ -1605,7 +1621,11 @@ void RSProperties::SetParticleVelocityFields(const std::shared_ptr<ParticleVeloc
 
 void RSProperties::SetParticleFields(const std::shared_ptr<ParticleFieldCollection>& para)
 {
-    particleFields_ = para;
+    if (para) {
+        GetEffect().particleFields_ = para;
+    } else {
+        WITH_EFFECT(particleFields_ = nullptr);
+    }
     if (para) {
         isDrawn_ = true;
         auto renderNode = backref_.lock();
@@ -1630,9 +1650,31 @@ void RSProperties::SetParticleFields(const std::shared_ptr<ParticleFieldCollecti
     contentDirty_ = true;
 }
 
+const std::shared_ptr<ParticleRippleFields>& RSProperties::GetParticleRippleFields() const
+{
+    static const std::shared_ptr<ParticleRippleFields> defaultValue = nullptr;
+    if (effect_) {
+        return effect_->particleRippleFields_;
+    }
+    return defaultValue;
+}
+
+const std::shared_ptr<ParticleVelocityFields>& RSProperties::GetParticleVelocityFields() const
+{
+    static const std::shared_ptr<ParticleVelocityFields> defaultValue = nullptr;
+    if (effect_) {
+        return effect_->particleVelocityFields_;
+    }
+    return defaultValue;
+}
+
 const std::shared_ptr<ParticleFieldCollection>& RSProperties::GetParticleFields() const
 {
-    return particleFields_;
+    static const std::shared_ptr<ParticleFieldCollection> defaultValue = nullptr;
+    if (effect_) {
+        return effect_->particleFields_;
+    }
+    return defaultValue;
 }
 
 void RSProperties::SetColorPickerPlaceholder(int placeholder)
@@ -1642,33 +1684,36 @@ void RSProperties::SetColorPickerPlaceholder(int placeholder)
 
 void RSProperties::SetColorPickerStrategy(int strategy)
 {
-    if (!colorPicker_) {
-        colorPicker_ = std::make_shared<ColorPickerParam>();
+    auto& colorPicker = GetEffect().colorPicker_;
+    if (!colorPicker) {
+        colorPicker = std::make_shared<ColorPickerParam>();
     }
-    colorPicker_->strategy = std::clamp(
+    colorPicker->strategy = std::clamp(
         static_cast<ColorPickStrategyType>(strategy), ColorPickStrategyType::NONE, ColorPickStrategyType::MAX);
     SetDirty();
 }
 
 void RSProperties::SetColorPickerInterval(int interval)
 {
-    if (!colorPicker_) {
-        colorPicker_ = std::make_shared<ColorPickerParam>();
+    auto& colorPicker = GetEffect().colorPicker_;
+    if (!colorPicker) {
+        colorPicker = std::make_shared<ColorPickerParam>();
     }
     static constexpr uint64_t MIN_INTERVAL = 180; // unit: ms
-    colorPicker_->interval = std::max(static_cast<uint64_t>(interval), MIN_INTERVAL);
+    colorPicker->interval = std::max(static_cast<uint64_t>(interval), MIN_INTERVAL);
     SetDirty();
 }
 
 void RSProperties::SetColorPickerNotifyThreshold(int packedThresholds)
 {
-    if (!colorPicker_) {
-        colorPicker_ = std::make_shared<ColorPickerParam>();
+    auto& colorPicker = GetEffect().colorPicker_;
+    if (!colorPicker) {
+        colorPicker = std::make_shared<ColorPickerParam>();
     }
     // Unpack: lower 16 bits = dark threshold, upper 16 bits = light threshold
     uint32_t darkThreshold = static_cast<uint32_t>(packedThresholds & 0xFFFF);
     uint32_t lightThreshold = static_cast<uint32_t>((packedThresholds >> 16) & 0xFFFF);
-    colorPicker_->notifyThreshold = {
+    colorPicker->notifyThreshold = {
         std::clamp(darkThreshold, 0u, RGBA_MAX),
         std::clamp(lightThreshold, 0u, RGBA_MAX)
     };
@@ -1677,26 +1722,28 @@ void RSProperties::SetColorPickerNotifyThreshold(int packedThresholds)
 
 void RSProperties::SetColorPickerRect(const Vector4f& rect)
 {
-    if (!colorPicker_) {
-        colorPicker_ = std::make_shared<ColorPickerParam>();
+    auto& colorPicker = GetEffect().colorPicker_;
+    if (!colorPicker) {
+        colorPicker = std::make_shared<ColorPickerParam>();
     }
     // Convert Vector4f [left, top, right, bottom] to Drawing::Rect
     auto effectiveRect = Drawing::Rect(rect.x_, rect.y_, rect.z_, rect.w_);
-    colorPicker_->rect = effectiveRect.IsValid() ? std::make_optional(effectiveRect) : std::nullopt;
+    colorPicker->rect = effectiveRect.IsValid() ? std::make_optional(effectiveRect) : std::nullopt;
     SetDirty();
 }
 
 void RSProperties::SetLastContrastColorScheme(ContrastColorScheme colorScheme)
 {
-    if (!colorPicker_) {
-        colorPicker_ = std::make_shared<ColorPickerParam>();
+    auto& colorPicker = GetEffect().colorPicker_;
+    if (!colorPicker) {
+        colorPicker = std::make_shared<ColorPickerParam>();
     }
-    colorPicker_->lastContrastColorScheme = colorScheme;
+    colorPicker->lastContrastColorScheme = colorScheme;
 }
 
 std::shared_ptr<ColorPickerParam> RSProperties::GetColorPicker() const
 {
-    return colorPicker_;
+    return effect_ ? effect_->colorPicker_ : nullptr;
 }
 
 void RSProperties::SetDynamicLightUpRate(const std::optional<float>& rate)
@@ -1992,9 +2039,9 @@ bool RSProperties::GetFgBrightnessEnableEDR() const
 void RSProperties::SetBgBrightnessRates(const Vector4f& rates)
 {
     if (!GetBgBrightnessParams().has_value()) {
-        bgBrightnessParams_ = std::make_optional<RSDynamicBrightnessPara>();
+        GetEffect().bgBrightnessParams_ = std::make_optional<RSDynamicBrightnessPara>();
     }
-    bgBrightnessParams_->rates_ = rates;
+    GetEffect().bgBrightnessParams_->rates_ = rates;
     isDrawn_ = true;
     filterNeedUpdate_ = true;
     SetDirty();
@@ -2010,9 +2057,9 @@ Vector4f RSProperties::GetBgBrightnessRates() const
 void RSProperties::SetBgBrightnessSaturation(const float& saturation)
 {
     if (!GetBgBrightnessParams().has_value()) {
-        bgBrightnessParams_ = std::make_optional<RSDynamicBrightnessPara>();
+        GetEffect().bgBrightnessParams_ = std::make_optional<RSDynamicBrightnessPara>();
     }
-    bgBrightnessParams_->saturation_ = saturation;
+    GetEffect().bgBrightnessParams_->saturation_ = saturation;
     isDrawn_ = true;
     filterNeedUpdate_ = true;
     SetDirty();
@@ -2028,9 +2075,9 @@ float RSProperties::GetBgBrightnessSaturation() const
 void RSProperties::SetBgBrightnessPosCoeff(const Vector4f& coeff)
 {
     if (!GetBgBrightnessParams().has_value()) {
-        bgBrightnessParams_ = std::make_optional<RSDynamicBrightnessPara>();
+        GetEffect().bgBrightnessParams_ = std::make_optional<RSDynamicBrightnessPara>();
     }
-    bgBrightnessParams_->posCoeff_ = coeff;
+    GetEffect().bgBrightnessParams_->posCoeff_ = coeff;
     isDrawn_ = true;
     filterNeedUpdate_ = true;
     SetDirty();
@@ -2046,9 +2093,9 @@ Vector4f RSProperties::GetBgBrightnessPosCoeff() const
 void RSProperties::SetBgBrightnessNegCoeff(const Vector4f& coeff)
 {
     if (!GetBgBrightnessParams().has_value()) {
-        bgBrightnessParams_ = std::make_optional<RSDynamicBrightnessPara>();
+        GetEffect().bgBrightnessParams_ = std::make_optional<RSDynamicBrightnessPara>();
     }
-    bgBrightnessParams_->negCoeff_ = coeff;
+    GetEffect().bgBrightnessParams_->negCoeff_ = coeff;
     isDrawn_ = true;
     filterNeedUpdate_ = true;
     SetDirty();
@@ -2064,9 +2111,9 @@ Vector4f RSProperties::GetBgBrightnessNegCoeff() const
 void RSProperties::SetBgBrightnessFract(const float& fraction)
 {
     if (!GetBgBrightnessParams().has_value()) {
-        bgBrightnessParams_ = std::make_optional<RSDynamicBrightnessPara>();
+        GetEffect().bgBrightnessParams_ = std::make_optional<RSDynamicBrightnessPara>();
     }
-    bgBrightnessParams_->fraction_ = fraction;
+    GetEffect().bgBrightnessParams_->fraction_ = fraction;
     isDrawn_ = true;
     filterNeedUpdate_ = true;
     SetDirty();
@@ -2081,7 +2128,11 @@ float RSProperties::GetBgBrightnessFract() const
 
 void RSProperties::SetBgBrightnessParams(const std::optional<RSDynamicBrightnessPara>& params)
 {
-    bgBrightnessParams_ = params;
+    if (params.has_value()) {
+        GetEffect().bgBrightnessParams_ = params;
+    } else {
+        WITH_EFFECT(bgBrightnessParams_ = std::nullopt);
+    }
     if (params.has_value()) {
         isDrawn_ = true;
     }
@@ -2092,7 +2143,10 @@ void RSProperties::SetBgBrightnessParams(const std::optional<RSDynamicBrightness
 
 std::optional<RSDynamicBrightnessPara> RSProperties::GetBgBrightnessParams() const
 {
-    return bgBrightnessParams_;
+    if (effect_) {
+        return effect_->bgBrightnessParams_;
+    }
+    return std::nullopt;
 }
 
 std::string RSProperties::GetFgBrightnessDescription() const
@@ -4797,10 +4851,10 @@ bool RSProperties::GetUseUnion() const
 
 void RSProperties::SetSDFUnionMode(int uniModeUC)
 {
-    if (ROSEN_EQ(uniModeUC_, uniModeUC)) {
+    if (ROSEN_EQ(GetSDFUnionMode(), uniModeUC)) {
         return;
     }
-    uniModeUC_ = uniModeUC;
+    GetEffect().uniModeUC_ = uniModeUC;
     isDrawn_ = true;
     filterNeedUpdate_ = true;
     SetDirty();
@@ -4808,15 +4862,18 @@ void RSProperties::SetSDFUnionMode(int uniModeUC)
 
 int RSProperties::GetSDFUnionMode() const
 {
-    return uniModeUC_;
+    if (effect_) {
+        return effect_->uniModeUC_;
+    }
+    return 0;
 }
 
 void RSProperties::SetGravityPullCenterFlag(bool isGravityPullModeCenter)
 {
-    if (ROSEN_EQ(isGravityPullModeCenter_, isGravityPullModeCenter)) {
+    if (ROSEN_EQ(GetGravityPullCenterFlag(), isGravityPullModeCenter)) {
         return;
     }
-    isGravityPullModeCenter_ = isGravityPullModeCenter;
+    GetEffect().isGravityPullModeCenter_ = isGravityPullModeCenter;
     isDrawn_ = true;
     filterNeedUpdate_ = true;
     SetDirty();
@@ -4824,15 +4881,18 @@ void RSProperties::SetGravityPullCenterFlag(bool isGravityPullModeCenter)
 
 bool RSProperties::GetGravityPullCenterFlag() const
 {
-    return isGravityPullModeCenter_;
+    if (effect_) {
+        return effect_->isGravityPullModeCenter_;
+    }
+    return false;
 }
 
 void RSProperties::SetGravityPullStrength(float gravityPullStrength)
 {
-    if (ROSEN_EQ(gravityPullStrength_, gravityPullStrength)) {
+    if (ROSEN_EQ(GetGravityPullStrength(), gravityPullStrength)) {
         return;
     }
-    gravityPullStrength_ = gravityPullStrength;
+    GetEffect().gravityPullStrength_ = gravityPullStrength;
     isDrawn_ = true;
     filterNeedUpdate_ = true;
     SetDirty();
@@ -4840,15 +4900,18 @@ void RSProperties::SetGravityPullStrength(float gravityPullStrength)
 
 float RSProperties::GetGravityPullStrength() const
 {
-    return gravityPullStrength_;
+    if (effect_) {
+        return effect_->gravityPullStrength_;
+    }
+    return 0.0f;
 }
 
 void RSProperties::SetGravityHotZone(float hotZone)
 {
-    if (ROSEN_EQ(gravityHotZone_, hotZone)) {
+    if (ROSEN_EQ(GetGravityHotZone(), hotZone)) {
         return;
     }
-    gravityHotZone_ = hotZone;
+    GetEffect().gravityHotZone_ = hotZone;
     isDrawn_ = true;
     filterNeedUpdate_ = true;
     SetDirty();
@@ -4856,7 +4919,10 @@ void RSProperties::SetGravityHotZone(float hotZone)
 
 float RSProperties::GetGravityHotZone() const
 {
-    return gravityHotZone_;
+    if (effect_) {
+        return effect_->gravityHotZone_;
+    }
+    return 0.0f;
 }
 
 void RSProperties::SetUnionSpacing(float spacing)
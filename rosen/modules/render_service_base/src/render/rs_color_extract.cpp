@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include "render/rs_color_extract.h"
+#include "render/rs_color_extract_kernel.h"
 #include <cmath>
 #include <iostream>
 #include <vector>
@@ -189,7 +190,7 @@ uint8_t RSColorExtract::Rgb2Gray(uint32_t color)
     uint32_t r = GetARGB32ColorR(color);
     uint32_t g = GetARGB32ColorG(color);
     uint32_t b = GetARGB32ColorB(color);
-    return static_cast<uint8_t>(r * RED_GRAY_RATIO + g * GREEN_GRAY_RATIO + b * BLUE_GRAY_RATIO);
+    return RSColorExtractKernel::Gray(r, g, b);
 }
 
 uint32_t RSColorExtract::CalcGrayMsd() const
@@ -197,18 +198,9 @@ uint32_t RSColorExtract::CalcGrayMsd() const
     if (colorValLen_ == 0) {
         return 0;
     }
-    uint32_t *colorVal = colorVal_.get();
-    unsigned long long int graySum = 0;
-    unsigned long long int grayVar = 0;
-    for (uint32_t i = 0; i < colorValLen_; i++) {
-        graySum += Rgb2Gray(colorVal[i]);
-    }
-    uint32_t grayAve = graySum / colorValLen_;
-    for (uint32_t i = 0; i < colorValLen_; i++) {
-        grayVar += pow(static_cast<unsigned long long int>(Rgb2Gray(colorVal[i])) - grayAve, 2); // 2 is square
-    }
-    grayVar /= colorValLen_;
-    return static_cast<uint32_t>(grayVar);
+    RSColorExtractKernel::ColorStats stats;
+    RSColorExtractKernel::AccumulateARGB32(colorVal_.get(), colorValLen_, nullptr, &stats);
+    return RSColorExtractKernel::CalcGrayMsd(stats.grayHist, colorValLen_);
 }
 
 float RSColorExtract::NormalizeRgb(uint32_t val)
@@ -230,7 +222,7 @@ float RSColorExtract::CalcRelativeLum(uint32_t color)
     float R = NormalizeRgb(r);
     float G = NormalizeRgb(g);
     float B = NormalizeRgb(b);
-    return R * RED_LUMINACE_RATIO + G * GREEN_LUMINACE_RATIO + B * BLUE_LUMINACE_RATIO;
+    return RSColorExtractKernel::RelativeLum(R, G, B);
 }
 
 float RSColorExtract::CalcContrastToWhite() const
@@ -238,16 +230,14 @@ float RSColorExtract::CalcContrastToWhite() const
     if (colorValLen_ == 0) {
         return 0.0;
     }
-    uint32_t *colorVal = colorVal_.get();
-    float lightDegree = 0;
-    float luminanceSum = 0;
-    for (uint32_t i = 0; i < colorValLen_; i++) {
-        luminanceSum += CalcRelativeLum(colorVal[i]);
+    // NormalizeRgb costs a pow per channel, look it up by channel level instead
+    float normalizeTable[RSColorExtractKernel::CHANNEL_LEVEL_NUM];
+    for (uint32_t level = 0; level < RSColorExtractKernel::CHANNEL_LEVEL_NUM; level++) {
+        normalizeTable[level] = NormalizeRgb(level);
     }
-    float luminanceAve = luminanceSum / colorValLen_;
-     // 0.05 is used to ensure denominator is not 0;
-    lightDegree = (1 + 0.05) / (luminanceAve + 0.05);
-    return lightDegree;
+    RSColorExtractKernel::ColorStats stats;
+    RSColorExtractKernel::AccumulateARGB32(colorVal_.get(), colorValLen_, nullptr, &stats, normalizeTable);
+    return RSColorExtractKernel::CalcContrastToWhite(stats.luminanceSum, colorValLen_);
 }
 
 void RSColorExtract::GetNFeatureColors(int colorNum)
@@ -262,10 +252,7 @@ void RSColorExtract::GetNFeatureColors(int colorNum)
         delete[] ptr;
     });
     hist_ = move(histShared);
-    for (uint32_t i = 0; i < colorValLen_; i++) {
-        uint32_t quantizedColor = QuantizeFromRGB888(colorVal[i]);
-        hist[quantizedColor]++;
-    }
+    RSColorExtractKernel::AccumulateARGB32(colorVal, colorValLen_, hist, nullptr);
 
     for (uint32_t color = 0; color < histLen; color++) {
         if (hist[color] > 0) {
@@ -34,6 +34,7 @@
 #include "platform/common/rs_system_properties.h"
 #include "render/rs_drawing_filter.h"
 #include "render/rs_filter_cache_memory_controller.h"
+#include "render/rs_filter_result_cache.h"
 #include "render/rs_high_performance_visual_engine.h"
 
 #ifdef USE_M133_SKIA
@@ -350,8 +351,25 @@ void RSFilterCacheManager::GenerateFilteredSnapshot(
 
     // planning yan for LINEAR_GEANDIENT_BLUR
 
-    // Create an offscreen canvas with the same size as the filter region.
+    // Another node may have applied the same filter to the same content already.
     auto offscreenRect = dstRect;
+    auto& resultCache = RSFilterResultCache::Instance();
+    RSFilterResultCache::Key resultKey;
+    bool useResultCache = resultCache.IsEnabled() &&
+        RSFilterResultCache::MakeKey(filter->Hash(), cachedSnapshot_->cachedImage_, offscreenRect,
+            RSFilterResultCache::GetContextId(canvas.GetGPUContext().get()), resultKey);
+    if (useResultCache) {
+        if (auto cachedResult = resultCache.Get(resultKey)) {
+            RS_OPTIONAL_TRACE_NAME_FMT("RSFilterCacheManager::GenerateFilteredSnapshot hit result cache %dx%d",
+                offscreenRect.GetWidth(), offscreenRect.GetHeight());
+            ReplaceCachedEffectData(
+                std::move(cachedResult), offscreenRect, cachedFilteredSnapshot_, cachedSnapshot_->geCacheProvider_);
+            isHpaeCachedFilteredSnapshot_ = false;
+            return;
+        }
+    }
+
+    // Create an offscreen canvas with the same size as the filter region.
     std::shared_ptr<Drawing::Surface> offscreenSurface = CreateOffscreenSurface(surface, offscreenRect, filter);
     if (offscreenSurface == nullptr) {
         RS_LOGD("RSFilterCacheManager::GenerateFilteredSnapshot offscreenSurface is nullptr");
@@ -386,6 +404,9 @@ void RSFilterCacheManager::GenerateFilteredSnapshot(
             filteredSnapshot = filteredSnapshot->MakeRasterImage();
         }
     }
+    if (useResultCache) {
+        resultCache.Put(resultKey, filteredSnapshot);
+    }
     ReplaceCachedEffectData(
         std::move(filteredSnapshot), offscreenRect, cachedFilteredSnapshot_, cachedSnapshot_->geCacheProvider_);
     isHpaeCachedFilteredSnapshot_ = false;
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "render/rs_filter_result_cache.h"
+
+#include <string_view>
+#include <vector>
+
+#include "common/rs_optional_trace.h"
+#include "platform/common/rs_log.h"
+#include "platform/common/rs_system_properties.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr size_t BYTES_PER_KB = 1024;
+constexpr int32_t HASH_BYTES_PER_PIXEL = 4;
+constexpr uint64_t HASH_COMBINE_SEED = 0x9e3779b97f4a7c15;
+constexpr int HASH_COMBINE_LEFT_SHIFT = 6;
+constexpr int HASH_COMBINE_RIGHT_SHIFT = 2;
+constexpr double PERCENT = 100.0;
+
+inline void HashCombine(size_t& seed, uint64_t value)
+{
+    seed ^= std::hash<uint64_t>{}(value) + HASH_COMBINE_SEED + (seed << HASH_COMBINE_LEFT_SHIFT) +
+        (seed >> HASH_COMBINE_RIGHT_SHIFT);
+}
+} // namespace
+
+size_t RSFilterResultCache::KeyHash::operator()(const Key& key) const
+{
+    size_t seed = key.contentHash;
+    HashCombine(seed, key.filterHash);
+    HashCombine(seed, static_cast<uint32_t>(key.srcWidth));
+    HashCombine(seed, static_cast<uint32_t>(key.srcHeight));
+    HashCombine(seed, static_cast<uint32_t>(key.dstWidth));
+    HashCombine(seed, static_cast<uint32_t>(key.dstHeight));
+    HashCombine(seed, key.contextId);
+    return seed;
+}
+
+RSFilterResultCache& RSFilterResultCache::Instance()
+{
+    static RSFilterResultCache instance;
+    return instance;
+}
+
+RSFilterResultCache::RSFilterResultCache()
+{
+    int budgetKB = RSSystemProperties::GetFilterResultCacheBudgetKB();
+    byteBudget_ = budgetKB > 0 ? static_cast<size_t>(budgetKB) * BYTES_PER_KB : 0;
+}
+
+void RSFilterResultCache::SetByteBudget(size_t byteBudget)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    byteBudget_ = byteBudget;
+    if (byteBudget_ == 0) {
+        ClearPartitionsLocked();
+        return;
+    }
+    // partitions of other threads are evicted by their owners on the next access
+    for (auto& [contextId, partition] : partitions_) {
+        if (partition.ownerThread == std::this_thread::get_id()) {
+            EvictLocked(partition, byteBudget_);
+        }
+    }
+}
+
+size_t RSFilterResultCache::GetByteBudget() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return byteBudget_;
+}
+
+bool RSFilterResultCache::IsEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return byteBudget_ > 0;
+}
+
+bool RSFilterResultCache::MakeKey(uint32_t filterHash, const std::shared_ptr<Drawing::Image>& input,
+    const Drawing::RectI& dstRect, uint64_t contextId, Key& key)
+{
+    if (input == nullptr || input->GetWidth() <= 0 || input->GetHeight() <= 0) {
+        return false;
+    }
+    RS_OPTIONAL_TRACE_NAME_FMT("RSFilterResultCache::MakeKey %dx%d", input->GetWidth(), input->GetHeight());
+    // read back in a fixed format, so equal content hashes the same whatever the backing of the image
+    Drawing::ImageInfo info(input->GetWidth(), input->GetHeight(), Drawing::COLORTYPE_RGBA_8888,
+        Drawing::ALPHATYPE_PREMUL);
+    size_t rowBytes = static_cast<size_t>(input->GetWidth()) * HASH_BYTES_PER_PIXEL;
+    std::vector<char> pixels(rowBytes * static_cast<size_t>(input->GetHeight()));
+    if (!input->ReadPixels(info, pixels.data(), rowBytes, 0, 0)) {
+        ROSEN_LOGD("RSFilterResultCache::MakeKey failed to read pixels");
+        return false;
+    }
+    key.filterHash = filterHash;
+    key.contentHash = std::hash<std::string_view>{}(std::string_view(pixels.data(), pixels.size()));
+    key.srcWidth = input->GetWidth();
+    key.srcHeight = input->GetHeight();
+    key.dstWidth = dstRect.GetWidth();
+    key.dstHeight = dstRect.GetHeight();
+    key.contextId = contextId;
+    return true;
+}
+
+uint64_t RSFilterResultCache::GetContextId(const Drawing::GPUContext* gpuContext)
+{
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(gpuContext));
+}
+
+std::shared_ptr<Drawing::Image> RSFilterResultCache::Get(const Key& key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto partition = GetOwnedPartitionLocked(key.contextId, false);
+    if (partition == nullptr) {
+        missCount_++;
+        return nullptr;
+    }
+    auto iter = partition->entries.find(key);
+    if (iter == partition->entries.end()) {
+        missCount_++;
+        return nullptr;
+    }
+    hitCount_++;
+    partition->lruList.splice(partition->lruList.begin(), partition->lruList, iter->second);
+    return iter->second->second;
+}
+
+void RSFilterResultCache::Put(const Key& key, const std::shared_ptr<Drawing::Image>& result)
+{
+    if (result == nullptr) {
+        return;
+    }
+    size_t bytes = GetImageBytes(result);
+    std::lock_guard<std::mutex> lock(mutex_);
+    // a result larger than the whole budget would only flush the other entries
+    if (bytes == 0 || bytes > byteBudget_) {
+        return;
+    }
+    auto partition = GetOwnedPartitionLocked(key.contextId, true);
+    if (partition == nullptr) {
+        return;
+    }
+    auto iter = partition->entries.find(key);
+    if (iter != partition->entries.end()) {
+        partition->cachedBytes -= GetImageBytes(iter->second->second);
+        partition->lruList.erase(iter->second);
+        partition->entries.erase(iter);
+    }
+    EvictLocked(*partition, byteBudget_ - bytes);
+    partition->lruList.emplace_front(key, result);
+    partition->entries.emplace(key, partition->lruList.begin());
+    partition->cachedBytes += bytes;
+}
+
+void RSFilterResultCache::ClearContext(uint64_t contextId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = partitions_.find(contextId);
+    if (iter == partitions_.end()) {
+        return;
+    }
+    if (iter->second.ownerThread != std::this_thread::get_id()) {
+        ROSEN_LOGD("RSFilterResultCache::ClearContext not called on the owner thread, clear on its next access");
+        iter->second.needClear = true;
+        return;
+    }
+    partitions_.erase(iter);
+}
+
+void RSFilterResultCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ClearPartitionsLocked();
+}
+
+size_t RSFilterResultCache::GetCachedBytes() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t cachedBytes = 0;
+    for (const auto& [contextId, partition] : partitions_) {
+        cachedBytes += partition.cachedBytes;
+    }
+    return cachedBytes;
+}
+
+size_t RSFilterResultCache::GetEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t entryCount = 0;
+    for (const auto& [contextId, partition] : partitions_) {
+        entryCount += partition.entries.size();
+    }
+    return entryCount;
+}
+
+void RSFilterResultCache::Dump(std::string& dumpString) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t cachedBytes = 0;
+    size_t entryCount = 0;
+    for (const auto& [contextId, partition] : partitions_) {
+        cachedBytes += partition.cachedBytes;
+        entryCount += partition.entries.size();
+    }
+    uint64_t lookupCount = hitCount_ + missCount_;
+    double hitRate = lookupCount > 0 ? hitCount_ * PERCENT / lookupCount : 0.0;
+    dumpString.append("\nRSFilterResultCache: budget " + std::to_string(byteBudget_) + " bytes per context, cached " +
+        std::to_string(cachedBytes) + " bytes in " + std::to_string(entryCount) + " entries of " +
+        std::to_string(partitions_.size()) + " contexts\n");
+    dumpString.append("  hit " + std::to_string(hitCount_) + ", miss " + std::to_string(missCount_) +
+        ", hit rate " + std::to_string(hitRate) + "%, evict " + std::to_string(evictCount_) + "\n");
+}
+
+size_t RSFilterResultCache::GetImageBytes(const std::shared_ptr<Drawing::Image>& image)
+{
+    if (image == nullptr || image->GetWidth() <= 0 || image->GetHeight() <= 0) {
+        return 0;
+    }
+    auto bytesPerPixel = image->GetImageInfo().GetBytesPerPixel();
+    return static_cast<size_t>(image->GetWidth()) * static_cast<size_t>(image->GetHeight()) *
+        static_cast<size_t>(bytesPerPixel > 0 ? bytesPerPixel : HASH_BYTES_PER_PIXEL);
+}
+
+RSFilterResultCache::Partition* RSFilterResultCache::GetOwnedPartitionLocked(uint64_t contextId, bool create)
+{
+    auto iter = partitions_.find(contextId);
+    if (iter == partitions_.end()) {
+        if (!create) {
+            return nullptr;
+        }
+        iter = partitions_.emplace(contextId, Partition()).first;
+        iter->second.ownerThread = std::this_thread::get_id();
+    }
+    auto& partition = iter->second;
+    // textures of a gpu context are only used and released on the thread of the context
+    if (partition.ownerThread != std::this_thread::get_id()) {
+        return nullptr;
+    }
+    if (partition.needClear) {
+        partition.needClear = false;
+        partition.lruList.clear();
+        partition.entries.clear();
+        partition.cachedBytes = 0;
+    }
+    EvictLocked(partition, byteBudget_);
+    return &partition;
+}
+
+void RSFilterResultCache::ClearPartitionsLocked()
+{
+    for (auto iter = partitions_.begin(); iter != partitions_.end();) {
+        if (iter->second.ownerThread == std::this_thread::get_id()) {
+            iter = partitions_.erase(iter);
+        } else {
+            iter->second.needClear = true;
+            ++iter;
+        }
+    }
+}
+
+void RSFilterResultCache::EvictLocked(Partition& partition, size_t byteBudget)
+{
+    while (partition.cachedBytes > byteBudget && !partition.lruList.empty()) {
+        auto& entry = partition.lruList.back();
+        partition.cachedBytes -= GetImageBytes(entry.second);
+        partition.entries.erase(entry.first);
+        partition.lruList.pop_back();
+        evictCount_++;
+    }
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -49,8 +49,11 @@ void RSImageCache::CacheDrawingImage(uint64_t uniqueId, std::shared_ptr<Drawing:
         if (!IsCacheAccessAllowed(uniqueId, callingPid)) {
             return;
         }
-        std::lock_guard<std::mutex> lock(mutex_);
         drawingImageCache_.emplace(uniqueId, std::make_pair(img, 0));
+        if (releasedImageBudget_ > 0) {
+            // the id is live again, a released copy must not shadow it later
+            TakeReleasedDrawingImage(uniqueId);
+        }
     }
 }
 
@@ -60,40 +63,147 @@ std::shared_ptr<Drawing::Image> RSImageCache::GetDrawingImageCache(uint64_t uniq
     if (!IsCacheAccessAllowed(uniqueId, callingPid)) {
         return nullptr;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = drawingImageCache_.find(uniqueId);
-    if (it != drawingImageCache_.end()) {
-        return it->second.first;
+    auto img = drawingImageCache_.Visit(uniqueId, [uniqueId](auto& map) -> std::shared_ptr<Drawing::Image> {
+        auto it = map.find(uniqueId);
+        return it != map.end() ? it->second.first : nullptr;
+    });
+    if (img != nullptr) {
+        drawingImageHitCount_++;
+        return img;
     }
-    return nullptr;
+    if (releasedImageBudget_ > 0) {
+        img = TakeReleasedDrawingImage(uniqueId);
+    }
+    if (img == nullptr) {
+        drawingImageMissCount_++;
+        return nullptr;
+    }
+    // revive the released image with ref count 0, as if the client had sent it again
+    releasedImageHitCount_++;
+    return drawingImageCache_.Visit(uniqueId, [uniqueId, &img](auto& map) {
+        return map.emplace(uniqueId, std::make_pair(img, 0)).first->second.first;
+    });
 }
 
 void RSImageCache::IncreaseDrawingImageCacheRefCount(uint64_t uniqueId)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = drawingImageCache_.find(uniqueId);
-    if (it != drawingImageCache_.end()) {
-        it->second.second++;
-    }
+    drawingImageCache_.Visit(uniqueId, [uniqueId](auto& map) {
+        auto it = map.find(uniqueId);
+        if (it != map.end()) {
+            it->second.second++;
+        }
+    });
 }
 
 void RSImageCache::ReleaseDrawingImageCache(uint64_t uniqueId)
 {
     // release the Drawing::Image if no RSImage holds it
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = drawingImageCache_.find(uniqueId);
-    if (it != drawingImageCache_.end()) {
+    auto released = drawingImageCache_.Visit(uniqueId, [uniqueId](auto& map) -> std::shared_ptr<Drawing::Image> {
+        auto it = map.find(uniqueId);
+        if (it == map.end()) {
+            return nullptr;
+        }
         auto& [ptr, count] = it->second;
-        if (ptr == nullptr || count == 0) {
-            drawingImageCache_.erase(it);
-            return;
+        if (ptr != nullptr && count > 1) {
+            count--;
+            return nullptr;
         }
-        if (--count == 0) {
-            drawingImageCache_.erase(it);
+        auto img = std::move(ptr);
+        map.erase(it);
+        return img;
+    });
+    if (released != nullptr && releasedImageBudget_ > 0) {
+        RetainReleasedDrawingImage(uniqueId, std::move(released));
+    }
+}
+
+void RSImageCache::RetainReleasedDrawingImage(uint64_t uniqueId, std::shared_ptr<Drawing::Image> img)
+{
+    size_t bytes = static_cast<size_t>(img->GetWidth()) * static_cast<size_t>(img->GetHeight()) *
+        static_cast<size_t>(img->GetImageInfo().GetBytesPerPixel());
+    // evicted images are destroyed after the lock is dropped
+    std::vector<std::shared_ptr<Drawing::Image>> evicted;
+    {
+        std::lock_guard<std::mutex> lock(releasedImageMutex_);
+        auto indexIt = releasedImageIndex_.find(uniqueId);
+        if (indexIt != releasedImageIndex_.end()) {
+            releasedImageBytes_ -= indexIt->second->bytes;
+            evicted.emplace_back(std::move(indexIt->second->image));
+            releasedImageLru_.erase(indexIt->second);
+            releasedImageIndex_.erase(indexIt);
         }
+        releasedImageLru_.push_front({ uniqueId, std::move(img), bytes });
+        releasedImageIndex_.emplace(uniqueId, releasedImageLru_.begin());
+        releasedImageBytes_ += bytes;
+        TrimReleasedDrawingImages(evicted);
     }
 }
 
+std::shared_ptr<Drawing::Image> RSImageCache::TakeReleasedDrawingImage(uint64_t uniqueId) const
+{
+    std::lock_guard<std::mutex> lock(releasedImageMutex_);
+    auto indexIt = releasedImageIndex_.find(uniqueId);
+    if (indexIt == releasedImageIndex_.end()) {
+        return nullptr;
+    }
+    auto img = std::move(indexIt->second->image);
+    releasedImageBytes_ -= indexIt->second->bytes;
+    releasedImageLru_.erase(indexIt->second);
+    releasedImageIndex_.erase(indexIt);
+    return img;
+}
+
+void RSImageCache::TrimReleasedDrawingImages(std::vector<std::shared_ptr<Drawing::Image>>& evicted)
+{
+    size_t budget = releasedImageBudget_;
+    while (releasedImageBytes_ > budget && !releasedImageLru_.empty()) {
+        auto& oldest = releasedImageLru_.back();
+        releasedImageBytes_ -= oldest.bytes;
+        evicted.emplace_back(std::move(oldest.image));
+        releasedImageIndex_.erase(oldest.uniqueId);
+        releasedImageLru_.pop_back();
+        releasedImageEvictionCount_++;
+    }
+}
+
+void RSImageCache::SetReleasedImageBudget(size_t bytes)
+{
+    releasedImageBudget_ = bytes;
+    std::vector<std::shared_ptr<Drawing::Image>> evicted;
+    std::lock_guard<std::mutex> lock(releasedImageMutex_);
+    TrimReleasedDrawingImages(evicted);
+}
+
+void RSImageCache::PurgeReleasedDrawingImages()
+{
+    std::list<ReleasedImage> purged;
+    std::lock_guard<std::mutex> lock(releasedImageMutex_);
+    releasedImageEvictionCount_ += releasedImageLru_.size();
+    purged.swap(releasedImageLru_);
+    releasedImageIndex_.clear();
+    releasedImageBytes_ = 0;
+}
+
+void RSImageCache::Dump(DfxString& log) const
+{
+    constexpr double KB = 1024.0;
+    size_t releasedCount = 0;
+    size_t releasedBytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(releasedImageMutex_);
+        releasedCount = releasedImageLru_.size();
+        releasedBytes = releasedImageBytes_;
+    }
+    log.AppendFormat("RSImageCache Dump:\n");
+    log.AppendFormat("  Entries: %zu drawing images / %zu pixelmaps / %zu pixelmap related images\n",
+        drawingImageCache_.size(), pixelMapCache_.size(), pixelMapIdRelatedDrawingImageCache_.size());
+    log.AppendFormat("  Released LRU: %zu images, %.2fKB of %.2fKB budget\n", releasedCount,
+        static_cast<double>(releasedBytes) / KB, static_cast<double>(releasedImageBudget_.load()) / KB);
+    log.AppendFormat("  Lookups: %" PRIu64 " hit / %" PRIu64 " released hit / %" PRIu64 " miss, %" PRIu64
+        " evicted\n", drawingImageHitCount_.load(), releasedImageHitCount_.load(), drawingImageMissCount_.load(),
+        releasedImageEvictionCount_.load());
+}
+
 void RSImageCache::CachePixelMap(uint64_t uniqueId, std::shared_ptr<Media::PixelMap> pixelMap)
 {
     if (pixelMap && uniqueId > 0) {
@@ -101,10 +211,7 @@ void RSImageCache::CachePixelMap(uint64_t uniqueId, std::shared_ptr<Media::Pixel
         if (!IsCacheAccessAllowed(uniqueId, callingPid)) {
             return;
         }
-        {
-            std::lock_guard<std::mutex> lock(mutex_);
-            pixelMapCache_.emplace(uniqueId, std::make_pair(pixelMap, 0));
-        }
+        pixelMapCache_.emplace(uniqueId, std::make_pair(pixelMap, 0));
         auto type = pixelMap->GetAllocatorType();
         pid_t pid = uniqueId >> 32; // right shift 32 bit to restore pid
         if (type != Media::AllocatorType::DMA_ALLOC && pid) {
@@ -122,21 +229,20 @@ std::shared_ptr<Media::PixelMap> RSImageCache::GetPixelMapCache(uint64_t uniqueI
     if (!IsCacheAccessAllowed(uniqueId, callingPid)) {
         return nullptr;
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = pixelMapCache_.find(uniqueId);
-    if (it != pixelMapCache_.end()) {
-        return it->second.first;
-    }
-    return nullptr;
+    return pixelMapCache_.Visit(uniqueId, [uniqueId](auto& map) -> std::shared_ptr<Media::PixelMap> {
+        auto it = map.find(uniqueId);
+        return it != map.end() ? it->second.first : nullptr;
+    });
 }
 
 void RSImageCache::IncreasePixelMapCacheRefCount(uint64_t uniqueId)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    auto it = pixelMapCache_.find(uniqueId);
-    if (it != pixelMapCache_.end()) {
-        it->second.second++;
-    }
+    pixelMapCache_.Visit(uniqueId, [uniqueId](auto& map) {
+        auto it = map.find(uniqueId);
+        if (it != map.end()) {
+            it->second.second++;
+        }
+    });
 }
 
 void RSImageCache::CollectUniqueId(uint64_t uniqueId)
@@ -173,31 +279,30 @@ bool RSImageCache::CheckUniqueIdIsEmpty()
 void RSImageCache::ReleasePixelMapCache(uint64_t uniqueId)
 {
     std::shared_ptr<Media::PixelMap> pixelMap = nullptr;
-    {
-        // release the pixelMap if no RSImage holds it
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto it = pixelMapCache_.find(uniqueId);
-        if (it != pixelMapCache_.end()) {
-            if (it->second.second > 0) {
-                it->second.second--;
-            }
-            if (it->second.first == nullptr || it->second.second == 0) {
-                pixelMap = it->second.first;
-                bool shouldCount = pixelMap && pixelMap->GetAllocatorType() != Media::AllocatorType::DMA_ALLOC;
-                pid_t pid = uniqueId >> 32; // right shift 32 bit to restore pid
-                if (shouldCount && pid) {
-                    auto realSize = pixelMap->GetAllocatorType() == Media::AllocatorType::SHARE_MEM_ALLOC
-                        ? pixelMap->GetCapacity() / 2 // rs only counts half of the SHARE_MEM_ALLOC memory
-                        : pixelMap->GetCapacity();
-                    MemorySnapshot::Instance().RemoveCpuMemory(pid, realSize);
-                }
-                pixelMapCache_.erase(it);
-                ReleaseDrawingImageCacheByPixelMapId(uniqueId);
+    // release the pixelMap if no RSImage holds it
+    pixelMapCache_.Visit(uniqueId, [this, uniqueId, &pixelMap](auto& map) {
+        auto it = map.find(uniqueId);
+        if (it == map.end()) {
+            ReleaseDrawingImageCacheByPixelMapId(uniqueId);
+            return;
+        }
+        if (it->second.second > 0) {
+            it->second.second--;
+        }
+        if (it->second.first == nullptr || it->second.second == 0) {
+            pixelMap = it->second.first;
+            bool shouldCount = pixelMap && pixelMap->GetAllocatorType() != Media::AllocatorType::DMA_ALLOC;
+            pid_t pid = uniqueId >> 32; // right shift 32 bit to restore pid
+            if (shouldCount && pid) {
+                auto realSize = pixelMap->GetAllocatorType() == Media::AllocatorType::SHARE_MEM_ALLOC
+                    ? pixelMap->GetCapacity() / 2 // rs only counts half of the SHARE_MEM_ALLOC memory
+                    : pixelMap->GetCapacity();
+                MemorySnapshot::Instance().RemoveCpuMemory(pid, realSize);
             }
-        } else {
+            map.erase(it);
             ReleaseDrawingImageCacheByPixelMapId(uniqueId);
         }
-    }
+    });
     pixelMap.reset();
 }
 
@@ -206,19 +311,18 @@ bool RSImageCache::CheckRefCntAndReleaseImageCache(uint64_t uniqueId, std::share
     if (!pixelMapIn) {
         return false;
     }
-    {
-        // release the pixelMap if no RSImage holds it
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto it = pixelMapCache_.find(uniqueId);
-        if (it == pixelMapCache_.end()) {
+    // release the pixelMap if no RSImage holds it
+    return pixelMapCache_.Visit(uniqueId, [this, uniqueId, &pixelMapIn](auto& map) {
+        auto it = map.find(uniqueId);
+        if (it == map.end()) {
             return false;
         }
         if (it->second.first != pixelMapIn || it->second.second > 1) {
             return false; // skip purge if pixelMap mismatch
         }
         ReleaseDrawingImageCacheByPixelMapId(uniqueId);
-    }
-    return true;
+        return true;
+    });
 }
 
 void RSImageCache::CacheEditablePixelMap(uint64_t uniqueId, std::shared_ptr<Media::PixelMap> pixelMap)
@@ -343,30 +447,30 @@ void RSImageCache::CacheRenderDrawingImageByPixelMapId(uint64_t uniqueId,
     std::shared_ptr<Drawing::Image> img, pid_t tid)
 {
     if (uniqueId > 0 && img) {
-        std::lock_guard<std::mutex> lock(mapMutex_);
-        pixelMapIdRelatedDrawingImageCache_[uniqueId][tid] = img;
+        pixelMapIdRelatedDrawingImageCache_.Visit(uniqueId, [uniqueId, tid, &img](auto& map) {
+            map[uniqueId][tid] = img;
+        });
     }
 }
 
 std::shared_ptr<Drawing::Image> RSImageCache::GetRenderDrawingImageCacheByPixelMapId(uint64_t uniqueId, pid_t tid) const
 {
-    std::lock_guard<std::mutex> lock(mapMutex_);
-    auto it = pixelMapIdRelatedDrawingImageCache_.find(uniqueId);
-    if (it != pixelMapIdRelatedDrawingImageCache_.end()) {
-        auto innerIt = it->second.find(tid);
-        if (innerIt != it->second.end()) {
-            return innerIt->second;
-        }
-    }
-    return nullptr;
+    return pixelMapIdRelatedDrawingImageCache_.Visit(uniqueId,
+        [uniqueId, tid](auto& map) -> std::shared_ptr<Drawing::Image> {
+            auto it = map.find(uniqueId);
+            if (it != map.end()) {
+                auto innerIt = it->second.find(tid);
+                if (innerIt != it->second.end()) {
+                    return innerIt->second;
+                }
+            }
+            return nullptr;
+        });
 }
 
 void RSImageCache::ReleaseDrawingImageCacheByPixelMapId(uint64_t uniqueId)
 {
-    std::lock_guard<std::mutex> lock(mapMutex_);
-    auto it = pixelMapIdRelatedDrawingImageCache_.find(uniqueId);
-    if (it != pixelMapIdRelatedDrawingImageCache_.end()) {
-        pixelMapIdRelatedDrawingImageCache_.erase(it);
+    if (pixelMapIdRelatedDrawingImageCache_.erase(uniqueId) > 0) {
 #ifdef RS_ENABLE_IMAGE_DETAIL_ENHANCER
         // used for ScaleImageAsync
         bool isEnabled = RSImageDetailEnhancerThread::Instance().GetEnabled();
@@ -15,6 +15,9 @@
 
 #include "render/rs_path.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "draw/path.h"
 #include "utils/matrix.h"
 #include "utils/scalar.h"
@@ -23,6 +26,23 @@
 
 namespace OHOS {
 namespace Rosen {
+namespace {
+// keeps the table of a long path under 64KB, the step is then longer than the precision
+constexpr size_t MAX_POS_TAN_SAMPLE_COUNT = 4096;
+// cosine of the largest turn of the tangent between two samples that is still interpolated, about 11 degrees
+constexpr float MIN_CONTINUOUS_TANGENT_COS = 0.98f;
+// the chord between two samples is never longer than the arc between them unless the path breaks there
+constexpr float CHORD_TOLERANCE = 1e-3f;
+
+bool IsContinuous(float step, float fromX, float fromY, float toX, float toY, float tangentCos)
+{
+    float maxChord = step * (1.0f + CHORD_TOLERANCE) + CHORD_TOLERANCE;
+    float dx = toX - fromX;
+    float dy = toY - fromY;
+    return dx * dx + dy * dy <= maxChord * maxChord && tangentCos >= MIN_CONTINUOUS_TANGENT_COS;
+}
+} // namespace
+
 std::shared_ptr<RSPath> RSPath::CreateRSPath()
 {
     return std::make_shared<RSPath>();
@@ -65,6 +85,102 @@ void RSPath::SetDrawingPath(const Drawing::Path& path)
         delete drPath_;
     }
     drPath_ = new Drawing::Path(path);
+    isDistanceValid_ = false;
+    ResetPosTanTable();
+}
+
+void RSPath::SetPosTanPrecision(float precision)
+{
+    if (!std::isfinite(precision) || precision < 0.0f) {
+        precision = 0.0f;
+    }
+    if (precision == posTanPrecision_) {
+        return;
+    }
+    posTanPrecision_ = precision;
+    ResetPosTanTable();
+}
+
+void RSPath::ResetPosTanTable()
+{
+    posTanQueryCount_ = 0;
+    isPosTanTableBuilt_ = false;
+    posTanStep_ = 0.0f;
+    posTanTable_.clear();
+}
+
+size_t RSPath::GetPosTanSampleCount() const
+{
+    float distance = GetDistance();
+    if (posTanPrecision_ <= 0.0f || !std::isfinite(distance) || distance <= 0.0f) {
+        return 0;
+    }
+    // intervals between the samples, the table has one more sample for the end of the path
+    return static_cast<size_t>(std::clamp(std::ceil(distance / posTanPrecision_), 1.0f,
+        static_cast<float>(MAX_POS_TAN_SAMPLE_COUNT)));
+}
+
+bool RSPath::BuildPosTanTable() const
+{
+    isPosTanTableBuilt_ = true;
+    posTanTable_.clear();
+    size_t count = GetPosTanSampleCount();
+    if (count == 0) {
+        return false;
+    }
+    float distance = GetDistance();
+    float step = distance / count;
+    posTanTable_.resize(count + 1);
+    Drawing::Point position;
+    Drawing::Point tangent;
+    for (size_t i = 0; i <= count; i++) {
+        // the last sample is at the end of the path rather than at count * step
+        float sampleDistance = i == count ? distance : step * i;
+        if (!drPath_->GetPositionAndTangent(sampleDistance, position, tangent, false)) {
+            ROSEN_LOGE("RSPath::BuildPosTanTable get failed at %{public}f", sampleDistance);
+            posTanTable_.clear();
+            return false;
+        }
+        posTanTable_[i] = { position.GetX(), position.GetY(), tangent.GetX(), tangent.GetY() };
+        if (i > 0) {
+            auto& previous = posTanTable_[i - 1];
+            // the tangents of the path measure are unit vectors
+            float tangentCos = previous.tangentX * tangent.GetX() + previous.tangentY * tangent.GetY();
+            previous.isContinuous = IsContinuous(sampleDistance - step * (i - 1), previous.x, previous.y,
+                position.GetX(), position.GetY(), tangentCos);
+        }
+    }
+    posTanStep_ = step;
+    return true;
+}
+
+bool RSPath::GetPosTanByTable(float distance, Vector2f& pos, float& degrees) const
+{
+    // same clamp as the path measure, NaN is left to the path measure too
+    if (std::isnan(distance)) {
+        return false;
+    }
+    distance = std::clamp(distance, 0.0f, distance_);
+    const PosTanSample* lower = &posTanTable_.back();
+    const PosTanSample* upper = lower;
+    float t = 0.0f;
+    if (distance < distance_) {
+        // the samples are evenly spaced, so the two around distance are found without a search
+        float index = distance / posTanStep_;
+        size_t lowerIndex = std::min(static_cast<size_t>(index), posTanTable_.size() - 2);
+        lower = &posTanTable_[lowerIndex];
+        upper = lower + 1;
+        t = std::clamp(index - lowerIndex, 0.0f, 1.0f);
+        if (t > 0.0f && !lower->isContinuous) {
+            return false;
+        }
+    }
+    pos.data_[0] = lower->x + (upper->x - lower->x) * t;
+    pos.data_[1] = lower->y + (upper->y - lower->y) * t;
+    float tangentX = lower->tangentX + (upper->tangentX - lower->tangentX) * t;
+    float tangentY = lower->tangentY + (upper->tangentY - lower->tangentY) * t;
+    degrees = Drawing::ConvertRadiansToDegrees(std::atan2(tangentY, tangentX));
+    return true;
 }
 
 std::shared_ptr<RSPath> RSPath::Reverse()
@@ -76,12 +192,25 @@ std::shared_ptr<RSPath> RSPath::Reverse()
 
 float RSPath::GetDistance() const
 {
-    return drPath_->GetLength(false);
+    if (!isDistanceValid_) {
+        distance_ = drPath_->GetLength(false);
+        isDistanceValid_ = true;
+    }
+    return distance_;
 }
 
 template<>
 bool RSPath::GetPosTan(float distance, Vector2f& pos, float& degrees) const
 {
+    if (posTanPrecision_ > 0.0f) {
+        // building the table costs one path query per sample, only a path queried that often pays it back
+        if (!isPosTanTableBuilt_ && ++posTanQueryCount_ >= GetPosTanSampleCount()) {
+            BuildPosTanTable();
+        }
+        if (!posTanTable_.empty() && GetPosTanByTable(distance, pos, degrees)) {
+            return true;
+        }
+    }
     Drawing::Point position;
     Drawing::Point tangent;
     bool ret = drPath_->GetPositionAndTangent(distance, position, tangent, false);
@@ -36,6 +36,10 @@ namespace {
 static constexpr size_t PARCEL_MAX_CAPACITY = 4000 * 1024; // upper bound of parcel capacity
 static constexpr size_t PARCEL_SPLIT_THRESHOLD = 1800 * 1024; // should be < PARCEL_MAX_CAPACITY
 static constexpr uint64_t MAX_ADVANCE_TIME = 1000000000; // one second advance most
+// below these sizes the dispatch cost of parallel apply outweighs the gain
+static constexpr size_t PARALLEL_APPLY_MIN_COMMANDS = 64;
+static constexpr size_t PARALLEL_APPLY_MIN_STAGE_COMMANDS = 32;
+static constexpr size_t PARALLEL_APPLY_MAX_TASKS = 4;
 #ifndef ROSEN_TRACE_DISABLE
 constexpr int TRACE_LEVEL_THREE = 3;
 #endif
@@ -65,11 +69,18 @@ RSTransactionData* RSTransactionData::Unmarshalling(Parcel& parcel)
     return nullptr;
 }
 
+RSTransactionData::ParallelApplyFunc RSTransactionData::parallelApplyFunc_ = nullptr;
+
 void RSTransactionData::AddAlarmLog(std::function<void(uint64_t, int, int)> func)
 {
     alarmLogFunc = func;
 }
 
+void RSTransactionData::SetParallelApplyFunc(ParallelApplyFunc func)
+{
+    parallelApplyFunc_ = std::move(func);
+}
+
 RSTransactionData::~RSTransactionData()
 {
     Clear();
@@ -214,15 +225,23 @@ void RSTransactionData::ProcessBySingleFrameComposer(RSContext& context)
     }
 }
 
+void RSTransactionData::ProcessCommand(RSContext& context, RSCommand* command)
+{
+    if (command == nullptr || !command->IsCallingPidValid()) {
+        return;
+    }
+    RS_PROFILER_EXECUTE_COMMAND(command);
+    command->Process(context);
+}
+
 void RSTransactionData::Process(RSContext& context)
 {
-    for (auto& [nodeId, followType, command] : payload_) {
-        if (command != nullptr) {
-            if (!command->IsCallingPidValid()) {
-                continue;
-            }
-            RS_PROFILER_EXECUTE_COMMAND(&*command);
-            command->Process(context);
+    if (parallelApplyFunc_ != nullptr && payload_.size() >= PARALLEL_APPLY_MIN_COMMANDS &&
+        !RS_PROFILER_IS_COMMAND_TRACKING_MODE()) {
+        ProcessParallel(context);
+    } else {
+        for (auto& [nodeId, followType, command] : payload_) {
+            ProcessCommand(context, command.get());
         }
     }
     if (token_ != 0) {
@@ -237,6 +256,93 @@ void RSTransactionData::Process(RSContext& context)
     }
 }
 
+// Splits the payload into stages of consecutive node-local commands. Every other command is a barrier:
+// it runs alone on the calling thread after everything before it has been applied, so the observable
+// order only changes between commands of different nodes inside one stage.
+void RSTransactionData::ProcessParallel(RSContext& context)
+{
+    size_t begin = 0;
+    while (begin < payload_.size()) {
+        size_t end = begin;
+        while (end < payload_.size()) {
+            auto& command = std::get<2>(payload_[end]);
+            if (command == nullptr || !CanProcessInParallel(*command)) {
+                break;
+            }
+            ++end;
+        }
+        if (end - begin >= PARALLEL_APPLY_MIN_STAGE_COMMANDS) {
+            ProcessStageParallel(context, begin, end);
+        } else {
+            for (size_t i = begin; i < end; ++i) {
+                ProcessCommand(context, std::get<2>(payload_[i]).get());
+            }
+        }
+        if (end < payload_.size()) {
+            ProcessCommand(context, std::get<2>(payload_[end]).get());
+        }
+        begin = end + 1;
+    }
+}
+
+// Commands of one node stay in one task in payload order; cross-node dirty marking is recorded per task
+// and replayed on the calling thread once all tasks have finished.
+void RSTransactionData::ProcessStageParallel(RSContext& context, size_t begin, size_t end)
+{
+    std::unordered_map<NodeId, size_t> groupIndex;
+    std::vector<std::vector<RSCommand*>> groups;
+    for (size_t i = begin; i < end; ++i) {
+        auto command = std::get<2>(payload_[i]).get();
+        if (!command->IsCallingPidValid()) {
+            continue;
+        }
+        auto [iter, inserted] = groupIndex.try_emplace(command->GetNodeId(), groups.size());
+        if (inserted) {
+            groups.emplace_back();
+        }
+        groups[iter->second].push_back(command);
+    }
+    if (groups.size() < 2) {
+        for (auto& group : groups) {
+            for (auto command : group) {
+                RS_PROFILER_EXECUTE_COMMAND(command);
+                command->Process(context);
+            }
+        }
+        return;
+    }
+
+    size_t taskCount = std::min(groups.size(), PARALLEL_APPLY_MAX_TASKS);
+    size_t target = (end - begin + taskCount - 1) / taskCount;
+    std::vector<std::vector<RSCommand*>> taskCommands(1);
+    for (auto& group : groups) {
+        if (taskCommands.back().size() >= target && taskCommands.size() < taskCount) {
+            taskCommands.emplace_back();
+        }
+        taskCommands.back().insert(taskCommands.back().end(), group.begin(), group.end());
+    }
+
+    std::vector<std::vector<RSRenderNode::DeferredDirtyEvent>> events(taskCommands.size());
+    std::vector<std::function<void()>> tasks;
+    tasks.reserve(taskCommands.size());
+    for (size_t i = 0; i < taskCommands.size(); ++i) {
+        tasks.emplace_back([&context, &commands = taskCommands[i], &taskEvents = events[i]]() {
+            RSRenderNode::SetDeferredDirtyEvents(&taskEvents);
+            for (auto command : commands) {
+                RS_PROFILER_EXECUTE_COMMAND(command);
+                command->Process(context);
+            }
+            RSRenderNode::SetDeferredDirtyEvents(nullptr);
+        });
+    }
+    RS_OPTIONAL_TRACE_NAME_FMT("RSTransactionData::ProcessStageParallel commands:%zu nodes:%zu tasks:%zu",
+        end - begin, groups.size(), tasks.size());
+    parallelApplyFunc_(tasks);
+    for (auto& taskEvents : events) {
+        RSRenderNode::FlushDeferredDirtyEvents(taskEvents);
+    }
+}
+
 void RSTransactionData::Clear()
 {
     std::unique_lock<std::mutex> lock(commandMutex_);
@@ -298,6 +404,49 @@ const std::set<uint16_t>& RSTransactionData::GetTreeHierarchyCommandSubTypes()
     return treeHierarchySubTypes;
 }
 
+// Returns the set of RS_NODE command subtypes whose Process only touches the target node itself
+// (plain value property updates). Only these may be applied in parallel with commands of other nodes.
+const std::set<uint16_t>& RSTransactionData::GetNodeLocalCommandSubTypes()
+{
+    static const std::set<uint16_t> nodeLocalSubTypes = {
+        RSNodeCommandType::UPDATE_MODIFIER_BOOL,
+        RSNodeCommandType::UPDATE_MODIFIER_FLOAT,
+        RSNodeCommandType::UPDATE_MODIFIER_INT,
+        RSNodeCommandType::UPDATE_MODIFIER_COLOR,
+        RSNodeCommandType::UPDATE_MODIFIER_GRAVITY,
+        RSNodeCommandType::UPDATE_MODIFIER_MATRIX3F,
+        RSNodeCommandType::UPDATE_MODIFIER_QUATERNION,
+        RSNodeCommandType::UPDATE_MODIFIER_VECTOR2F,
+        RSNodeCommandType::UPDATE_MODIFIER_VECTOR3F,
+        RSNodeCommandType::UPDATE_MODIFIER_VECTOR4_BORDER_STYLE,
+        RSNodeCommandType::UPDATE_MODIFIER_VECTOR4_COLOR,
+        RSNodeCommandType::UPDATE_MODIFIER_VECTOR4F,
+        RSNodeCommandType::UPDATE_MODIFIER_RRECT,
+        RSNodeCommandType::UPDATE_MODIFIER_VECTOR_FLOAT,
+        RSNodeCommandType::UPDATE_MODIFIER_VECTOR_VECTOR2F,
+        RSNodeCommandType::UPDATE_MODIFIER_SHORT,
+        RSNodeCommandType::UPDATE_MODIFIER_VECTOR_VECTOR4F,
+    };
+    return nodeLocalSubTypes;
+}
+
+bool RSTransactionData::IsNodeLocalCommand(uint16_t commandType, uint16_t commandSubType)
+{
+    return (commandType == RSCommandType::RS_NODE) && (GetNodeLocalCommandSubTypes().count(commandSubType) > 0);
+}
+
+// A FORCE_OVERWRITE update cancels the running animations of the property, which finishes them through the
+// animation manager and posts UI messages, so it is a barrier like any other non node-local command.
+bool RSTransactionData::CanProcessInParallel(const RSCommand& command)
+{
+    if (!IsNodeLocalCommand(command.GetType(), command.GetSubType())) {
+        return false;
+    }
+    PropertyId propertyId = 0;
+    PropertyUpdateType updateType = UPDATE_TYPE_OVERWRITE;
+    return command.GetPropertyUpdate(propertyId, updateType) && updateType != UPDATE_TYPE_FORCE_OVERWRITE;
+}
+
 // Checks whether a command is a tree hierarchy command by its type and subtype.
 bool RSTransactionData::IsTreeHierarchyCommand(uint16_t commandType, uint16_t commandSubType)
 {
@@ -358,6 +507,60 @@ void RSTransactionData::MoveAllCommand(std::unique_ptr<RSTransactionData>& trans
     payload_.clear();
 }
 
+bool RSTransactionData::ReplaceCommand(size_t index, std::unique_ptr<RSCommand>& command)
+{
+    if (command == nullptr || index >= payload_.size()) {
+        return false;
+    }
+    auto& oldCommand = std::get<2>(payload_[index]); // 2:command
+    if (oldCommand == nullptr || oldCommand->GetUniqueType() != command->GetUniqueType() ||
+        oldCommand->GetNodeId() != command->GetNodeId()) {
+        return false;
+    }
+    command->indexVerifier_ = index;
+    oldCommand = std::move(command);
+    return true;
+}
+
+bool RSTransactionData::AddCommandWithCoalescing(PropertyUpdateCoalescingState& state,
+    std::unique_ptr<RSCommand>& command, NodeId nodeId, FollowType followType)
+{
+    // the recorded indexes are only valid while every command of the transaction data is added here
+    if (state.transactionData != this || state.commandCount != GetCommandCount()) {
+        state.transactionData = this;
+        state.lastUpdateIndex.clear();
+    }
+    PropertyId propertyId = 0;
+    PropertyUpdateType updateType = UPDATE_TYPE_OVERWRITE;
+    if (command == nullptr || !command->GetPropertyUpdate(propertyId, updateType)) {
+        // tree and animation commands may depend on the property values set before them
+        state.lastUpdateIndex.clear();
+    } else if (updateType != UPDATE_TYPE_OVERWRITE) {
+        // incremental and forced updates must stay ordered with the overwrites of the same property
+        auto iter = state.lastUpdateIndex.find(command->GetNodeId());
+        if (iter != state.lastUpdateIndex.end()) {
+            iter->second.erase(propertyId);
+        }
+    } else {
+        auto& lastUpdateIndex = state.lastUpdateIndex[command->GetNodeId()];
+        auto iter = lastUpdateIndex.find(propertyId);
+        if (iter != lastUpdateIndex.end() && iter->second < payload_.size()) {
+            auto& lastCommand = std::get<2>(payload_[iter->second]); // 2:command
+            PropertyId lastPropertyId = 0;
+            PropertyUpdateType lastUpdateType = UPDATE_TYPE_INCREMENTAL;
+            if (lastCommand && lastCommand->GetPropertyUpdate(lastPropertyId, lastUpdateType) &&
+                lastPropertyId == propertyId && lastUpdateType == UPDATE_TYPE_OVERWRITE &&
+                ReplaceCommand(iter->second, command)) {
+                return true;
+            }
+        }
+        lastUpdateIndex[propertyId] = GetCommandCount();
+    }
+    AddCommand(command, nodeId, followType);
+    state.commandCount = GetCommandCount();
+    return false;
+}
+
 bool RSTransactionData::UnmarshallingCommand(Parcel& parcel)
 {
     Clear();
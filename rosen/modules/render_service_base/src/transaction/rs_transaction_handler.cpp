@@ -21,6 +21,7 @@
 
 #include "command/rs_ui_director_command.h"
 #include "platform/common/rs_log.h"
+#include "platform/common/rs_system_properties.h"
 #include "transaction/rs_transaction_proxy.h"
 
 #ifdef _WIN32
@@ -40,6 +41,16 @@
 
 namespace OHOS {
 namespace Rosen {
+RSTransactionHandler::RSTransactionHandler()
+    : propertyUpdateCoalescingEnabled_(RSSystemProperties::GetTransactionCoalescingEnabled())
+{}
+
+RSTransactionHandler::RSTransactionHandler(uint64_t token,
+    std::shared_ptr<RSRenderPipelineClient> renderPipelineClient)
+    : token_(token), renderPipelineClient_(renderPipelineClient),
+      propertyUpdateCoalescingEnabled_(RSSystemProperties::GetTransactionCoalescingEnabled())
+{}
+
 void RSTransactionHandler::SetRenderThreadClient(std::unique_ptr<RSIRenderClient>& renderThreadClient)
 {
     if (renderThreadClient != nullptr) {
@@ -161,6 +172,7 @@ void RSTransactionHandler::FlushImplicitTransaction(uint64_t timestamp, const st
     }
     timestamp_ = std::max(timestamp, timestamp_);
     thread_local pid_t tid = gettid();
+    ResetPropertyUpdateCoalescing();
     if (renderThreadClient_ != nullptr && !implicitCommonTransactionData_->IsEmpty()) {
         implicitCommonTransactionData_->timestamp_ = timestamp_;
         implicitCommonTransactionData_->token_ = token_;
@@ -278,6 +290,7 @@ void RSTransactionHandler::Begin(uint64_t syncId)
     RS_LOGD("RSTransactionHandler::Begin syncId:%{public}" PRIu64 ", transactionHandler:%{public}zu, "
         "remoteTransactionDataStack.size:%{public}zu", syncId, std::hash<RSTransactionHandler*>()(this),
         implicitRemoteTransactionDataStack_.size());
+    ResetPropertyUpdateCoalescing();
     implicitCommonTransactionDataStack_.emplace(std::make_unique<RSTransactionData>());
     implicitRemoteTransactionDataStack_.emplace(std::make_unique<RSTransactionData>());
     if (needSync_ && syncId > 0) {
@@ -298,6 +311,7 @@ void RSTransactionHandler::Commit(uint64_t timestamp)
             std::hash<RSTransactionHandler*>()(this));
         return;
     }
+    ResetPropertyUpdateCoalescing();
     if (!implicitCommonTransactionDataStack_.empty()) {
         implicitCommonTransactionDataStack_.pop();
     }
@@ -350,6 +364,7 @@ void RSTransactionHandler::CommitSyncTransaction(uint64_t syncId, uint64_t times
     std::unique_lock<std::mutex> cmdLock(mutex_);
     timestamp_ = std::max(timestamp, timestamp_);
     thread_local pid_t tid = gettid();
+    ResetPropertyUpdateCoalescing();
 
     if (renderThreadClient_) {
         ProcessSyncTransactionStack(implicitCommonTransactionDataStack_, *renderThreadClient_,
@@ -457,10 +472,11 @@ void RSTransactionHandler::SetParentPid(const int32_t parentPid)
 void RSTransactionHandler::AddCommonCommand(std::unique_ptr<RSCommand>& command)
 {
     if (!implicitCommonTransactionDataStack_.empty()) {
-        implicitCommonTransactionDataStack_.top()->AddCommand(command, 0, FollowType::NONE);
+        AddCommandWithCoalescing(implicitCommonTransactionDataStack_.top(), commonCoalescingState_, command, 0,
+            FollowType::NONE);
         return;
     }
-    implicitCommonTransactionData_->AddCommand(command, 0, FollowType::NONE);
+    AddCommandWithCoalescing(implicitCommonTransactionData_, commonCoalescingState_, command, 0, FollowType::NONE);
 }
 
 void RSTransactionHandler::MoveCommonCommandByNodeId(
@@ -507,10 +523,42 @@ void RSTransactionHandler::MoveCommonCommandByNodeIdExcludeTreeCommands(
 void RSTransactionHandler::AddRemoteCommand(std::unique_ptr<RSCommand>& command, NodeId nodeId, FollowType followType)
 {
     if (!implicitRemoteTransactionDataStack_.empty()) {
-        implicitRemoteTransactionDataStack_.top()->AddCommand(command, nodeId, followType);
+        AddCommandWithCoalescing(
+            implicitRemoteTransactionDataStack_.top(), remoteCoalescingState_, command, nodeId, followType);
         return;
     }
-    implicitRemoteTransactionData_->AddCommand(command, nodeId, followType);
+    AddCommandWithCoalescing(implicitRemoteTransactionData_, remoteCoalescingState_, command, nodeId, followType);
+}
+
+void RSTransactionHandler::AddCommandWithCoalescing(std::unique_ptr<RSTransactionData>& transactionData,
+    RSTransactionData::PropertyUpdateCoalescingState& state, std::unique_ptr<RSCommand>& command, NodeId nodeId,
+    FollowType followType)
+{
+    if (!propertyUpdateCoalescingEnabled_) {
+        transactionData->AddCommand(command, nodeId, followType);
+        return;
+    }
+    if (transactionData->AddCommandWithCoalescing(state, command, nodeId, followType)) {
+        coalescedCommandCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void RSTransactionHandler::ResetPropertyUpdateCoalescing()
+{
+    commonCoalescingState_ = RSTransactionData::PropertyUpdateCoalescingState();
+    remoteCoalescingState_ = RSTransactionData::PropertyUpdateCoalescingState();
+}
+
+void RSTransactionHandler::SetPropertyUpdateCoalescingEnabled(bool enabled)
+{
+    std::unique_lock<std::mutex> cmdLock(mutex_);
+    propertyUpdateCoalescingEnabled_ = enabled;
+    ResetPropertyUpdateCoalescing();
+}
+
+uint64_t RSTransactionHandler::GetCoalescedCommandCount() const
+{
+    return coalescedCommandCount_.load(std::memory_order_relaxed);
 }
 
 void RSTransactionHandler::MoveRemoteCommandByNodeIdExcludeTreeCommands(
@@ -52,6 +52,7 @@ RSTransactionProxy* RSTransactionProxy::GetInstance()
 }
 
 RSTransactionProxy::RSTransactionProxy()
+    : propertyUpdateCoalescingEnabled_(RSSystemProperties::GetTransactionCoalescingEnabled())
 {
     handler_ = std::make_shared<AppExecFwk::EventHandler>(AppExecFwk::EventRunner::GetMainEventRunner());
     renderPipelineClient_ = std::make_shared<RSRenderPipelineClient>();
@@ -163,6 +164,7 @@ void RSTransactionProxy::FlushImplicitTransaction(uint64_t timestamp, const std:
         timestamp_ = std::max(timestamp, timestamp_);
     }
     thread_local pid_t tid = gettid();
+    ResetPropertyUpdateCoalescing();
     if (renderThreadClient_ != nullptr && !implicitCommonTransactionData_->IsEmpty()) {
         implicitCommonTransactionData_->timestamp_ = timestamp_;
         implicitCommonTransactionData_->tid_ = tid;
@@ -285,6 +287,7 @@ void RSTransactionProxy::StartCloseSyncTransactionFallbackTask(bool isOpen)
 void RSTransactionProxy::Begin()
 {
     std::unique_lock<std::mutex> cmdLock(mutex_);
+    ResetPropertyUpdateCoalescing();
     implicitCommonTransactionDataStack_.emplace(std::make_unique<RSTransactionData>());
     implicitRemoteTransactionDataStack_.emplace(std::make_unique<RSTransactionData>());
     if (needSync_) {
@@ -296,6 +299,7 @@ void RSTransactionProxy::Begin()
 void RSTransactionProxy::Commit(uint64_t timestamp)
 {
     std::unique_lock<std::mutex> cmdLock(mutex_);
+    ResetPropertyUpdateCoalescing();
     if (!implicitCommonTransactionDataStack_.empty()) {
         implicitCommonTransactionDataStack_.pop();
     }
@@ -316,6 +320,7 @@ void RSTransactionProxy::CommitSyncTransaction(uint64_t timestamp, const std::st
     std::unique_lock<std::mutex> cmdLock(mutex_);
     timestamp_ = std::max(timestamp, timestamp_);
     thread_local pid_t tid = gettid();
+    ResetPropertyUpdateCoalescing();
     if (!implicitCommonTransactionDataStack_.empty()) {
         if (renderThreadClient_ != nullptr && (!implicitCommonTransactionDataStack_.top()->IsEmpty() ||
             implicitCommonTransactionDataStack_.top()->IsNeedSync())) {
@@ -395,19 +400,52 @@ void RSTransactionProxy::SetParentPid(const int32_t parentPid)
 void RSTransactionProxy::AddCommonCommand(std::unique_ptr<RSCommand> &command)
 {
     if (!implicitCommonTransactionDataStack_.empty()) {
-        implicitCommonTransactionDataStack_.top()->AddCommand(command, 0, FollowType::NONE);
+        AddCommandWithCoalescing(implicitCommonTransactionDataStack_.top(), commonCoalescingState_, command, 0,
+            FollowType::NONE);
         return;
     }
-    implicitCommonTransactionData_->AddCommand(command, 0, FollowType::NONE);
+    AddCommandWithCoalescing(implicitCommonTransactionData_, commonCoalescingState_, command, 0, FollowType::NONE);
 }
 
 void RSTransactionProxy::AddRemoteCommand(std::unique_ptr<RSCommand>& command, NodeId nodeId, FollowType followType)
 {
     if (!implicitRemoteTransactionDataStack_.empty()) {
-        implicitRemoteTransactionDataStack_.top()->AddCommand(command, nodeId, followType);
+        AddCommandWithCoalescing(
+            implicitRemoteTransactionDataStack_.top(), remoteCoalescingState_, command, nodeId, followType);
         return;
     }
-    implicitRemoteTransactionData_->AddCommand(command, nodeId, followType);
+    AddCommandWithCoalescing(implicitRemoteTransactionData_, remoteCoalescingState_, command, nodeId, followType);
+}
+
+void RSTransactionProxy::AddCommandWithCoalescing(std::unique_ptr<RSTransactionData>& transactionData,
+    RSTransactionData::PropertyUpdateCoalescingState& state, std::unique_ptr<RSCommand>& command, NodeId nodeId,
+    FollowType followType)
+{
+    if (!propertyUpdateCoalescingEnabled_) {
+        transactionData->AddCommand(command, nodeId, followType);
+        return;
+    }
+    if (transactionData->AddCommandWithCoalescing(state, command, nodeId, followType)) {
+        coalescedCommandCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void RSTransactionProxy::ResetPropertyUpdateCoalescing()
+{
+    commonCoalescingState_ = RSTransactionData::PropertyUpdateCoalescingState();
+    remoteCoalescingState_ = RSTransactionData::PropertyUpdateCoalescingState();
+}
+
+void RSTransactionProxy::SetPropertyUpdateCoalescingEnabled(bool enabled)
+{
+    std::unique_lock<std::mutex> cmdLock(mutex_);
+    propertyUpdateCoalescingEnabled_ = enabled;
+    ResetPropertyUpdateCoalescing();
+}
+
+uint64_t RSTransactionProxy::GetCoalescedCommandCount() const
+{
+    return coalescedCommandCount_.load(std::memory_order_relaxed);
 }
 
 } // namespace Rosen
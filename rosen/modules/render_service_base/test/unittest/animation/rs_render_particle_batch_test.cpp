@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "animation/rs_particle_field_collection.h"
+#include "animation/rs_particle_ripple_field.h"
+#include "animation/rs_particle_velocity_field.h"
+#include "animation/rs_render_particle.h"
+#include "animation/rs_render_particle_batch.h"
+#include "animation/rs_render_particle_effector.h"
+#include "animation/rs_render_particle_system.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr int64_t FRAME_TIME_NS = 16666667;
+constexpr int64_t PARTICLE_LIFETIME_MS = 10000;
+constexpr int FRAME_COUNT = 8;
+constexpr float POSITION_TOLERANCE = 1e-3f;
+constexpr float VALUE_TOLERANCE = 1e-4f;
+} // namespace
+
+class RSRenderParticleBatchTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static EmitterConfig MakeEmitterConfig(int particleCount)
+    {
+        return EmitterConfig(particleCount, ShapeType::RECT, Vector2f(0.f, 0.f), Vector2f(400.f, 400.f),
+            particleCount, Range<int64_t>(PARTICLE_LIFETIME_MS, PARTICLE_LIFETIME_MS), ParticleType::POINTS, 1.f,
+            nullptr, Vector2f(1.f, 1.f));
+    }
+
+    // every attribute changes with a random speed, opacity fades out so some particles die on the way
+    static std::shared_ptr<ParticleRenderParams> MakeRandomParams(int particleCount)
+    {
+        ParticleVelocity velocity(Range<float>(10.f, 80.f), Range<float>(0.f, 360.f));
+        auto accValue = RenderParticleParaType<float>(
+            Range<float>(5.f, 20.f), ParticleUpdator::RANDOM, Range<float>(-2.f, 2.f), {});
+        auto accAngle = RenderParticleParaType<float>(
+            Range<float>(0.f, 360.f), ParticleUpdator::RANDOM, Range<float>(-30.f, 30.f), {});
+        RenderParticleAcceleration acceleration(accValue, accAngle);
+        RenderParticleColorParaType color(Range<Color>(Color(0, 0, 0, 255), Color(255, 255, 255, 255)),
+            DistributionType::UNIFORM, ParticleUpdator::RANDOM, Range<float>(-300.f, 300.f),
+            Range<float>(-300.f, 300.f), Range<float>(-300.f, 300.f), Range<float>(-100.f, 0.f), {});
+        auto opacity = RenderParticleParaType<float>(
+            Range<float>(0.f, 1.f), ParticleUpdator::RANDOM, Range<float>(-3.f, 1.f), {});
+        auto scale = RenderParticleParaType<float>(
+            Range<float>(0.f, 2.f), ParticleUpdator::RANDOM, Range<float>(-2.f, 2.f), {});
+        auto spin = RenderParticleParaType<float>(
+            Range<float>(0.f, 90.f), ParticleUpdator::RANDOM, Range<float>(-90.f, 90.f), {});
+        return std::make_shared<ParticleRenderParams>(
+            MakeEmitterConfig(particleCount), velocity, acceleration, color, opacity, scale, spin);
+    }
+
+    static std::shared_ptr<ParticleRenderParams> MakeCurveParams(int particleCount)
+    {
+        ParticleVelocity velocity(Range<float>(10.f, 80.f), Range<float>(0.f, 360.f));
+        std::vector<std::shared_ptr<ChangeInOverLife<float>>> floatCurves {
+            std::make_shared<ChangeInOverLife<float>>(0.f, 1.f, 0, 50, RSInterpolator::DEFAULT),
+            std::make_shared<ChangeInOverLife<float>>(1.f, 0.5f, 50, 120, RSInterpolator::DEFAULT) };
+        std::vector<std::shared_ptr<ChangeInOverLife<Color>>> colorCurves {
+            std::make_shared<ChangeInOverLife<Color>>(
+                Color(255, 0, 0, 255), Color(0, 0, 255, 128), 0, 100, RSInterpolator::DEFAULT) };
+        auto accValue = RenderParticleParaType<float>(
+            Range<float>(5.f, 20.f), ParticleUpdator::CURVE, Range<float>(), floatCurves);
+        auto accAngle = RenderParticleParaType<float>(
+            Range<float>(0.f, 360.f), ParticleUpdator::CURVE, Range<float>(), floatCurves);
+        RenderParticleAcceleration acceleration(accValue, accAngle);
+        RenderParticleColorParaType color(Range<Color>(Color(255, 0, 0, 255), Color(255, 0, 0, 255)),
+            DistributionType::UNIFORM, ParticleUpdator::CURVE, Range<float>(), Range<float>(), Range<float>(),
+            Range<float>(), colorCurves);
+        auto opacity = RenderParticleParaType<float>(
+            Range<float>(0.f, 1.f), ParticleUpdator::CURVE, Range<float>(), floatCurves);
+        auto scale = RenderParticleParaType<float>(
+            Range<float>(0.f, 2.f), ParticleUpdator::CURVE, Range<float>(), floatCurves);
+        auto spin = RenderParticleParaType<float>(
+            Range<float>(0.f, 90.f), ParticleUpdator::CURVE, Range<float>(), floatCurves);
+        return std::make_shared<ParticleRenderParams>(
+            MakeEmitterConfig(particleCount), velocity, acceleration, color, opacity, scale, spin);
+    }
+
+    static std::shared_ptr<ParticleFieldCollection> MakeFields()
+    {
+        auto fields = std::make_shared<ParticleFieldCollection>();
+        auto ripple = std::make_shared<ParticleRippleField>(Vector2f(200.f, 200.f), 100.f, 50.f, 200.f, 0.5f);
+        ripple->regionShape_ = ShapeType::RECT;
+        ripple->regionPosition_ = Vector2f(200.f, 200.f);
+        ripple->regionSize_ = Vector2f(400.f, 400.f);
+        fields->Add(ripple);
+        auto velocity = std::make_shared<ParticleVelocityField>(Vector2f(10.f, -20.f));
+        velocity->regionShape_ = ShapeType::CIRCLE;
+        velocity->regionPosition_ = Vector2f(100.f, 100.f);
+        velocity->regionSize_ = Vector2f(200.f, 200.f);
+        fields->Add(velocity);
+        return fields;
+    }
+
+    static std::vector<std::shared_ptr<RSRenderParticle>> MakeParticles(
+        const std::shared_ptr<ParticleRenderParams>& params, int count)
+    {
+        std::vector<std::shared_ptr<RSRenderParticle>> particles;
+        for (int i = 0; i < count; i++) {
+            particles.push_back(std::make_shared<RSRenderParticle>(params));
+        }
+        return particles;
+    }
+
+    static std::vector<std::shared_ptr<RSRenderParticle>> CopyParticles(
+        const std::vector<std::shared_ptr<RSRenderParticle>>& particles)
+    {
+        std::vector<std::shared_ptr<RSRenderParticle>> copies;
+        for (const auto& particle : particles) {
+            copies.push_back(std::make_shared<RSRenderParticle>(*particle));
+        }
+        return copies;
+    }
+
+    // the per particle path of RSRenderParticleSystem::UpdateParticle
+    static void UpdateOneByOne(std::vector<std::shared_ptr<RSRenderParticle>>& particles,
+        const std::shared_ptr<ParticleFieldCollection>& fields, int64_t deltaTime)
+    {
+        RSRenderParticleEffector effector;
+        for (auto it = particles.begin(); it != particles.end();) {
+            if (!(*it)->IsAlive()) {
+                it = particles.erase(it);
+            } else {
+                effector.Update(*it, fields, deltaTime);
+                ++it;
+            }
+        }
+    }
+
+    static void ExpectSameParticles(const std::vector<std::shared_ptr<RSRenderParticle>>& expected,
+        const std::vector<std::shared_ptr<RSRenderParticle>>& actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_NEAR(expected[i]->GetPosition().x_, actual[i]->GetPosition().x_, POSITION_TOLERANCE);
+            EXPECT_NEAR(expected[i]->GetPosition().y_, actual[i]->GetPosition().y_, POSITION_TOLERANCE);
+            EXPECT_NEAR(expected[i]->GetVelocity().x_, actual[i]->GetVelocity().x_, POSITION_TOLERANCE);
+            EXPECT_NEAR(expected[i]->GetVelocity().y_, actual[i]->GetVelocity().y_, POSITION_TOLERANCE);
+            EXPECT_NEAR(expected[i]->GetOpacity(), actual[i]->GetOpacity(), VALUE_TOLERANCE);
+            EXPECT_NEAR(expected[i]->GetScale(), actual[i]->GetScale(), VALUE_TOLERANCE);
+            EXPECT_NEAR(expected[i]->GetSpin(), actual[i]->GetSpin(), VALUE_TOLERANCE);
+            // a float rounding difference may move a channel across an integer step
+            EXPECT_LE(std::abs(expected[i]->GetColor().GetRed() - actual[i]->GetColor().GetRed()), 1);
+            EXPECT_LE(std::abs(expected[i]->GetColor().GetGreen() - actual[i]->GetColor().GetGreen()), 1);
+            EXPECT_LE(std::abs(expected[i]->GetColor().GetBlue() - actual[i]->GetColor().GetBlue()), 1);
+            EXPECT_LE(std::abs(expected[i]->GetColor().GetAlpha() - actual[i]->GetColor().GetAlpha()), 1);
+            EXPECT_EQ(expected[i]->GetActiveTime(), actual[i]->GetActiveTime());
+            EXPECT_EQ(expected[i]->IsAlive(), actual[i]->IsAlive());
+        }
+    }
+
+    static void RunAndCompare(const std::shared_ptr<ParticleRenderParams>& params,
+        const std::shared_ptr<ParticleFieldCollection>& fields, int particleCount)
+    {
+        auto expected = MakeParticles(params, particleCount);
+        RSRenderParticleBatch batch(params);
+        batch.Adopt(CopyParticles(expected));
+        ASSERT_EQ(batch.GetParticleCount(), expected.size());
+        for (int frame = 0; frame < FRAME_COUNT; frame++) {
+            if (fields != nullptr) {
+                fields->UpdateAll(static_cast<float>(FRAME_TIME_NS) / NS_TO_S);
+            }
+            UpdateOneByOne(expected, fields, FRAME_TIME_NS);
+            batch.Update(FRAME_TIME_NS, fields);
+            ExpectSameParticles(expected, batch.GetParticles());
+        }
+    }
+};
+
+/**
+ * @tc.name: UpdateRandomUpdator001
+ * @tc.desc: A batch with RANDOM updators produces the same particles as updating them one by one
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderParticleBatchTest, UpdateRandomUpdator001, TestSize.Level1)
+{
+    RunAndCompare(MakeRandomParams(200), nullptr, 200);
+}
+
+/**
+ * @tc.name: UpdateCurveUpdator001
+ * @tc.desc: A batch with CURVE updators produces the same particles as updating them one by one
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderParticleBatchTest, UpdateCurveUpdator001, TestSize.Level1)
+{
+    RunAndCompare(MakeCurveParams(200), nullptr, 200);
+}
+
+/**
+ * @tc.name: UpdateWithFields001
+ * @tc.desc: Ripple and velocity fields push the batch exactly as they push single particles
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderParticleBatchTest, UpdateWithFields001, TestSize.Level1)
+{
+    auto params = MakeRandomParams(200);
+    auto expectedFields = MakeFields();
+    auto expected = MakeParticles(params, 200);
+    auto batchFields = MakeFields();
+    RSRenderParticleBatch batch(params);
+    batch.Adopt(CopyParticles(expected));
+    for (int frame = 0; frame < FRAME_COUNT; frame++) {
+        expectedFields->UpdateAll(static_cast<float>(FRAME_TIME_NS) / NS_TO_S);
+        batchFields->UpdateAll(static_cast<float>(FRAME_TIME_NS) / NS_TO_S);
+        UpdateOneByOne(expected, expectedFields, FRAME_TIME_NS);
+        batch.Update(FRAME_TIME_NS, batchFields);
+        ExpectSameParticles(expected, batch.GetParticles());
+    }
+}
+
+/**
+ * @tc.name: ApplyBatch001
+ * @tc.desc: ApplyAllBatch accumulates the same force as ApplyAll for every position
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderParticleBatchTest, ApplyBatch001, TestSize.Level1)
+{
+    auto fields = MakeFields();
+    fields->UpdateAll(0.5f);
+    std::vector<float> posX;
+    std::vector<float> posY;
+    for (float x = -50.f; x <= 450.f; x += 25.f) {
+        for (float y = -50.f; y <= 450.f; y += 25.f) {
+            posX.push_back(x);
+            posY.push_back(y);
+        }
+    }
+    std::vector<float> forceX(posX.size(), 1.f);
+    std::vector<float> forceY(posX.size(), 1.f);
+    fields->ApplyAllBatch(posX.data(), posY.data(), forceX.data(), forceY.data(), posX.size(), 0.016f);
+    for (size_t i = 0; i < posX.size(); i++) {
+        auto force = fields->ApplyAll(Vector2f(posX[i], posY[i]), 0.016f);
+        EXPECT_NEAR(force.x_, forceX[i], VALUE_TOLERANCE);
+        EXPECT_NEAR(force.y_, forceY[i], VALUE_TOLERANCE);
+    }
+}
+
+/**
+ * @tc.name: ClearAndDeadParticles001
+ * @tc.desc: Dead particles leave the batch on the next update and Clear drops everything
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderParticleBatchTest, ClearAndDeadParticles001, TestSize.Level1)
+{
+    auto params = MakeRandomParams(10);
+    auto particles = MakeParticles(params, 10);
+    particles[3]->SetIsDead();
+    particles.push_back(nullptr);
+    RSRenderParticleBatch batch(params);
+    batch.Adopt(particles);
+    EXPECT_EQ(batch.GetParticleCount(), 10u);
+    batch.Update(FRAME_TIME_NS, nullptr);
+    EXPECT_EQ(batch.GetParticleCount(), 9u);
+    batch.Clear();
+    EXPECT_EQ(batch.GetParticleCount(), 0u);
+    batch.Update(FRAME_TIME_NS, nullptr);
+    EXPECT_EQ(batch.GetParticleCount(), 0u);
+}
+
+/**
+ * @tc.name: SystemEmitterBatchUpdate001
+ * @tc.desc: Particles of a batched emitter are updated by the batch and still handed out for drawing,
+ *           and are handed back to the one by one path when batching is switched off
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderParticleBatchTest, SystemEmitterBatchUpdate001, TestSize.Level1)
+{
+    std::vector<std::shared_ptr<ParticleRenderParams>> params { MakeRandomParams(100), MakeCurveParams(100) };
+    auto system = std::make_shared<RSRenderParticleSystem>(params);
+    system->SetEmitterBatchUpdate(1, true);
+    system->SetEmitterBatchUpdate(5, true);
+    EXPECT_FALSE(system->IsEmitterBatchUpdate(0));
+    EXPECT_TRUE(system->IsEmitterBatchUpdate(1));
+    EXPECT_FALSE(system->IsEmitterBatchUpdate(5));
+
+    std::vector<std::shared_ptr<RSRenderParticle>> active;
+    std::vector<std::shared_ptr<RSImage>> images;
+    for (int frame = 0; frame < FRAME_COUNT; frame++) {
+        system->Emit(FRAME_TIME_NS, active, images);
+        system->UpdateParticle(FRAME_TIME_NS, active);
+    }
+    size_t batched = 0;
+    for (const auto& particle : active) {
+        ASSERT_NE(particle, nullptr);
+        batched += particle->GetParticleRenderParams() == params[1] ? 1 : 0;
+    }
+    EXPECT_GT(batched, 0u);
+    size_t total = active.size();
+
+    system->SetEmitterBatchUpdate(1, false);
+    EXPECT_FALSE(system->IsEmitterBatchUpdate(1));
+    system->UpdateParticle(FRAME_TIME_NS, active);
+    size_t handedBack = 0;
+    for (const auto& particle : active) {
+        handedBack += particle->GetParticleRenderParams() == params[1] ? 1 : 0;
+    }
+    EXPECT_GT(handedBack, 0u);
+    EXPECT_LE(active.size(), total);
+
+    // the owner dropping activeParticles drops the batched particles with it
+    system->SetEmitterBatchUpdate(1, true);
+    system->Emit(FRAME_TIME_NS, active, images);
+    system->UpdateParticle(FRAME_TIME_NS, active);
+    active.clear();
+    system->UpdateParticle(FRAME_TIME_NS, active);
+    EXPECT_TRUE(active.empty());
+}
+
+/**
+ * @tc.name: UpdatePerformance001
+ * @tc.desc: 10k particles updated as a batch for 60 frames keep the same population as the one by one path
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(RSRenderParticleBatchTest, UpdatePerformance001, TestSize.Level1)
+{
+    constexpr int particleCount = 10000;
+    constexpr int frameCount = 60;
+    auto params = MakeRandomParams(particleCount);
+    auto oneByOneFields = MakeFields();
+    auto batchFields = MakeFields();
+    auto oneByOne = MakeParticles(params, particleCount);
+    RSRenderParticleBatch batch(params);
+    batch.Adopt(CopyParticles(oneByOne));
+
+    size_t lastCount = batch.GetParticleCount();
+    for (int frame = 0; frame < frameCount; frame++) {
+        oneByOneFields->UpdateAll(static_cast<float>(FRAME_TIME_NS) / NS_TO_S);
+        UpdateOneByOne(oneByOne, oneByOneFields, FRAME_TIME_NS);
+        batchFields->UpdateAll(static_cast<float>(FRAME_TIME_NS) / NS_TO_S);
+        batch.Update(FRAME_TIME_NS, batchFields);
+        EXPECT_EQ(oneByOne.size(), batch.GetParticleCount());
+        EXPECT_LE(batch.GetParticleCount(), lastCount);
+        lastCount = batch.GetParticleCount();
+    }
+    EXPECT_EQ(batch.GetParticles().size(), batch.GetParticleCount());
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -2333,21 +2333,30 @@ bool ReadRemoteRequest(
            parcel.WriteBuffer(buffer.data(), buffer.size());
 }
 
+bool RSProfiler::ReplayRemoteRequest(const std::vector<uint8_t>& data, const RemoteRequestHandler& handler)
+{
+    pid_t pid = 0;
+    uint32_t code = 0;
+    AlignedMessageParcel parcel;
+    MessageOption option;
+    if (!ReadRemoteRequest(data, pid, code, parcel.parcel, option)) {
+        return false;
+    }
+    handler(pid, code, parcel.parcel, option);
+    return true;
+}
+
 double RSProfiler::PlaybackUpdate(double deltaTime, double eofTime, double advanceTime)
 {
     std::vector<uint8_t> data;
     double time = 0.0;
     while (!g_playbackShouldBeTerminated && g_playbackFile.ReadRSData(deltaTime + advanceTime, data, time)) {
-        pid_t pid = 0;
-        uint32_t code = 0;
-        AlignedMessageParcel parcel;
-        MessageOption option;
-        if (ReadRemoteRequest(data, pid, code, parcel.parcel, option)) {
+        ReplayRemoteRequest(data, [](pid_t pid, uint32_t code, MessageParcel& parcel, MessageOption& option) {
             if (const auto connection = GetMockConnection(Utils::GetMockPid(pid))) {
                 MessageParcel reply;
-                connection->SendRequest(code, parcel.parcel, reply, option);
+                connection->SendRequest(code, parcel, reply, option);
             }
-        }
+        });
 
         if (g_playbackImmediate) {
             deltaTime = time;
@@ -112,6 +112,7 @@ RSB_EXPORT const TRACE3D_CORE_API_TABLE* Trace3DCoreInitRS();
 #define RS_PROFILER_LOG_SHADER_CALL(shaderType, srcImage, dstRect, outImage) \
     RSProfiler::LogShaderCall(shaderType, srcImage, dstRect, outImage)
 #define RS_PROFILER_IS_RECORDING_MODE() RSProfiler::IsRecordingMode()
+#define RS_PROFILER_IS_COMMAND_TRACKING_MODE() RSProfiler::IsCommandTrackingMode()
 #define RS_PROFILER_TRANSACTION_UNMARSHALLING_START(parcel, parcelNumber) \
     RSProfiler::TransactionUnmarshallingStart(parcel, parcelNumber)
 #define RS_PROFILER_ANIMATION_NODE(type, pixels) RSProfiler::AddAnimationNodeMetrics(type, pixels)
@@ -183,6 +184,7 @@ RSB_EXPORT const TRACE3D_CORE_API_TABLE* Trace3DCoreInitRS();
 #define RS_PROFILER_ADD_MESA_BLUR_METRICS(area)
 #define RS_PROFILER_LOG_SHADER_CALL(shaderType, srcImage, dstRect, outImage)
 #define RS_PROFILER_IS_RECORDING_MODE() false
+#define RS_PROFILER_IS_COMMAND_TRACKING_MODE() false
 #define RS_PROFILER_TRANSACTION_UNMARSHALLING_START(parcel, parcelNumber)
 #define RS_PROFILER_ANIMATION_NODE(type, pixels)
 #define RS_PROFILER_ANIMATION_DURATION_START(id, timestamp_ns)
@@ -597,6 +599,7 @@ public:
     RSB_EXPORT static bool IsSavingMode();
 
     RSB_EXPORT static bool IsRecordingMode();
+    RSB_EXPORT static bool IsCommandTrackingMode();
 
     RSB_EXPORT static TextureRecordType GetTextureRecordType();
     RSB_EXPORT static void SetTextureRecordType(TextureRecordType type);
@@ -639,6 +642,9 @@ private:
     static uint64_t ProcessRemoteRequest(
         pid_t pid, uint32_t code, MessageParcel& parcel, MessageParcel& reply, MessageOption& option);
     static uint64_t WriteRemoteRequest(pid_t pid, uint32_t code, MessageParcel& parcel, MessageOption& option);
+    // the parcel handed to handler is a mock one, so node ids and pids in it are patched like in playback
+    using RemoteRequestHandler = std::function<void(pid_t, uint32_t, MessageParcel&, MessageOption&)>;
+    static bool ReplayRemoteRequest(const std::vector<uint8_t>& data, const RemoteRequestHandler& handler);
 
     static const char* GetProcessNameByPid(int pid);
     RSB_EXPORT static std::shared_ptr<ProfilerMarshallingJob> GetJobForExecution();
@@ -957,6 +963,7 @@ private:
     RSB_EXPORT static std::unordered_map<AnimationId, int64_t> animationsTimes_;
 
     friend class TestTreeBuilder;
+    friend class RSProfilerReplayBench;
     friend class RSClientToServiceConnection;
 
     using LogicalDisplayChildren =
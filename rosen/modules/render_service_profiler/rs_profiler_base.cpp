@@ -2127,4 +2127,10 @@ bool RSProfiler::IsRecordingMode()
 {
     return IsEnabled() && IsWriteMode();
 }
+
+// ExecuteCommand counts and marshals commands in record and replay, so they have to be applied serially then.
+bool RSProfiler::IsCommandTrackingMode()
+{
+    return IsEnabled() && (IsWriteMode() || IsReadMode());
+}
 } // namespace OHOS::Rosen
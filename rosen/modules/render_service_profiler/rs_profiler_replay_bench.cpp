@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rs_profiler_replay_bench.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+#include "message_option.h"
+#include "message_parcel.h"
+#include "rs_profiler.h"
+#include "rs_profiler_utils.h"
+
+#include "command/rs_display_node_command.h"
+#include "drawable/rs_render_node_drawable.h"
+#include "engine/rs_base_render_util.h"
+#include "params/rs_render_thread_params.h"
+#include "pipeline/main_thread/rs_uni_render_visitor.h"
+#include "pipeline/render_thread/rs_uni_render_thread.h"
+#include "pipeline/rs_context.h"
+#include "pipeline/rs_logical_display_render_node.h"
+#include "pipeline/rs_paint_filter_canvas.h"
+#include "pipeline/rs_render_node_gc.h"
+#include "pipeline/rs_screen_render_node.h"
+#include "platform/ohos/transaction/zidl/rs_iclient_to_render_connection.h"
+#include "render/rs_typeface_cache.h"
+#include "transaction/rs_marshalling_helper.h"
+#include "transaction/rs_transaction_data.h"
+
+namespace OHOS::Rosen {
+namespace {
+constexpr double MS_PER_SECOND = 1000.0;
+constexpr double PERCENTILE_50 = 0.5;
+constexpr double PERCENTILE_95 = 0.95;
+// ids of the screen and display the capture is replayed on, the nodes of the capture all have patched ids
+constexpr NodeId SCREEN_NODE_ID = 1;
+constexpr NodeId DISPLAY_NODE_ID = 2;
+
+template<typename Func>
+double MeasureMs(Func&& func)
+{
+    auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+double Percentile(std::vector<double> values, double percentile)
+{
+    if (values.empty()) {
+        return 0.0;
+    }
+    auto index = static_cast<size_t>(percentile * (values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+} // namespace
+
+RSProfilerReplayBench::RSProfilerReplayBench() = default;
+
+RSProfilerReplayBench::~RSProfilerReplayBench()
+{
+    Close();
+}
+
+bool RSProfilerReplayBench::Open(const std::string& path, std::string& error, uint32_t frameRate)
+{
+    if (context_ != nullptr) {
+        error = "capture is already opened";
+        return false;
+    }
+    if (!file_.Open(path, error)) {
+        return false;
+    }
+    frameInterval_ = 1.0 / std::max(frameRate, 1u);
+    eofTime_ = file_.GetEOFTime();
+
+    // node ids and pids of the capture are patched like in playback, so they can not collide with live ones
+    profilerWasEnabled_ = RSProfiler::enabled_;
+    RSProfiler::enabled_ = true;
+    RSTypefaceCache::Instance().ReplayClear();
+    context_ = std::make_shared<RSContext>();
+    context_->Initialize();
+
+    std::stringstream stream(file_.GetHeaderFirstFrame());
+    error = RSProfiler::TypefaceUnmarshalling(stream, file_.GetVersion());
+    if (error.empty()) {
+        RSProfiler::SetSubMode(SubMode::READ_EMUL);
+        RSProfiler::DisableSharedMemory();
+        error = RSProfiler::UnmarshalNodes(*context_, stream, file_.GetVersion());
+        RSProfiler::EnableSharedMemory();
+        RSProfiler::SetSubMode(SubMode::NONE);
+    }
+    if (error.empty()) {
+        error = CreateScreen();
+    }
+    if (!error.empty()) {
+        Close();
+        return false;
+    }
+
+    const auto& screenProperty = RSProfiler::GetScreenNode(*context_)->GetScreenProperty();
+    Drawing::ImageInfo info(static_cast<int>(screenProperty.GetWidth()), static_cast<int>(screenProperty.GetHeight()),
+        Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL);
+    surface_ = Drawing::Surface::MakeRaster(info);
+    if (surface_ == nullptr) {
+        error = "can not create a raster surface of the screen size";
+        Close();
+        return false;
+    }
+    // transaction times become capture relative, the time base ReplayFrame animates with
+    RSProfiler::SetReplayStartTimeNano(0);
+    RSProfiler::SetTransactionTimeCorrection(file_.GetWriteTime());
+    RSProfiler::SetMode(Mode::READ);
+    return true;
+}
+
+void RSProfilerReplayBench::Close()
+{
+    if (context_ == nullptr) {
+        return;
+    }
+    RSProfiler::SetMode(Mode::NONE);
+    surface_ = nullptr;
+    context_ = nullptr;
+    file_.Close();
+    RSTypefaceCache::Instance().ReplayClear();
+    RSProfiler::enabled_ = profilerWasEnabled_;
+    time_ = 0.0;
+    frameNumber_ = 0;
+}
+
+std::string RSProfilerReplayBench::CreateScreen()
+{
+    // like in playback, the screens and displays of the capture are unmarshalled as plain nodes under a patched
+    // global root, so the windows of the first display are moved onto a screen and a display of the bench
+    auto& nodeMap = context_->GetMutableNodeMap();
+    RSRenderNode::SharedPtr mockDisplay;
+    if (const auto mockRoot = nodeMap.GetRenderNode(Utils::PatchNodeId(0))) {
+        for (const auto& child : mockRoot->GetChildrenList()) {
+            const auto screen = child.lock();
+            const auto display = screen ? screen->GetFirstChild() : nullptr;
+            if (display && display->GetChildrenCount()) {
+                mockDisplay = display;
+                break;
+            }
+        }
+    }
+    if (mockDisplay == nullptr) {
+        return "capture has no display with windows";
+    }
+
+    // the modifiers of screens and displays are not unmarshalled, the screen is sized to fit the windows instead
+    std::vector<RSRenderNode::SharedPtr> windows;
+    float width = 0.0f;
+    float height = 0.0f;
+    for (const auto& child : mockDisplay->GetChildrenList()) {
+        if (const auto window = child.lock()) {
+            const auto& properties = window->GetRenderProperties();
+            width = std::max(width, properties.GetBoundsPositionX() + properties.GetBoundsWidth());
+            height = std::max(height, properties.GetBoundsPositionY() + properties.GetBoundsHeight());
+            windows.push_back(window);
+        }
+    }
+    if (width < 1.0f || height < 1.0f) {
+        return "capture has no window of a size";
+    }
+
+    auto screenNode = std::shared_ptr<RSScreenRenderNode>(
+        new RSScreenRenderNode(SCREEN_NODE_ID, 0, context_->weak_from_this()), RSRenderNodeGC::NodeDestructor);
+    screenNode->UpdateScreenProperty(ScreenPropertyType::RENDER_RESOLUTION,
+        sptr<ScreenProperty<resolutionValType>>::MakeSptr(
+            resolutionValType(static_cast<uint32_t>(width), static_cast<uint32_t>(height))));
+    nodeMap.RegisterRenderNode(screenNode);
+    context_->GetGlobalRootRenderNode()->AddChild(screenNode);
+
+    DisplayNodeCommandHelper::Create(*context_, DISPLAY_NODE_ID, RSDisplayNodeConfig {});
+    const auto displayNode = nodeMap.GetRenderNode<RSLogicalDisplayRenderNode>(DISPLAY_NODE_ID);
+    if (displayNode == nullptr || displayNode->GetParent().lock() != screenNode) {
+        return "can not create a display node";
+    }
+    for (const auto& window : windows) {
+        displayNode->AddChild(window);
+    }
+    return "";
+}
+
+bool RSProfilerReplayBench::ReplayFrame(RSProfilerReplayFrameStats& stats)
+{
+    if (context_ == nullptr || time_ >= eofTime_) {
+        return false;
+    }
+    auto screenNode = RSProfiler::GetScreenNode(*context_);
+    if (screenNode == nullptr) {
+        return false;
+    }
+    stats = {};
+    stats.frame = frameNumber_++;
+    time_ += frameInterval_;
+    stats.time = time_;
+
+    stats.commandMs = MeasureMs([this, &stats]() { ProcessTransactions(time_, stats); });
+    stats.animateMs = MeasureMs([this, &stats]() {
+        Animate(static_cast<uint64_t>(Utils::ToNanoseconds(time_)), stats);
+    });
+    stats.prepareMs = MeasureMs([this, &screenNode, &stats]() { Prepare(screenNode, stats); });
+    stats.syncMs = MeasureMs([this, &stats]() { Sync(stats); });
+    stats.drawMs = MeasureMs([this, &screenNode, &stats]() { Draw(screenNode, stats); });
+    stats.nodeCount = context_->GetNodeMap().GetSize();
+    return true;
+}
+
+void RSProfilerReplayBench::ProcessTransactions(double untilTime, RSProfilerReplayFrameStats& stats)
+{
+    std::vector<uint8_t> data;
+    double readTime = 0.0;
+    while (file_.ReadRSData(untilTime, data, readTime)) {
+        if (ProcessTransaction(data, stats.commandCount)) {
+            stats.transactionCount++;
+        }
+    }
+}
+
+bool RSProfilerReplayBench::ProcessTransaction(const std::vector<uint8_t>& data, uint32_t& commandCount)
+{
+    bool processed = false;
+    RSProfiler::ReplayRemoteRequest(data,
+        [this, &processed, &commandCount](pid_t pid, uint32_t code, MessageParcel& parcel, MessageOption&) {
+            if (code != static_cast<uint32_t>(RSIClientToRenderConnectionInterfaceCode::COMMIT_TRANSACTION)) {
+                return;
+            }
+            // requests recorded as received start with the interface token and the parcel kind, the ones recorded
+            // after an ashmem or ring parcel has been parsed start with the transaction data
+            if (parcel.ReadInterfaceToken() == RSIClientToRenderConnection::GetDescriptor()) {
+                int32_t parcelKind = -1;
+                if (!parcel.ReadInt32(parcelKind) || parcelKind != 0) {
+                    return;
+                }
+            } else {
+                parcel.RewindRead(0);
+            }
+            bool waitUnmarshalling = true;
+            RSMarshallingHelper::UnmarshallingTransactionVer(parcel);
+            if (!RSMarshallingHelper::CompatibleUnmarshalling(
+                parcel, waitUnmarshalling, false, RSPARCELVER_ADD_NONEED)) {
+                return;
+            }
+            auto transactionData = RSBaseRenderUtil::ParseTransactionData(parcel, 0);
+            if (transactionData == nullptr) {
+                return;
+            }
+            transactionData->SetCallingPid(Utils::GetMockPid(pid));
+            transactionData->SetSendingPid(Utils::GetMockPid(pid));
+            commandCount += transactionData->GetCommandCount();
+            transactionData->Process(*context_);
+            processed = true;
+        });
+    return processed;
+}
+
+void RSProfilerReplayBench::Animate(uint64_t timestamp, RSProfilerReplayFrameStats& stats)
+{
+    int64_t minLeftDelayTime = 0;
+    context_->UpdateGroupAnimators(static_cast<int64_t>(timestamp), minLeftDelayTime);
+    stats.animatingNodeCount = context_->animatingNodeList_.size();
+    EraseIf(context_->animatingNodeList_, [timestamp, &minLeftDelayTime](const auto& iter) -> bool {
+        auto node = iter.second.lock();
+        if (node == nullptr) {
+            return true;
+        }
+        int64_t nextFrameTime = INT64_MAX;
+        auto [hasRunningAnimation, needRequestNextVsync, calculateAnimationValue] =
+            node->Animate(static_cast<int64_t>(timestamp), minLeftDelayTime, nextFrameTime);
+        return !hasRunningAnimation;
+    });
+}
+
+void RSProfilerReplayBench::Prepare(
+    const std::shared_ptr<RSScreenRenderNode>& screenNode, RSProfilerReplayFrameStats& stats)
+{
+    auto visitor = std::make_shared<RSUniRenderVisitor>();
+    visitor->SetDirtyFlag(true);
+    context_->GetGlobalRootRenderNode()->QuickPrepare(visitor);
+    auto dirtyManager = screenNode->GetDirtyManager();
+    if (dirtyManager != nullptr) {
+        const auto& dirtyRect = dirtyManager->GetCurrentFrameDirtyRegion();
+        const auto& screenRect = dirtyManager->GetSurfaceRect();
+        stats.dirtyArea = static_cast<int64_t>(dirtyRect.GetWidth()) * dirtyRect.GetHeight();
+        stats.screenArea = static_cast<int64_t>(screenRect.GetWidth()) * screenRect.GetHeight();
+    }
+}
+
+void RSProfilerReplayBench::Sync(RSProfilerReplayFrameStats& stats)
+{
+    context_->GetGlobalRootRenderNode()->Sync();
+    auto& pendingSyncNodes = context_->pendingSyncNodes_;
+    stats.syncNodeCount = pendingSyncNodes.size();
+    for (auto& [id, weakPtr] : pendingSyncNodes) {
+        if (auto node = weakPtr.lock()) {
+            node->Sync();
+        }
+    }
+    pendingSyncNodes.clear();
+    RSUniRenderThread::Instance().Sync(std::make_unique<RSRenderThreadParams>());
+}
+
+void RSProfilerReplayBench::Draw(
+    const std::shared_ptr<RSScreenRenderNode>& screenNode, RSProfilerReplayFrameStats& stats)
+{
+    // the screen drawable needs the composer and an output surface, so the displays of the screen are drawn
+    // directly onto the raster surface
+    RSPaintFilterCanvas canvas(surface_.get());
+    canvas.Clear(Drawing::Color::COLOR_BLACK);
+    DrawableV2::RSRenderNodeDrawable::ClearTotalProcessedNodeCount();
+    for (const auto& displayNode : *screenNode->GetSortedChildren()) {
+        for (const auto& child : *displayNode->GetSortedChildren()) {
+            if (auto drawable = child->GetRenderDrawable()) {
+                drawable->Draw(canvas);
+            }
+        }
+    }
+    canvas.Flush();
+    stats.drawnNodeCount = DrawableV2::RSRenderNodeDrawable::GetTotalProcessedNodeCount();
+}
+
+std::string RSProfilerReplayBench::GetStatsHeader()
+{
+    return "frame,time_ms,transactions,commands,nodes,animating_nodes,sync_nodes,drawn_nodes,dirty_percent,"
+           "command_ms,animate_ms,prepare_ms,sync_ms,draw_ms";
+}
+
+std::string RSProfilerReplayBench::StatsToString(const RSProfilerReplayFrameStats& stats)
+{
+    constexpr double percent = 100.0;
+    double dirtyPercent = stats.screenArea > 0 ? percent * stats.dirtyArea / stats.screenArea : 0.0;
+    std::stringstream out;
+    out << stats.frame << "," << stats.time * MS_PER_SECOND << "," << stats.transactionCount << ","
+        << stats.commandCount << "," << stats.nodeCount << "," << stats.animatingNodeCount << ","
+        << stats.syncNodeCount << "," << stats.drawnNodeCount << "," << dirtyPercent << "," << stats.commandMs << ","
+        << stats.animateMs << "," << stats.prepareMs << "," << stats.syncMs << "," << stats.drawMs;
+    return out.str();
+}
+
+std::string RSProfilerReplayBench::SummaryToString(const std::vector<RSProfilerReplayFrameStats>& frames)
+{
+    std::vector<double> commandMs;
+    std::vector<double> animateMs;
+    std::vector<double> prepareMs;
+    std::vector<double> syncMs;
+    std::vector<double> drawMs;
+    for (const auto& stats : frames) {
+        commandMs.push_back(stats.commandMs);
+        animateMs.push_back(stats.animateMs);
+        prepareMs.push_back(stats.prepareMs);
+        syncMs.push_back(stats.syncMs);
+        drawMs.push_back(stats.drawMs);
+    }
+    std::stringstream out;
+    out << frames.size() << " frames, median / p95 (ms):";
+    const std::pair<const char*, const std::vector<double>*> phases[] = { { "command", &commandMs },
+        { "animate", &animateMs }, { "prepare", &prepareMs }, { "sync", &syncMs }, { "draw", &drawMs } };
+    for (const auto& [name, values] : phases) {
+        out << " " << name << " " << Percentile(*values, PERCENTILE_50) << " / " << Percentile(*values, PERCENTILE_95);
+    }
+    return out.str();
+}
+} // namespace OHOS::Rosen
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RENDER_SERVICE_PROFILER_REPLAY_BENCH_H
+#define RENDER_SERVICE_PROFILER_REPLAY_BENCH_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/rs_macros.h"
+#include "draw/surface.h"
+#include "rs_profiler_file.h"
+
+namespace OHOS::Rosen {
+class RSContext;
+class RSScreenRenderNode;
+
+struct RSProfilerReplayFrameStats {
+    uint32_t frame = 0;
+    // capture time the frame is replayed up to, in seconds
+    double time = 0.0;
+    uint32_t transactionCount = 0;
+    uint32_t commandCount = 0;
+    size_t nodeCount = 0;
+    size_t animatingNodeCount = 0;
+    size_t syncNodeCount = 0;
+    int drawnNodeCount = 0;
+    int64_t dirtyArea = 0;
+    int64_t screenArea = 0;
+    double commandMs = 0.0;
+    double animateMs = 0.0;
+    double prepareMs = 0.0;
+    double syncMs = 0.0;
+    double drawMs = 0.0;
+};
+
+/*
+ * Replays a profiler capture without the render service running. The first frame of the capture is unmarshalled into a
+ * context of its own and its windows are put on a screen sized to fit them, then for every frame the recorded
+ * transactions up to the frame time are processed directly on that context, animations are ticked, the tree is prepared
+ * by RSUniRenderVisitor, synced to the drawables and played back onto a raster surface. No IPC, vsync, composer or GPU
+ * is involved, so the timings of a capture are repeatable from run to run. Not to be used inside a running render
+ * service, it switches the profiler to replay mode for the whole process.
+ */
+class RSB_EXPORT RSProfilerReplayBench final {
+public:
+    static constexpr uint32_t DEFAULT_FRAME_RATE = 120;
+
+    RSProfilerReplayBench();
+    ~RSProfilerReplayBench();
+
+    bool Open(const std::string& path, std::string& error, uint32_t frameRate = DEFAULT_FRAME_RATE);
+    // false once the capture has been replayed to the end
+    bool ReplayFrame(RSProfilerReplayFrameStats& stats);
+    // also restores the profiler state Open found
+    void Close();
+
+    static std::string GetStatsHeader();
+    static std::string StatsToString(const RSProfilerReplayFrameStats& stats);
+    static std::string SummaryToString(const std::vector<RSProfilerReplayFrameStats>& frames);
+
+private:
+    std::string CreateScreen();
+    void ProcessTransactions(double untilTime, RSProfilerReplayFrameStats& stats);
+    bool ProcessTransaction(const std::vector<uint8_t>& data, uint32_t& commandCount);
+    void Animate(uint64_t timestamp, RSProfilerReplayFrameStats& stats);
+    void Prepare(const std::shared_ptr<RSScreenRenderNode>& screenNode, RSProfilerReplayFrameStats& stats);
+    void Sync(RSProfilerReplayFrameStats& stats);
+    void Draw(const std::shared_ptr<RSScreenRenderNode>& screenNode, RSProfilerReplayFrameStats& stats);
+
+    std::shared_ptr<RSContext> context_;
+    RSFile file_;
+    std::shared_ptr<Drawing::Surface> surface_;
+    double frameInterval_ = 1.0 / DEFAULT_FRAME_RATE;
+    double time_ = 0.0;
+    double eofTime_ = 0.0;
+    uint32_t frameNumber_ = 0;
+    bool profilerWasEnabled_ = false;
+};
+} // namespace OHOS::Rosen
+
+#endif // RENDER_SERVICE_PROFILER_REPLAY_BENCH_H
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <iostream>
+
+#include "rs_profiler_replay_bench.h"
+
+using namespace OHOS::Rosen;
+
+namespace {
+constexpr int ARG_CAPTURE_PATH = 1;
+constexpr int ARG_FRAME_RATE = 2;
+constexpr int ARG_MAX_FRAMES = 3;
+} // namespace
+
+// usage: rs_profiler_replay_bench <capture.ohr> [frame rate] [max frames]
+// prints the stats of every replayed frame as csv, then the median and p95 of every phase
+int main(int argc, char* argv[])
+{
+    if (argc <= ARG_CAPTURE_PATH) {
+        std::cerr << "usage: " << argv[0] << " <capture.ohr> [frame rate] [max frames]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    uint32_t frameRate = argc > ARG_FRAME_RATE ? static_cast<uint32_t>(std::strtoul(argv[ARG_FRAME_RATE], nullptr, 0)) :
+        RSProfilerReplayBench::DEFAULT_FRAME_RATE;
+    uint32_t maxFrames = argc > ARG_MAX_FRAMES ? static_cast<uint32_t>(std::strtoul(argv[ARG_MAX_FRAMES], nullptr, 0)) :
+        UINT32_MAX;
+
+    RSProfilerReplayBench bench;
+    std::string error;
+    if (!bench.Open(argv[ARG_CAPTURE_PATH], error, frameRate)) {
+        std::cerr << "can not open " << argv[ARG_CAPTURE_PATH] << ": " << error << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::vector<RSProfilerReplayFrameStats> frames;
+    RSProfilerReplayFrameStats stats;
+    std::cout << RSProfilerReplayBench::GetStatsHeader() << std::endl;
+    while (frames.size() < maxFrames && bench.ReplayFrame(stats)) {
+        std::cout << RSProfilerReplayBench::StatsToString(stats) << std::endl;
+        frames.push_back(stats);
+    }
+    bench.Close();
+    std::cerr << RSProfilerReplayBench::SummaryToString(frames) << std::endl;
+    return EXIT_SUCCESS;
+}
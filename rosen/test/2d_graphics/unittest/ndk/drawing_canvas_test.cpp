@@ -17,6 +17,7 @@
 
 #include <vector>
 
+#include "array_mgr.h"
 #include "drawing_bitmap.h"
 #include "drawing_brush.h"
 #include "drawing_canvas.h"
@@ -47,6 +48,7 @@
 #include "draw/color.h"
 #include "effect/color_filter.h"
 #include "effect/filter.h"
+#include "recording/draw_cmd_list.h"
 #include "recording/recording_canvas.h"
 #include "image/pixelmap_native.h"
 #include "drawing_canvas_utils.h"
@@ -79,6 +81,10 @@ constexpr uint32_t INTNUM_TEN = 10;
 constexpr int32_t NEGATIVE_ONE = -1;
 constexpr int32_t IS_OPAQUE_TEST_WIDTH = 720;
 constexpr int32_t IS_OPAQUE_TEST_HEIGHT = 720;
+constexpr size_t BATCH_RECT_COUNT = 6;
+constexpr size_t BENCHMARK_RECT_COUNT = 10000;
+constexpr float BATCH_RECT_SIZE = 10.0f;
+constexpr int32_t BATCH_CANVAS_SIZE = 100;
 
 static void TestIsOpaqueHelper(OH_Drawing_ColorFormat colorType, OH_Drawing_AlphaFormat alphaType, bool expectedOpaque)
 {
@@ -3444,6 +3450,144 @@ HWTEST_F(NativeDrawingCanvasTest, NativeDrawingCanvasTest_IsOpaque007, TestSize.
     OH_Drawing_GpuContextDestroy(gpuContext);
 }
 
+/**
+ * @tc.name: NativeDrawingCanvasTest_DrawRects001
+ * @tc.desc: test for DrawRects and DrawRoundRects with invalid parameters and on a bound canvas
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(NativeDrawingCanvasTest, NativeDrawingCanvasTest_DrawRects001, TestSize.Level1)
+{
+    OH_Drawing_Array* rects = OH_Drawing_RectCreateArray(BATCH_RECT_COUNT);
+    ASSERT_NE(rects, nullptr);
+    OH_Drawing_Array* strings = reinterpret_cast<OH_Drawing_Array*>(new ObjectArray());
+    EXPECT_EQ(OH_Drawing_CanvasDrawRects(nullptr, rects), OH_DRAWING_ERROR_INCORRECT_PARAMETER);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRects(canvas_, nullptr), OH_DRAWING_ERROR_INCORRECT_PARAMETER);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRects(canvas_, strings), OH_DRAWING_ERROR_INCORRECT_PARAMETER);
+    OH_Drawing_CanvasAttachBrush(canvas_, brush_);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRects(canvas_, rects), OH_DRAWING_SUCCESS);
+
+    OH_Drawing_Rect* bounds = OH_Drawing_RectCreate(0, 0, BATCH_RECT_SIZE, BATCH_RECT_SIZE);
+    OH_Drawing_RoundRect* roundRect = OH_Drawing_RoundRectCreate(bounds, 1, 1);
+    const OH_Drawing_RoundRect* roundRects[] = { roundRect, roundRect };
+    const OH_Drawing_RoundRect* nullRoundRects[] = { roundRect, nullptr };
+    EXPECT_EQ(OH_Drawing_CanvasDrawRoundRects(nullptr, roundRects, 2), OH_DRAWING_ERROR_INCORRECT_PARAMETER);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRoundRects(canvas_, nullptr, 2), OH_DRAWING_ERROR_INCORRECT_PARAMETER);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRoundRects(canvas_, nullRoundRects, 2), OH_DRAWING_ERROR_INCORRECT_PARAMETER);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRoundRects(canvas_, roundRects, 0), OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRoundRects(canvas_, roundRects, 2), OH_DRAWING_SUCCESS);
+    OH_Drawing_RoundRectDestroy(roundRect);
+    OH_Drawing_RectDestroy(bounds);
+    delete reinterpret_cast<ObjectArray*>(strings);
+    OH_Drawing_RectDestroyArray(rects);
+}
+
+/**
+ * @tc.name: NativeDrawingCanvasTest_DrawRectsWithBrushes001
+ * @tc.desc: test DrawRectsWithBrushes records one op per run of the same brush and keeps the attached paint
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(NativeDrawingCanvasTest, NativeDrawingCanvasTest_DrawRectsWithBrushes001, TestSize.Level1)
+{
+    auto recordingCanvas = new RecordingCanvas(BATCH_CANVAS_SIZE, BATCH_CANVAS_SIZE);
+    OH_Drawing_Canvas* canvas = reinterpret_cast<OH_Drawing_Canvas*>(recordingCanvas);
+    OH_Drawing_Array* rects = OH_Drawing_RectCreateArray(BATCH_RECT_COUNT);
+    ASSERT_NE(rects, nullptr);
+    OH_Drawing_Brush* red = OH_Drawing_BrushCreate();
+    OH_Drawing_BrushSetColor(red, OH_Drawing_ColorSetArgb(0xFF, 0xFF, 0x00, 0x00));
+    OH_Drawing_Brush* blue = OH_Drawing_BrushCreate();
+    OH_Drawing_BrushSetColor(blue, OH_Drawing_ColorSetArgb(0xFF, 0x00, 0x00, 0xFF));
+    const OH_Drawing_Brush* brushes[] = { red, blue, nullptr };
+    uint32_t brushIndices[BATCH_RECT_COUNT] = { 0, 0, 1, 1, 1, 0 };
+    uint32_t badIndices[BATCH_RECT_COUNT] = { 0, 0, 1, 3, 1, 0 };
+    uint32_t nullIndices[BATCH_RECT_COUNT] = { 0, 2, 1, 1, 1, 0 };
+
+    EXPECT_EQ(OH_Drawing_CanvasDrawRectsWithBrushes(nullptr, rects, brushes, 2, brushIndices),
+        OH_DRAWING_ERROR_INCORRECT_PARAMETER);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRectsWithBrushes(canvas, rects, nullptr, 2, brushIndices),
+        OH_DRAWING_ERROR_INCORRECT_PARAMETER);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRectsWithBrushes(canvas, rects, brushes, 2, nullptr),
+        OH_DRAWING_ERROR_INCORRECT_PARAMETER);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRectsWithBrushes(canvas, rects, brushes, 0, brushIndices),
+        OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRectsWithBrushes(canvas, rects, brushes, 3, badIndices),
+        OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRectsWithBrushes(canvas, rects, brushes, 3, nullIndices),
+        OH_DRAWING_ERROR_INCORRECT_PARAMETER);
+    EXPECT_EQ(recordingCanvas->GetDrawCmdList()->GetOpItemSize(), 0);
+
+    OH_Drawing_Pen* pen = OH_Drawing_PenCreate();
+    OH_Drawing_CanvasAttachPen(canvas, pen);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRectsWithBrushes(canvas, rects, brushes, 2, brushIndices), OH_DRAWING_SUCCESS);
+    // runs [0, 2), [2, 5) and [5, 6)
+    EXPECT_EQ(recordingCanvas->GetDrawCmdList()->GetOpItemSize(), 3);
+    EXPECT_TRUE(recordingCanvas->GetMutablePen().IsValid());
+    EXPECT_FALSE(recordingCanvas->GetMutableBrush().IsValid());
+
+    OH_Drawing_Rect* bounds = OH_Drawing_RectCreate(0, 0, BATCH_RECT_SIZE, BATCH_RECT_SIZE);
+    OH_Drawing_RoundRect* roundRect = OH_Drawing_RoundRectCreate(bounds, 1, 1);
+    const OH_Drawing_RoundRect* roundRects[] = { roundRect, roundRect, roundRect };
+    uint32_t roundRectIndices[] = { 1, 1, 1 };
+    EXPECT_EQ(OH_Drawing_CanvasDrawRoundRectsWithBrushes(canvas, roundRects, 0, brushes, 2, roundRectIndices),
+        OH_DRAWING_ERROR_PARAMETER_OUT_OF_RANGE);
+    EXPECT_EQ(OH_Drawing_CanvasDrawRoundRectsWithBrushes(canvas, roundRects, 3, brushes, 2, roundRectIndices),
+        OH_DRAWING_SUCCESS);
+    EXPECT_EQ(recordingCanvas->GetDrawCmdList()->GetOpItemSize(), 4);
+
+    OH_Drawing_RoundRectDestroy(roundRect);
+    OH_Drawing_RectDestroy(bounds);
+    OH_Drawing_PenDestroy(pen);
+    OH_Drawing_BrushDestroy(red);
+    OH_Drawing_BrushDestroy(blue);
+    OH_Drawing_RectDestroyArray(rects);
+    delete recordingCanvas;
+}
+
+/**
+ * @tc.name: NativeDrawingCanvasTest_DrawRectsPerfTest
+ * @tc.desc: test DrawRects records many rects as a single op that is smaller than one DrawRect op per rect
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(NativeDrawingCanvasTest, NativeDrawingCanvasTest_DrawRectsPerfTest, TestSize.Level2)
+{
+    OH_Drawing_Array* rects = OH_Drawing_RectCreateArray(BENCHMARK_RECT_COUNT);
+    ASSERT_NE(rects, nullptr);
+    for (size_t i = 0; i < BENCHMARK_RECT_COUNT; i++) {
+        OH_Drawing_Rect* rect = nullptr;
+        OH_Drawing_RectGetArrayElement(rects, i, &rect);
+        float offset = static_cast<float>(i % BATCH_CANVAS_SIZE);
+        OH_Drawing_RectSetLeft(rect, offset);
+        OH_Drawing_RectSetTop(rect, offset);
+        OH_Drawing_RectSetRight(rect, offset + BATCH_RECT_SIZE);
+        OH_Drawing_RectSetBottom(rect, offset + BATCH_RECT_SIZE);
+    }
+    auto singleCanvas = new RecordingCanvas(BATCH_CANVAS_SIZE, BATCH_CANVAS_SIZE);
+    auto batchCanvas = new RecordingCanvas(BATCH_CANVAS_SIZE, BATCH_CANVAS_SIZE);
+    OH_Drawing_CanvasAttachBrush(reinterpret_cast<OH_Drawing_Canvas*>(singleCanvas), brush_);
+    OH_Drawing_CanvasAttachBrush(reinterpret_cast<OH_Drawing_Canvas*>(batchCanvas), brush_);
+
+    for (size_t i = 0; i < BENCHMARK_RECT_COUNT; i++) {
+        OH_Drawing_Rect* rect = nullptr;
+        OH_Drawing_RectGetArrayElement(rects, i, &rect);
+        OH_Drawing_CanvasDrawRect(reinterpret_cast<OH_Drawing_Canvas*>(singleCanvas), rect);
+    }
+    EXPECT_EQ(OH_Drawing_CanvasDrawRects(reinterpret_cast<OH_Drawing_Canvas*>(batchCanvas), rects),
+        OH_DRAWING_SUCCESS);
+
+    auto singleCmdList = singleCanvas->GetDrawCmdList();
+    auto batchCmdList = batchCanvas->GetDrawCmdList();
+    EXPECT_EQ(singleCmdList->GetOpItemSize(), BENCHMARK_RECT_COUNT);
+    EXPECT_EQ(batchCmdList->GetOpItemSize(), 1);
+    EXPECT_LT(batchCmdList->GetData().second, singleCmdList->GetData().second);
+    // the brush stays attached after the batch, the same as after the single rects
+    EXPECT_TRUE(batchCanvas->GetMutableBrush().IsValid());
+    EXPECT_TRUE(singleCanvas->GetMutableBrush().IsValid());
+    delete singleCanvas;
+    delete batchCanvas;
+    OH_Drawing_RectDestroyArray(rects);
+}
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
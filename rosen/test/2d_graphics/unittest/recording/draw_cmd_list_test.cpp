@@ -13,6 +13,9 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <cstring>
+
 #include "gtest/gtest.h"
 
 #include "draw/brush.h"
@@ -677,6 +680,293 @@ HWTEST_F(DrawCmdListTest, FlushImageCacheTest002, TestSize.Level1)
     EXPECT_TRUE(mockNineObj->flushCalled);
     EXPECT_TRUE(mockLatticeObj->flushCalled);
 }
+
+/**
+ * @tc.name: ChunkedRecordingTest001
+ * @tc.desc: Test that ops recorded in chunked mode are unmarshalled the same as in contiguous mode.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DrawCmdListTest, ChunkedRecordingTest001, TestSize.Level1)
+{
+    constexpr int32_t opCount = 1000;
+    auto drawCmdList = std::make_shared<DrawCmdList>(TEST_MEM_SIZE, TEST_MEM_SIZE);
+    ASSERT_TRUE(drawCmdList->SetChunkedRecording(true, 256)); // 256 is a small block size to force many blocks
+    PaintHandle paintHandle;
+    for (int32_t i = 0; i < opCount; i++) {
+        ASSERT_TRUE(drawCmdList->AddDrawOp<DrawRectOpItem::ConstructorHandle>(Rect(0, 0, i, i), paintHandle));
+    }
+    ASSERT_GT(drawCmdList->opAllocator_.GetChunkCount(), 1u);
+    // reading the ops for marshalling flattens the blocks and ends chunked recording
+    auto data = drawCmdList->GetData();
+    ASSERT_NE(data.first, nullptr);
+    EXPECT_FALSE(drawCmdList->IsChunkedRecording());
+
+    auto newCmdList = DrawCmdList::CreateFromData(data, true);
+    ASSERT_NE(newCmdList, nullptr);
+    EXPECT_EQ(newCmdList->GetWidth(), TEST_MEM_SIZE);
+    newCmdList->UnmarshallingDrawOps();
+    EXPECT_EQ(newCmdList->GetOpItemSize(), static_cast<size_t>(opCount));
+}
+
+/**
+ * @tc.name: ChunkedRecordingTest002
+ * @tc.desc: Test that the flattened op buffer of chunked recording has the same bytes as contiguous recording,
+ *           and that ClearOp ends chunked recording.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DrawCmdListTest, ChunkedRecordingTest002, TestSize.Level1)
+{
+    constexpr int32_t opCount = 1000;
+    // the ClearOpItem handle has no padding, so every byte of the op buffer is written by the recording
+    auto record = [](bool chunked) {
+        auto drawCmdList = std::make_shared<DrawCmdList>(TEST_MEM_SIZE, TEST_MEM_SIZE);
+        EXPECT_TRUE(drawCmdList->SetChunkedRecording(chunked, 256)); // 256 is a small block size for many blocks
+        for (int32_t i = 0; i < opCount; i++) {
+            EXPECT_TRUE(drawCmdList->AddDrawOp<ClearOpItem::ConstructorHandle>(static_cast<ColorQuad>(i)));
+        }
+        EXPECT_TRUE(drawCmdList->SetChunkedRecording(false));
+        return drawCmdList;
+    };
+    auto contiguousList = record(false);
+    auto chunkedList = record(true);
+    auto contiguousData = contiguousList->GetData();
+    auto chunkedData = chunkedList->GetData();
+    ASSERT_NE(chunkedData.first, nullptr);
+    ASSERT_EQ(chunkedData.second, contiguousData.second);
+    EXPECT_EQ(memcmp(chunkedData.first, contiguousData.first, contiguousData.second), 0);
+
+    ASSERT_TRUE(chunkedList->SetChunkedRecording(true));
+    chunkedList->ClearOp();
+    EXPECT_FALSE(chunkedList->IsChunkedRecording());
+    EXPECT_FALSE(chunkedList->opAllocator_.IsChunkMode());
+}
+
+/**
+ * @tc.name: ChunkedRecordingPerfTest
+ * @tc.desc: Test that recording many ops in chunked mode never moves the recorded ops, takes a number of blocks
+ *           that grows with the log of the size up to MAX_CHUNK_SIZE, and marshals the same bytes as the contiguous
+ *           buffer.
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(DrawCmdListTest, ChunkedRecordingPerfTest, TestSize.Level2)
+{
+    constexpr int32_t opCount = 20000;
+    PaintHandle paintHandle;
+    auto record = [&paintHandle](bool chunked, bool& isMoved, size_t& chunkCount) {
+        auto drawCmdList = std::make_shared<DrawCmdList>(TEST_MEM_SIZE, TEST_MEM_SIZE);
+        EXPECT_TRUE(drawCmdList->SetChunkedRecording(chunked));
+        EXPECT_TRUE(drawCmdList->AddDrawOp<DrawRectOpItem::ConstructorHandle>(Rect(0, 0, 1, 1), paintHandle));
+        const void* firstOp = drawCmdList->GetCmdListData(0, 1);
+        isMoved = false;
+        for (int32_t i = 1; i < opCount; i++) {
+            EXPECT_TRUE(drawCmdList->AddDrawOp<DrawRectOpItem::ConstructorHandle>(Rect(0, 0, i, i), paintHandle));
+            isMoved = isMoved || drawCmdList->GetCmdListData(0, 1) != firstOp;
+        }
+        chunkCount = drawCmdList->opAllocator_.GetChunkCount();
+        return drawCmdList;
+    };
+    bool isContiguousMoved = false;
+    bool isChunkedMoved = true;
+    size_t contiguousChunkCount = 0;
+    size_t chunkCount = 0;
+    auto contiguousList = record(false, isContiguousMoved, contiguousChunkCount);
+    auto chunkedList = record(true, isChunkedMoved, chunkCount);
+    // the contiguous buffer is reallocated and copied while it grows, the blocks never are
+    EXPECT_TRUE(isContiguousMoved);
+    EXPECT_FALSE(isChunkedMoved);
+    EXPECT_EQ(contiguousChunkCount, 0u);
+
+    auto contiguousData = contiguousList->GetData();
+    auto chunkedData = chunkedList->GetData();
+    ASSERT_NE(chunkedData.first, nullptr);
+    ASSERT_EQ(chunkedData.second, contiguousData.second);
+    EXPECT_EQ(memcmp(chunkedData.first, contiguousData.first, contiguousData.second), 0);
+    // blocks double from DEFAULT_CHUNK_SIZE to MAX_CHUNK_SIZE, then stay at MAX_CHUNK_SIZE
+    size_t growingChunkCount = 1;
+    for (size_t size = MemAllocator::DEFAULT_CHUNK_SIZE; size < MemAllocator::MAX_CHUNK_SIZE; size *= 2) {
+        growingChunkCount++;
+    }
+    EXPECT_GT(chunkCount, 1u);
+    EXPECT_LE(chunkCount, growingChunkCount + contiguousData.second / MemAllocator::MAX_CHUNK_SIZE);
+}
+
+/**
+ * @tc.name: IndexedPlaybackTest001
+ * @tc.desc: Test that indexed playback only unmarshals the geometry ops inside the clip.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DrawCmdListTest, IndexedPlaybackTest001, TestSize.Level1)
+{
+    constexpr int32_t opCount = 100;
+    constexpr scalar opSpacing = 100.0f;
+    constexpr scalar opSize = 50.0f;
+    constexpr int32_t canvasSize = 10000;
+    auto drawCmdList = std::make_shared<DrawCmdList>(canvasSize, canvasSize);
+    PaintHandle paintHandle;
+    drawCmdList->AddDrawOp<SaveOpItem::ConstructorHandle>();
+    for (int32_t i = 0; i < opCount; i++) {
+        Rect rect(i * opSpacing, 0, i * opSpacing + opSize, opSize);
+        ASSERT_TRUE(drawCmdList->AddDrawOp<DrawRectOpItem::ConstructorHandle>(rect, paintHandle));
+    }
+    drawCmdList->AddDrawOp<RestoreOpItem::ConstructorHandle>();
+
+    auto newCmdList = DrawCmdList::CreateFromData(drawCmdList->GetData(), true);
+    ASSERT_NE(newCmdList, nullptr);
+    newCmdList->SetIndexedPlayback(true);
+    newCmdList->UnmarshallingDrawOps();
+    ASSERT_EQ(newCmdList->GetOpItemSize(), static_cast<size_t>(opCount + 2)); // 2 for save and restore
+    EXPECT_EQ(newCmdList->pendingIndexedOpCount_, static_cast<size_t>(opCount));
+    EXPECT_NE(newCmdList->drawOpItems_.front(), nullptr);
+    EXPECT_NE(newCmdList->drawOpItems_.back(), nullptr);
+
+    Canvas canvas(canvasSize, canvasSize);
+    canvas.ClipRect(Rect(0, 0, opSpacing + opSize, opSpacing + opSize));
+    newCmdList->Playback(canvas);
+    // only the first two rects intersect the clip
+    EXPECT_EQ(newCmdList->pendingIndexedOpCount_, static_cast<size_t>(opCount - 2));
+    EXPECT_NE(newCmdList->drawOpItems_[1], nullptr);
+    EXPECT_NE(newCmdList->drawOpItems_[2], nullptr);
+    EXPECT_EQ(newCmdList->drawOpItems_[3], nullptr);
+
+    // accessors see every op without caching them
+    auto drawOpItems = newCmdList->GetDrawOpItems();
+    EXPECT_TRUE(std::all_of(drawOpItems.begin(), drawOpItems.end(), [](const auto& op) { return op != nullptr; }));
+    EXPECT_EQ(newCmdList->pendingIndexedOpCount_, static_cast<size_t>(opCount - 2));
+}
+
+/**
+ * @tc.name: IndexedPlaybackTest002
+ * @tc.desc: Test that the indexed ops are materialized and the buffer is released when all ops are needed.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DrawCmdListTest, IndexedPlaybackTest002, TestSize.Level1)
+{
+    constexpr int32_t opCount = 10;
+    auto drawCmdList = std::make_shared<DrawCmdList>(TEST_MEM_SIZE, TEST_MEM_SIZE);
+    PaintHandle paintHandle;
+    for (int32_t i = 0; i < opCount; i++) {
+        drawCmdList->AddDrawOp<DrawRectOpItem::ConstructorHandle>(Rect(0, 0, i, i), paintHandle);
+    }
+    auto newCmdList = DrawCmdList::CreateFromData(drawCmdList->GetData(), true);
+    ASSERT_NE(newCmdList, nullptr);
+    newCmdList->SetIndexedPlayback(true);
+    EXPECT_TRUE(newCmdList->IsIndexedPlayback());
+    newCmdList->UnmarshallingDrawOps();
+    EXPECT_GT(newCmdList->opAllocator_.GetSize(), newCmdList->offset_);
+
+    std::string dump;
+    newCmdList->Dump(dump);
+    EXPECT_FALSE(dump.empty());
+    EXPECT_EQ(newCmdList->pendingIndexedOpCount_, 0u);
+    EXPECT_EQ(newCmdList->opAllocator_.GetSize(), newCmdList->offset_);
+    for (const auto& op : newCmdList->drawOpItems_) {
+        ASSERT_NE(op, nullptr);
+        EXPECT_EQ(op->GetType(), DrawOpItem::RECT_OPITEM);
+    }
+
+    // playback still works after the buffer is released
+    Canvas canvas(TEST_MEM_SIZE, TEST_MEM_SIZE);
+    newCmdList->Playback(canvas);
+    newCmdList->ClearOp();
+    EXPECT_TRUE(newCmdList->opIndex_.empty());
+}
+
+/**
+ * @tc.name: IndexedPlaybackTest003
+ * @tc.desc: Test that partial-dirty playback of a large list in indexed mode only unmarshals the ops inside the
+ *           dirty rect, while deferred mode unmarshals every op.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DrawCmdListTest, IndexedPlaybackTest003, TestSize.Level1)
+{
+    constexpr int32_t opColumns = 200;
+    constexpr int32_t opRows = 100;
+    constexpr int32_t opSpacing = 10;
+    constexpr int32_t opSize = 8;
+    constexpr int32_t dirtySize = 95; // covers 10x10 ops and stays clear of the 11th row and column
+    constexpr size_t dirtyOpCount = 100;
+    constexpr size_t opCount = opColumns * opRows;
+    auto drawCmdList = std::make_shared<DrawCmdList>(opColumns * opSpacing, opRows * opSpacing);
+    PaintHandle paintHandle;
+    paintHandle.style = Paint::PaintStyle::PAINT_FILL;
+    for (int32_t row = 0; row < opRows; row++) {
+        for (int32_t column = 0; column < opColumns; column++) {
+            Rect rect(column * opSpacing, row * opSpacing, column * opSpacing + opSize, row * opSpacing + opSize);
+            drawCmdList->AddDrawOp<DrawRectOpItem::ConstructorHandle>(rect, paintHandle);
+        }
+    }
+    auto data = drawCmdList->GetData();
+    for (bool indexed : { false, true }) {
+        auto cmdList = DrawCmdList::CreateFromData(data, true);
+        ASSERT_NE(cmdList, nullptr);
+        cmdList->SetIndexedPlayback(indexed);
+        cmdList->UnmarshallingDrawOps();
+        ASSERT_EQ(cmdList->GetOpItemSize(), opCount);
+        Canvas canvas(opColumns * opSpacing, opRows * opSpacing);
+        canvas.ClipRect(Rect(0, 0, dirtySize, dirtySize));
+        cmdList->Playback(canvas);
+        size_t unmarshalledCount = static_cast<size_t>(std::count_if(cmdList->drawOpItems_.begin(),
+            cmdList->drawOpItems_.end(), [](const auto& op) { return op != nullptr; }));
+        EXPECT_EQ(unmarshalledCount, indexed ? dirtyOpCount : opCount);
+        EXPECT_EQ(cmdList->pendingIndexedOpCount_, indexed ? opCount - dirtyOpCount : 0u);
+    }
+}
+
+/**
+ * @tc.name: IndexedPlaybackPerfTest
+ * @tc.desc: Test frame after frame partial-dirty playback of a large list: with a dirty rect moving over the list,
+ *           indexed mode only unmarshals the ops of each newly dirty area once, while deferred mode unmarshals
+ *           the whole list up front.
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(DrawCmdListTest, IndexedPlaybackPerfTest, TestSize.Level2)
+{
+    constexpr int32_t opColumns = 200;
+    constexpr int32_t opRows = 100;
+    constexpr int32_t opSpacing = 10;
+    constexpr int32_t opSize = 8;
+    constexpr int32_t dirtySize = 95; // covers 10x10 ops and stays clear of the 11th row and column
+    constexpr int32_t dirtyStep = 100;
+    constexpr size_t dirtyOpCount = 100;
+    constexpr size_t opCount = opColumns * opRows;
+    constexpr int32_t rounds = 10;
+    auto drawCmdList = std::make_shared<DrawCmdList>(opColumns * opSpacing, opRows * opSpacing);
+    PaintHandle paintHandle;
+    paintHandle.style = Paint::PaintStyle::PAINT_FILL;
+    for (int32_t row = 0; row < opRows; row++) {
+        for (int32_t column = 0; column < opColumns; column++) {
+            Rect rect(column * opSpacing, row * opSpacing, column * opSpacing + opSize, row * opSpacing + opSize);
+            drawCmdList->AddDrawOp<DrawRectOpItem::ConstructorHandle>(rect, paintHandle);
+        }
+    }
+    auto data = drawCmdList->GetData();
+    for (bool indexed : { false, true }) {
+        auto cmdList = DrawCmdList::CreateFromData(data, true);
+        ASSERT_NE(cmdList, nullptr);
+        cmdList->SetIndexedPlayback(indexed);
+        cmdList->UnmarshallingDrawOps();
+        for (int32_t round = 0; round < rounds; round++) {
+            // every area is played back twice, the second frame must not unmarshal anything new
+            for (int32_t frame = 0; frame < 2; frame++) {
+                Canvas canvas(opColumns * opSpacing, opRows * opSpacing);
+                canvas.ClipRect(Rect(round * dirtyStep, 0, round * dirtyStep + dirtySize, dirtySize));
+                cmdList->Playback(canvas);
+            }
+            size_t unmarshalledCount = static_cast<size_t>(std::count_if(cmdList->drawOpItems_.begin(),
+                cmdList->drawOpItems_.end(), [](const auto& op) { return op != nullptr; }));
+            size_t expectedCount = indexed ? (round + 1) * dirtyOpCount : opCount;
+            EXPECT_EQ(unmarshalledCount, expectedCount);
+            EXPECT_EQ(cmdList->pendingIndexedOpCount_, opCount - expectedCount);
+        }
+    }
+}
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
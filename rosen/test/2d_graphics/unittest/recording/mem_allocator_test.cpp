@@ -139,4 +139,107 @@ HWTEST_F(MemAllocatorTest, AddTest001, TestSize.Level1)
     memAllocator->Add(dataVal, size);
     ASSERT_TRUE(memAllocator->size_ == 0);
 }
+
+/**
+ * @tc.name: ChunkModeTest001
+ * @tc.desc: Test that offsets stay valid across blocks and after flattening in chunk mode.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MemAllocatorTest, ChunkModeTest001, TestSize.Level1)
+{
+    auto memAllocator = std::make_shared<MemAllocator>();
+    int32_t header = 1; // 1 for test
+    memAllocator->Add(&header, sizeof(int32_t));
+    ASSERT_TRUE(memAllocator->SetChunkMode(true, 64)); // 64 is a small block size to force many blocks
+    ASSERT_TRUE(memAllocator->IsChunkMode());
+    ASSERT_EQ(memAllocator->GetChunkCount(), 1u);
+
+    constexpr uint32_t count = 100;
+    std::vector<size_t> offsets;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t* value = memAllocator->Allocate<uint32_t>(i);
+        ASSERT_NE(value, nullptr);
+        size_t offset = memAllocator->AddrToOffset(value);
+        ASSERT_EQ(memAllocator->OffsetToAddr(offset, sizeof(uint32_t)), value);
+        offsets.push_back(offset);
+    }
+    ASSERT_GT(memAllocator->GetChunkCount(), 1u);
+    size_t size = memAllocator->GetSize();
+    ASSERT_EQ(memAllocator->GetData(), nullptr);
+
+    ASSERT_TRUE(memAllocator->Flatten());
+    auto data = static_cast<const char*>(memAllocator->GetData());
+    ASSERT_NE(data, nullptr);
+    ASSERT_EQ(memAllocator->GetChunkCount(), 1u);
+    ASSERT_EQ(memAllocator->GetSize(), size);
+    ASSERT_EQ(*reinterpret_cast<const int32_t*>(data), header);
+    for (uint32_t i = 0; i < count; i++) {
+        ASSERT_EQ(*reinterpret_cast<const uint32_t*>(data + offsets[i]), i);
+    }
+}
+
+/**
+ * @tc.name: ChunkModeTest002
+ * @tc.desc: Test switching chunk mode on a read-only allocator and back to contiguous mode.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MemAllocatorTest, ChunkModeTest002, TestSize.Level1)
+{
+    auto memAllocator = std::make_shared<MemAllocator>();
+    int32_t number = 0;
+    ASSERT_TRUE(memAllocator->BuildFromData(&number, sizeof(int32_t)));
+    ASSERT_FALSE(memAllocator->SetChunkMode(true));
+    ASSERT_FALSE(memAllocator->IsChunkMode());
+
+    ASSERT_TRUE(memAllocator->BuildFromDataWithCopy(&number, sizeof(int32_t)));
+    ASSERT_TRUE(memAllocator->SetChunkMode(true, 0));
+    ASSERT_EQ(memAllocator->chunkSize_, MemAllocator::DEFAULT_CHUNK_SIZE);
+    char buffer[MemAllocator::DEFAULT_CHUNK_SIZE] = { 0 };
+    ASSERT_NE(memAllocator->Add(buffer, sizeof(buffer)), nullptr);
+    ASSERT_TRUE(memAllocator->SetChunkMode(false));
+    ASSERT_FALSE(memAllocator->IsChunkMode());
+    ASSERT_EQ(memAllocator->GetChunkCount(), 0u);
+    ASSERT_EQ(memAllocator->GetSize(), sizeof(int32_t) + sizeof(buffer));
+
+    memAllocator->ClearData();
+    ASSERT_EQ(memAllocator->GetSize(), 0u);
+}
+
+/**
+ * @tc.name: ChunkModeTest003
+ * @tc.desc: Test that a copy of a chunked allocator owns its own blocks and that ClearData ends chunk mode.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(MemAllocatorTest, ChunkModeTest003, TestSize.Level1)
+{
+    MemAllocator memAllocator;
+    ASSERT_TRUE(memAllocator.SetChunkMode(true, 64)); // 64 is a small block size to force many blocks
+    constexpr uint32_t count = 100;
+    for (uint32_t i = 0; i < count; i++) {
+        ASSERT_NE(memAllocator.Allocate<uint32_t>(i), nullptr);
+    }
+    ASSERT_GT(memAllocator.GetChunkCount(), 1u);
+
+    MemAllocator copy(memAllocator);
+    ASSERT_EQ(copy.GetChunkCount(), memAllocator.GetChunkCount());
+    for (size_t i = 0; i < copy.GetChunkCount(); i++) {
+        EXPECT_NE(copy.chunks_[i].data, memAllocator.chunks_[i].data);
+    }
+    MemAllocator assigned;
+    assigned = memAllocator;
+    memAllocator.ClearData();
+    EXPECT_FALSE(memAllocator.IsChunkMode());
+
+    for (auto* allocator : { &copy, &assigned }) {
+        ASSERT_TRUE(allocator->Flatten());
+        auto data = static_cast<const uint32_t*>(allocator->GetData());
+        ASSERT_NE(data, nullptr);
+        for (uint32_t i = 0; i < count; i++) {
+            EXPECT_EQ(data[i], i);
+        }
+    }
+}
 } // namespace OHOS::Rosen::Drawing
\ No newline at end of file
@@ -250,6 +250,82 @@ HWTEST_F(RecordingCanvasTest, DrawRoundRect001, TestSize.Level1)
     drawCmdList2->Playback(canvas);
 }
 
+/**
+ * @tc.name: DrawRects001
+ * @tc.desc: Test the DrawRects function records a single op item and plays it back.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RecordingCanvasTest, DrawRects001, TestSize.Level1)
+{
+    auto recordingCanvas1 = std::make_shared<RecordingCanvas>(CANAS_WIDTH, CANAS_HEIGHT);
+    auto recordingCanvas2 = std::make_shared<RecordingCanvas>(CANAS_WIDTH, CANAS_HEIGHT, false);
+    EXPECT_TRUE(recordingCanvas1 != nullptr && recordingCanvas2 != nullptr);
+    std::vector<Rect> rects = { Rect(0.0f, 0.0f, 1.0f, 1.0f), Rect(2.0f, 2.0f, CANAS_WIDTH, 3.0f),
+        Rect(1.0f, 4.0f, 2.0f, CANAS_HEIGHT) };
+    recordingCanvas1->DrawRects(nullptr, rects.size());
+    recordingCanvas1->DrawRects(rects.data(), 0);
+    EXPECT_EQ(recordingCanvas1->GetDrawCmdList()->GetOpItemSize(), 0);
+
+    Brush brush(Color::COLOR_GREEN);
+    recordingCanvas1->AttachBrush(brush);
+    recordingCanvas2->AttachBrush(brush);
+    recordingCanvas1->DrawRects(rects.data(), rects.size());
+    recordingCanvas2->DrawRects(rects.data(), rects.size());
+
+    auto drawCmdList1 = recordingCanvas1->GetDrawCmdList();
+    auto drawCmdList2 = recordingCanvas2->GetDrawCmdList();
+    EXPECT_TRUE(drawCmdList1 != nullptr && drawCmdList2 != nullptr);
+    EXPECT_EQ(drawCmdList1->GetOpItemSize(), 1);
+    EXPECT_EQ(drawCmdList2->GetOpItemSize(), 1);
+    EXPECT_EQ(drawCmdList2->GetCmdlistDrawRegion(), Rect(0.0f, 0.0f, CANAS_WIDTH, CANAS_HEIGHT));
+
+    // the deferred op item survives marshalling
+    drawCmdList2->MarshallingDrawOps();
+    auto drawCmdList3 = DrawCmdList::CreateFromData(drawCmdList2->GetData(), true);
+    ASSERT_TRUE(drawCmdList3 != nullptr);
+    drawCmdList3->UnmarshallingDrawOps();
+    auto opItems = drawCmdList3->GetDrawOpItems();
+    ASSERT_EQ(opItems.size(), 1);
+    EXPECT_EQ(opItems[0]->GetType(), DrawOpItem::RECTS_OPITEM);
+
+    Canvas canvas;
+    drawCmdList1->Playback(canvas);
+    drawCmdList2->Playback(canvas);
+}
+
+/**
+ * @tc.name: DrawRoundRects001
+ * @tc.desc: Test the DrawRoundRects function records a single op item and plays it back.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RecordingCanvasTest, DrawRoundRects001, TestSize.Level1)
+{
+    auto recordingCanvas1 = std::make_shared<RecordingCanvas>(CANAS_WIDTH, CANAS_HEIGHT);
+    auto recordingCanvas2 = std::make_shared<RecordingCanvas>(CANAS_WIDTH, CANAS_HEIGHT, false);
+    EXPECT_TRUE(recordingCanvas1 != nullptr && recordingCanvas2 != nullptr);
+    std::vector<RoundRect> roundRects = { RoundRect(Rect(0.0f, 0.0f, CANAS_WIDTH, CANAS_HEIGHT), RADIUS, RADIUS),
+        RoundRect(Rect(1.0f, 1.0f, 2.0f, 2.0f), RADIUS, RADIUS) };
+    recordingCanvas1->DrawRoundRects(nullptr, roundRects.size());
+    EXPECT_EQ(recordingCanvas1->GetDrawCmdList()->GetOpItemSize(), 0);
+
+    Pen pen(Color::COLOR_GREEN);
+    recordingCanvas1->AttachPen(pen);
+    recordingCanvas2->AttachPen(pen);
+    recordingCanvas1->DrawRoundRects(roundRects.data(), roundRects.size());
+    recordingCanvas2->DrawRoundRects(roundRects.data(), roundRects.size());
+
+    auto drawCmdList1 = recordingCanvas1->GetDrawCmdList();
+    auto drawCmdList2 = recordingCanvas2->GetDrawCmdList();
+    EXPECT_TRUE(drawCmdList1 != nullptr && drawCmdList2 != nullptr);
+    EXPECT_EQ(drawCmdList1->GetOpItemSize(), 1);
+    EXPECT_EQ(drawCmdList2->GetOpItemSize(), 1);
+    Canvas canvas;
+    drawCmdList1->Playback(canvas);
+    drawCmdList2->Playback(canvas);
+}
+
 /**
  * @tc.name: DrawNestedRoundRect001
  * @tc.desc: Test the playback of the DrawNestedRoundRect function.
@@ -52,7 +52,9 @@ void RSRenderPipelineTest::SetUpTestCase()
     renderNodeGC.nodeBucket_ = std::queue<std::vector<RSRenderNode*>>();
     renderNodeGC.drawableBucket_ = std::queue<std::vector<DrawableV2::RSRenderNodeDrawableAdapter*>>();
     auto& memTrack = MemoryTrack::Instance();
-    memTrack.memNodeMap_ = std::unordered_map<NodeId, MemoryInfo>();
+    for (auto& shard : memTrack.nodeShards_) {
+        shard.memNodeMap.clear();
+    }
     auto& memorySnapshot = MemorySnapshot::Instance();
     memorySnapshot.appMemorySnapshots_ = std::unordered_map<pid_t, MemorySnapshotInfo>();
 }
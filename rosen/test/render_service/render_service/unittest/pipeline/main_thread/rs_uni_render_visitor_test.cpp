@@ -32,6 +32,8 @@
 #include "feature/layer/rs_layer_cache_manager_base.h"
 #include "feature/protective_solid/rs_protective_solid_render_node.h"
 #include "modifier_ng/appearance/rs_behind_window_filter_render_modifier.h"
+#include "modifier_ng/appearance/rs_coverage_ng_shader_render_modifier.h"
+#include "modifier_ng/geometry/rs_bounds_render_modifier.h"
 #include "monitor/self_drawing_node_monitor.h"
 #include "pipeline/hardware_thread/rs_realtime_refresh_rate_manager.h"
 #include "engine/rs_uni_render_engine.h"
@@ -11341,5 +11343,197 @@ HWTEST_F(RSUniRenderVisitorTest, CollectVirtualScreenNodeId_AllConditionsTrue, T
 
     rsUniRenderVisitor->CollectVirtualScreenNodeId(*screenNode);
 }
+
+constexpr uint32_t WINDOW_PREPARE_WINDOW_COUNT = 4;
+constexpr uint32_t WINDOW_PREPARE_CANVAS_COUNT = 8;
+constexpr float WINDOW_PREPARE_CANVAS_SIZE = 100.f;
+
+// logical display -> windows -> canvas nodes with a dirty bounds modifier, node ids start from idBegin
+std::shared_ptr<RSLogicalDisplayRenderNode> CreateWindowPrepareTree(NodeId idBegin,
+    const std::shared_ptr<RSContext>& context, std::vector<std::shared_ptr<RSRenderNode>>& canvasNodes)
+{
+    NodeId id = idBegin;
+    RSDisplayNodeConfig config;
+    auto displayNode = std::make_shared<RSLogicalDisplayRenderNode>(id++, config, context);
+    displayNode->InitRenderParams();
+    for (uint32_t i = 0; i < WINDOW_PREPARE_WINDOW_COUNT; i++) {
+        auto surfaceNode = std::make_shared<RSSurfaceRenderNode>(id++, context);
+        surfaceNode->InitRenderParams();
+        displayNode->AddChild(surfaceNode);
+        for (uint32_t j = 0; j < WINDOW_PREPARE_CANVAS_COUNT; j++) {
+            auto canvasNode = std::make_shared<RSCanvasRenderNode>(id++, context);
+            canvasNode->InitRenderParams();
+            surfaceNode->AddChild(canvasNode);
+            auto bounds = std::make_shared<RSRenderAnimatableProperty<Vector4f>>(
+                Vector4f(j * WINDOW_PREPARE_CANVAS_SIZE, i * WINDOW_PREPARE_CANVAS_SIZE, WINDOW_PREPARE_CANVAS_SIZE,
+                    WINDOW_PREPARE_CANVAS_SIZE), id++);
+            auto modifier = std::make_shared<ModifierNG::RSBoundsRenderModifier>();
+            modifier->AttachProperty(ModifierNG::RSPropertyType::BOUNDS, bounds);
+            canvasNode->AddModifier(modifier);
+            canvasNodes.emplace_back(canvasNode);
+        }
+        surfaceNode->GenerateFullChildrenList();
+    }
+    displayNode->GenerateFullChildrenList();
+    return displayNode;
+}
+
+std::shared_ptr<RSUniRenderVisitor> CreateWindowPrepareVisitor(const std::shared_ptr<RSContext>& context,
+    const std::shared_ptr<RSLogicalDisplayRenderNode>& displayNode, bool parallel)
+{
+    auto rsUniRenderVisitor = std::make_shared<RSUniRenderVisitor>();
+    auto screenNode = std::make_shared<RSScreenRenderNode>(displayNode->GetId() - 1, 0, context->weak_from_this());
+    screenNode->InitRenderParams();
+    rsUniRenderVisitor->curScreenNode_ = screenNode;
+    rsUniRenderVisitor->curLogicalDisplayNode_ = displayNode;
+    rsUniRenderVisitor->curScreenDirtyManager_ = std::make_shared<RSDirtyRegionManager>();
+    rsUniRenderVisitor->isParallelWindowPrepareEnabled_ = parallel;
+    return rsUniRenderVisitor;
+}
+
+/**
+ * @tc.name: ApplyWindowModifiersInParallel001
+ * @tc.desc: Test ApplyWindowModifiersInParallel applies the modifiers of every dirty window subtree once
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSUniRenderVisitorTest, ApplyWindowModifiersInParallel001, TestSize.Level2)
+{
+    constexpr NodeId idBegin = 30000;
+    auto rsContext = std::make_shared<RSContext>();
+    std::vector<std::shared_ptr<RSRenderNode>> canvasNodes;
+    auto displayNode = CreateWindowPrepareTree(idBegin, rsContext, canvasNodes);
+    ASSERT_TRUE(displayNode->IsSubTreeDirty());
+
+    auto serialVisitor = CreateWindowPrepareVisitor(rsContext, displayNode, false);
+    serialVisitor->ApplyWindowModifiersInParallel(*displayNode);
+    for (auto& canvasNode : canvasNodes) {
+        EXPECT_TRUE(canvasNode->CanApplyModifiersInParallel());
+        EXPECT_TRUE(canvasNode->dirtyTypesNG_.any());
+    }
+
+    auto parallelVisitor = CreateWindowPrepareVisitor(rsContext, displayNode, true);
+    parallelVisitor->ApplyWindowModifiersInParallel(*displayNode);
+    for (auto& canvasNode : canvasNodes) {
+        EXPECT_TRUE(canvasNode->dirtyTypesNG_.none());
+        EXPECT_EQ(canvasNode->GetRenderProperties().GetBoundsWidth(), WINDOW_PREPARE_CANVAS_SIZE);
+        // pending sync is recorded on the workers and added to the context when the events are replayed
+        EXPECT_TRUE(canvasNode->addedToPendingSyncList_);
+        EXPECT_EQ(rsContext->pendingSyncNodes_.count(canvasNode->GetId()), 1);
+    }
+}
+
+/**
+ * @tc.name: ApplyWindowModifiersInParallel002
+ * @tc.desc: Test QuickPrepareLogicalDisplayRenderNode gets the same dirty and visible regions with parallel window
+ *           prepare as the serial prepare
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSUniRenderVisitorTest, ApplyWindowModifiersInParallel002, TestSize.Level2)
+{
+    constexpr NodeId serialIdBegin = 31000;
+    constexpr NodeId parallelIdBegin = 32000;
+    auto serialContext = std::make_shared<RSContext>();
+    auto parallelContext = std::make_shared<RSContext>();
+    std::vector<std::shared_ptr<RSRenderNode>> serialCanvasNodes;
+    std::vector<std::shared_ptr<RSRenderNode>> parallelCanvasNodes;
+    auto serialDisplayNode = CreateWindowPrepareTree(serialIdBegin, serialContext, serialCanvasNodes);
+    auto parallelDisplayNode = CreateWindowPrepareTree(parallelIdBegin, parallelContext, parallelCanvasNodes);
+
+    auto serialVisitor = CreateWindowPrepareVisitor(serialContext, serialDisplayNode, false);
+    serialVisitor->QuickPrepareLogicalDisplayRenderNode(*serialDisplayNode);
+    auto parallelVisitor = CreateWindowPrepareVisitor(parallelContext, parallelDisplayNode, true);
+    parallelVisitor->QuickPrepareLogicalDisplayRenderNode(*parallelDisplayNode);
+
+    EXPECT_EQ(serialVisitor->curScreenDirtyManager_->GetCurrentFrameDirtyRegion(),
+        parallelVisitor->curScreenDirtyManager_->GetCurrentFrameDirtyRegion());
+    auto serialWindows = serialDisplayNode->GetSortedChildren();
+    auto parallelWindows = parallelDisplayNode->GetSortedChildren();
+    ASSERT_EQ(serialWindows->size(), parallelWindows->size());
+    for (size_t i = 0; i < serialWindows->size(); i++) {
+        auto serialWindow = RSBaseRenderNode::ReinterpretCast<RSSurfaceRenderNode>((*serialWindows)[i]);
+        auto parallelWindow = RSBaseRenderNode::ReinterpretCast<RSSurfaceRenderNode>((*parallelWindows)[i]);
+        ASSERT_NE(serialWindow, nullptr);
+        ASSERT_NE(parallelWindow, nullptr);
+        EXPECT_EQ(serialWindow->GetVisibleRegion().GetBound(), parallelWindow->GetVisibleRegion().GetBound());
+        ASSERT_NE(serialWindow->GetDirtyManager(), nullptr);
+        ASSERT_NE(parallelWindow->GetDirtyManager(), nullptr);
+        EXPECT_EQ(serialWindow->GetDirtyManager()->GetCurrentFrameDirtyRegion(),
+            parallelWindow->GetDirtyManager()->GetCurrentFrameDirtyRegion());
+    }
+    ASSERT_EQ(serialCanvasNodes.size(), parallelCanvasNodes.size());
+    for (size_t i = 0; i < serialCanvasNodes.size(); i++) {
+        EXPECT_EQ(serialCanvasNodes[i]->GetRenderProperties().GetBounds(),
+            parallelCanvasNodes[i]->GetRenderProperties().GetBounds());
+        EXPECT_EQ(serialCanvasNodes[i]->GetOldDirty(), parallelCanvasNodes[i]->GetOldDirty());
+    }
+}
+
+/**
+ * @tc.name: ApplyWindowModifiersInParallel003
+ * @tc.desc: Test light source and illuminated nodes are left to the serial prepare by ApplyWindowModifiersInParallel
+ *           and registered to the point light manager by QuickPrepareLogicalDisplayRenderNode
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSUniRenderVisitorTest, ApplyWindowModifiersInParallel003, TestSize.Level2)
+{
+    constexpr NodeId idBegin = 33000;
+    constexpr float lightIntensity = 1.f;
+    auto rsContext = std::make_shared<RSContext>();
+    std::vector<std::shared_ptr<RSRenderNode>> canvasNodes;
+    auto displayNode = CreateWindowPrepareTree(idBegin, rsContext, canvasNodes);
+    // the first canvas node of every window is a light source, the second one is illuminated
+    std::vector<std::shared_ptr<RSRenderNode>> lightNodes;
+    std::vector<std::shared_ptr<RSRenderNode>> illuminatedNodes;
+    constexpr NodeId propertyIdBegin = idBegin + 500;
+    NodeId propertyId = propertyIdBegin;
+    for (size_t i = 0; i < canvasNodes.size(); i += WINDOW_PREPARE_CANVAS_COUNT) {
+        auto lightModifier = std::make_shared<ModifierNG::RSCoverageNGShaderRenderModifier>();
+        lightModifier->AttachProperty(ModifierNG::RSPropertyType::LIGHT_INTENSITY,
+            std::make_shared<RSRenderAnimatableProperty<float>>(lightIntensity, propertyId++));
+        canvasNodes[i]->AddModifier(lightModifier);
+        lightNodes.emplace_back(canvasNodes[i]);
+        auto illuminatedModifier = std::make_shared<ModifierNG::RSCoverageNGShaderRenderModifier>();
+        illuminatedModifier->AttachProperty(ModifierNG::RSPropertyType::ILLUMINATED_TYPE,
+            std::make_shared<RSRenderProperty<int>>(static_cast<int>(IlluminatedType::CONTENT), propertyId++));
+        canvasNodes[i + 1]->AddModifier(illuminatedModifier);
+        illuminatedNodes.emplace_back(canvasNodes[i + 1]);
+    }
+
+    auto parallelVisitor = CreateWindowPrepareVisitor(rsContext, displayNode, true);
+    parallelVisitor->ApplyWindowModifiersInParallel(*displayNode);
+    for (auto& node : lightNodes) {
+        EXPECT_FALSE(node->CanApplyModifiersInParallel());
+        EXPECT_TRUE(node->dirtyTypesNG_.any());
+        const auto& manager = RSPointLightManager::Instance(node->GetLogicalDisplayNodeId());
+        EXPECT_EQ(manager->lightSourceNodeMap_.count(node->GetId()), 0);
+    }
+    for (auto& node : illuminatedNodes) {
+        EXPECT_FALSE(node->CanApplyModifiersInParallel());
+        EXPECT_TRUE(node->dirtyTypesNG_.any());
+        const auto& manager = RSPointLightManager::Instance(node->GetLogicalDisplayNodeId());
+        EXPECT_EQ(manager->illuminatedNodeMap_.count(node->GetId()), 0);
+    }
+
+    parallelVisitor->QuickPrepareLogicalDisplayRenderNode(*displayNode);
+    for (auto& node : lightNodes) {
+        EXPECT_TRUE(node->dirtyTypesNG_.none());
+        ASSERT_NE(node->GetRenderProperties().GetLightSource(), nullptr);
+        EXPECT_EQ(node->GetRenderProperties().GetLightSource()->GetLightIntensity(), lightIntensity);
+        const auto& manager = RSPointLightManager::Instance(node->GetLogicalDisplayNodeId());
+        EXPECT_EQ(manager->lightSourceNodeMap_.count(node->GetId()), 1);
+    }
+    for (auto& node : illuminatedNodes) {
+        EXPECT_TRUE(node->dirtyTypesNG_.none());
+        ASSERT_NE(node->GetRenderProperties().GetIlluminated(), nullptr);
+        const auto& manager = RSPointLightManager::Instance(node->GetLogicalDisplayNodeId());
+        EXPECT_EQ(manager->illuminatedNodeMap_.count(node->GetId()), 1);
+    }
+    for (auto& node : canvasNodes) {
+        RSPointLightManager::ReleaseInstance(node->GetLogicalDisplayNodeId());
+    }
+}
 } // namespace OHOS::Rosen
 #endif // RS_ENABLE_UNI_RENDER
@@ -2850,4 +2850,197 @@ HWTEST_F(RSBaseRenderUtilTest, CreateYuvToRGBABitMap_PaddingHeight001, TestSize.
     bool result = RSBaseRenderUtil::CreateYuvToRGBABitMap(buffer, newBuffer, bitmap);
     EXPECT_TRUE(result);
 }
+
+namespace {
+constexpr int32_t RGBA_CHANNEL_COUNT = 4;
+
+// data has to outlive the returned buffer
+sptr<SurfaceBuffer> CreateCpuBuffer(std::vector<uint8_t>& data, int32_t width, int32_t height, int32_t stride,
+    int32_t format)
+{
+    auto* impl = new SurfaceBufferImpl();
+    auto* handle = new BufferHandle();
+    handle->width = width;
+    handle->height = height;
+    handle->stride = stride;
+    handle->size = static_cast<int32_t>(data.size());
+    handle->format = format;
+    handle->virAddr = data.data();
+    impl->SetBufferHandle(handle);
+    return impl;
+}
+} // namespace
+
+/*
+ * @tc.name: CreateYuvToRGBABitMap_Gray001
+ * @tc.desc: Test that neutral chroma converts every luma level to the same gray with opaque alpha
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSBaseRenderUtilTest, CreateYuvToRGBABitMap_Gray001, TestSize.Level1)
+{
+    constexpr int32_t width = 20;
+    constexpr int32_t height = 4;
+    constexpr int32_t stride = 32;
+    constexpr uint8_t neutralChroma = 128;
+    std::vector<uint8_t> yuv(stride * height * 3 / 2, neutralChroma); // 3 / 2: NV21 size
+    for (int32_t i = 0; i < stride * height; i++) {
+        yuv[i] = static_cast<uint8_t>(i * 3); // 3: spread the luma levels
+    }
+    auto buffer = CreateCpuBuffer(yuv, width, height, stride, GRAPHIC_PIXEL_FMT_YCRCB_420_SP);
+    std::vector<uint8_t> rgba;
+    Drawing::Bitmap bitmap;
+    ASSERT_TRUE(RSBaseRenderUtil::CreateYuvToRGBABitMap(buffer, rgba, bitmap));
+    for (int32_t i = 0; i < height; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            const uint8_t* pixel = &rgba[(i * width + j) * RGBA_CHANNEL_COUNT];
+            uint8_t luma = yuv[i * stride + j];
+            EXPECT_EQ(pixel[0], luma);
+            EXPECT_EQ(pixel[1], luma);
+            EXPECT_EQ(pixel[2], luma);
+            EXPECT_EQ(pixel[3], 255); // 255: opaque
+        }
+    }
+}
+
+/*
+ * @tc.name: CreateYuvToRGBABitMap_Vectorized001
+ * @tc.desc: Test that the vectorized pixels match the scalar tail of a row and that NV12 is NV21 with the chroma
+ *           bytes swapped
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSBaseRenderUtilTest, CreateYuvToRGBABitMap_Vectorized001, TestSize.Level1)
+{
+    // the first 8 pixels of a row are vectorized, the last 4 are not, the content repeats every 4 pixels
+    constexpr int32_t width = 12;
+    constexpr int32_t height = 2;
+    constexpr int32_t period = 4;
+    const uint8_t lumas[period] = { 16, 90, 180, 235 };
+    const uint8_t chromas[period] = { 20, 240, 100, 170 }; // V U V U for NV21
+    std::vector<uint8_t> nv21(width * height * 3 / 2); // 3 / 2: NV21 size
+    std::vector<uint8_t> nv12(nv21.size());
+    for (int32_t i = 0; i < width * height; i++) {
+        nv21[i] = lumas[i % period];
+        nv12[i] = nv21[i];
+    }
+    for (int32_t j = 0; j < width; j += 2) { // 2: one chroma pair
+        nv21[width * height + j] = chromas[j % period];
+        nv21[width * height + j + 1] = chromas[j % period + 1];
+        nv12[width * height + j] = chromas[j % period + 1];
+        nv12[width * height + j + 1] = chromas[j % period];
+    }
+    std::vector<uint8_t> rgba21;
+    std::vector<uint8_t> rgba12;
+    Drawing::Bitmap bitmap;
+    ASSERT_TRUE(RSBaseRenderUtil::CreateYuvToRGBABitMap(
+        CreateCpuBuffer(nv21, width, height, width, GRAPHIC_PIXEL_FMT_YCRCB_420_SP), rgba21, bitmap));
+    ASSERT_TRUE(RSBaseRenderUtil::CreateYuvToRGBABitMap(
+        CreateCpuBuffer(nv12, width, height, width, GRAPHIC_PIXEL_FMT_YCBCR_420_SP), rgba12, bitmap));
+    EXPECT_EQ(rgba21, rgba12);
+    constexpr int32_t vectorWidth = 8;
+    for (int32_t j = vectorWidth; j < width; j++) {
+        for (int32_t k = 0; k < RGBA_CHANNEL_COUNT; k++) {
+            EXPECT_EQ(rgba21[j * RGBA_CHANNEL_COUNT + k], rgba21[(j - vectorWidth) * RGBA_CHANNEL_COUNT + k]);
+        }
+    }
+}
+
+/*
+ * @tc.name: CreateNewColorGamutBitmap_Table001
+ * @tc.desc: Test the table driven gamut conversion of 8 bit pixels: sRGB to sRGB is lossless, grays stay gray from
+ *           sRGB to P3, alpha is kept and BGRA is converted like RGBA
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSBaseRenderUtilTest, CreateNewColorGamutBitmap_Table001, TestSize.Level1)
+{
+    constexpr int32_t width = 256;
+    std::vector<uint8_t> gray(width * RGBA_CHANNEL_COUNT);
+    for (int32_t i = 0; i < width; i++) {
+        std::fill_n(&gray[i * RGBA_CHANNEL_COUNT], RGBA_CHANNEL_COUNT, static_cast<uint8_t>(i));
+    }
+    auto grayBuffer = CreateCpuBuffer(gray, width, 1, width * RGBA_CHANNEL_COUNT, GRAPHIC_PIXEL_FMT_RGBA_8888);
+    std::vector<uint8_t> converted;
+    Drawing::Bitmap bitmap;
+    ASSERT_TRUE(RSBaseRenderUtil::CreateNewColorGamutBitmap(grayBuffer, converted, bitmap,
+        GRAPHIC_COLOR_GAMUT_SRGB, GRAPHIC_COLOR_GAMUT_SRGB));
+    EXPECT_EQ(converted, gray);
+    ASSERT_TRUE(RSBaseRenderUtil::CreateNewColorGamutBitmap(grayBuffer, converted, bitmap,
+        GRAPHIC_COLOR_GAMUT_SRGB, GRAPHIC_COLOR_GAMUT_DISPLAY_P3));
+    EXPECT_EQ(converted, gray);
+
+    std::vector<uint8_t> rgba = { 255, 0, 0, 255, 30, 200, 90, 128 };
+    std::vector<uint8_t> bgra = { 0, 0, 255, 255, 90, 200, 30, 128 };
+    std::vector<uint8_t> rgbaConverted;
+    std::vector<uint8_t> bgraConverted;
+    ASSERT_TRUE(RSBaseRenderUtil::CreateNewColorGamutBitmap(
+        CreateCpuBuffer(rgba, 2, 1, 2 * RGBA_CHANNEL_COUNT, GRAPHIC_PIXEL_FMT_RGBA_8888), rgbaConverted, bitmap,
+        GRAPHIC_COLOR_GAMUT_SRGB, GRAPHIC_COLOR_GAMUT_DISPLAY_P3));
+    ASSERT_TRUE(RSBaseRenderUtil::CreateNewColorGamutBitmap(
+        CreateCpuBuffer(bgra, 2, 1, 2 * RGBA_CHANNEL_COUNT, GRAPHIC_PIXEL_FMT_BGRA_8888), bgraConverted, bitmap,
+        GRAPHIC_COLOR_GAMUT_SRGB, GRAPHIC_COLOR_GAMUT_DISPLAY_P3));
+    ASSERT_EQ(rgbaConverted.size(), rgba.size());
+    ASSERT_EQ(bgraConverted.size(), bgra.size());
+    // sRGB red is inside the P3 gamut
+    EXPECT_LT(rgbaConverted[0], 255);
+    EXPECT_GT(rgbaConverted[1], 0);
+    EXPECT_EQ(rgbaConverted[7], 128); // 7: alpha of the second pixel
+    for (size_t i = 0; i < rgba.size(); i += RGBA_CHANNEL_COUNT) {
+        EXPECT_EQ(rgbaConverted[i], bgraConverted[i + 2]); // 2: blue index of BGRA
+        EXPECT_EQ(rgbaConverted[i + 1], bgraConverted[i + 1]);
+        EXPECT_EQ(rgbaConverted[i + 2], bgraConverted[i]); // 2: blue index of RGBA
+        EXPECT_EQ(rgbaConverted[i + 3], bgraConverted[i + 3]); // 3: alpha
+    }
+}
+
+/*
+ * @tc.name: ConvertBufferPerf001
+ * @tc.desc: Test NV21 to RGBA and sRGB to P3 conversion of 1080p and 4K buffers: NV12 with the chroma bytes swapped
+ *           gives the same pixels, sRGB to sRGB is lossless and the alpha is kept
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(RSBaseRenderUtilTest, ConvertBufferPerf001, TestSize.Level2)
+{
+    const std::pair<int32_t, int32_t> sizes[] = { { 1920, 1080 }, { 3840, 2160 } };
+    for (const auto& [width, height] : sizes) {
+        size_t lumaSize = static_cast<size_t>(width) * height;
+        std::vector<uint8_t> nv21(lumaSize * 3 / 2); // 3 / 2: NV21 size
+        for (size_t i = 0; i < nv21.size(); i++) {
+            nv21[i] = static_cast<uint8_t>(i * 7 + i / width); // 7: vary the bytes
+        }
+        std::vector<uint8_t> nv12(nv21);
+        for (size_t i = lumaSize; i + 1 < nv12.size(); i += 2) { // 2: one chroma pair
+            std::swap(nv12[i], nv12[i + 1]);
+        }
+        std::vector<uint8_t> rgba;
+        std::vector<uint8_t> rgba12;
+        Drawing::Bitmap bitmap;
+        ASSERT_TRUE(RSBaseRenderUtil::CreateYuvToRGBABitMap(
+            CreateCpuBuffer(nv21, width, height, width, GRAPHIC_PIXEL_FMT_YCRCB_420_SP), rgba, bitmap));
+        ASSERT_EQ(rgba.size(), lumaSize * RGBA_CHANNEL_COUNT);
+        EXPECT_EQ(bitmap.GetWidth(), width);
+        EXPECT_EQ(bitmap.GetHeight(), height);
+        ASSERT_TRUE(RSBaseRenderUtil::CreateYuvToRGBABitMap(
+            CreateCpuBuffer(nv12, width, height, width, GRAPHIC_PIXEL_FMT_YCBCR_420_SP), rgba12, bitmap));
+        EXPECT_EQ(rgba12, rgba);
+        for (size_t i = 3; i < rgba.size(); i += RGBA_CHANNEL_COUNT) { // 3: alpha index
+            ASSERT_EQ(rgba[i], 255); // 255: opaque
+        }
+
+        auto rgbaBuffer =
+            CreateCpuBuffer(rgba, width, height, width * RGBA_CHANNEL_COUNT, GRAPHIC_PIXEL_FMT_RGBA_8888);
+        std::vector<uint8_t> converted;
+        ASSERT_TRUE(RSBaseRenderUtil::CreateNewColorGamutBitmap(rgbaBuffer, converted, bitmap,
+            GRAPHIC_COLOR_GAMUT_SRGB, GRAPHIC_COLOR_GAMUT_SRGB));
+        EXPECT_EQ(converted, rgba);
+        ASSERT_TRUE(RSBaseRenderUtil::CreateNewColorGamutBitmap(rgbaBuffer, converted, bitmap,
+            GRAPHIC_COLOR_GAMUT_SRGB, GRAPHIC_COLOR_GAMUT_DISPLAY_P3));
+        ASSERT_EQ(converted.size(), rgba.size());
+        for (size_t i = 3; i < converted.size(); i += RGBA_CHANNEL_COUNT) { // 3: alpha index
+            ASSERT_EQ(converted[i], rgba[i]);
+        }
+    }
+}
 } // namespace OHOS::Rosen
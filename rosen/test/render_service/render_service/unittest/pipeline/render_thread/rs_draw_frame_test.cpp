@@ -18,6 +18,7 @@
 #include "foundation/graphic/graphic_2d/rosen/test/render_service/render_service/unittest/pipeline/rs_test_util.h"
 #include "pipeline/render_thread/rs_draw_frame.h"
 #include "pipeline/main_thread/rs_main_thread.h"
+#include "pipeline/rs_canvas_render_node.h"
 #include "recording/recording_canvas.h"
 
 using namespace testing;
@@ -25,14 +26,48 @@ using namespace testing::ext;
 using namespace OHOS::Rosen::DrawableV2;
 
 namespace OHOS::Rosen {
+namespace {
+constexpr NodeId PARAMS_SYNC_NODE_ID_BEGIN = 10000;
+constexpr size_t PARAMS_SYNC_NODE_COUNT = 200;
+constexpr size_t PARAMS_SYNC_BENCHMARK_NODE_COUNT = 3000;
+constexpr int PARAMS_SYNC_BENCHMARK_ROUNDS = 10;
+}
+
 class RSDrawFrameTest : public testing::Test {
 public:
     static void SetUpTestCase();
     static void TearDownTestCase();
     void SetUp() override;
     void TearDown() override;
+
+    static std::vector<std::shared_ptr<RSRenderNode>> CreateParamsSyncNodes(size_t count);
+    static void SyncNodes(RSDrawFrame& drawFrame, const std::vector<std::shared_ptr<RSRenderNode>>& nodes, float alpha);
 };
 
+std::vector<std::shared_ptr<RSRenderNode>> RSDrawFrameTest::CreateParamsSyncNodes(size_t count)
+{
+    std::vector<std::shared_ptr<RSRenderNode>> nodes;
+    for (size_t i = 0; i < count; i++) {
+        auto node = std::make_shared<RSCanvasRenderNode>(PARAMS_SYNC_NODE_ID_BEGIN + i);
+        node->InitRenderParams();
+        nodes.emplace_back(node);
+    }
+    return nodes;
+}
+
+void RSDrawFrameTest::SyncNodes(RSDrawFrame& drawFrame, const std::vector<std::shared_ptr<RSRenderNode>>& nodes,
+    float alpha)
+{
+    auto& pendingSyncNodes = RSMainThread::Instance()->GetContext().pendingSyncNodes_;
+    for (auto& node : nodes) {
+        node->GetStagingRenderParams()->SetAlpha(alpha);
+        pendingSyncNodes.emplace(node->GetId(), node);
+    }
+    auto params = std::make_unique<RSRenderThreadParams>();
+    drawFrame.SetRenderThreadParams(params);
+    drawFrame.Sync();
+}
+
 void RSDrawFrameTest::SetUpTestCase()
 {
     RSTestUtil::InitRenderNodeGC();
@@ -267,4 +302,96 @@ HWTEST_F(RSDrawFrameTest, SetEarlyZEnabled_NullContext, TestSize.Level1)
     // early return should not mutate internal counters
     ASSERT_EQ(drawFrame.longFrameCount_, 0);
 }
+
+/**
+ * @tc.name: ParallelParamsSyncTest
+ * @tc.desc: test render params synced in parallel match the serial sync and the sync stats are recorded
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSDrawFrameTest, ParallelParamsSyncTest, TestSize.Level1)
+{
+    constexpr float serialAlpha = 0.25f;
+    constexpr float parallelAlpha = 0.75f;
+    RSDrawFrame drawFrame;
+    auto nodes = CreateParamsSyncNodes(PARAMS_SYNC_NODE_COUNT);
+    drawFrame.SetParallelParamsSyncEnabled(false);
+    SyncNodes(drawFrame, nodes, serialAlpha);
+    // no stats are collected while parallel params sync is off
+    EXPECT_EQ(drawFrame.lastSyncStats_.syncNodeCount, 0);
+    EXPECT_EQ(drawFrame.lastSyncStats_.deferredNodeCount, 0);
+
+    drawFrame.SetParallelParamsSyncEnabled(true);
+    ASSERT_NE(drawFrame.paramsSyncQueue_, nullptr);
+    SyncNodes(drawFrame, nodes, parallelAlpha);
+    EXPECT_EQ(drawFrame.lastSyncStats_.syncNodeCount, PARAMS_SYNC_NODE_COUNT);
+#ifdef RS_ENABLE_GPU
+    EXPECT_EQ(drawFrame.lastSyncStats_.deferredNodeCount, PARAMS_SYNC_NODE_COUNT);
+    EXPECT_GT(drawFrame.lastSyncStats_.paramsSyncTaskCount, 1);
+    for (auto& node : nodes) {
+        auto drawable = node->GetRenderDrawable();
+        ASSERT_NE(drawable, nullptr);
+        EXPECT_EQ(drawable->GetRenderParams()->GetAlpha(), parallelAlpha);
+        EXPECT_FALSE(node->GetStagingRenderParams()->NeedSync());
+        EXPECT_FALSE(node->IsRenderParamsSyncDeferred());
+    }
+#endif
+    EXPECT_TRUE(RSMainThread::Instance()->GetContext().pendingSyncNodes_.empty());
+}
+
+/**
+ * @tc.name: ParallelParamsSyncTest002
+ * @tc.desc: test a few pending nodes keep the serial sync even when parallel params sync is enabled
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSDrawFrameTest, ParallelParamsSyncTest002, TestSize.Level1)
+{
+    constexpr size_t nodeCount = 8;
+    RSDrawFrame drawFrame;
+    drawFrame.SetParallelParamsSyncEnabled(true);
+    auto nodes = CreateParamsSyncNodes(nodeCount);
+    SyncNodes(drawFrame, nodes, 0.5f);
+    EXPECT_EQ(drawFrame.lastSyncStats_.syncNodeCount, nodeCount);
+    EXPECT_EQ(drawFrame.lastSyncStats_.deferredNodeCount, 0);
+    EXPECT_EQ(drawFrame.lastSyncStats_.paramsSyncTaskCount, 0);
+}
+
+/**
+ * @tc.name: ParallelParamsSyncPerfTest
+ * @tc.desc: test the sync phase of thousands of dirty nodes over several frames: serial sync collects no stats,
+ *           parallel params sync defers every node to a bounded number of tasks and leaves no params behind
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(RSDrawFrameTest, ParallelParamsSyncPerfTest, TestSize.Level2)
+{
+    constexpr size_t maxParamsSyncTasks = 4;
+    RSDrawFrame drawFrame;
+    auto nodes = CreateParamsSyncNodes(PARAMS_SYNC_BENCHMARK_NODE_COUNT);
+    for (bool parallel : { false, true }) {
+        drawFrame.SetParallelParamsSyncEnabled(parallel);
+        for (int round = 0; round < PARAMS_SYNC_BENCHMARK_ROUNDS; round++) {
+            // alternate the alpha so every round has params to sync
+            float alpha = (round % 2 == 0) ? 0.5f : 1.0f;
+            SyncNodes(drawFrame, nodes, alpha);
+            EXPECT_TRUE(RSMainThread::Instance()->GetContext().pendingSyncNodes_.empty());
+            if (!parallel) {
+                EXPECT_EQ(drawFrame.lastSyncStats_.syncNodeCount, 0);
+                continue;
+            }
+            EXPECT_EQ(drawFrame.lastSyncStats_.syncNodeCount, PARAMS_SYNC_BENCHMARK_NODE_COUNT);
+#ifdef RS_ENABLE_GPU
+            EXPECT_EQ(drawFrame.lastSyncStats_.deferredNodeCount, PARAMS_SYNC_BENCHMARK_NODE_COUNT);
+            EXPECT_EQ(drawFrame.lastSyncStats_.paramsSyncTaskCount, maxParamsSyncTasks);
+            for (auto& node : nodes) {
+                auto drawable = node->GetRenderDrawable();
+                ASSERT_NE(drawable, nullptr);
+                EXPECT_EQ(drawable->GetRenderParams()->GetAlpha(), alpha);
+                EXPECT_FALSE(node->GetStagingRenderParams()->NeedSync());
+            }
+#endif
+        }
+    }
+}
 }
\ No newline at end of file
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "include/animation/rs_cubic_bezier_interpolator.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Rosen {
+namespace {
+struct BezierCurve {
+    float x1;
+    float y1;
+    float x2;
+    float y2;
+};
+
+// ease, ease in, ease out, ease in out, fast out slow in, friction, sharp and an overshooting curve
+const std::vector<BezierCurve> CURVES = {
+    { 0.25f, 0.1f, 0.25f, 1.0f },
+    { 0.42f, 0.0f, 1.0f, 1.0f },
+    { 0.0f, 0.0f, 0.58f, 1.0f },
+    { 0.42f, 0.0f, 0.58f, 1.0f },
+    { 0.4f, 0.0f, 0.2f, 1.0f },
+    { 0.2f, 0.0f, 0.2f, 1.0f },
+    { 0.33f, 0.0f, 0.67f, 1.0f },
+    { 0.2f, 1.5f, 0.3f, -0.5f },
+};
+
+constexpr float CURVE_TOLERANCE = 1e-5f;
+constexpr int SAMPLE_COUNT = 10000;
+
+template<typename T>
+T BezierValue(T time, T ctl1, T ctl2)
+{
+    constexpr T three = 3;
+    T oneMinusTime = 1 - time;
+    return three * oneMinusTime * oneMinusTime * time * ctl1 + three * oneMinusTime * time * time * ctl2 +
+        time * time * time;
+}
+
+// y of the curve at x, solved by bisection in double
+double ExactCurveValue(const BezierCurve& curve, double x)
+{
+    constexpr int iterations = 60;
+    double low = 0.0;
+    double high = 1.0;
+    for (int i = 0; i < iterations; i++) {
+        double middle = (low + high) / 2.0;
+        if (BezierValue<double>(middle, curve.x1, curve.x2) < x) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return BezierValue<double>((low + high) / 2.0, curve.y1, curve.y2);
+}
+
+// the interpolation before the sample table: binary search of x(t) on a grid of 4000 steps
+float GridSearchCurveValue(const BezierCurve& curve, float input)
+{
+    constexpr int resolution = 4000;
+    constexpr float step = 1.0f / resolution;
+    constexpr float epsilon = 1e-6f;
+    if (std::fabs(input - 1.0f) <= epsilon) {
+        return 1.0f;
+    }
+    int low = 0;
+    int high = resolution;
+    while (low <= high) {
+        int middle = (low + high) / 2;
+        float approximation = BezierValue(step * middle, curve.x1, curve.x2);
+        if (std::fabs(approximation - input) <= epsilon) {
+            low = middle;
+            break;
+        } else if (approximation < input) {
+            low = middle + 1;
+        } else {
+            high = middle - 1;
+        }
+    }
+    return low > resolution ? 1.0f : BezierValue(step * low, curve.y1, curve.y2);
+}
+} // namespace
+
+class RSCubicBezierInterpolatorTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void RSCubicBezierInterpolatorTest::SetUpTestCase() {}
+void RSCubicBezierInterpolatorTest::TearDownTestCase() {}
+void RSCubicBezierInterpolatorTest::SetUp() {}
+void RSCubicBezierInterpolatorTest::TearDown() {}
+
+/**
+ * @tc.name: InterpolateTest001
+ * @tc.desc: Verify the ends of the curve, out of range inputs and linear curves
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSCubicBezierInterpolatorTest, InterpolateTest001, TestSize.Level1)
+{
+    RSCubicBezierInterpolator interpolator(0.42f, 0.0f, 0.58f, 1.0f);
+    EXPECT_EQ(interpolator.InterpolateImpl(0.0f), 0.0f);
+    EXPECT_EQ(interpolator.InterpolateImpl(1.0f), 1.0f);
+    EXPECT_EQ(interpolator.InterpolateImpl(-0.5f), 0.0f);
+    EXPECT_EQ(interpolator.InterpolateImpl(1.5f), 1.0f);
+    EXPECT_EQ(interpolator.InterpolateImpl(NAN), 0.0f);
+    EXPECT_NEAR(interpolator.InterpolateImpl(0.5f), 0.5f, CURVE_TOLERANCE);
+
+    RSCubicBezierInterpolator linear(0.3f, 0.3f, 0.7f, 0.7f);
+    EXPECT_TRUE(linear.isLinear_);
+    EXPECT_EQ(linear.InterpolateImpl(0.123f), 0.123f);
+
+    // invalid control points fall back to ease in out, which has its sample table too
+    RSCubicBezierInterpolator invalid(NAN, 0.0f, 1.0f, 1.0f);
+    EXPECT_EQ(invalid.sampleTable_, interpolator.sampleTable_);
+}
+
+/**
+ * @tc.name: InterpolateTest002
+ * @tc.desc: Verify the curves are within the documented tolerance of the exact curve and at least as close as the
+ *           grid search they replace
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSCubicBezierInterpolatorTest, InterpolateTest002, TestSize.Level1)
+{
+    for (const auto& curve : CURVES) {
+        RSCubicBezierInterpolator interpolator(curve.x1, curve.y1, curve.x2, curve.y2);
+        double maxError = 0.0;
+        double maxGridError = 0.0;
+        for (int i = 0; i <= SAMPLE_COUNT; i++) {
+            float input = static_cast<float>(i) / SAMPLE_COUNT;
+            double exact = ExactCurveValue(curve, input);
+            maxError = std::max(maxError, std::fabs(interpolator.InterpolateImpl(input) - exact));
+            maxGridError = std::max(maxGridError, std::fabs(GridSearchCurveValue(curve, input) - exact));
+        }
+        EXPECT_LT(maxError, CURVE_TOLERANCE);
+        EXPECT_LE(maxError, maxGridError);
+    }
+}
+
+/**
+ * @tc.name: InterpolateBatchTest001
+ * @tc.desc: Verify the batch interpolation gives the values of Interpolate for the cubic bezier and the default
+ *           implementation of the other interpolators
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSCubicBezierInterpolatorTest, InterpolateBatchTest001, TestSize.Level1)
+{
+    std::vector<float> inputs;
+    for (int i = -1; i <= SAMPLE_COUNT / 100 + 1; i++) {
+        inputs.push_back(static_cast<float>(i) / (SAMPLE_COUNT / 100));
+    }
+    std::vector<float> outputs(inputs.size());
+    std::vector<std::shared_ptr<RSInterpolator>> interpolators = {
+        std::make_shared<RSCubicBezierInterpolator>(0.2f, 0.0f, 0.2f, 1.0f),
+        std::make_shared<LinearInterpolator>(),
+    };
+    for (const auto& interpolator : interpolators) {
+        interpolator->Interpolate(inputs.data(), outputs.data(), inputs.size());
+        for (size_t i = 0; i < inputs.size(); i++) {
+            EXPECT_EQ(outputs[i], interpolator->Interpolate(inputs[i]));
+        }
+    }
+    // a null buffer is ignored
+    interpolators[0]->Interpolate(nullptr, outputs.data(), inputs.size());
+    interpolators[0]->Interpolate(inputs.data(), nullptr, inputs.size());
+}
+
+/**
+ * @tc.name: IsSameCurveTest001
+ * @tc.desc: Verify only interpolators of equal control points or both linear are taken as the same curve
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSCubicBezierInterpolatorTest, IsSameCurveTest001, TestSize.Level1)
+{
+    RSCubicBezierInterpolator curve(0.2f, 0.0f, 0.2f, 1.0f);
+    RSCubicBezierInterpolator sameCurve(0.2f, 0.0f, 0.2f, 1.0f);
+    RSCubicBezierInterpolator otherCurve(0.4f, 0.0f, 0.2f, 1.0f);
+    LinearInterpolator linear;
+    LinearInterpolator otherLinear;
+    EXPECT_TRUE(curve.IsSameCurve(curve));
+    EXPECT_TRUE(curve.IsSameCurve(sameCurve));
+    EXPECT_FALSE(curve.IsSameCurve(otherCurve));
+    EXPECT_FALSE(curve.IsSameCurve(linear));
+    EXPECT_TRUE(linear.IsSameCurve(otherLinear));
+    EXPECT_FALSE(linear.IsSameCurve(curve));
+}
+
+/**
+ * @tc.name: UnmarshallingTest001
+ * @tc.desc: Verify the constructor used by Unmarshalling builds the sample table too
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSCubicBezierInterpolatorTest, UnmarshallingTest001, TestSize.Level1)
+{
+    RSCubicBezierInterpolator interpolator(0.4f, 0.0f, 0.2f, 1.0f);
+    RSCubicBezierInterpolator copy(interpolator.id_, 0.4f, 0.0f, 0.2f, 1.0f);
+    EXPECT_EQ(copy.sampleTable_, interpolator.sampleTable_);
+    for (int i = 0; i <= SAMPLE_COUNT / 100; i++) {
+        float input = static_cast<float>(i) / (SAMPLE_COUNT / 100);
+        EXPECT_EQ(copy.InterpolateImpl(input), interpolator.InterpolateImpl(input));
+    }
+}
+
+/**
+ * @tc.name: InterpolatePerfTest
+ * @tc.desc: Verify the sample table with Newton steps over many frames stays on the curve, agrees with the grid search
+ *           it replaces and gives the same values one by one and in batch
+ * @tc.type: PERF
+ */
+HWTEST_F(RSCubicBezierInterpolatorTest, InterpolatePerfTest, TestSize.Level2)
+{
+    constexpr int frameCount = 200000;
+    constexpr int fractionCount = 997;
+    std::vector<float> inputs(frameCount);
+    for (int i = 0; i < frameCount; i++) {
+        // fractions of a 120Hz frame clock for animations of different durations
+        inputs[i] = static_cast<float>(i % fractionCount) / fractionCount;
+    }
+    std::vector<float> outputs(frameCount);
+    for (const auto& curve : CURVES) {
+        RSCubicBezierInterpolator interpolator(curve.x1, curve.y1, curve.x2, curve.y2);
+        float gridSum = 0.0f;
+        float tableSum = 0.0f;
+        for (float input : inputs) {
+            gridSum += GridSearchCurveValue(curve, input);
+            tableSum += interpolator.InterpolateImpl(input);
+        }
+        EXPECT_NEAR(gridSum / frameCount, tableSum / frameCount, CURVE_TOLERANCE * 100);
+
+        interpolator.Interpolate(inputs.data(), outputs.data(), frameCount);
+        for (int i = 0; i < frameCount; i++) {
+            ASSERT_EQ(outputs[i], interpolator.Interpolate(inputs[i]));
+        }
+        // the inputs repeat every fractionCount frames
+        for (int i = 0; i < fractionCount; i++) {
+            ASSERT_NEAR(outputs[i], ExactCurveValue(curve, inputs[i]), CURVE_TOLERANCE);
+        }
+    }
+}
+} // namespace OHOS::Rosen
@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+#include "animation/rs_animation_manager.h"
+#include "animation/rs_cubic_bezier_interpolator.h"
+#include "animation/rs_render_animation_batch.h"
+#include "animation/rs_render_curve_animation.h"
+#include "modifier/rs_render_property.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Rosen {
+namespace {
+    constexpr int64_t FRAME_INTERVAL_NS = 16666667;
+    constexpr int32_t MAX_FRAME_COUNT = 200;
+    constexpr int32_t PERF_NODE_COUNT = 300;
+    constexpr int32_t PERF_ANIMATION_COUNT_PER_NODE = 8;
+    constexpr int32_t PERF_FRAME_COUNT = 60;
+
+    // a node worth of animations: two additive float animations of one property, one non-additive float, one of
+    // each other supported type, one start delayed with fill mode and one quaternion that is never batched
+    struct AnimationSet {
+        std::unique_ptr<RSAnimationManager> manager = std::make_unique<RSAnimationManager>();
+        std::shared_ptr<RSRenderAnimatableProperty<float>> sharedFloat;
+        std::shared_ptr<RSRenderAnimatableProperty<float>> overwriteFloat;
+        std::shared_ptr<RSRenderAnimatableProperty<Vector2f>> vector2f;
+        std::shared_ptr<RSRenderAnimatableProperty<Vector4f>> vector4f;
+        std::shared_ptr<RSRenderAnimatableProperty<Color>> color;
+        std::shared_ptr<RSRenderAnimatableProperty<float>> delayedFloat;
+        std::shared_ptr<RSRenderAnimatableProperty<Quaternion>> quaternion;
+    };
+
+    template<typename T>
+    std::shared_ptr<RSRenderCurveAnimation> AddCurveAnimation(RSAnimationManager& manager, AnimationId id,
+        const std::shared_ptr<RSRenderAnimatableProperty<T>>& property, const T& start, const T& end,
+        int duration, bool isAdditive = true)
+    {
+        auto animation = std::make_shared<RSRenderCurveAnimation>(id, property->GetId(),
+            std::make_shared<RSRenderAnimatableProperty<T>>(property->Get()),
+            std::make_shared<RSRenderAnimatableProperty<T>>(start),
+            std::make_shared<RSRenderAnimatableProperty<T>>(end));
+        animation->SetDuration(duration);
+        animation->SetAdditive(isAdditive);
+        animation->SetInterpolator(std::make_shared<RSCubicBezierInterpolator>(0.2f, 0.0f, 0.2f, 1.0f));
+        animation->AttachRenderProperty(property);
+        manager.AddAnimation(animation);
+        return animation;
+    }
+
+    std::unique_ptr<AnimationSet> CreateAnimationSet()
+    {
+        auto set = std::make_unique<AnimationSet>();
+        auto& manager = *set->manager;
+        PropertyId propertyId = 1;
+        AnimationId animationId = 1;
+        set->sharedFloat = std::make_shared<RSRenderAnimatableProperty<float>>(0.0f, propertyId++);
+        set->overwriteFloat = std::make_shared<RSRenderAnimatableProperty<float>>(1.0f, propertyId++);
+        set->vector2f = std::make_shared<RSRenderAnimatableProperty<Vector2f>>(Vector2f(), propertyId++);
+        set->vector4f = std::make_shared<RSRenderAnimatableProperty<Vector4f>>(Vector4f(), propertyId++);
+        set->color = std::make_shared<RSRenderAnimatableProperty<Color>>(Color(), propertyId++);
+        set->delayedFloat = std::make_shared<RSRenderAnimatableProperty<float>>(0.0f, propertyId++);
+        set->quaternion = std::make_shared<RSRenderAnimatableProperty<Quaternion>>(Quaternion(), propertyId++);
+
+        AddCurveAnimation(manager, animationId++, set->sharedFloat, 0.0f, 100.0f, 300)->Start();
+        auto reversed = AddCurveAnimation(manager, animationId++, set->sharedFloat, 0.0f, -30.0f, 500);
+        reversed->SetRepeatCount(2);
+        reversed->SetAutoReverse(true);
+        reversed->Start();
+        AddCurveAnimation(manager, animationId++, set->overwriteFloat, 1.0f, 0.3f, 400, false)->Start();
+        AddCurveAnimation(manager, animationId++, set->vector2f, Vector2f(0.0f, 0.0f), Vector2f(720.0f, -1280.0f),
+            350)->Start();
+        AddCurveAnimation(manager, animationId++, set->vector4f, Vector4f(0.0f, 0.0f, 0.0f, 0.0f),
+            Vector4f(10.0f, 20.0f, 300.0f, 400.0f), 450)->Start();
+        AddCurveAnimation(manager, animationId++, set->color, Color(0, 0, 0, 0), Color(255, 128, 64, 255), 250)
+            ->Start();
+        auto delayed = AddCurveAnimation(manager, animationId++, set->delayedFloat, 10.0f, 20.0f, 200);
+        delayed->SetStartDelay(100);
+        delayed->SetFillMode(FillMode::BOTH);
+        delayed->Start();
+        AddCurveAnimation(manager, animationId++, set->quaternion, Quaternion(), Quaternion(0.0f, 0.0f, 1.0f, 0.0f),
+            300)->Start();
+        return set;
+    }
+
+    void ExpectSameValues(const AnimationSet& expected, const AnimationSet& actual)
+    {
+        EXPECT_EQ(expected.sharedFloat->Get(), actual.sharedFloat->Get());
+        EXPECT_EQ(expected.overwriteFloat->Get(), actual.overwriteFloat->Get());
+        EXPECT_EQ(expected.delayedFloat->Get(), actual.delayedFloat->Get());
+        for (int i = 0; i < 2; i++) { // 2: dimension of Vector2f
+            EXPECT_EQ(expected.vector2f->Get()[i], actual.vector2f->Get()[i]);
+        }
+        for (int i = 0; i < 4; i++) { // 4: dimension of Vector4f and Quaternion
+            EXPECT_EQ(expected.vector4f->Get()[i], actual.vector4f->Get()[i]);
+            EXPECT_EQ(expected.quaternion->Get()[i], actual.quaternion->Get()[i]);
+        }
+        EXPECT_EQ(expected.color->Get().GetRedF(), actual.color->Get().GetRedF());
+        EXPECT_EQ(expected.color->Get().GetGreenF(), actual.color->Get().GetGreenF());
+        EXPECT_EQ(expected.color->Get().GetBlueF(), actual.color->Get().GetBlueF());
+        EXPECT_EQ(expected.color->Get().GetAlphaF(), actual.color->Get().GetAlphaF());
+    }
+
+    std::tuple<bool, bool, bool> AnimateSet(AnimationSet& set, int64_t time, int64_t& minLeftDelayTime,
+        bool isBatchAnimateEnabled)
+    {
+        set.manager->isBatchAnimateEnabled_ = isBatchAnimateEnabled;
+        return set.manager->Animate(time, minLeftDelayTime, true, RSSurfaceNodeAbilityState::FOREGROUND);
+    }
+}
+
+class RSRenderAnimationBatchTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: IsSupportedTypeTest
+ * @tc.desc: test the value types evaluated in batch
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSRenderAnimationBatchTest, IsSupportedTypeTest, TestSize.Level1)
+{
+    EXPECT_TRUE(RSRenderAnimationBatch::IsSupportedType(RSPropertyType::FLOAT));
+    EXPECT_TRUE(RSRenderAnimationBatch::IsSupportedType(RSPropertyType::VECTOR2F));
+    EXPECT_TRUE(RSRenderAnimationBatch::IsSupportedType(RSPropertyType::VECTOR4F));
+    EXPECT_TRUE(RSRenderAnimationBatch::IsSupportedType(RSPropertyType::RS_COLOR));
+    EXPECT_FALSE(RSRenderAnimationBatch::IsSupportedType(RSPropertyType::QUATERNION));
+    EXPECT_FALSE(RSRenderAnimationBatch::IsSupportedType(RSPropertyType::INVALID));
+}
+
+/**
+ * @tc.name: AddTest
+ * @tc.desc: test that only running curve animations past their first frame are added
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSRenderAnimationBatchTest, AddTest, TestSize.Level1)
+{
+    RSAnimationManager manager;
+    auto property = std::make_shared<RSRenderAnimatableProperty<float>>(0.0f, 1);
+    auto animation = AddCurveAnimation(manager, 1, property, 0.0f, 1.0f, 300);
+    RSRenderAnimationBatch batch;
+    int64_t minLeftDelayTime = 0;
+    // not started
+    EXPECT_FALSE(batch.Add(*animation, 0, minLeftDelayTime));
+    animation->Start();
+    // start time and initialization are done by Animate
+    EXPECT_FALSE(batch.Add(*animation, 0, minLeftDelayTime));
+    animation->Animate(0, minLeftDelayTime);
+    animation->Animate(FRAME_INTERVAL_NS, minLeftDelayTime);
+    // same time as the last frame
+    EXPECT_FALSE(batch.Add(*animation, FRAME_INTERVAL_NS, minLeftDelayTime));
+    EXPECT_TRUE(batch.Add(*animation, FRAME_INTERVAL_NS * 2, minLeftDelayTime)); // 2: the second frame
+    EXPECT_EQ(batch.GetSize(), 1);
+    EXPECT_EQ(batch.GetAnimation(0), animation.get());
+    EXPECT_EQ(batch.GetAnimation(1), nullptr);
+
+    auto quaternion = std::make_shared<RSRenderAnimatableProperty<Quaternion>>(Quaternion(), 2);
+    auto quaternionAnimation = AddCurveAnimation(manager, 2, quaternion, Quaternion(), Quaternion(), 300);
+    quaternionAnimation->Start();
+    quaternionAnimation->Animate(0, minLeftDelayTime);
+    quaternionAnimation->Animate(FRAME_INTERVAL_NS, minLeftDelayTime);
+    EXPECT_FALSE(batch.Add(*quaternionAnimation, FRAME_INTERVAL_NS * 2, minLeftDelayTime)); // 2: the second frame
+    batch.Clear();
+    EXPECT_EQ(batch.GetSize(), 0);
+}
+
+/**
+ * @tc.name: ApplyTest
+ * @tc.desc: test that the batched value of a frame is the one Animate gives
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSRenderAnimationBatchTest, ApplyTest, TestSize.Level1)
+{
+    RSAnimationManager manager;
+    auto expected = std::make_shared<RSRenderAnimatableProperty<Vector4f>>(Vector4f(), 1);
+    auto actual = std::make_shared<RSRenderAnimatableProperty<Vector4f>>(Vector4f(), 2);
+    Vector4f end(1.0f, 2.0f, 3.0f, 4.0f);
+    auto expectedAnimation = AddCurveAnimation(manager, 1, expected, Vector4f(), end, 300);
+    auto actualAnimation = AddCurveAnimation(manager, 2, actual, Vector4f(), end, 300);
+    int64_t minLeftDelayTime = 0;
+    for (auto& animation : { expectedAnimation, actualAnimation }) {
+        animation->Start();
+        animation->Animate(0, minLeftDelayTime);
+        animation->Animate(FRAME_INTERVAL_NS, minLeftDelayTime);
+    }
+
+    RSRenderAnimationBatch batch;
+    EXPECT_FALSE(batch.Apply(0, 0, minLeftDelayTime));
+    bool isFinished = false;
+    for (int32_t frame = 2; frame < MAX_FRAME_COUNT && !isFinished; frame++) { // 2: frames run above
+        int64_t time = frame * FRAME_INTERVAL_NS;
+        isFinished = expectedAnimation->Animate(time, minLeftDelayTime);
+        batch.Clear();
+        ASSERT_TRUE(batch.Add(*actualAnimation, time, minLeftDelayTime));
+        batch.Evaluate();
+        EXPECT_EQ(batch.Apply(0, time, minLeftDelayTime), isFinished);
+        EXPECT_EQ(expectedAnimation->GetValueFraction(), actualAnimation->GetValueFraction());
+        for (int i = 0; i < 4; i++) { // 4: dimension of Vector4f
+            EXPECT_EQ(expected->Get()[i], actual->Get()[i]);
+        }
+    }
+    EXPECT_TRUE(isFinished);
+}
+
+/**
+ * @tc.name: FindTest
+ * @tc.desc: test that the animations are found in any order and applied out of order or after being paused give the
+ *           values of Animate
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSRenderAnimationBatchTest, FindTest, TestSize.Level1)
+{
+    RSAnimationManager manager;
+    std::vector<std::shared_ptr<RSRenderAnimatableProperty<float>>> properties;
+    std::vector<std::shared_ptr<RSRenderCurveAnimation>> animations;
+    int64_t minLeftDelayTime = 0;
+    for (int32_t i = 0; i < 4; i++) { // 4: expected and actual of two animations
+        properties.push_back(std::make_shared<RSRenderAnimatableProperty<float>>(0.0f, i + 1));
+        animations.push_back(AddCurveAnimation(manager, i + 1, properties.back(), 0.0f, 100.0f * (i / 2 + 1), 300));
+        animations.back()->Start();
+        animations.back()->Animate(0, minLeftDelayTime);
+        animations.back()->Animate(FRAME_INTERVAL_NS, minLeftDelayTime);
+    }
+
+    RSRenderAnimationBatch batch;
+    int64_t time = FRAME_INTERVAL_NS * 2; // 2: the frame after the ones run above
+    animations[0]->Animate(time, minLeftDelayTime);
+    animations[2]->Animate(time, minLeftDelayTime); // 2: expected of the second animation
+    ASSERT_TRUE(batch.Add(*animations[1], time, minLeftDelayTime));
+    ASSERT_TRUE(batch.Add(*animations[3], time, minLeftDelayTime)); // 3: actual of the second animation
+    batch.Evaluate();
+    EXPECT_EQ(batch.Find(animations[3].get()), 1);
+    EXPECT_EQ(batch.Find(animations[1].get()), 0);
+    EXPECT_EQ(batch.Find(animations[0].get()), batch.GetSize());
+    EXPECT_FALSE(batch.Apply(1, time, minLeftDelayTime));
+    EXPECT_FALSE(batch.Apply(0, time, minLeftDelayTime));
+    EXPECT_EQ(properties[0]->Get(), properties[1]->Get());
+    EXPECT_EQ(properties[2]->Get(), properties[3]->Get()); // 2, 3: expected and actual of the second animation
+
+    // paused after being added, e.g. by the callback of an animation applied before it
+    time += FRAME_INTERVAL_NS;
+    batch.Clear();
+    ASSERT_TRUE(batch.Add(*animations[1], time, minLeftDelayTime));
+    batch.Evaluate();
+    animations[1]->Pause();
+    float pausedValue = properties[1]->Get();
+    EXPECT_FALSE(batch.Apply(batch.Find(animations[1].get()), time, minLeftDelayTime));
+    EXPECT_EQ(properties[1]->Get(), pausedValue);
+}
+
+/**
+ * @tc.name: BatchAnimateEquivalenceTest
+ * @tc.desc: test that RSAnimationManager::Animate gives the same values and results with and without batch
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSRenderAnimationBatchTest, BatchAnimateEquivalenceTest, TestSize.Level1)
+{
+    bool isCalcAnimateVelocity = RSRenderAnimation::isCalcAnimateVelocity_;
+    RSRenderAnimation::isCalcAnimateVelocity_ = true;
+    auto expected = CreateAnimationSet();
+    auto actual = CreateAnimationSet();
+    ExpectSameValues(*expected, *actual);
+
+    int32_t frame = 0;
+    for (; frame < MAX_FRAME_COUNT && expected->manager->GetAnimationsSize() > 0; frame++) {
+        int64_t time = frame * FRAME_INTERVAL_NS;
+        int64_t expectedDelayTime = INT64_MAX;
+        int64_t actualDelayTime = INT64_MAX;
+        auto expectedResult = AnimateSet(*expected, time, expectedDelayTime, false);
+        auto actualResult = AnimateSet(*actual, time, actualDelayTime, true);
+        EXPECT_EQ(expectedResult, actualResult);
+        EXPECT_EQ(expectedDelayTime, actualDelayTime);
+        EXPECT_EQ(expected->manager->GetAnimationsSize(), actual->manager->GetAnimationsSize());
+        ExpectSameValues(*expected, *actual);
+    }
+    EXPECT_LT(frame, MAX_FRAME_COUNT);
+    EXPECT_EQ(actual->manager->GetAnimationsSize(), 0);
+    RSRenderAnimation::isCalcAnimateVelocity_ = isCalcAnimateVelocity;
+}
+
+/**
+ * @tc.name: BatchAnimatePerfTest
+ * @tc.desc: test that many nodes of curve animations get the same values and results with and without batch, and
+ *           that every value keeps moving towards its end while no animation finishes early
+ * @tc.type: PERF
+ */
+HWTEST_F(RSRenderAnimationBatchTest, BatchAnimatePerfTest, TestSize.Level2)
+{
+    // values of all the properties and results of all the managers after each frame
+    std::vector<Vector4f> values[2];
+    std::vector<std::tuple<bool, bool, bool>> results[2];
+    for (int32_t pass = 0; pass < 2; pass++) { // 2: without and with batch
+        std::vector<std::unique_ptr<RSAnimationManager>> managers;
+        std::vector<std::shared_ptr<RSRenderAnimatableProperty<Vector4f>>> properties;
+        AnimationId animationId = 1;
+        for (int32_t node = 0; node < PERF_NODE_COUNT; node++) {
+            managers.push_back(std::make_unique<RSAnimationManager>());
+            managers.back()->isBatchAnimateEnabled_ = pass == 1;
+            for (int32_t i = 0; i < PERF_ANIMATION_COUNT_PER_NODE; i++) {
+                properties.push_back(std::make_shared<RSRenderAnimatableProperty<Vector4f>>(Vector4f(), animationId));
+                auto animation = AddCurveAnimation(*managers.back(), animationId++, properties.back(), Vector4f(),
+                    Vector4f(1.0f, 2.0f, 3.0f, 4.0f), PERF_FRAME_COUNT * 20); // 20: longer than the frames run
+                if (i % 2 == 1) { // 2: half of the animations on a second curve
+                    animation->SetInterpolator(std::make_shared<RSCubicBezierInterpolator>(0.4f, 0.0f, 0.2f, 1.0f));
+                }
+                animation->Start();
+            }
+        }
+        for (int32_t frame = 0; frame < PERF_FRAME_COUNT; frame++) {
+            for (auto& manager : managers) {
+                int64_t minLeftDelayTime = 0;
+                results[pass].push_back(manager->Animate(frame * FRAME_INTERVAL_NS, minLeftDelayTime, true,
+                    RSSurfaceNodeAbilityState::FOREGROUND));
+            }
+            for (const auto& property : properties) {
+                values[pass].push_back(property->Get());
+            }
+        }
+        for (const auto& manager : managers) {
+            EXPECT_EQ(manager->GetAnimationsSize(), PERF_ANIMATION_COUNT_PER_NODE);
+        }
+    }
+    EXPECT_EQ(results[0], results[1]);
+    ASSERT_EQ(values[0].size(), values[1].size());
+    for (size_t i = 0; i < values[0].size(); i++) {
+        for (int j = 0; j < 4; j++) { // 4: dimension of Vector4f
+            ASSERT_EQ(values[0][i][j], values[1][i][j]);
+        }
+    }
+    // the values of the last frame moved away from the start without reaching the end
+    size_t propertyCount = static_cast<size_t>(PERF_NODE_COUNT) * PERF_ANIMATION_COUNT_PER_NODE;
+    ASSERT_EQ(values[1].size(), propertyCount * PERF_FRAME_COUNT);
+    for (size_t i = values[1].size() - propertyCount; i < values[1].size(); i++) {
+        EXPECT_GT(values[1][i][0], 0.0f);
+        EXPECT_LT(values[1][i][0], 1.0f);
+    }
+}
+} // namespace OHOS::Rosen
@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <random>
+
 #include "gtest/gtest.h"
 
 #include "platform/common/rs_innovation.h"
@@ -620,4 +622,106 @@ HWTEST_F(RSOcclusionRegionTest, GetSizeReturnType001, Function | MediumTest | Le
     size = emptyRegion.GetSize();
     EXPECT_EQ(size, static_cast<size_t>(0));
 }
+
+namespace {
+// window layout of a multi-window scene: full screen windows, floating cards and small widgets
+std::vector<Region> MakeWindowLayout(int windowCount, uint32_t seed)
+{
+    constexpr int screenWidth = 1260;
+    constexpr int screenHeight = 2720;
+    constexpr int minSize = 64;
+    std::mt19937 rng(seed);
+    std::vector<Region> windows;
+    for (int i = 0; i < windowCount; i++) {
+        int width = std::max(minSize, static_cast<int>(rng() % screenWidth));
+        int height = std::max(minSize, static_cast<int>(rng() % screenHeight));
+        int left = static_cast<int>(rng() % (screenWidth - width + 1));
+        int top = static_cast<int>(rng() % (screenHeight - height + 1));
+        Region window(Rect(left, top, left + width, top + height));
+        // rounded corners split the opaque region into several rects
+        constexpr int radius = 32;
+        if (width > radius * 2 && height > radius * 2) {
+            window.SubSelf(Region(Rect(left, top, left + radius, top + radius)));
+            window.SubSelf(Region(Rect(left + width - radius, top + height - radius, left + width, top + height)));
+        }
+        windows.push_back(window);
+    }
+    return windows;
+}
+
+// accumulate occlusion from top to bottom like the visitor does per frame, return the total visible area
+int64_t CalcVisibleArea(const std::vector<Region>& windows, bool useSelfOps)
+{
+    Region accumulated;
+    int64_t visibleArea = 0;
+    for (auto iter = windows.rbegin(); iter != windows.rend(); ++iter) {
+        if (useSelfOps) {
+            Region visible = *iter;
+            visibleArea += visible.SubSelf(accumulated).Area();
+            accumulated.OrSelf(*iter);
+        } else {
+            Region window = *iter;
+            visibleArea += window.Sub(accumulated).Area();
+            accumulated = accumulated.Or(*iter);
+        }
+    }
+    return visibleArea;
+}
+} // namespace
+
+/**
+ * @tc.name: OperationSelfTest001
+ * @tc.desc: test that AndSelf/OrSelf/XOrSelf/SubSelf, which reuse per-thread buffers, give the same rects as
+ *           And/Or/Xor/Sub, also when the region operates with itself or with an empty region
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSOcclusionRegionTest, OperationSelfTest001, Function | MediumTest | Level2)
+{
+    constexpr int windowCount = 60;
+    auto windows = MakeWindowLayout(windowCount, 2);
+    windows.emplace_back();
+    Region accumulated;
+    for (size_t i = 1; i < windows.size(); i++) {
+        Region lhs = windows[i - 1];
+        const Region& rhs = windows[i];
+        std::vector<std::pair<Region, Region>> results = {
+            { Region(lhs).AndSelf(rhs), lhs.And(rhs) },
+            { Region(lhs).OrSelf(rhs), lhs.Or(rhs) },
+            { Region(lhs).XOrSelf(rhs), lhs.Xor(rhs) },
+            { Region(lhs).SubSelf(rhs), lhs.Sub(rhs) },
+            { Region(lhs).OrSelf(lhs), lhs.Or(Region(lhs)) },
+            { Region(lhs).SubSelf(lhs), lhs.Sub(Region(lhs)) },
+        };
+        for (auto& [selfRes, res] : results) {
+            ASSERT_EQ(selfRes.GetSize(), res.GetSize());
+            for (size_t j = 0; j < res.GetSize(); j++) {
+                EXPECT_EQ(selfRes.GetRegionRects()[j], res.GetRegionRects()[j]);
+            }
+            EXPECT_EQ(selfRes.GetBound(), res.GetBound());
+        }
+        Region merged = accumulated.Or(rhs);
+        accumulated.OrSelf(rhs);
+        EXPECT_EQ(accumulated.Area(), merged.Area());
+    }
+}
+/**
+ * @tc.name: OcclusionFramePerfTest
+ * @tc.desc: test that per-frame occlusion of 50+ window scenes with the Self ops, whose buffers are kept across
+ *           ops and frames, gives the visible area of the copying ops on every frame
+ * @tc.type:PERF
+ * @tc.require:
+ */
+HWTEST_F(RSOcclusionRegionTest, OcclusionFramePerfTest, Function | MediumTest | Level3)
+{
+    constexpr int frames = 5;
+    for (int windowCount : { 50, 80, 120 }) {
+        auto windows = MakeWindowLayout(windowCount, static_cast<uint32_t>(windowCount));
+        int64_t visibleArea = CalcVisibleArea(windows, false);
+        EXPECT_GT(visibleArea, 0);
+        for (int frame = 0; frame < frames; frame++) {
+            EXPECT_EQ(CalcVisibleArea(windows, true), visibleArea);
+        }
+    }
+}
 } // namespace OHOS::Rosen::Occlusion
\ No newline at end of file
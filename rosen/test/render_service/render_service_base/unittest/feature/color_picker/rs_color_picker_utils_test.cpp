@@ -553,10 +553,10 @@ HWTEST_F(RSColorPickerUtilsTest, DirtyInCurrentSurfaceInvalidCustomRect, TestSiz
 {
     auto filterNode = CreatePreparingColorPickerNode(COLOR_PICKER_FILTER_NODE_ID, COLOR_PICKER_ABS_RECT);
     auto& properties = filterNode->GetMutableRenderProperties();
-    ASSERT_NE(properties.colorPicker_, nullptr);
+    ASSERT_NE(properties.GetColorPicker(), nullptr);
 
     auto expectFallback = [&properties, &filterNode](const Drawing::Rect& customRect) {
-        properties.colorPicker_->rect = customRect;
+        properties.GetColorPicker()->rect = customRect;
         EXPECT_TRUE(RSColorPickerUtils::DirtyInCurrentSurface(*filterNode, COLOR_PICKER_INTERSECT_DIRTY_RECT));
     };
 
@@ -573,12 +573,12 @@ HWTEST_F(RSColorPickerUtilsTest, DirtyInCurrentSurfaceInvalidCustomRect, TestSiz
 
     const RectI maxAbsRect = { std::numeric_limits<int32_t>::max() - 5, 0, 5, 5 };
     filterNode->GetRenderProperties().GetBoundsGeometry()->absRect_ = maxAbsRect;
-    properties.colorPicker_->rect = Drawing::Rect(10.f, 0.f, 20.f, 10.f);
+    properties.GetColorPicker()->rect = Drawing::Rect(10.f, 0.f, 20.f, 10.f);
     EXPECT_TRUE(RSColorPickerUtils::DirtyInCurrentSurface(*filterNode, maxAbsRect));
 
     const RectI minAbsRect = { 0, std::numeric_limits<int32_t>::min() + 5, 5, 5 };
     filterNode->GetRenderProperties().GetBoundsGeometry()->absRect_ = minAbsRect;
-    properties.colorPicker_->rect = Drawing::Rect(0.f, -10.f, 10.f, 0.f);
+    properties.GetColorPicker()->rect = Drawing::Rect(0.f, -10.f, 10.f, 0.f);
     EXPECT_TRUE(RSColorPickerUtils::DirtyInCurrentSurface(*filterNode, minAbsRect));
 }
 
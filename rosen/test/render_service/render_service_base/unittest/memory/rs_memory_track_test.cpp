@@ -14,7 +14,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <fstream>
+#include <thread>
 #include "memory/rs_memory_track.h"
 
 namespace OHOS::Rosen {
@@ -136,7 +138,7 @@ HWTEST_F(RSMemoryTrackTest, RegisterNodeMemTest001, testing::ext::TestSize.Level
     pid_t testPid = -1;
     size_t testSize = 100;
     MemoryTrack::Instance().RegisterNodeMem(testPid, testSize, MEMORY_TYPE::MEM_RENDER_NODE);
-    auto& memData = MemoryTrack::Instance().nodeMemOfPid_[testPid];
+    auto& memData = MemoryTrack::Instance().GetNodeShard(testPid).nodeMemOfPid[testPid];
     EXPECT_EQ(memData.first, testSize);
 }
 
@@ -151,7 +153,7 @@ HWTEST_F(RSMemoryTrackTest, RegisterNodeMemTest002, testing::ext::TestSize.Level
     pid_t testPid = -1;
     size_t testSize = 200;
     MemoryTrack::Instance().RegisterNodeMem(testPid, testSize, MEMORY_TYPE::MEM_RENDER_DRAWABLE_NODE);
-    auto& memData = MemoryTrack::Instance().nodeMemOfPid_[testPid];
+    auto& memData = MemoryTrack::Instance().GetNodeShard(testPid).nodeMemOfPid[testPid];
     EXPECT_EQ(memData.second, testSize);
 }
 
@@ -166,7 +168,7 @@ HWTEST_F(RSMemoryTrackTest, RegisterNodeMemTest003, testing::ext::TestSize.Level
     pid_t testPid = -2;
     size_t testSize = 150;
     MemoryTrack::Instance().RegisterNodeMem(testPid, testSize, static_cast<MEMORY_TYPE>(999));
-    auto& memData = MemoryTrack::Instance().nodeMemOfPid_[testPid];
+    auto& memData = MemoryTrack::Instance().GetNodeShard(testPid).nodeMemOfPid[testPid];
     EXPECT_EQ(memData.first, 0);
     EXPECT_EQ(memData.second, 0);
 }
@@ -184,7 +186,7 @@ HWTEST_F(RSMemoryTrackTest, UnRegisterNodeMemTest001, testing::ext::TestSize.Lev
     size_t unregisterSize = 100;
     MemoryTrack::Instance().RegisterNodeMem(testPid, initialSize, MEMORY_TYPE::MEM_RENDER_NODE);
     MemoryTrack::Instance().UnRegisterNodeMem(testPid, unregisterSize, MEMORY_TYPE::MEM_RENDER_NODE);
-    auto& memData = MemoryTrack::Instance().nodeMemOfPid_[testPid];
+    auto& memData = MemoryTrack::Instance().GetNodeShard(testPid).nodeMemOfPid[testPid];
     EXPECT_EQ(memData.first, initialSize - unregisterSize);
     EXPECT_EQ(memData.second, 0);
 }
@@ -202,7 +204,7 @@ HWTEST_F(RSMemoryTrackTest, UnRegisterNodeMemTest002, testing::ext::TestSize.Lev
     size_t unregisterSize = 150;
     MemoryTrack::Instance().RegisterNodeMem(testPid, initialSize, MEMORY_TYPE::MEM_RENDER_DRAWABLE_NODE);
     MemoryTrack::Instance().UnRegisterNodeMem(testPid, unregisterSize, MEMORY_TYPE::MEM_RENDER_DRAWABLE_NODE);
-    auto& memData = MemoryTrack::Instance().nodeMemOfPid_[testPid];
+    auto& memData = MemoryTrack::Instance().GetNodeShard(testPid).nodeMemOfPid[testPid];
     EXPECT_EQ(memData.second, initialSize - unregisterSize);
 }
 
@@ -219,7 +221,7 @@ HWTEST_F(RSMemoryTrackTest, UnRegisterNodeMemTest003, testing::ext::TestSize.Lev
     size_t unregisterSize = 100;
     MemoryTrack::Instance().RegisterNodeMem(testPid, initialSize, MEMORY_TYPE::MEM_RENDER_NODE);
     MemoryTrack::Instance().UnRegisterNodeMem(testPid, unregisterSize, static_cast<MEMORY_TYPE>(999));
-    auto& memData = MemoryTrack::Instance().nodeMemOfPid_[testPid];
+    auto& memData = MemoryTrack::Instance().GetNodeShard(testPid).nodeMemOfPid[testPid];
     EXPECT_EQ(memData.first, initialSize);
 }
 
@@ -236,7 +238,7 @@ HWTEST_F(RSMemoryTrackTest, UnRegisterNodeMemTest004, testing::ext::TestSize.Lev
     size_t unregisterSize = 200;
     MemoryTrack::Instance().RegisterNodeMem(testPid, initialSize, MEMORY_TYPE::MEM_RENDER_NODE);
     MemoryTrack::Instance().UnRegisterNodeMem(testPid, unregisterSize, MEMORY_TYPE::MEM_RENDER_NODE);
-    auto& memData = MemoryTrack::Instance().nodeMemOfPid_[testPid];
+    auto& memData = MemoryTrack::Instance().GetNodeShard(testPid).nodeMemOfPid[testPid];
     EXPECT_EQ(memData.first, 0);
 }
 
@@ -253,7 +255,7 @@ HWTEST_F(RSMemoryTrackTest, UnRegisterNodeMemTest005, testing::ext::TestSize.Lev
     size_t unregisterSize = 200;
     MemoryTrack::Instance().RegisterNodeMem(testPid, initialSize, MEMORY_TYPE::MEM_RENDER_DRAWABLE_NODE);
     MemoryTrack::Instance().UnRegisterNodeMem(testPid, unregisterSize, MEMORY_TYPE::MEM_RENDER_DRAWABLE_NODE);
-    auto& memData = MemoryTrack::Instance().nodeMemOfPid_[testPid];
+    auto& memData = MemoryTrack::Instance().GetNodeShard(testPid).nodeMemOfPid[testPid];
     EXPECT_EQ(memData.second, 0);
 }
 
@@ -271,7 +273,8 @@ HWTEST_F(RSMemoryTrackTest, UnRegisterNodeMemTest006, testing::ext::TestSize.Lev
     MemoryTrack::Instance().RegisterNodeMem(testPid, initialSize, MEMORY_TYPE::MEM_RENDER_DRAWABLE_NODE);
     MemoryTrack::Instance().UnRegisterNodeMem(testPid, initialSize, MEMORY_TYPE::MEM_RENDER_NODE);
     MemoryTrack::Instance().UnRegisterNodeMem(testPid, initialSize, MEMORY_TYPE::MEM_RENDER_DRAWABLE_NODE);
-    EXPECT_EQ(MemoryTrack::Instance().nodeMemOfPid_.find(testPid), MemoryTrack::Instance().nodeMemOfPid_.end());
+    auto& shard = MemoryTrack::Instance().GetNodeShard(testPid);
+    EXPECT_EQ(shard.nodeMemOfPid.find(testPid), shard.nodeMemOfPid.end());
 }
 
 /**
@@ -544,7 +547,7 @@ HWTEST_F(RSMemoryTrackTest, AddPictureRecordTest, testing::ext::TestSize.Level1)
     MemoryInfo info;
     MemoryTrack& test1 =  MemoryTrack::Instance();
     test1.AddPictureRecord(addr, info);
-    EXPECT_TRUE(test1.memPicRecord_.count(addr));
+    EXPECT_TRUE(test1.GetPicShard(addr).memPicRecord.count(addr));
 }
 
 /**
@@ -559,9 +562,9 @@ HWTEST_F(RSMemoryTrackTest, RemovePictureRecordTest, testing::ext::TestSize.Leve
     MemoryInfo info;
     MemoryTrack& test1 = MemoryTrack::Instance();
     test1.AddPictureRecord(addr, info);
-    EXPECT_TRUE(test1.memPicRecord_.count(addr));
+    EXPECT_TRUE(test1.GetPicShard(addr).memPicRecord.count(addr));
     test1.RemovePictureRecord(addr);
-    EXPECT_FALSE(test1.memPicRecord_.count(addr));
+    EXPECT_FALSE(test1.GetPicShard(addr).memPicRecord.count(addr));
 }
 
 /**
@@ -579,7 +582,7 @@ HWTEST_F(RSMemoryTrackTest, UpdatePictureInfoTest, testing::ext::TestSize.Level1
     MemoryTrack& test1 = MemoryTrack::Instance();
     test1.AddPictureRecord(addr, info);
     test1.UpdatePictureInfo(addr, nodeId, pid);
-    auto itr = test1.memPicRecord_.find(addr);
+    auto itr = test1.GetPicShard(addr).memPicRecord.find(addr);
     MemoryInfo info2 = itr->second;
     EXPECT_EQ(-1, info2.pid);  //1.for test
 }
@@ -599,7 +602,7 @@ HWTEST_F(RSMemoryTrackTest, AddPictureRecordWithPixelMapTest, testing::ext::Test
     info.allocType = OHOS::Media::AllocatorType::HEAP_ALLOC;
     MemoryTrack& test1 = MemoryTrack::Instance();
     test1.AddPictureRecord(addr, info);
-    EXPECT_TRUE(test1.memPicRecord_.count(addr));
+    EXPECT_TRUE(test1.GetPicShard(addr).memPicRecord.count(addr));
     test1.RemovePictureRecord(addr);
 }
 
@@ -618,7 +621,7 @@ HWTEST_F(RSMemoryTrackTest, AddPictureRecordWithSkImageTest, testing::ext::TestS
     info.allocType = OHOS::Media::AllocatorType::HEAP_ALLOC;
     MemoryTrack& test1 = MemoryTrack::Instance();
     test1.AddPictureRecord(addr, info);
-    EXPECT_TRUE(test1.memPicRecord_.count(addr));
+    EXPECT_TRUE(test1.GetPicShard(addr).memPicRecord.count(addr));
     test1.RemovePictureRecord(addr);
 }
 
@@ -637,7 +640,7 @@ HWTEST_F(RSMemoryTrackTest, AddPictureRecordWithDmaAllocTest, testing::ext::Test
     info.allocType = OHOS::Media::AllocatorType::DMA_ALLOC;
     MemoryTrack& test1 = MemoryTrack::Instance();
     test1.AddPictureRecord(addr, info);
-    EXPECT_TRUE(test1.memPicRecord_.count(addr));
+    EXPECT_TRUE(test1.GetPicShard(addr).memPicRecord.count(addr));
     test1.RemovePictureRecord(addr);
 }
 
@@ -656,9 +659,9 @@ HWTEST_F(RSMemoryTrackTest, RemovePictureRecordWithPixelMapTest, testing::ext::T
     info.allocType = OHOS::Media::AllocatorType::SHARE_MEM_ALLOC;
     MemoryTrack& test1 = MemoryTrack::Instance();
     test1.AddPictureRecord(addr, info);
-    EXPECT_TRUE(test1.memPicRecord_.count(addr));
+    EXPECT_TRUE(test1.GetPicShard(addr).memPicRecord.count(addr));
     test1.RemovePictureRecord(addr);
-    EXPECT_FALSE(test1.memPicRecord_.count(addr));
+    EXPECT_FALSE(test1.GetPicShard(addr).memPicRecord.count(addr));
 }
 
 /**
@@ -676,9 +679,9 @@ HWTEST_F(RSMemoryTrackTest, RemovePictureRecordWithSkImageTest, testing::ext::Te
     info.allocType = OHOS::Media::AllocatorType::HEAP_ALLOC;
     MemoryTrack& test1 = MemoryTrack::Instance();
     test1.AddPictureRecord(addr, info);
-    EXPECT_TRUE(test1.memPicRecord_.count(addr));
+    EXPECT_TRUE(test1.GetPicShard(addr).memPicRecord.count(addr));
     test1.RemovePictureRecord(addr);
-    EXPECT_FALSE(test1.memPicRecord_.count(addr));
+    EXPECT_FALSE(test1.GetPicShard(addr).memPicRecord.count(addr));
 }
 
 /**
@@ -691,9 +694,9 @@ HWTEST_F(RSMemoryTrackTest, RemoveNonExistentPictureRecordTest, testing::ext::Te
 {
     const void* addr = reinterpret_cast<void*>(0x8000);
     MemoryTrack& test1 = MemoryTrack::Instance();
-    EXPECT_FALSE(test1.memPicRecord_.count(addr));
+    EXPECT_FALSE(test1.GetPicShard(addr).memPicRecord.count(addr));
     test1.RemovePictureRecord(addr);
-    EXPECT_FALSE(test1.memPicRecord_.count(addr));
+    EXPECT_FALSE(test1.GetPicShard(addr).memPicRecord.count(addr));
 }
 
 /**
@@ -750,9 +753,9 @@ HWTEST_F(RSMemoryTrackTest, MultiplePixelMapRecordsSamePidTest, testing::ext::Te
     test1.AddPictureRecord(addr2, info);
     test1.AddPictureRecord(addr3, info);
 
-    EXPECT_TRUE(test1.memPicRecord_.count(addr1));
-    EXPECT_TRUE(test1.memPicRecord_.count(addr2));
-    EXPECT_TRUE(test1.memPicRecord_.count(addr3));
+    EXPECT_TRUE(test1.GetPicShard(addr1).memPicRecord.count(addr1));
+    EXPECT_TRUE(test1.GetPicShard(addr2).memPicRecord.count(addr2));
+    EXPECT_TRUE(test1.GetPicShard(addr3).memPicRecord.count(addr3));
 
     test1.RemovePictureRecord(addr1);
     test1.RemovePictureRecord(addr2);
@@ -783,8 +786,8 @@ HWTEST_F(RSMemoryTrackTest, MultiplePixelMapRecordsDifferentPidTest, testing::ex
     test1.AddPictureRecord(addr1, info1);
     test1.AddPictureRecord(addr2, info2);
 
-    EXPECT_TRUE(test1.memPicRecord_.count(addr1));
-    EXPECT_TRUE(test1.memPicRecord_.count(addr2));
+    EXPECT_TRUE(test1.GetPicShard(addr1).memPicRecord.count(addr1));
+    EXPECT_TRUE(test1.GetPicShard(addr2).memPicRecord.count(addr2));
 
     test1.RemovePictureRecord(addr1);
     test1.RemovePictureRecord(addr2);
@@ -824,11 +827,11 @@ HWTEST_F(RSMemoryTrackTest, PixelMapRecordWithDifferentAllocatorTypesTest, testi
     MemoryTrack::Instance().AddPictureRecord(addr5, info);
 
     MemoryTrack& test1 = MemoryTrack::Instance();
-    EXPECT_TRUE(test1.memPicRecord_.count(addr1));
-    EXPECT_TRUE(test1.memPicRecord_.count(addr2));
-    EXPECT_TRUE(test1.memPicRecord_.count(addr3));
-    EXPECT_TRUE(test1.memPicRecord_.count(addr4));
-    EXPECT_TRUE(test1.memPicRecord_.count(addr5));
+    EXPECT_TRUE(test1.GetPicShard(addr1).memPicRecord.count(addr1));
+    EXPECT_TRUE(test1.GetPicShard(addr2).memPicRecord.count(addr2));
+    EXPECT_TRUE(test1.GetPicShard(addr3).memPicRecord.count(addr3));
+    EXPECT_TRUE(test1.GetPicShard(addr4).memPicRecord.count(addr4));
+    EXPECT_TRUE(test1.GetPicShard(addr5).memPicRecord.count(addr5));
 
     test1.RemovePictureRecord(addr1);
     test1.RemovePictureRecord(addr2);
@@ -1390,4 +1393,109 @@ HWTEST_F(RSMemoryTrackTest, GetMemNodeMapTest001, testing::ext::TestSize.Level1)
 
     MemoryTrack::Instance().RemoveNodeRecord(testId);
 }
-} // namespace OHOS::Rosen
\ No newline at end of file
+
+/**
+ * @tc.name: ShardedRecordTest001
+ * @tc.desc: Test node records of many pids registered from several threads are aggregated for report.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSMemoryTrackTest, ShardedRecordTest001, testing::ext::TestSize.Level1)
+{
+    constexpr pid_t basePid = 70001;
+    constexpr int threadCount = 4;
+    constexpr uint32_t nodesPerPid = 50;
+    constexpr size_t nodeSize = 64;
+    auto& memTrack = MemoryTrack::Instance();
+    auto registerNodes = [&memTrack](pid_t pid) {
+        for (uint32_t i = 1; i <= nodesPerPid; i++) {
+            NodeId id = (static_cast<NodeId>(pid) << 32) | i; // 32: pid is the high 32 bits of node id
+            MemoryInfo info = {nodeSize, pid, id, 0, MEMORY_TYPE::MEM_RENDER_NODE};
+            memTrack.AddNodeRecord(id, info);
+            memTrack.RegisterNodeMem(pid, nodeSize, MEMORY_TYPE::MEM_RENDER_NODE);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back(registerNodes, basePid + t);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int t = 0; t < threadCount; t++) {
+        pid_t pid = basePid + t;
+        EXPECT_EQ(memTrack.GetNodeNumOfPid(pid), nodesPerPid);
+        EXPECT_FLOAT_EQ(memTrack.CountRSMemory(pid).GetCpuMemorySize(), static_cast<float>(nodesPerPid * nodeSize));
+        EXPECT_EQ(memTrack.GetNodeMemoryOfPid(pid, MEMORY_TYPE::MEM_RENDER_NODE),
+            nodesPerPid * nodeSize / BYTE_CONVERT);
+    }
+    auto memNodeMap = memTrack.GetMemNodeMap();
+    EXPECT_EQ(memNodeMap.count((static_cast<NodeId>(basePid) << 32) | 1), 1); // 32: pid is the high 32 bits
+
+    for (int t = 0; t < threadCount; t++) {
+        pid_t pid = basePid + t;
+        for (uint32_t i = 1; i <= nodesPerPid; i++) {
+            memTrack.RemoveNodeRecord((static_cast<NodeId>(pid) << 32) | i); // 32: pid is the high 32 bits
+            memTrack.UnRegisterNodeMem(pid, nodeSize, MEMORY_TYPE::MEM_RENDER_NODE);
+        }
+        EXPECT_EQ(memTrack.GetNodeNumOfPid(pid), 0);
+        EXPECT_EQ(memTrack.GetNodeMemoryOfPid(pid, MEMORY_TYPE::MEM_RENDER_NODE), 0);
+        memTrack.RemovePidRecord(pid);
+    }
+}
+
+/**
+ * @tc.name: ShardedRecordTest002
+ * @tc.desc: Test add and remove bursts of several pids from several threads while another thread reads the
+ *           per-pid counts, every count read stays in range and all records are gone afterwards.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSMemoryTrackTest, ShardedRecordTest002, testing::ext::TestSize.Level1)
+{
+    constexpr pid_t basePid = 80001;
+    constexpr int threadCount = 4;
+    constexpr uint32_t nodesPerPid = 2000;
+    constexpr size_t nodeSize = 64;
+    auto& memTrack = MemoryTrack::Instance();
+    auto burst = [&memTrack](pid_t pid) {
+        for (uint32_t i = 1; i <= nodesPerPid; i++) {
+            NodeId id = (static_cast<NodeId>(pid) << 32) | i; // 32: pid is the high 32 bits of node id
+            MemoryInfo info = {nodeSize, pid, id, 0, MEMORY_TYPE::MEM_RENDER_NODE};
+            memTrack.AddNodeRecord(id, info);
+            memTrack.RegisterNodeMem(pid, nodeSize, MEMORY_TYPE::MEM_RENDER_NODE);
+        }
+        for (uint32_t i = 1; i <= nodesPerPid; i++) {
+            memTrack.RemoveNodeRecord((static_cast<NodeId>(pid) << 32) | i); // 32: pid is the high 32 bits
+            memTrack.UnRegisterNodeMem(pid, nodeSize, MEMORY_TYPE::MEM_RENDER_NODE);
+        }
+    };
+    std::atomic<bool> done = false;
+    std::atomic<bool> outOfRange = false;
+    std::thread reader([&memTrack, &done, &outOfRange]() {
+        while (!done.load()) {
+            for (int t = 0; t < threadCount; t++) {
+                if (memTrack.GetNodeNumOfPid(basePid + t) > nodesPerPid) {
+                    outOfRange = true;
+                }
+            }
+        }
+    });
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back(burst, basePid + t);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    done = true;
+    reader.join();
+    EXPECT_FALSE(outOfRange.load());
+    for (int t = 0; t < threadCount; t++) {
+        EXPECT_EQ(memTrack.GetNodeNumOfPid(basePid + t), 0);
+        EXPECT_EQ(memTrack.GetNodeMemoryOfPid(basePid + t, MEMORY_TYPE::MEM_RENDER_NODE), 0);
+        memTrack.RemovePidRecord(basePid + t);
+    }
+    EXPECT_EQ(memTrack.GetMemNodeMap().count((static_cast<NodeId>(basePid) << 32) | 1), 0); // 32: pid high bits
+}
+} // namespace OHOS::Rosen
@@ -5957,5 +5957,132 @@ HWTEST_F(RSRenderNodeTest, UpdateDisplayListExtTest004, TestSize.Level1)
     EXPECT_EQ(n3->stagingDrawCmdList_.size(), n4->stagingDrawCmdList_.size());
 }
 #endif
+
+/**
+ * @tc.name: IsRenderParamsSyncDeferrableTest
+ * @tc.desc: test only nodes whose params sync is node-local can defer it
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderNodeTest, IsRenderParamsSyncDeferrableTest, TestSize.Level1)
+{
+    auto node = std::make_shared<RSRenderNode>(1);
+    EXPECT_FALSE(node->IsRenderParamsSyncDeferrable());
+    node->renderDrawable_ = std::make_shared<RSRenderNodeDrawableAdapterBoy>(node);
+    node->stagingRenderParams_ = std::make_unique<RSRenderParams>(node->GetId());
+    EXPECT_TRUE(node->IsRenderParamsSyncDeferrable());
+    // clearing the surface of a node without node group runs within OnSync
+    node->SetNeedClearRenderGroupCache(true);
+    EXPECT_FALSE(node->IsRenderParamsSyncDeferrable());
+    node->SetNeedClearRenderGroupCache(false);
+
+    auto surfaceNode = std::make_shared<RSSurfaceRenderNode>(2);
+    surfaceNode->renderDrawable_ = std::make_shared<RSRenderNodeDrawableAdapterBoy>(surfaceNode);
+    surfaceNode->stagingRenderParams_ = std::make_unique<RSRenderParams>(surfaceNode->GetId());
+    EXPECT_FALSE(surfaceNode->IsRenderParamsSyncDeferrable());
+    auto canvasDrawingNode = std::make_shared<RSCanvasDrawingRenderNode>(3);
+    canvasDrawingNode->renderDrawable_ = std::make_shared<RSRenderNodeDrawableAdapterBoy>(canvasDrawingNode);
+    canvasDrawingNode->stagingRenderParams_ = std::make_unique<RSRenderParams>(canvasDrawingNode->GetId());
+    EXPECT_FALSE(canvasDrawingNode->IsRenderParamsSyncDeferrable());
+}
+
+/**
+ * @tc.name: SyncDeferredRenderParamsTest
+ * @tc.desc: test a deferred Sync leaves the params to SyncDeferredRenderParams and syncs everything else
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderNodeTest, SyncDeferredRenderParamsTest, TestSize.Level1)
+{
+    constexpr float alpha = 0.5f;
+    auto node = std::make_shared<RSRenderNode>(1);
+    node->renderDrawable_ = std::make_shared<RSRenderNodeDrawableAdapterBoy>(node);
+    node->stagingRenderParams_ = std::make_unique<RSRenderParams>(node->GetId());
+    node->stagingRenderParams_->SetAlpha(alpha);
+    node->stagingRenderParams_->needSync_ = true;
+    node->drawCmdListNeedSync_ = true;
+
+    node->SetRenderParamsSyncDeferred(true);
+    node->Sync();
+    EXPECT_FALSE(node->drawCmdListNeedSync_);
+#ifdef RS_ENABLE_GPU
+    EXPECT_TRUE(node->IsRenderParamsSyncDeferred());
+    EXPECT_NE(node->renderDrawable_->renderParams_->GetAlpha(), alpha);
+    node->SyncDeferredRenderParams();
+    EXPECT_EQ(node->renderDrawable_->renderParams_->GetAlpha(), alpha);
+    EXPECT_FALSE(node->stagingRenderParams_->NeedSync());
+#endif
+    EXPECT_FALSE(node->IsRenderParamsSyncDeferred());
+
+    // nothing to defer when the params do not need sync
+    node->SetRenderParamsSyncDeferred(true);
+    node->Sync();
+    EXPECT_FALSE(node->IsRenderParamsSyncDeferred());
+}
+
+/**
+ * @tc.name: CanApplyModifiersInParallelTest
+ * @tc.desc: test only nodes whose dirty modifiers are all node-local types can be applied in parallel
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderNodeTest, CanApplyModifiersInParallelTest, TestSize.Level1)
+{
+    auto node = std::make_shared<RSCanvasRenderNode>(1);
+    EXPECT_TRUE(node->CanApplyModifiersInParallel());
+    node->AddDirtyType(ModifierNG::RSModifierType::USE_EFFECT);
+    EXPECT_FALSE(node->CanApplyModifiersInParallel());
+    node->dirtyTypesNG_.reset();
+    node->AddDirtyType(ModifierNG::RSModifierType::USE_UNION);
+    EXPECT_FALSE(node->CanApplyModifiersInParallel());
+    // light source and illuminated properties register to the point light manager
+    node->dirtyTypesNG_.reset();
+    node->AddDirtyType(ModifierNG::RSModifierType::COVERAGE_NG_SHADER);
+    EXPECT_FALSE(node->CanApplyModifiersInParallel());
+    node->dirtyTypesNG_.reset();
+    node->AddDirtyType(ModifierNG::RSModifierType::SPATIAL_EFFECT);
+    EXPECT_FALSE(node->CanApplyModifiersInParallel());
+    node->dirtyTypesNG_.reset();
+    node->AddDirtyType(ModifierNG::RSModifierType::BOUNDS);
+    node->AddDirtyType(ModifierNG::RSModifierType::ALPHA);
+    node->AddDirtyType(ModifierNG::RSModifierType::CONTENT_STYLE);
+    EXPECT_TRUE(node->CanApplyModifiersInParallel());
+    // any type outside the node-local list keeps the node serial, also types added after the list was written
+    node->AddDirtyType(ModifierNG::RSModifierType::BACKGROUND_FILTER);
+    EXPECT_FALSE(node->CanApplyModifiersInParallel());
+    node->dirtyTypesNG_.reset();
+    node->AddDirtyType(ModifierNG::RSModifierType::OVERLAY_NG_SHADER);
+    EXPECT_FALSE(node->CanApplyModifiersInParallel());
+
+    auto surfaceNode = std::make_shared<RSSurfaceRenderNode>(2);
+    EXPECT_FALSE(surfaceNode->CanApplyModifiersInParallel());
+    auto canvasDrawingNode = std::make_shared<RSCanvasDrawingRenderNode>(3);
+    EXPECT_FALSE(canvasDrawingNode->CanApplyModifiersInParallel());
+}
+
+/**
+ * @tc.name: DeferredPendingSyncTest
+ * @tc.desc: test AddToPendingSyncList is recorded while events are deferred and added to the context on flush
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSRenderNodeTest, DeferredPendingSyncTest, TestSize.Level1)
+{
+    auto context = std::make_shared<RSContext>();
+    auto node = std::make_shared<RSRenderNode>(1, context);
+    std::vector<RSRenderNode::DeferredDirtyEvent> events;
+    RSRenderNode::SetDeferredDirtyEvents(&events);
+    node->AddToPendingSyncList();
+    node->AddToPendingSyncList();
+    RSRenderNode::SetDeferredDirtyEvents(nullptr);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].type, RSRenderNode::DeferredDirtyEvent::Type::PENDING_SYNC);
+    EXPECT_TRUE(context->pendingSyncNodes_.empty());
+
+    RSRenderNode::FlushDeferredDirtyEvents(events);
+    EXPECT_TRUE(events.empty());
+    EXPECT_TRUE(node->addedToPendingSyncList_);
+    EXPECT_EQ(context->pendingSyncNodes_.count(node->GetId()), 1);
+}
 } // namespace Rosen
 } // namespace OHOS
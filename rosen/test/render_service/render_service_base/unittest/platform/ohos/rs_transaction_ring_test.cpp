@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <fcntl.h>
+#include <memory>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "transaction/rs_ashmem_helper.h"
+#include "transaction/rs_transaction_ring.h"
+#include "platform/ohos/transaction/zidl/rs_iclient_to_render_connection.h"
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+#ifndef MFD_ALLOW_SEALING
+#define MFD_ALLOW_SEALING 0x0002U
+#endif
+#ifndef F_ADD_SEALS
+#define F_ADD_SEALS 1033
+#endif
+#ifndef F_SEAL_SEAL
+#define F_SEAL_SEAL 0x0001
+#endif
+#ifndef F_SEAL_SHRINK
+#define F_SEAL_SHRINK 0x0002
+#endif
+#ifndef F_SEAL_GROW
+#define F_SEAL_GROW 0x0004
+#endif
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr size_t TEST_CAPACITY = 64 * 1024;
+constexpr int32_t LOOPBACK_ROUNDS = 64;
+// ring parcels only carry transactions over the ashmem threshold
+constexpr size_t LOOPBACK_SLOT_SIZE = 256 * 1024;
+constexpr uint8_t LOOPBACK_MODE_RING = 0;
+constexpr uint8_t LOOPBACK_MODE_EXIT = 2;
+
+struct LoopbackMessage {
+    uint8_t mode;
+    uint64_t pos;
+    uint32_t size;
+};
+
+bool SendMessage(int sock, const LoopbackMessage& msg, int fd)
+{
+    iovec iov { const_cast<LoopbackMessage*>(&msg), sizeof(msg) };
+    msghdr hdr {};
+    hdr.msg_iov = &iov;
+    hdr.msg_iovlen = 1;
+    char control[CMSG_SPACE(sizeof(int))] = {};
+    if (fd >= 0) {
+        hdr.msg_control = control;
+        hdr.msg_controllen = sizeof(control);
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+        *reinterpret_cast<int*>(CMSG_DATA(cmsg)) = fd;
+    }
+    return sendmsg(sock, &hdr, 0) == static_cast<ssize_t>(sizeof(msg));
+}
+
+bool RecvMessage(int sock, LoopbackMessage& msg, int& fd)
+{
+    iovec iov { &msg, sizeof(msg) };
+    msghdr hdr {};
+    hdr.msg_iov = &iov;
+    hdr.msg_iovlen = 1;
+    char control[CMSG_SPACE(sizeof(int))] = {};
+    hdr.msg_control = control;
+    hdr.msg_controllen = sizeof(control);
+    fd = -1;
+    if (recvmsg(sock, &hdr, 0) != static_cast<ssize_t>(sizeof(msg))) {
+        return false;
+    }
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr);
+    if (cmsg != nullptr && cmsg->cmsg_type == SCM_RIGHTS) {
+        fd = *reinterpret_cast<int*>(CMSG_DATA(cmsg));
+    }
+    return true;
+}
+
+// consumer process: mirrors what the render service does for ring parcels, acks 1 if the slot holds the bytes
+// the producer wrote for this round
+void RunLoopbackConsumer(int sock)
+{
+    std::unique_ptr<RSTransactionRing> ring;
+    LoopbackMessage msg {};
+    int fd = -1;
+    uint8_t round = 0;
+    while (RecvMessage(sock, msg, fd) && msg.mode != LOOPBACK_MODE_EXIT) {
+        if (fd >= 0) {
+            ring = RSTransactionRing::Attach(fd);
+        }
+        auto data = static_cast<uint8_t*>(ring ? ring->CopyOutAndRelease(msg.pos, msg.size) : nullptr);
+        bool isIntact = data != nullptr && msg.size == LOOPBACK_SLOT_SIZE;
+        for (uint32_t i = 0; isIntact && i < msg.size; i++) {
+            isIntact = data[i] == round;
+        }
+        round++;
+        uint8_t ack = isIntact ? 1 : 0;
+        free(data);
+        if (write(sock, &ack, sizeof(ack)) != sizeof(ack)) {
+            break;
+        }
+    }
+    _exit(0);
+}
+
+// returns true if every round was written to the ring and acknowledged intact by the consumer
+bool RunLoopbackProducer(int sock)
+{
+    auto ring = RSTransactionRing::Create(RSTransactionRing::MIN_CAPACITY * 16); // 1MB
+    if (ring == nullptr) {
+        return false;
+    }
+    std::vector<uint8_t> payload(LOOPBACK_SLOT_SIZE);
+    bool fdSent = false;
+    for (int32_t i = 0; i < LOOPBACK_ROUNDS; i++) {
+        std::fill(payload.begin(), payload.end(), static_cast<uint8_t>(i));
+        LoopbackMessage msg { LOOPBACK_MODE_RING, 0, static_cast<uint32_t>(payload.size()) };
+        if (!ring->Write(payload.data(), payload.size(), msg.pos)) {
+            return false;
+        }
+        bool sent = SendMessage(sock, msg, fdSent ? -1 : ring->GetFd());
+        fdSent = true;
+        uint8_t ack = 0;
+        if (!sent || read(sock, &ack, sizeof(ack)) != sizeof(ack) || ack != 1) {
+            return false;
+        }
+    }
+    // every slot was released, the ring went round several laps
+    return ring->GetReadPos() == ring->GetWritePos() && ring->GetWritePos() > ring->GetCapacity();
+}
+
+bool RunLoopback()
+{
+    int socks[2] = { -1, -1 };
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, socks) != 0) {
+        return false;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        ::close(socks[0]);
+        RunLoopbackConsumer(socks[1]);
+    }
+    ::close(socks[1]);
+    bool isIntact = pid > 0 && RunLoopbackProducer(socks[0]);
+    LoopbackMessage exitMsg { LOOPBACK_MODE_EXIT, 0, 0 };
+    SendMessage(socks[0], exitMsg, -1);
+    ::close(socks[0]);
+    if (pid > 0) {
+        waitpid(pid, nullptr, 0);
+    }
+    return isIntact;
+}
+}
+
+class RSTransactionRingTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() override;
+    void TearDown() override;
+};
+
+void RSTransactionRingTest::SetUpTestCase() {}
+void RSTransactionRingTest::TearDownTestCase() {}
+void RSTransactionRingTest::SetUp() {}
+void RSTransactionRingTest::TearDown() {}
+
+/**
+ * @tc.name: CreateTest001
+ * @tc.desc: test create ring with valid and invalid capacity
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionRingTest, CreateTest001, TestSize.Level1)
+{
+    EXPECT_EQ(RSTransactionRing::Create(RSTransactionRing::MIN_CAPACITY - 1024), nullptr);
+    EXPECT_EQ(RSTransactionRing::Create(RSTransactionRing::MAX_CAPACITY + 1024), nullptr);
+    auto ring = RSTransactionRing::Create(TEST_CAPACITY);
+    ASSERT_NE(ring, nullptr);
+    EXPECT_GE(ring->GetFd(), 0);
+    EXPECT_EQ(ring->GetCapacity(), TEST_CAPACITY);
+    EXPECT_EQ(ring->GetFreeSize(), TEST_CAPACITY);
+}
+
+/**
+ * @tc.name: WriteAndCopyOutTest001
+ * @tc.desc: test consumer copies out the slot written by producer and releases it
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionRingTest, WriteAndCopyOutTest001, TestSize.Level1)
+{
+    auto producer = RSTransactionRing::Create(TEST_CAPACITY);
+    ASSERT_NE(producer, nullptr);
+    auto consumer = RSTransactionRing::Attach(dup(producer->GetFd()));
+    ASSERT_NE(consumer, nullptr);
+
+    std::vector<uint8_t> payload(1000);
+    for (size_t i = 0; i < payload.size(); i++) {
+        payload[i] = static_cast<uint8_t>(i);
+    }
+    uint64_t pos = 0;
+    ASSERT_TRUE(producer->Write(payload.data(), payload.size(), pos));
+    EXPECT_EQ(pos, 0u);
+    EXPECT_EQ(producer->GetWritePos(), 1000u);
+    EXPECT_EQ(producer->GetFreeSize(), TEST_CAPACITY - 1000);
+
+    void* data = consumer->CopyOutAndRelease(pos, payload.size());
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(memcmp(data, payload.data(), payload.size()), 0);
+    free(data);
+    EXPECT_EQ(producer->GetReadPos(), 1000u);
+    EXPECT_EQ(producer->GetFreeSize(), TEST_CAPACITY);
+
+    // the same slot can not be released twice
+    EXPECT_EQ(consumer->CopyOutAndRelease(pos, payload.size()), nullptr);
+}
+
+/**
+ * @tc.name: WrapTest001
+ * @tc.desc: test slots never cross the ring end and a full ring rejects writes
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionRingTest, WrapTest001, TestSize.Level1)
+{
+    auto producer = RSTransactionRing::Create(TEST_CAPACITY);
+    ASSERT_NE(producer, nullptr);
+    auto consumer = RSTransactionRing::Attach(dup(producer->GetFd()));
+    ASSERT_NE(consumer, nullptr);
+
+    std::vector<uint8_t> payload(20000, 0x5a);
+    uint64_t pos[3] = { 0, 0, 0 };
+    ASSERT_TRUE(producer->Write(payload.data(), payload.size(), pos[0]));
+    ASSERT_TRUE(producer->Write(payload.data(), payload.size(), pos[1]));
+    ASSERT_TRUE(producer->Write(payload.data(), payload.size(), pos[2]));
+    uint64_t fullPos = 0;
+    EXPECT_FALSE(producer->Write(payload.data(), payload.size(), fullPos));
+
+    for (uint64_t slot : pos) {
+        void* data = consumer->CopyOutAndRelease(slot, payload.size());
+        ASSERT_NE(data, nullptr);
+        free(data);
+    }
+    // the tail of the first lap is too short, the next slot starts the second lap
+    uint64_t nextPos = 0;
+    ASSERT_TRUE(producer->Write(payload.data(), payload.size(), nextPos));
+    EXPECT_EQ(nextPos, TEST_CAPACITY);
+    void* data = consumer->CopyOutAndRelease(nextPos, payload.size());
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(memcmp(data, payload.data(), payload.size()), 0);
+    free(data);
+}
+
+/**
+ * @tc.name: CopyOutInvalidSlotTest001
+ * @tc.desc: test consumer rejects slots outside the producible window
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionRingTest, CopyOutInvalidSlotTest001, TestSize.Level1)
+{
+    auto producer = RSTransactionRing::Create(TEST_CAPACITY);
+    ASSERT_NE(producer, nullptr);
+    auto consumer = RSTransactionRing::Attach(dup(producer->GetFd()));
+    ASSERT_NE(consumer, nullptr);
+
+    EXPECT_EQ(consumer->CopyOutAndRelease(0, 0), nullptr);
+    EXPECT_EQ(consumer->CopyOutAndRelease(0, TEST_CAPACITY + 1), nullptr);
+    EXPECT_EQ(consumer->CopyOutAndRelease(TEST_CAPACITY, 16), nullptr);
+    EXPECT_EQ(consumer->CopyOutAndRelease(TEST_CAPACITY - 8, 16), nullptr);
+    EXPECT_EQ(consumer->CopyOutAndRelease(UINT64_MAX - 8, 16), nullptr);
+    EXPECT_EQ(producer->GetReadPos(), 0u);
+}
+
+/**
+ * @tc.name: AttachTest001
+ * @tc.desc: test attach rejects unsealed memfd and invalid header
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionRingTest, AttachTest001, TestSize.Level1)
+{
+    EXPECT_EQ(RSTransactionRing::Attach(-1), nullptr);
+
+    int fd = memfd_create("RSRingTest", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(ftruncate(fd, TEST_CAPACITY * 2), 0);
+    EXPECT_EQ(RSTransactionRing::Attach(fd), nullptr); // not sealed
+
+    fd = memfd_create("RSRingTest", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(ftruncate(fd, TEST_CAPACITY * 2), 0);
+    ASSERT_EQ(fcntl(fd, F_ADD_SEALS, F_SEAL_SEAL | F_SEAL_SHRINK | F_SEAL_GROW), 0);
+    EXPECT_EQ(RSTransactionRing::Attach(fd), nullptr); // sealed but no ring header
+}
+
+/**
+ * @tc.name: AttachParcelTest001
+ * @tc.desc: test the ring is only used after the consumer acknowledges the attach, the attach parcel is
+ *           resent until then
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionRingTest, AttachParcelTest001, TestSize.Level1)
+{
+    auto producer = RSTransactionRing::Create(TEST_CAPACITY);
+    ASSERT_NE(producer, nullptr);
+    EXPECT_FALSE(producer->IsAttached());
+    auto dataParcel = std::make_shared<MessageParcel>();
+    dataParcel->WriteInterfaceToken(RSIClientToRenderConnection::GetDescriptor());
+    dataParcel->WriteInt32(0);
+    // not attached, the transaction keeps the parcel path and no slot is taken
+    EXPECT_EQ(producer->CreateRingParcel(dataParcel), nullptr);
+    EXPECT_EQ(producer->GetWritePos(), 0u);
+
+    // the first attach parcel is lost, the second one is attached
+    auto lostParcel = producer->CreateAttachParcel();
+    ASSERT_NE(lostParcel, nullptr);
+    auto attachParcel = producer->CreateAttachParcel();
+    ASSERT_NE(attachParcel, nullptr);
+    EXPECT_EQ(producer->GetAttachRequestCount(), 2u);
+    ASSERT_EQ(attachParcel->ReadInterfaceToken(), RSIClientToRenderConnection::GetDescriptor());
+    ASSERT_EQ(attachParcel->ReadInt32(), RSTransactionRing::RING_ATTACH_PARCEL_FLAG);
+    std::unique_ptr<RSTransactionRing> consumer;
+    ASSERT_TRUE(RSTransactionRing::AttachFromParcel(attachParcel.get(), consumer));
+    EXPECT_NE(consumer, nullptr);
+    EXPECT_TRUE(producer->IsAttached());
+    EXPECT_NE(producer->CreateRingParcel(dataParcel), nullptr);
+
+    // a parcel without a valid fd does not replace the attached ring
+    MessageParcel invalidParcel;
+    EXPECT_FALSE(RSTransactionRing::AttachFromParcel(&invalidParcel, consumer));
+    EXPECT_NE(consumer, nullptr);
+    EXPECT_FALSE(RSTransactionRing::AttachFromParcel(nullptr, consumer));
+}
+
+/**
+ * @tc.name: RingParcelTest001
+ * @tc.desc: test ring parcel round trip after the attach, ring parcels carry no fd
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionRingTest, RingParcelTest001, TestSize.Level1)
+{
+    auto producer = RSTransactionRing::Create(TEST_CAPACITY);
+    ASSERT_NE(producer, nullptr);
+    std::unique_ptr<RSTransactionRing> consumer;
+    auto attachParcel = producer->CreateAttachParcel();
+    ASSERT_NE(attachParcel, nullptr);
+    attachParcel->ReadInterfaceToken();
+    attachParcel->ReadInt32();
+    ASSERT_TRUE(RSTransactionRing::AttachFromParcel(attachParcel.get(), consumer));
+    for (int i = 0; i < 2; i++) {
+        auto dataParcel = std::make_shared<MessageParcel>();
+        dataParcel->WriteInterfaceToken(RSIClientToRenderConnection::GetDescriptor());
+        dataParcel->WriteInt32(0);
+        dataParcel->WriteInt32(i);
+        auto ringParcel = producer->CreateRingParcel(dataParcel);
+        ASSERT_NE(ringParcel, nullptr);
+        EXPECT_EQ(ringParcel->GetOffsetsSize(), 0u);
+        ASSERT_EQ(ringParcel->ReadInterfaceToken(), RSIClientToRenderConnection::GetDescriptor());
+        ASSERT_EQ(ringParcel->ReadInt32(), RSTransactionRing::RING_PARCEL_FLAG);
+
+        std::shared_ptr<AshmemFlowControlUnit> flowControlUnit;
+        auto parsedParcel = RSTransactionRing::ParseFromRingParcel(ringParcel.get(), consumer, flowControlUnit,
+            getpid());
+        ASSERT_NE(parsedParcel, nullptr);
+        EXPECT_EQ(parsedParcel->ReadInt32(), i);
+    }
+    EXPECT_EQ(producer->GetReadPos(), producer->GetWritePos());
+
+    // a slot without an attached ring is rejected
+    std::unique_ptr<RSTransactionRing> emptyRing;
+    auto dataParcel = std::make_shared<MessageParcel>();
+    dataParcel->WriteInterfaceToken(RSIClientToRenderConnection::GetDescriptor());
+    dataParcel->WriteInt32(0);
+    auto ringParcel = producer->CreateRingParcel(dataParcel);
+    ASSERT_NE(ringParcel, nullptr);
+    ringParcel->ReadInterfaceToken();
+    ringParcel->ReadInt32();
+    std::shared_ptr<AshmemFlowControlUnit> flowControlUnit;
+    EXPECT_EQ(RSTransactionRing::ParseFromRingParcel(ringParcel.get(), emptyRing, flowControlUnit, getpid()),
+        nullptr);
+}
+
+/**
+ * @tc.name: LoopbackPerfTest
+ * @tc.desc: test that transactions over the ashmem threshold go through the ring intact for several laps, with
+ *           producer and consumer in two processes connected by a socketpair
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionRingTest, LoopbackPerfTest, TestSize.Level3)
+{
+    EXPECT_TRUE(RunLoopback());
+}
+} // namespace Rosen
+} // namespace OHOS
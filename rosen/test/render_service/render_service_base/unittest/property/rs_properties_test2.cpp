@@ -581,13 +581,13 @@ HWTEST_F(PropertiesTest, GetFgBrightnessDescriptionTest, TestSize.Level1)
 HWTEST_F(PropertiesTest, GetBgBrightnessDescriptionTest, TestSize.Level1)
 {
     RSProperties properties;
-    properties.bgBrightnessParams_ = std::nullopt;
+    properties.SetBgBrightnessParams(std::nullopt);
     properties.GetBgBrightnessDescription();
 
     RSDynamicBrightnessPara value;
-    properties.bgBrightnessParams_ = value;
+    properties.SetBgBrightnessParams(value);
     properties.GetBgBrightnessDescription();
-    EXPECT_TRUE(properties.bgBrightnessParams_ != std::nullopt);
+    EXPECT_TRUE(properties.GetBgBrightnessParams() != std::nullopt);
 }
 
 /**
@@ -1557,7 +1557,7 @@ HWTEST_F(PropertiesTest, SetGravityHotZoneTest001, TestSize.Level1)
 {
     RSProperties properties;
     properties.SetGravityHotZone(0.5f);
-    EXPECT_FLOAT_EQ(properties.gravityHotZone_, 0.5f);
+    EXPECT_FLOAT_EQ(properties.GetGravityHotZone(), 0.5f);
     EXPECT_TRUE(properties.isDrawn_);
     EXPECT_TRUE(properties.filterNeedUpdate_);
     EXPECT_TRUE(properties.isDirty_);
@@ -2054,7 +2054,7 @@ HWTEST_F(PropertiesTest, SetParticleRippleFieldsWithAnimation001, TestSize.Level
     renderNode->GetMutableRenderProperties().backref_ = renderNode;
     auto rippleFields = std::make_shared<ParticleRippleFields>();
     renderNode->GetMutableRenderProperties().SetParticleRippleFields(rippleFields);
-    EXPECT_EQ(renderNode->GetRenderProperties().particleRippleFields_, rippleFields);
+    EXPECT_EQ(renderNode->GetRenderProperties().GetParticleRippleFields(), rippleFields);
 }
 
 /**
@@ -2078,7 +2078,7 @@ HWTEST_F(PropertiesTest, SetParticleVelocityFieldsWithAnimation001, TestSize.Lev
     renderNode->GetMutableRenderProperties().backref_ = renderNode;
     auto velocityFields = std::make_shared<ParticleVelocityFields>();
     renderNode->GetMutableRenderProperties().SetParticleVelocityFields(velocityFields);
-    EXPECT_EQ(renderNode->GetRenderProperties().particleVelocityFields_, velocityFields);
+    EXPECT_EQ(renderNode->GetRenderProperties().GetParticleVelocityFields(), velocityFields);
 }
 
 /**
@@ -2147,7 +2147,7 @@ HWTEST_F(PropertiesTest, SetParticleRippleFieldsNullBackref001, TestSize.Level1)
     RSProperties properties;
     auto rippleFields = std::make_shared<ParticleRippleFields>();
     properties.SetParticleRippleFields(rippleFields);
-    EXPECT_EQ(properties.particleRippleFields_, rippleFields);
+    EXPECT_EQ(properties.GetParticleRippleFields(), rippleFields);
 }
 
 /**
@@ -2161,7 +2161,7 @@ HWTEST_F(PropertiesTest, SetParticleVelocityFieldsNullBackref001, TestSize.Level
     RSProperties properties;
     auto velocityFields = std::make_shared<ParticleVelocityFields>();
     properties.SetParticleVelocityFields(velocityFields);
-    EXPECT_EQ(properties.particleVelocityFields_, velocityFields);
+    EXPECT_EQ(properties.GetParticleVelocityFields(), velocityFields);
 }
 
 /**
@@ -2201,7 +2201,7 @@ HWTEST_F(PropertiesTest, SetParticleRippleFieldsNullPara001, TestSize.Level1)
 {
     RSProperties properties;
     properties.SetParticleRippleFields(nullptr);
-    EXPECT_EQ(properties.particleRippleFields_, nullptr);
+    EXPECT_EQ(properties.GetParticleRippleFields(), nullptr);
 }
 
 /**
@@ -2214,7 +2214,7 @@ HWTEST_F(PropertiesTest, SetParticleVelocityFieldsNullPara001, TestSize.Level1)
 {
     RSProperties properties;
     properties.SetParticleVelocityFields(nullptr);
-    EXPECT_EQ(properties.particleVelocityFields_, nullptr);
+    EXPECT_EQ(properties.GetParticleVelocityFields(), nullptr);
 }
 
 /**
@@ -4487,5 +4487,56 @@ HWTEST_F(PropertiesTest, SetGeoDirtyTest002, TestSize.Level1)
     properties.SetGeoDirty();
     EXPECT_TRUE(properties.IsGeoDirty());
 }
+
+/**
+ * @tc.name: ColdEffectStorageTest
+ * @tc.desc: test that common node properties do not allocate the effect params, and rarely used ones do
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PropertiesTest, ColdEffectStorageTest, TestSize.Level1)
+{
+    RSProperties properties;
+    properties.SetBounds({ 0.f, 0.f, 100.f, 100.f });
+    properties.SetFrame({ 0.f, 0.f, 100.f, 100.f });
+    properties.SetAlpha(0.5f);
+    properties.SetSublayerTransform(std::nullopt);
+    properties.SetBgBrightnessParams(std::nullopt);
+    properties.SetParticleRippleFields(nullptr);
+    EXPECT_EQ(properties.effect_, nullptr);
+    EXPECT_EQ(properties.GetColorPicker(), nullptr);
+    EXPECT_EQ(properties.GetSublayerTransform(), std::nullopt);
+    EXPECT_FLOAT_EQ(properties.GetGravityPullStrength(), 0.0f);
+
+    properties.SetGravityPullStrength(0.5f);
+    ASSERT_NE(properties.effect_, nullptr);
+    EXPECT_FLOAT_EQ(properties.GetGravityPullStrength(), 0.5f);
+    Matrix3f matrix;
+    properties.SetSublayerTransform(matrix);
+    EXPECT_TRUE(properties.GetSublayerTransform().has_value());
+    properties.SetSublayerTransform(std::nullopt);
+    EXPECT_EQ(properties.GetSublayerTransform(), std::nullopt);
+}
+
+/**
+ * @tc.name: PropertiesMemoryTest
+ * @tc.desc: test the rarely used effect state is kept in the lazily allocated effect params, so plain nodes are
+ *           smaller than before the split
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(PropertiesTest, PropertiesMemoryTest, TestSize.Level1)
+{
+    // sizeof(RSProperties) on 64-bit targets before particle fields, brightness, gravity pull, sublayer transform
+    // and color picker state moved into CommonEffectParams
+    constexpr size_t sizeBeforeSplit = 584;
+    EXPECT_LT(sizeof(RSProperties), sizeBeforeSplit);
+
+    // reading the moved state of a plain node does not allocate the effect params
+    RSProperties properties;
+    EXPECT_FALSE(properties.GetSublayerTransform().has_value());
+    EXPECT_EQ(properties.GetColorPicker(), nullptr);
+    EXPECT_EQ(properties.effect_, nullptr);
+}
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -13,13 +13,64 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+
 #include "gtest/gtest.h"
 #include "include/render/rs_color_extract.h"
+#include "include/render/rs_color_extract_kernel.h"
 
 using namespace testing;
 using namespace testing::ext;
 
 namespace OHOS::Rosen {
+namespace {
+constexpr uint32_t IMAGE_4K_WIDTH = 3840;
+constexpr uint32_t IMAGE_4K_HEIGHT = 2160;
+constexpr uint32_t ODD_PIXEL_NUM = 1027; // not a multiple of the simd lanes
+
+struct ScalarColorStats {
+    std::vector<uint32_t> hist = std::vector<uint32_t>(RSColorExtractKernel::QUANTIZED_HIST_LEN, 0);
+    uint32_t grayMsd = 0;
+    float luminanceSum = 0.0f;
+};
+
+std::vector<uint32_t> MakeRandomColors(uint32_t num)
+{
+    std::mt19937 random(num);
+    std::vector<uint32_t> colors(num);
+    for (auto& color : colors) {
+        color = random();
+    }
+    return colors;
+}
+
+// the separate per-pixel passes the kernel replaces
+ScalarColorStats CalcScalarColorStats(const std::vector<uint32_t>& colors)
+{
+    ScalarColorStats stats;
+    auto num = static_cast<uint32_t>(colors.size());
+    long long int graySum = 0;
+    for (auto color : colors) {
+        graySum += RSColorExtract::Rgb2Gray(color);
+    }
+    uint32_t grayAve = graySum / num;
+    long long int grayVar = 0;
+    for (auto color : colors) {
+        grayVar += pow(static_cast<long long int>(RSColorExtract::Rgb2Gray(color)) - grayAve, 2); // 2 is square
+    }
+    stats.grayMsd = static_cast<uint32_t>(grayVar / num);
+    for (auto color : colors) {
+        stats.luminanceSum += RSColorExtract::CalcRelativeLum(color);
+    }
+    for (auto color : colors) {
+        stats.hist[RSColorExtract::QuantizeFromRGB888(color)]++;
+    }
+    return stats;
+}
+} // namespace
+
 class RSColorExtractTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -345,4 +396,71 @@ HWTEST_F(RSColorExtractTest, GetNFeatureColorsTest, TestSize.Level1)
     EXPECT_NE(extract2->colorValLen_, 0);
 }
 
-} // namespace OHOS::Rosen
\ No newline at end of file
+/**
+ * @tc.name: ColorStatsKernelTest
+ * @tc.desc: Verify the fused kernel pass is bit exact with the per-pixel scalar gray, luminance and histogram
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSColorExtractTest, ColorStatsKernelTest, TestSize.Level1)
+{
+    auto colors = MakeRandomColors(ODD_PIXEL_NUM);
+    auto expected = CalcScalarColorStats(colors);
+
+    float normalizeTable[RSColorExtractKernel::CHANNEL_LEVEL_NUM];
+    for (uint32_t level = 0; level < RSColorExtractKernel::CHANNEL_LEVEL_NUM; level++) {
+        normalizeTable[level] = RSColorExtract::NormalizeRgb(level);
+    }
+    std::vector<uint32_t> hist(RSColorExtractKernel::QUANTIZED_HIST_LEN, 0);
+    RSColorExtractKernel::ColorStats stats;
+    RSColorExtractKernel::AccumulateARGB32(colors.data(), ODD_PIXEL_NUM, hist.data(), &stats, normalizeTable);
+    EXPECT_EQ(RSColorExtractKernel::CalcGrayMsd(stats.grayHist, ODD_PIXEL_NUM), expected.grayMsd);
+    EXPECT_EQ(stats.luminanceSum, expected.luminanceSum);
+    EXPECT_EQ(hist, expected.hist);
+
+    extract->colorValLen_ = ODD_PIXEL_NUM;
+    extract->colorVal_ = std::shared_ptr<uint32_t>(colors.data(), [](uint32_t*) {});
+    EXPECT_EQ(extract->CalcGrayMsd(), expected.grayMsd);
+    EXPECT_EQ(extract->CalcContrastToWhite(),
+        RSColorExtractKernel::CalcContrastToWhite(expected.luminanceSum, ODD_PIXEL_NUM));
+    extract->GetNFeatureColors(extract->specifiedFeatureColorNum_);
+    EXPECT_EQ(std::vector<uint32_t>(extract->hist_.get(), extract->hist_.get() + hist.size()), expected.hist);
+    extract->colorVal_ = nullptr;
+    extract->colorValLen_ = 0;
+}
+
+/**
+ * @tc.name: ColorStatsKernelPerfTest
+ * @tc.desc: Verify the fused kernel pass over a 4K image matches the per-pixel scalar passes, counts every pixel once
+ *           and gives the same histograms when the gray stats or the luminance are skipped
+ * @tc.type:PERF
+ * @tc.require:
+ */
+HWTEST_F(RSColorExtractTest, ColorStatsKernelPerfTest, TestSize.Level2)
+{
+    constexpr uint32_t pixelNum = IMAGE_4K_WIDTH * IMAGE_4K_HEIGHT;
+    auto colors = MakeRandomColors(pixelNum);
+    auto expected = CalcScalarColorStats(colors);
+
+    float normalizeTable[RSColorExtractKernel::CHANNEL_LEVEL_NUM];
+    for (uint32_t level = 0; level < RSColorExtractKernel::CHANNEL_LEVEL_NUM; level++) {
+        normalizeTable[level] = RSColorExtract::NormalizeRgb(level);
+    }
+    std::vector<uint32_t> hist(RSColorExtractKernel::QUANTIZED_HIST_LEN, 0);
+    RSColorExtractKernel::ColorStats stats;
+    RSColorExtractKernel::AccumulateARGB32(colors.data(), pixelNum, hist.data(), &stats, normalizeTable);
+    EXPECT_EQ(RSColorExtractKernel::CalcGrayMsd(stats.grayHist, pixelNum), expected.grayMsd);
+    EXPECT_EQ(stats.luminanceSum, expected.luminanceSum);
+    EXPECT_EQ(hist, expected.hist);
+    EXPECT_EQ(std::accumulate(hist.begin(), hist.end(), 0ull), pixelNum);
+    EXPECT_EQ(std::accumulate(std::begin(stats.grayHist), std::end(stats.grayHist), 0ull), pixelNum);
+
+    std::vector<uint32_t> histOnly(RSColorExtractKernel::QUANTIZED_HIST_LEN, 0);
+    RSColorExtractKernel::AccumulateARGB32(colors.data(), pixelNum, histOnly.data(), nullptr);
+    EXPECT_EQ(histOnly, expected.hist);
+    RSColorExtractKernel::ColorStats grayOnly;
+    RSColorExtractKernel::AccumulateARGB32(colors.data(), pixelNum, nullptr, &grayOnly);
+    EXPECT_TRUE(std::equal(std::begin(grayOnly.grayHist), std::end(grayOnly.grayHist), std::begin(stats.grayHist)));
+    EXPECT_EQ(grayOnly.luminanceSum, 0.0f);
+}
+} // namespace OHOS::Rosen
@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <future>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "draw/canvas.h"
+#include "draw/surface.h"
+#include "effect/image_filter.h"
+#include "image/bitmap.h"
+#include "render/rs_filter_result_cache.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Rosen {
+namespace {
+constexpr int32_t IMAGE_SIDE = 64;
+constexpr size_t IMAGE_BYTES = IMAGE_SIDE * IMAGE_SIDE * 4; // 4: bytes per RGBA 8888 pixel
+constexpr uint32_t FILTER_HASH = 0x1234;
+constexpr int32_t PERF_IMAGE_SIDE = 512;
+constexpr int32_t PERF_NODE_COUNT = 20;
+constexpr float PERF_BLUR_SIGMA = 20.0f;
+
+std::shared_ptr<Drawing::Image> MakeImage(int32_t width, int32_t height, Drawing::ColorQuad color)
+{
+    Drawing::Bitmap bitmap;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    bitmap.Build(width, height, format);
+    bitmap.ClearWithColor(color);
+    auto image = std::make_shared<Drawing::Image>();
+    image->BuildFromBitmap(bitmap);
+    return image;
+}
+
+RSFilterResultCache::Key MakeTestKey(uint32_t filterHash, const std::shared_ptr<Drawing::Image>& input,
+    uint64_t contextId = 0)
+{
+    RSFilterResultCache::Key key;
+    EXPECT_TRUE(RSFilterResultCache::MakeKey(filterHash, input,
+        Drawing::RectI(0, 0, input->GetWidth(), input->GetHeight()), contextId, key));
+    return key;
+}
+
+std::shared_ptr<Drawing::Image> BlurOnRaster(const std::shared_ptr<Drawing::Image>& input)
+{
+    auto surface = Drawing::Surface::MakeRasterN32Premul(input->GetWidth(), input->GetHeight());
+    if (surface == nullptr) {
+        return nullptr;
+    }
+    auto canvas = surface->GetCanvas();
+    Drawing::Brush brush;
+    Drawing::Filter filter;
+    filter.SetImageFilter(Drawing::ImageFilter::CreateBlurImageFilter(PERF_BLUR_SIGMA, PERF_BLUR_SIGMA,
+        Drawing::TileMode::CLAMP, nullptr));
+    brush.SetFilter(filter);
+    canvas->AttachBrush(brush);
+    canvas->DrawImage(*input, 0, 0, Drawing::SamplingOptions());
+    canvas->DetachBrush();
+    return surface->GetImageSnapshot();
+}
+} // namespace
+
+class RSFilterResultCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        auto& cache = RSFilterResultCache::Instance();
+        originBudget_ = cache.GetByteBudget();
+        cache.SetByteBudget(0);
+        cache.hitCount_ = 0;
+        cache.missCount_ = 0;
+        cache.evictCount_ = 0;
+    }
+    void TearDown() override
+    {
+        RSFilterResultCache::Instance().SetByteBudget(originBudget_);
+    }
+
+private:
+    size_t originBudget_ = 0;
+};
+
+/**
+ * @tc.name: MakeKeyTest
+ * @tc.desc: test that equal content makes equal keys and a different filter, content or size does not
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSFilterResultCacheTest, MakeKeyTest, TestSize.Level1)
+{
+    RSFilterResultCache::Key key;
+    EXPECT_FALSE(RSFilterResultCache::MakeKey(FILTER_HASH, nullptr, Drawing::RectI(), 0, key));
+
+    auto red = MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_RED);
+    auto sameRed = MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_RED);
+    auto blue = MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_BLUE);
+    auto redKey = MakeTestKey(FILTER_HASH, red);
+    EXPECT_EQ(redKey, MakeTestKey(FILTER_HASH, sameRed));
+    EXPECT_FALSE(redKey == MakeTestKey(FILTER_HASH, blue));
+    EXPECT_FALSE(redKey == MakeTestKey(FILTER_HASH + 1, red));
+
+    RSFilterResultCache::Key scaledKey;
+    ASSERT_TRUE(RSFilterResultCache::MakeKey(FILTER_HASH, red, Drawing::RectI(0, 0, IMAGE_SIDE * 2, IMAGE_SIDE),
+        0, scaledKey));
+    EXPECT_EQ(scaledKey.contentHash, redKey.contentHash);
+    EXPECT_FALSE(redKey == scaledKey);
+}
+
+/**
+ * @tc.name: GetAndPutTest
+ * @tc.desc: test that a result put for one node is found for another node with the same input
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSFilterResultCacheTest, GetAndPutTest, TestSize.Level1)
+{
+    auto& cache = RSFilterResultCache::Instance();
+    auto input = MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_RED);
+    auto result = MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_GREEN);
+    auto key = MakeTestKey(FILTER_HASH, input);
+
+    // disabled by a zero budget
+    EXPECT_FALSE(cache.IsEnabled());
+    cache.Put(key, result);
+    EXPECT_EQ(cache.GetEntryCount(), 0);
+
+    cache.SetByteBudget(IMAGE_BYTES * 4); // 4: room for four results
+    EXPECT_TRUE(cache.IsEnabled());
+    EXPECT_EQ(cache.Get(key), nullptr);
+    cache.Put(key, result);
+    auto otherNodeKey = MakeTestKey(FILTER_HASH, MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_RED));
+    EXPECT_EQ(cache.Get(otherNodeKey), result);
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+    EXPECT_EQ(cache.GetCachedBytes(), IMAGE_BYTES);
+    EXPECT_EQ(cache.hitCount_, 1);
+    EXPECT_EQ(cache.missCount_, 1);
+
+    // putting the same key again replaces the result
+    auto newResult = MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_BLUE);
+    cache.Put(key, newResult);
+    EXPECT_EQ(cache.Get(key), newResult);
+    EXPECT_EQ(cache.GetCachedBytes(), IMAGE_BYTES);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetEntryCount(), 0);
+    EXPECT_EQ(cache.GetCachedBytes(), 0);
+}
+
+/**
+ * @tc.name: EvictTest
+ * @tc.desc: test that the least recently used results are evicted to stay in the byte budget
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSFilterResultCacheTest, EvictTest, TestSize.Level1)
+{
+    auto& cache = RSFilterResultCache::Instance();
+    cache.SetByteBudget(IMAGE_BYTES * 2); // 2: room for two results
+    auto input = MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_RED);
+    auto result = MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_GREEN);
+    auto key1 = MakeTestKey(FILTER_HASH, input);
+    auto key2 = MakeTestKey(FILTER_HASH + 1, input);
+    auto key3 = MakeTestKey(FILTER_HASH + 2, input);
+    cache.Put(key1, result);
+    cache.Put(key2, result);
+    // touch key1, so key2 is the least recently used one
+    EXPECT_NE(cache.Get(key1), nullptr);
+    cache.Put(key3, result);
+    EXPECT_EQ(cache.GetEntryCount(), 2);
+    EXPECT_EQ(cache.evictCount_, 1);
+    EXPECT_NE(cache.Get(key1), nullptr);
+    EXPECT_EQ(cache.Get(key2), nullptr);
+    EXPECT_NE(cache.Get(key3), nullptr);
+
+    // a result larger than the budget is not cached and keeps the others
+    cache.Put(key2, MakeImage(IMAGE_SIDE * 2, IMAGE_SIDE * 2, Drawing::Color::COLOR_GREEN));
+    EXPECT_EQ(cache.Get(key2), nullptr);
+    EXPECT_EQ(cache.GetEntryCount(), 2);
+
+    cache.SetByteBudget(IMAGE_BYTES);
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+    EXPECT_NE(cache.Get(key3), nullptr);
+    cache.SetByteBudget(0);
+    EXPECT_EQ(cache.GetEntryCount(), 0);
+    EXPECT_EQ(cache.GetCachedBytes(), 0);
+}
+
+/**
+ * @tc.name: ContextPartitionTest
+ * @tc.desc: test that each gpu context has its own budget and clearing a context keeps the results of the others
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSFilterResultCacheTest, ContextPartitionTest, TestSize.Level1)
+{
+    constexpr uint64_t otherContextId = 1;
+    auto& cache = RSFilterResultCache::Instance();
+    cache.SetByteBudget(IMAGE_BYTES);
+    auto input = MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_RED);
+    auto result = MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_GREEN);
+    auto key = MakeTestKey(FILTER_HASH, input);
+    auto otherKey = MakeTestKey(FILTER_HASH, input, otherContextId);
+    EXPECT_EQ(RSFilterResultCache::GetContextId(nullptr), 0);
+
+    // a full context does not evict the results of another one
+    cache.Put(key, result);
+    cache.Put(otherKey, result);
+    EXPECT_EQ(cache.GetEntryCount(), 2);
+    EXPECT_EQ(cache.evictCount_, 0);
+    EXPECT_EQ(cache.Get(key), result);
+    EXPECT_EQ(cache.Get(otherKey), result);
+
+    cache.ClearContext(otherContextId);
+    EXPECT_EQ(cache.Get(otherKey), nullptr);
+    EXPECT_EQ(cache.Get(key), result);
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+    EXPECT_EQ(cache.partitions_.count(otherContextId), 0);
+    cache.ClearContext(otherContextId);
+}
+
+/**
+ * @tc.name: OwnerThreadTest
+ * @tc.desc: test that only the thread owning a context gets or releases its results, a clear from another thread
+ *           is applied by the owner on its next access
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSFilterResultCacheTest, OwnerThreadTest, TestSize.Level1)
+{
+    constexpr uint64_t contextId = 2;
+    auto& cache = RSFilterResultCache::Instance();
+    cache.SetByteBudget(IMAGE_BYTES * 2); // 2: room for two results
+    auto input = MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_RED);
+    auto result = MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_GREEN);
+    auto key = MakeTestKey(FILTER_HASH, input, contextId);
+
+    std::promise<void> putDone;
+    std::promise<void> clearDone;
+    std::promise<size_t> ownerEntryCount;
+    std::thread owner([&]() {
+        cache.Put(key, result);
+        EXPECT_EQ(cache.Get(key), result);
+        putDone.set_value();
+        clearDone.get_future().wait();
+        // the clear requested by the other thread is applied here
+        EXPECT_EQ(cache.Get(key), nullptr);
+        ownerEntryCount.set_value(cache.GetEntryCount());
+        cache.ClearContext(contextId);
+    });
+    putDone.get_future().wait();
+    // the results of another thread's context are neither returned nor released here
+    EXPECT_EQ(cache.Get(key), nullptr);
+    cache.Put(key, result);
+    cache.ClearContext(contextId);
+    cache.Clear();
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+    EXPECT_TRUE(cache.partitions_[contextId].needClear);
+    clearDone.set_value();
+    EXPECT_EQ(ownerEntryCount.get_future().get(), 0);
+    owner.join();
+    EXPECT_EQ(cache.partitions_.count(contextId), 0);
+}
+
+/**
+ * @tc.name: DumpTest
+ * @tc.desc: test that the dump reports the hit rate
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSFilterResultCacheTest, DumpTest, TestSize.Level1)
+{
+    auto& cache = RSFilterResultCache::Instance();
+    cache.SetByteBudget(IMAGE_BYTES);
+    auto key = MakeTestKey(FILTER_HASH, MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_RED));
+    EXPECT_EQ(cache.Get(key), nullptr);
+    cache.Put(key, MakeImage(IMAGE_SIDE, IMAGE_SIDE, Drawing::Color::COLOR_GREEN));
+    EXPECT_NE(cache.Get(key), nullptr);
+    std::string dumpString;
+    cache.Dump(dumpString);
+    EXPECT_NE(dumpString.find("hit 1, miss 1, hit rate 50"), std::string::npos);
+    EXPECT_NE(dumpString.find("1 entries"), std::string::npos);
+}
+
+/**
+ * @tc.name: SharedResultPerfTest
+ * @tc.desc: test that nodes blurring the same content on the raster backend blur it once and share the cached result
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(RSFilterResultCacheTest, SharedResultPerfTest, TestSize.Level2)
+{
+    auto& cache = RSFilterResultCache::Instance();
+    auto input = MakeImage(PERF_IMAGE_SIDE, PERF_IMAGE_SIDE, Drawing::Color::COLOR_RED);
+    cache.SetByteBudget(static_cast<size_t>(PERF_IMAGE_SIDE) * PERF_IMAGE_SIDE * 4); // 4: bytes per pixel
+    int32_t blurCount = 0;
+    std::shared_ptr<Drawing::Image> firstResult;
+    for (int32_t node = 0; node < PERF_NODE_COUNT; node++) {
+        auto key = MakeTestKey(FILTER_HASH, input);
+        auto result = cache.Get(key);
+        if (result == nullptr) {
+            result = BlurOnRaster(input);
+            ASSERT_NE(result, nullptr);
+            cache.Put(key, result);
+            blurCount++;
+        }
+        if (firstResult == nullptr) {
+            firstResult = result;
+        }
+        EXPECT_EQ(result, firstResult);
+    }
+    EXPECT_EQ(blurCount, 1);
+    EXPECT_EQ(cache.hitCount_, PERF_NODE_COUNT - 1);
+    EXPECT_EQ(cache.missCount_, 1);
+    EXPECT_EQ(cache.evictCount_, 0);
+}
+} // namespace OHOS::Rosen
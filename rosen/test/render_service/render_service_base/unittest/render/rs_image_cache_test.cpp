@@ -972,9 +972,11 @@ HWTEST_F(RSImageCacheTest, ReleasePixelMapCacheTest011, TestSize.Level1)
     imageCache.pixelMapCache_.emplace(1, std::make_pair(pixelMap, 2));
     pixelMap->allocatorType_ = Media::AllocatorType::DMA_ALLOC;
     imageCache.ReleasePixelMapCache(1);
-    auto it = imageCache.pixelMapCache_.find(1);
-    EXPECT_TRUE(it != imageCache.pixelMapCache_.end());
-    EXPECT_EQ(it->second.second, 1u);
+    imageCache.pixelMapCache_.Visit(1, [](auto& map) {
+        auto it = map.find(1);
+        EXPECT_TRUE(it != map.end());
+        EXPECT_EQ(it->second.second, 1u);
+    });
 }
 
 #ifdef RS_ENABLE_IMAGE_DETAIL_ENHANCER
@@ -1108,4 +1110,114 @@ HWTEST_F(RSImageCacheTest, IsCacheAccessAllowedTest, TestSize.Level1)
     EXPECT_TRUE(RSImageCache::IsCacheAccessAllowed(uniqueId, 0));
     RSMarshallingHelper::SetCallingPid(originPid);
 }
+
+/**
+ * @tc.name: ShardedMapTest
+ * @tc.desc: Verify the std-like helpers of RSImageCacheShardedMap work across shards
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSImageCacheTest, ShardedMapTest, TestSize.Level1)
+{
+    constexpr uint64_t idCount = 100;
+    constexpr pid_t pid = 1000;
+    RSImageCacheShardedMap<int> map;
+    EXPECT_TRUE(map.empty());
+    for (uint64_t i = 0; i < idCount; i++) {
+        EXPECT_TRUE(map.emplace((static_cast<uint64_t>(pid) << 32) | i, static_cast<int>(i)));
+    }
+    EXPECT_FALSE(map.emplace(static_cast<uint64_t>(pid) << 32, 1));
+    EXPECT_EQ(map.size(), idCount);
+    int value = map.Visit((static_cast<uint64_t>(pid) << 32) | 7, [pid](auto& shard) {
+        return shard.at((static_cast<uint64_t>(pid) << 32) | 7);
+    });
+    EXPECT_EQ(value, 7);
+    EXPECT_EQ(map.erase(static_cast<uint64_t>(pid) << 32), 1u);
+    EXPECT_EQ(map.size(), idCount - 1);
+    map.clear();
+    EXPECT_TRUE(map.empty());
+}
+
+/**
+ * @tc.name: ReleasedImageLruTest001
+ * @tc.desc: Verify a released drawing image is dropped when the released budget is 0
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSImageCacheTest, ReleasedImageLruTest001, TestSize.Level1)
+{
+    RSImageCache imageCache;
+    auto img = std::make_shared<Drawing::Image>();
+    imageCache.CacheDrawingImage(1, img);
+    imageCache.IncreaseDrawingImageCacheRefCount(1);
+    EXPECT_EQ(imageCache.GetDrawingImageCache(1), img);
+    imageCache.ReleaseDrawingImageCache(1);
+    EXPECT_EQ(imageCache.GetDrawingImageCache(1), nullptr);
+    EXPECT_TRUE(imageCache.releasedImageLru_.empty());
+    EXPECT_EQ(imageCache.drawingImageHitCount_.load(), 1u);
+    EXPECT_EQ(imageCache.drawingImageMissCount_.load(), 1u);
+}
+
+/**
+ * @tc.name: ReleasedImageLruTest002
+ * @tc.desc: Verify a released drawing image is revived from the LRU tier and evicted over budget
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSImageCacheTest, ReleasedImageLruTest002, TestSize.Level1)
+{
+    constexpr size_t budget = 1024;
+    RSImageCache imageCache;
+    imageCache.SetReleasedImageBudget(budget);
+    auto img = std::make_shared<Drawing::Image>();
+    imageCache.CacheDrawingImage(1, img);
+    imageCache.IncreaseDrawingImageCacheRefCount(1);
+    imageCache.ReleaseDrawingImageCache(1);
+    EXPECT_TRUE(imageCache.drawingImageCache_.empty());
+    ASSERT_EQ(imageCache.releasedImageLru_.size(), 1u);
+
+    // revived with ref count 0 and removed from the LRU tier
+    EXPECT_EQ(imageCache.GetDrawingImageCache(1), img);
+    EXPECT_TRUE(imageCache.releasedImageLru_.empty());
+    EXPECT_EQ(imageCache.drawingImageCache_.size(), 1u);
+    EXPECT_EQ(imageCache.releasedImageHitCount_.load(), 1u);
+
+    imageCache.ReleaseDrawingImageCache(1);
+    imageCache.CacheDrawingImage(2, std::make_shared<Drawing::Image>());
+    imageCache.ReleaseDrawingImageCache(2);
+    EXPECT_EQ(imageCache.releasedImageLru_.size(), 2u);
+    EXPECT_EQ(imageCache.releasedImageLru_.front().uniqueId, 2u);
+    imageCache.releasedImageLru_.back().bytes = budget + 1;
+    imageCache.releasedImageBytes_ += budget + 1;
+    imageCache.SetReleasedImageBudget(budget);
+    ASSERT_EQ(imageCache.releasedImageLru_.size(), 1u);
+    EXPECT_EQ(imageCache.releasedImageLru_.front().uniqueId, 2u);
+    EXPECT_EQ(imageCache.releasedImageEvictionCount_.load(), 1u);
+
+    imageCache.PurgeReleasedDrawingImages();
+    EXPECT_TRUE(imageCache.releasedImageLru_.empty());
+    EXPECT_TRUE(imageCache.releasedImageIndex_.empty());
+    EXPECT_EQ(imageCache.releasedImageBytes_, 0u);
+    EXPECT_EQ(imageCache.GetDrawingImageCache(2), nullptr);
+}
+
+/**
+ * @tc.name: ReleasedImageLruTest003
+ * @tc.desc: Verify caching an id again drops its released copy and Dump reports the counters
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSImageCacheTest, ReleasedImageLruTest003, TestSize.Level1)
+{
+    RSImageCache imageCache;
+    imageCache.SetReleasedImageBudget(1024);
+    imageCache.CacheDrawingImage(1, std::make_shared<Drawing::Image>());
+    imageCache.ReleaseDrawingImageCache(1);
+    EXPECT_EQ(imageCache.releasedImageLru_.size(), 1u);
+    auto img = std::make_shared<Drawing::Image>();
+    imageCache.CacheDrawingImage(1, img);
+    EXPECT_TRUE(imageCache.releasedImageLru_.empty());
+    EXPECT_EQ(imageCache.GetDrawingImageCache(1), img);
+
+    DfxString log;
+    imageCache.Dump(log);
+    EXPECT_NE(log.GetString().find("RSImageCache Dump"), std::string::npos);
+    EXPECT_NE(log.GetString().find("1 hit"), std::string::npos);
+}
 } // namespace OHOS::Rosen
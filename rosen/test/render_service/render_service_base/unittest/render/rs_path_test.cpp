@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <cmath>
+
 #include "gtest/gtest.h"
 
 #include "draw/path.h"
@@ -47,6 +49,19 @@ static Drawing::Path CreateDrawingPath()
     return path;
 }
 
+// several contours of lines, quads, cubics and arcs like the motion paths of the apps
+static const std::string MULTI_CONTOUR_SVG_PATH =
+    "M 20 20 C 120 -60 260 200 360 40 Q 420 -40 520 60 A 80 60 0 0 1 600 240 L 420 300 C 300 380 120 180 20 320 Z "
+    "M 700 20 L 900 20 Q 1000 120 900 220 C 820 300 760 140 700 220 Z "
+    "M 40 600 A 200 200 0 1 0 440 600 A 200 200 0 1 0 40 600 Z";
+
+static float DegreesDiff(float lhs, float rhs)
+{
+    constexpr float fullCircle = 360.0f;
+    float diff = std::fmod(std::fabs(lhs - rhs), fullCircle);
+    return std::min(diff, fullCircle - diff);
+}
+
 /**
  * @tc.name: CreateRSPathTest
  * @tc.desc:
@@ -174,4 +189,214 @@ HWTEST_F(RSPathTest, SetDrawingPath_001, TestSize.Level2)
     rsPath->SetDrawingPath(path);
     EXPECT_NE(rsPath->drPath_, nullptr);
 }
+
+/**
+ * @tc.name: SetPosTanPrecisionTest001
+ * @tc.desc: Verify function SetPosTanPrecision ignores invalid precisions and drops the table
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSPathTest, SetPosTanPrecisionTest001, TestSize.Level1)
+{
+    auto rsPath = RSPath::CreateRSPath(MULTI_CONTOUR_SVG_PATH);
+    EXPECT_EQ(rsPath->GetPosTanPrecision(), 0.0f);
+    rsPath->SetPosTanPrecision(-1.0f);
+    EXPECT_EQ(rsPath->GetPosTanPrecision(), 0.0f);
+    rsPath->SetPosTanPrecision(NAN);
+    EXPECT_EQ(rsPath->GetPosTanPrecision(), 0.0f);
+
+    EXPECT_EQ(rsPath->GetPosTanSampleCount(), 0);
+    EXPECT_FALSE(rsPath->BuildPosTanTable());
+
+    rsPath->SetPosTanPrecision(RSPath::DEFAULT_POS_TAN_PRECISION);
+    EXPECT_TRUE(rsPath->BuildPosTanTable());
+    EXPECT_EQ(rsPath->posTanTable_.size(), rsPath->GetPosTanSampleCount() + 1);
+    rsPath->SetPosTanPrecision(1.0f);
+    EXPECT_FALSE(rsPath->isPosTanTableBuilt_);
+    EXPECT_TRUE(rsPath->posTanTable_.empty());
+}
+
+/**
+ * @tc.name: SetPosTanPrecisionTest002
+ * @tc.desc: Verify GetPosTan builds the table once it has been called as many times as the table has samples
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSPathTest, SetPosTanPrecisionTest002, TestSize.Level1)
+{
+    auto rsPath = RSPath::CreateRSPath(MULTI_CONTOUR_SVG_PATH);
+    Vector2f pos;
+    float degrees = 0.0f;
+    EXPECT_TRUE(rsPath->GetPosTan(1.0f, pos, degrees));
+    EXPECT_EQ(rsPath->posTanQueryCount_, 0);
+
+    constexpr float precision = 50.0f;
+    rsPath->SetPosTanPrecision(precision);
+    size_t sampleCount = rsPath->GetPosTanSampleCount();
+    ASSERT_GT(sampleCount, 1);
+    for (size_t i = 1; i < sampleCount; i++) {
+        EXPECT_TRUE(rsPath->GetPosTan(1.0f, pos, degrees));
+    }
+    EXPECT_FALSE(rsPath->isPosTanTableBuilt_);
+    EXPECT_TRUE(rsPath->GetPosTan(1.0f, pos, degrees));
+    EXPECT_TRUE(rsPath->isPosTanTableBuilt_);
+    EXPECT_EQ(rsPath->posTanTable_.size(), sampleCount + 1);
+
+    // an empty path has no table and still fails
+    auto emptyPath = RSPath::CreateRSPath();
+    emptyPath->SetPosTanPrecision(precision);
+    EXPECT_FALSE(emptyPath->GetPosTan(0.0f, pos, degrees));
+    EXPECT_TRUE(emptyPath->isPosTanTableBuilt_);
+}
+
+/**
+ * @tc.name: GetPosTanByTableTest001
+ * @tc.desc: Verify the position and tangent table matches the path within the precision and is exact at the ends
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSPathTest, GetPosTanByTableTest001, TestSize.Level1)
+{
+    auto exactPath = RSPath::CreateRSPath(MULTI_CONTOUR_SVG_PATH);
+    auto tablePath = RSPath::CreateRSPath(MULTI_CONTOUR_SVG_PATH);
+    tablePath->SetPosTanPrecision(RSPath::DEFAULT_POS_TAN_PRECISION);
+    ASSERT_TRUE(tablePath->BuildPosTanTable());
+    float distance = exactPath->GetDistance();
+    ASSERT_GT(distance, 0.0f);
+    EXPECT_EQ(tablePath->GetDistance(), distance);
+
+    constexpr int sampleCount = 997;
+    for (int i = 0; i <= sampleCount; i++) {
+        Vector2f exactPos;
+        Vector2f tablePos;
+        float exactDegrees = 0.0f;
+        float tableDegrees = 0.0f;
+        float sampleDistance = distance * i / sampleCount;
+        ASSERT_TRUE(exactPath->GetPosTan(sampleDistance, exactPos, exactDegrees));
+        ASSERT_TRUE(tablePath->GetPosTan(sampleDistance, tablePos, tableDegrees));
+        EXPECT_NEAR(tablePos[0], exactPos[0], RSPath::DEFAULT_POS_TAN_PRECISION);
+        EXPECT_NEAR(tablePos[1], exactPos[1], RSPath::DEFAULT_POS_TAN_PRECISION);
+        if (i == 0 || i == sampleCount) {
+            EXPECT_EQ(tablePos, exactPos);
+            EXPECT_EQ(tableDegrees, exactDegrees);
+        }
+    }
+
+    // out of range distances are clamped like the path does
+    Vector2f exactPos;
+    Vector2f tablePos;
+    float exactDegrees = 0.0f;
+    float tableDegrees = 0.0f;
+    EXPECT_TRUE(exactPath->GetPosTan(distance * 2.0f, exactPos, exactDegrees));
+    EXPECT_TRUE(tablePath->GetPosTan(distance * 2.0f, tablePos, tableDegrees));
+    EXPECT_EQ(tablePos, exactPos);
+    EXPECT_TRUE(tablePath->GetPosTan(-1.0f, tablePos, tableDegrees));
+    EXPECT_FALSE(tablePath->GetPosTan(NAN, tablePos, tableDegrees));
+}
+
+/**
+ * @tc.name: GetPosTanByTableTest002
+ * @tc.desc: Verify the tangent of the table on a smooth path and the table being rebuilt by SetDrawingPath
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSPathTest, GetPosTanByTableTest002, TestSize.Level1)
+{
+    Drawing::Path circle;
+    constexpr float radius = 100.0f;
+    circle.AddCircle(START_X + radius, START_Y + radius, radius);
+    auto exactPath = RSPath::CreateRSPath(circle);
+    auto tablePath = RSPath::CreateRSPath(MULTI_CONTOUR_SVG_PATH);
+    tablePath->SetPosTanPrecision(RSPath::DEFAULT_POS_TAN_PRECISION);
+    Vector4f pos;
+    float degrees = 0.0f;
+    ASSERT_TRUE(tablePath->BuildPosTanTable());
+    tablePath->SetDrawingPath(circle);
+    EXPECT_TRUE(tablePath->posTanTable_.empty());
+    ASSERT_TRUE(tablePath->BuildPosTanTable());
+    float distance = exactPath->GetDistance();
+    EXPECT_EQ(tablePath->GetDistance(), distance);
+    constexpr int sampleCount = 360;
+    constexpr float degreesTolerance = 0.5f;
+    for (int i = 0; i <= sampleCount; i++) {
+        Vector4f exactPos;
+        float exactDegrees = 0.0f;
+        float sampleDistance = distance * i / sampleCount;
+        ASSERT_TRUE(exactPath->GetPosTan(sampleDistance, exactPos, exactDegrees));
+        ASSERT_TRUE(tablePath->GetPosTan(sampleDistance, pos, degrees));
+        EXPECT_NEAR(pos[0], exactPos[0], RSPath::DEFAULT_POS_TAN_PRECISION);
+        EXPECT_NEAR(pos[1], exactPos[1], RSPath::DEFAULT_POS_TAN_PRECISION);
+        EXPECT_LT(DegreesDiff(degrees, exactDegrees), degreesTolerance);
+    }
+}
+
+/**
+ * @tc.name: GetPosTanByTableTest003
+ * @tc.desc: Verify the table is not interpolated across a corner of the path, where the path is queried instead
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSPathTest, GetPosTanByTableTest003, TestSize.Level1)
+{
+    // 7px samples do not fall on the corners at 100px and 200px
+    constexpr float precision = 7.0f;
+    const std::string cornerPath = "M 0 0 L 100 0 L 100 100 L 0 100";
+    auto exactPath = RSPath::CreateRSPath(cornerPath);
+    auto tablePath = RSPath::CreateRSPath(cornerPath);
+    tablePath->SetPosTanPrecision(precision);
+    ASSERT_TRUE(tablePath->BuildPosTanTable());
+    size_t brokenCount = 0;
+    for (size_t i = 0; i + 1 < tablePath->posTanTable_.size(); i++) {
+        brokenCount += tablePath->posTanTable_[i].isContinuous ? 0 : 1;
+    }
+    EXPECT_EQ(brokenCount, 2); // 2: the corners
+
+    constexpr float cornerDistances[] = { 99.0f, 100.5f, 199.0f, 201.0f };
+    for (float distance : cornerDistances) {
+        Vector2f exactPos;
+        Vector2f tablePos;
+        float exactDegrees = 0.0f;
+        float tableDegrees = 0.0f;
+        ASSERT_TRUE(exactPath->GetPosTan(distance, exactPos, exactDegrees));
+        ASSERT_TRUE(tablePath->GetPosTan(distance, tablePos, tableDegrees));
+        EXPECT_EQ(tablePos, exactPos);
+        EXPECT_EQ(tableDegrees, exactDegrees);
+    }
+}
+
+/**
+ * @tc.name: GetPosTanByTablePerfTest
+ * @tc.desc: Verify path animations on a multi contour svg path played once keep the exact path queries and the ones
+ *           repeated switch to the table once it pays back its build, staying within the precision of the path
+ * @tc.type: PERF
+ */
+HWTEST_F(RSPathTest, GetPosTanByTablePerfTest, TestSize.Level2)
+{
+    constexpr int frameCount = 120;
+    constexpr int repeatCounts[] = { 1, 10, 100 };
+    for (int repeatCount : repeatCounts) {
+        // every animation unmarshals its own path
+        auto exactPath = RSPath::CreateRSPath(MULTI_CONTOUR_SVG_PATH);
+        auto tablePath = RSPath::CreateRSPath(MULTI_CONTOUR_SVG_PATH);
+        tablePath->SetPosTanPrecision(RSPath::DEFAULT_POS_TAN_PRECISION);
+        size_t sampleCount = tablePath->GetPosTanSampleCount();
+        ASSERT_GT(sampleCount, static_cast<size_t>(frameCount));
+        float distance = exactPath->GetDistance();
+        for (int frame = 0; frame < frameCount * repeatCount; frame++) {
+            Vector2f exactPos;
+            Vector2f tablePos;
+            float exactDegrees = 0.0f;
+            float tableDegrees = 0.0f;
+            float frameDistance = distance * (frame % frameCount) / frameCount;
+            ASSERT_TRUE(exactPath->GetPosTan(frameDistance, exactPos, exactDegrees));
+            bool isTableBuilt = tablePath->isPosTanTableBuilt_;
+            ASSERT_TRUE(tablePath->GetPosTan(frameDistance, tablePos, tableDegrees));
+            if (!isTableBuilt) {
+                ASSERT_EQ(tablePos, exactPos);
+                ASSERT_EQ(tableDegrees, exactDegrees);
+            } else {
+                ASSERT_NEAR(tablePos[0], exactPos[0], RSPath::DEFAULT_POS_TAN_PRECISION);
+                ASSERT_NEAR(tablePos[1], exactPos[1], RSPath::DEFAULT_POS_TAN_PRECISION);
+            }
+        }
+        size_t queryCount = static_cast<size_t>(frameCount) * repeatCount;
+        EXPECT_EQ(tablePath->isPosTanTableBuilt_, queryCount >= sampleCount);
+        EXPECT_EQ(tablePath->posTanTable_.empty(), queryCount < sampleCount);
+    }
+}
 } // namespace OHOS::Rosen
@@ -14,11 +14,14 @@
  */
 
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "command/rs_base_node_command.h"
 #include "command/rs_command.h"
 #include "command/rs_command_factory.h"
 #include "command/rs_node_command.h"
+#include "modifier_ng/rs_render_modifier_ng.h"
+#include "pipeline/rs_canvas_render_node.h"
 #include "pipeline/rs_surface_render_node.h"
 #include "platform/common/rs_log.h"
 #include "platform/common/rs_system_properties.h"
@@ -41,7 +44,56 @@ public:
 void RSTransactionDataTest::SetUpTestCase() {}
 void RSTransactionDataTest::TearDownTestCase() {}
 void RSTransactionDataTest::SetUp() {}
-void RSTransactionDataTest::TearDown() {}
+void RSTransactionDataTest::TearDown()
+{
+    RSTransactionData::SetParallelApplyFunc(nullptr);
+}
+
+namespace {
+constexpr size_t PARALLEL_NODE_COUNT = 8;
+constexpr size_t PARALLEL_UPDATES_PER_NODE = 16;
+
+// each node owns one alpha property whose id equals the node id
+std::vector<std::shared_ptr<RSRenderProperty<float>>> CreateNodesWithAlpha(
+    const std::shared_ptr<RSContext>& context, NodeId firstId, size_t count)
+{
+    std::vector<std::shared_ptr<RSRenderProperty<float>>> properties;
+    for (size_t i = 0; i < count; ++i) {
+        NodeId nodeId = firstId + i;
+        auto node = std::make_shared<RSCanvasRenderNode>(nodeId, context);
+        auto property = std::make_shared<RSRenderProperty<float>>(0.f, nodeId);
+        auto modifier = ModifierNG::RSRenderModifier::MakeRenderModifier(
+            ModifierNG::RSModifierType::ALPHA, property, nodeId, ModifierNG::RSPropertyType::ALPHA);
+        node->AddModifier(modifier);
+        context->GetMutableNodeMap().RegisterRenderNode(node);
+        properties.push_back(property);
+    }
+    return properties;
+}
+
+// interleaves updates of all nodes so that every stage spans several nodes
+void AddAlphaUpdates(RSTransactionData& data, NodeId firstId, size_t count, float base)
+{
+    for (size_t round = 0; round < PARALLEL_UPDATES_PER_NODE; ++round) {
+        for (size_t i = 0; i < count; ++i) {
+            NodeId nodeId = firstId + i;
+            data.AddCommand(std::make_unique<RSUpdatePropertyFloat>(nodeId, base + i * 100.f + round, nodeId,
+                UPDATE_TYPE_OVERWRITE), nodeId, FollowType::NONE);
+        }
+    }
+}
+
+void RunTasksOnThreads(std::vector<std::function<void()>>& tasks)
+{
+    std::vector<std::thread> threads;
+    for (auto& task : tasks) {
+        threads.emplace_back(task);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+} // namespace
 
 /**
  * @tc.name: ProcessTest
@@ -953,5 +1005,194 @@ HWTEST_F(RSTransactionDataTest, IsCallingPidValid011, TestSize.Level1)
     EXPECT_FALSE(storedCommand->IsCallingPidValid());
 }
 
+/**
+ * @tc.name: ProcessParallel001
+ * @tc.desc: Node-local updates applied in parallel leave every node with its last update in payload order
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionDataTest, ProcessParallel001, TestSize.Level1)
+{
+    auto context = std::make_shared<RSContext>();
+    NodeId firstId = 1000;
+    auto properties = CreateNodesWithAlpha(context, firstId, PARALLEL_NODE_COUNT);
+    size_t applyCount = 0;
+    size_t taskCount = 0;
+    RSTransactionData::SetParallelApplyFunc([&applyCount, &taskCount](std::vector<std::function<void()>>& tasks) {
+        ++applyCount;
+        taskCount += tasks.size();
+        RunTasksOnThreads(tasks);
+    });
+
+    RSTransactionData data;
+    AddAlphaUpdates(data, firstId, PARALLEL_NODE_COUNT, 1.f);
+    data.Process(*context);
+
+    EXPECT_EQ(applyCount, 1u);
+    EXPECT_GT(taskCount, 1u);
+    for (size_t i = 0; i < PARALLEL_NODE_COUNT; ++i) {
+        EXPECT_EQ(properties[i]->Get(), 1.f + i * 100.f + (PARALLEL_UPDATES_PER_NODE - 1));
+    }
+}
+
+/**
+ * @tc.name: ProcessParallel002
+ * @tc.desc: A command outside the node-local set splits the payload into stages around it
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionDataTest, ProcessParallel002, TestSize.Level1)
+{
+    auto context = std::make_shared<RSContext>();
+    NodeId firstId = 2000;
+    auto properties = CreateNodesWithAlpha(context, firstId, PARALLEL_NODE_COUNT);
+    size_t applyCount = 0;
+    RSTransactionData::SetParallelApplyFunc([&applyCount](std::vector<std::function<void()>>& tasks) {
+        ++applyCount;
+        RunTasksOnThreads(tasks);
+    });
+
+    RSTransactionData data;
+    AddAlphaUpdates(data, firstId, PARALLEL_NODE_COUNT, 1.f);
+    std::string nodeName = "barrier";
+    data.AddCommand(std::make_unique<RSSetNodeName>(firstId, nodeName), firstId, FollowType::NONE);
+    AddAlphaUpdates(data, firstId, PARALLEL_NODE_COUNT, 2.f);
+    data.Process(*context);
+
+    EXPECT_EQ(applyCount, 2u);
+    for (size_t i = 0; i < PARALLEL_NODE_COUNT; ++i) {
+        EXPECT_EQ(properties[i]->Get(), 2.f + i * 100.f + (PARALLEL_UPDATES_PER_NODE - 1));
+    }
+}
+
+/**
+ * @tc.name: ProcessParallel003
+ * @tc.desc: Small transactions and stages targeting a single node are applied on the calling thread
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionDataTest, ProcessParallel003, TestSize.Level1)
+{
+    auto context = std::make_shared<RSContext>();
+    NodeId firstId = 3000;
+    auto properties = CreateNodesWithAlpha(context, firstId, PARALLEL_NODE_COUNT);
+    size_t applyCount = 0;
+    RSTransactionData::SetParallelApplyFunc([&applyCount](std::vector<std::function<void()>>& tasks) {
+        ++applyCount;
+        RunTasksOnThreads(tasks);
+    });
+
+    RSTransactionData small;
+    small.AddCommand(std::make_unique<RSUpdatePropertyFloat>(firstId, 5.f, firstId, UPDATE_TYPE_OVERWRITE),
+        firstId, FollowType::NONE);
+    small.Process(*context);
+    EXPECT_EQ(properties[0]->Get(), 5.f);
+
+    RSTransactionData singleNode;
+    AddAlphaUpdates(singleNode, firstId, 1, 1.f);
+    AddAlphaUpdates(singleNode, firstId, 1, 1.f);
+    AddAlphaUpdates(singleNode, firstId, 1, 1.f);
+    AddAlphaUpdates(singleNode, firstId, 1, 1.f);
+    singleNode.Process(*context);
+    EXPECT_EQ(properties[0]->Get(), 1.f + (PARALLEL_UPDATES_PER_NODE - 1));
+    EXPECT_EQ(applyCount, 0u);
+}
+
+/**
+ * @tc.name: ProcessParallel004
+ * @tc.desc: A FORCE_OVERWRITE update cancels animations through the animation manager, so it is a barrier
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionDataTest, ProcessParallel004, TestSize.Level1)
+{
+    auto context = std::make_shared<RSContext>();
+    NodeId firstId = 3500;
+    auto properties = CreateNodesWithAlpha(context, firstId, PARALLEL_NODE_COUNT);
+    size_t applyCount = 0;
+    RSTransactionData::SetParallelApplyFunc([&applyCount](std::vector<std::function<void()>>& tasks) {
+        ++applyCount;
+        RunTasksOnThreads(tasks);
+    });
+
+    RSTransactionData data;
+    AddAlphaUpdates(data, firstId, PARALLEL_NODE_COUNT, 1.f);
+    data.AddCommand(std::make_unique<RSUpdatePropertyFloat>(firstId, 0.5f, firstId, UPDATE_TYPE_FORCE_OVERWRITE),
+        firstId, FollowType::NONE);
+    AddAlphaUpdates(data, firstId, PARALLEL_NODE_COUNT, 2.f);
+    data.Process(*context);
+
+    EXPECT_EQ(applyCount, 2u);
+    for (size_t i = 0; i < PARALLEL_NODE_COUNT; ++i) {
+        EXPECT_EQ(properties[i]->Get(), 2.f + i * 100.f + (PARALLEL_UPDATES_PER_NODE - 1));
+    }
+}
+
+/**
+ * @tc.name: DeferredDirtyEvents001
+ * @tc.desc: Parent sub tree dirty marking is recorded while deferring and applied on flush
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionDataTest, DeferredDirtyEvents001, TestSize.Level1)
+{
+    auto context = std::make_shared<RSContext>();
+    auto parent = std::make_shared<RSCanvasRenderNode>(4000, context);
+    auto child = std::make_shared<RSCanvasRenderNode>(4001, context);
+    parent->AddChild(child);
+    parent->SetSubTreeDirty(false);
+    parent->isChildrenSorted_ = true;
+
+    std::vector<RSRenderNode::DeferredDirtyEvent> events;
+    RSRenderNode::SetDeferredDirtyEvents(&events);
+    child->SetDirty();
+    child->MarkParentNeedRegenerateChildren();
+    RSRenderNode::SetDeferredDirtyEvents(nullptr);
+    EXPECT_EQ(events.size(), 2u);
+    EXPECT_FALSE(parent->IsSubTreeDirty());
+    EXPECT_TRUE(parent->isChildrenSorted_);
+
+    RSRenderNode::FlushDeferredDirtyEvents(events);
+    EXPECT_TRUE(events.empty());
+    EXPECT_TRUE(parent->IsSubTreeDirty());
+    EXPECT_FALSE(parent->isChildrenSorted_);
+}
+
+/**
+ * @tc.name: IsNodeLocalCommand001
+ * @tc.desc: Only plain value property updates are treated as node-local
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionDataTest, IsNodeLocalCommand001, TestSize.Level1)
+{
+    EXPECT_TRUE(RSTransactionData::IsNodeLocalCommand(RSCommandType::RS_NODE,
+        RSNodeCommandType::UPDATE_MODIFIER_FLOAT));
+    EXPECT_FALSE(RSTransactionData::IsNodeLocalCommand(RSCommandType::RS_NODE,
+        RSNodeCommandType::UPDATE_MODIFIER_DRAW_CMD_LIST));
+    EXPECT_FALSE(RSTransactionData::IsNodeLocalCommand(RSCommandType::RS_NODE, RSNodeCommandType::SET_NODE_NAME));
+    EXPECT_FALSE(RSTransactionData::IsNodeLocalCommand(RSCommandType::BASE_NODE,
+        RSBaseNodeCommandType::BASE_NODE_ADD_CHILD));
+}
+
+/**
+ * @tc.name: CanProcessInParallel001
+ * @tc.desc: Node-local updates are applied in parallel unless they force overwrite a property
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSTransactionDataTest, CanProcessInParallel001, TestSize.Level1)
+{
+    NodeId nodeId = 1;
+    EXPECT_TRUE(RSTransactionData::CanProcessInParallel(
+        RSUpdatePropertyFloat(nodeId, 1.f, nodeId, UPDATE_TYPE_OVERWRITE)));
+    EXPECT_TRUE(RSTransactionData::CanProcessInParallel(
+        RSUpdatePropertyFloat(nodeId, 1.f, nodeId, UPDATE_TYPE_INCREMENTAL)));
+    EXPECT_FALSE(RSTransactionData::CanProcessInParallel(
+        RSUpdatePropertyFloat(nodeId, 1.f, nodeId, UPDATE_TYPE_FORCE_OVERWRITE)));
+    std::string nodeName = "node";
+    EXPECT_FALSE(RSTransactionData::CanProcessInParallel(RSSetNodeName(nodeId, nodeName)));
+}
+
 } // namespace Rosen
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -2199,5 +2199,143 @@ HWTEST_F(RSTransactionHandlerTest, GetTransactionDataIndex001, TestSize.Level1)
     transaction->FlushImplicitTransaction(1);
     ASSERT_NE(transaction->GetTransactionDataIndex(), expectedIndex);
 }
+
+namespace {
+std::unique_ptr<RSCommand> MakeFloatUpdate(NodeId nodeId, PropertyId propertyId, float value,
+    PropertyUpdateType type = UPDATE_TYPE_OVERWRITE)
+{
+    return std::make_unique<RSUpdatePropertyFloat>(nodeId, value, propertyId, type);
+}
+
+size_t GetMarshalledSize(const RSTransactionData& transactionData)
+{
+    Parcel parcel;
+    if (!transactionData.Marshalling(parcel)) {
+        return 0;
+    }
+    return parcel.GetDataSize();
+}
+} // namespace
+
+/**
+ * @tc.name: PropertyUpdateCoalescing001
+ * @tc.desc: Test that only the last overwrite of a node property is kept, at the position of the first one
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSTransactionHandlerTest, PropertyUpdateCoalescing001, TestSize.Level1)
+{
+    auto transaction = std::make_shared<RSTransactionHandler>();
+    transaction->SetPropertyUpdateCoalescingEnabled(true);
+    constexpr NodeId nodeId = 1;
+    constexpr PropertyId alphaId = 10;
+    constexpr PropertyId scaleId = 11;
+    constexpr float lastAlpha = 0.5f;
+    auto alpha = MakeFloatUpdate(nodeId, alphaId, 1.0f);
+    transaction->AddRemoteCommand(alpha, nodeId, FollowType::NONE);
+    auto scale = MakeFloatUpdate(nodeId, scaleId, 2.0f);
+    transaction->AddRemoteCommand(scale, nodeId, FollowType::NONE);
+    auto otherNodeAlpha = MakeFloatUpdate(nodeId + 1, alphaId, 1.0f);
+    transaction->AddRemoteCommand(otherNodeAlpha, nodeId + 1, FollowType::NONE);
+    auto alphaAgain = MakeFloatUpdate(nodeId, alphaId, lastAlpha);
+    transaction->AddRemoteCommand(alphaAgain, nodeId, FollowType::NONE);
+
+    auto& payload = transaction->implicitRemoteTransactionData_->payload_;
+    ASSERT_EQ(payload.size(), 3);
+    EXPECT_EQ(transaction->GetCoalescedCommandCount(), 1);
+    auto first = static_cast<RSUpdatePropertyFloat*>(std::get<2>(payload[0]).get());
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(std::get<1>(first->params_), lastAlpha);
+    EXPECT_EQ(first->indexVerifier_, 0);
+    EXPECT_GT(GetMarshalledSize(*transaction->implicitRemoteTransactionData_), 0);
+}
+
+/**
+ * @tc.name: PropertyUpdateCoalescing002
+ * @tc.desc: Test that other commands and non-overwrite updates are not coalesced across, and the switch works
+ * @tc.type: FUNC
+ */
+HWTEST_F(RSTransactionHandlerTest, PropertyUpdateCoalescing002, TestSize.Level1)
+{
+    auto transaction = std::make_shared<RSTransactionHandler>();
+    transaction->SetPropertyUpdateCoalescingEnabled(true);
+    constexpr NodeId nodeId = 1;
+    constexpr PropertyId alphaId = 10;
+    auto& payload = transaction->implicitRemoteTransactionData_->payload_;
+
+    // an animation command in between keeps both overwrites
+    auto alpha = MakeFloatUpdate(nodeId, alphaId, 1.0f);
+    transaction->AddRemoteCommand(alpha, nodeId, FollowType::NONE);
+    std::unique_ptr<RSCommand> animation =
+        std::make_unique<RSAnimationCallback>(nodeId, 1, 1, AnimationCallbackEvent::FINISHED);
+    transaction->AddRemoteCommand(animation, nodeId, FollowType::NONE);
+    auto alphaAgain = MakeFloatUpdate(nodeId, alphaId, 0.0f);
+    transaction->AddRemoteCommand(alphaAgain, nodeId, FollowType::NONE);
+    EXPECT_EQ(payload.size(), 3);
+
+    // an incremental update of the same property keeps the overwrites on both sides
+    auto increment = MakeFloatUpdate(nodeId, alphaId, 0.1f, UPDATE_TYPE_INCREMENTAL);
+    transaction->AddRemoteCommand(increment, nodeId, FollowType::NONE);
+    auto alphaLast = MakeFloatUpdate(nodeId, alphaId, 1.0f);
+    transaction->AddRemoteCommand(alphaLast, nodeId, FollowType::NONE);
+    EXPECT_EQ(payload.size(), 5);
+    EXPECT_EQ(transaction->GetCoalescedCommandCount(), 0);
+
+    transaction->SetPropertyUpdateCoalescingEnabled(false);
+    auto alphaDisabled = MakeFloatUpdate(nodeId, alphaId, 0.5f);
+    transaction->AddRemoteCommand(alphaDisabled, nodeId, FollowType::NONE);
+    EXPECT_EQ(payload.size(), 6);
+    EXPECT_EQ(transaction->GetCoalescedCommandCount(), 0);
+}
+
+/**
+ * @tc.name: PropertyUpdateCoalescingPerfTest
+ * @tc.desc: Test that one frame of an animation heavy scene keeps one update per node property when coalescing,
+ *           and marshals fewer bytes than the same frame without coalescing
+ * @tc.type: PERF
+ */
+HWTEST_F(RSTransactionHandlerTest, PropertyUpdateCoalescingPerfTest, TestSize.Level2)
+{
+    constexpr NodeId nodeCount = 200;
+    constexpr PropertyId propertyCount = 4;
+    constexpr int setsPerFrame = 5;
+    constexpr NodeId nodesPerAnimation = 10;
+    constexpr size_t animationCount = nodeCount / nodesPerAnimation;
+    auto buildFrame = [](bool coalescing) {
+        auto transaction = std::make_shared<RSTransactionHandler>();
+        transaction->SetPropertyUpdateCoalescingEnabled(coalescing);
+        for (int round = 0; round < setsPerFrame; round++) {
+            for (NodeId nodeId = 1; nodeId <= nodeCount; nodeId++) {
+                for (PropertyId propertyId = 1; propertyId <= propertyCount; propertyId++) {
+                    auto command = MakeFloatUpdate(nodeId, nodeId * propertyCount + propertyId, round);
+                    transaction->AddRemoteCommand(command, nodeId, FollowType::NONE);
+                }
+            }
+        }
+        for (NodeId nodeId = 1; nodeId <= nodeCount; nodeId += nodesPerAnimation) {
+            std::unique_ptr<RSCommand> command =
+                std::make_unique<RSAnimationCallback>(nodeId, 1, 1, AnimationCallbackEvent::FINISHED);
+            transaction->AddRemoteCommand(command, nodeId, FollowType::NONE);
+        }
+        return transaction;
+    };
+    auto plain = buildFrame(false);
+    auto coalesced = buildFrame(true);
+    EXPECT_EQ(plain->implicitRemoteTransactionData_->GetCommandCount(),
+        nodeCount * propertyCount * setsPerFrame + animationCount);
+    EXPECT_EQ(coalesced->implicitRemoteTransactionData_->GetCommandCount(),
+        nodeCount * propertyCount + animationCount);
+    EXPECT_EQ(plain->GetCoalescedCommandCount(), 0);
+    EXPECT_EQ(coalesced->GetCoalescedCommandCount(), nodeCount * propertyCount * (setsPerFrame - 1));
+    // every kept update carries the value of the last set of the frame
+    auto& payload = coalesced->implicitRemoteTransactionData_->payload_;
+    for (size_t i = 0; i < nodeCount * propertyCount; i++) {
+        auto command = static_cast<RSUpdatePropertyFloat*>(std::get<2>(payload[i]).get());
+        ASSERT_NE(command, nullptr);
+        EXPECT_EQ(std::get<1>(command->params_), static_cast<float>(setsPerFrame - 1));
+        EXPECT_EQ(command->indexVerifier_, i);
+    }
+    EXPECT_LT(GetMarshalledSize(*coalesced->implicitRemoteTransactionData_),
+        GetMarshalledSize(*plain->implicitRemoteTransactionData_));
+}
 } // namespace Rosen
 } // namespace OHOS
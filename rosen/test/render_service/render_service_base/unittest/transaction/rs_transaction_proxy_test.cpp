@@ -17,6 +17,7 @@
 
 #include "command/rs_animation_command.h"
 #include "command/rs_command.h"
+#include "command/rs_node_command.h"
 #include "transaction/rs_render_service_client.h"
 #include "transaction/rs_transaction_proxy.h"
 
@@ -1010,5 +1011,42 @@ HWTEST_F(RSTransactionProxyTest, CallbackPopMatchingFront001, TestSize.Level1)
     GTEST_LOG_(INFO) << "RSTransactionProxyTest CallbackPopMatchingFront001 end";
 }
 
+/**
+ * @tc.name: PropertyUpdateCoalescing001
+ * @tc.desc: Verify the proxy keeps only the last overwrite of a node property until another command is added
+ * @tc.type:FUNC
+ */
+HWTEST_F(RSTransactionProxyTest, PropertyUpdateCoalescing001, TestSize.Level1)
+{
+    auto rsTransactionProxy = RSTransactionProxy::GetInstance();
+    ASSERT_NE(rsTransactionProxy, nullptr);
+    rsTransactionProxy->implicitRemoteTransactionDataStack_ = {};
+    rsTransactionProxy->implicitRemoteTransactionData_ = std::make_unique<RSTransactionData>();
+    rsTransactionProxy->SetPropertyUpdateCoalescingEnabled(true);
+    uint64_t coalescedCount = rsTransactionProxy->GetCoalescedCommandCount();
+    constexpr NodeId nodeId = 1;
+    constexpr PropertyId alphaId = 10;
+    std::unique_ptr<RSCommand> alpha = std::make_unique<RSUpdatePropertyFloat>(nodeId, 1.0f, alphaId,
+        UPDATE_TYPE_OVERWRITE);
+    rsTransactionProxy->AddRemoteCommand(alpha, nodeId, FollowType::NONE);
+    std::unique_ptr<RSCommand> alphaAgain = std::make_unique<RSUpdatePropertyFloat>(nodeId, 0.5f, alphaId,
+        UPDATE_TYPE_OVERWRITE);
+    rsTransactionProxy->AddRemoteCommand(alphaAgain, nodeId, FollowType::NONE);
+    EXPECT_EQ(rsTransactionProxy->implicitRemoteTransactionData_->GetCommandCount(), 1u);
+    EXPECT_EQ(rsTransactionProxy->GetCoalescedCommandCount(), coalescedCount + 1);
+
+    std::unique_ptr<RSCommand> animation =
+        std::make_unique<RSAnimationCallback>(nodeId, 1, 1, AnimationCallbackEvent::FINISHED);
+    rsTransactionProxy->AddRemoteCommand(animation, nodeId, FollowType::NONE);
+    std::unique_ptr<RSCommand> alphaLast = std::make_unique<RSUpdatePropertyFloat>(nodeId, 0.0f, alphaId,
+        UPDATE_TYPE_OVERWRITE);
+    rsTransactionProxy->AddRemoteCommand(alphaLast, nodeId, FollowType::NONE);
+    EXPECT_EQ(rsTransactionProxy->implicitRemoteTransactionData_->GetCommandCount(), 3u);
+    EXPECT_EQ(rsTransactionProxy->GetCoalescedCommandCount(), coalescedCount + 1);
+
+    rsTransactionProxy->SetPropertyUpdateCoalescingEnabled(false);
+    rsTransactionProxy->implicitRemoteTransactionData_ = std::make_unique<RSTransactionData>();
+}
+
 } // namespace Rosen
 } // namespace OHOS
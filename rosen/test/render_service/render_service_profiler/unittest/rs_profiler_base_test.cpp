@@ -589,6 +589,23 @@ HWTEST_F(RecorRsProfileRecordTest, RecordStartSuccess, Level1)
     EXPECT_TRUE(RSProfiler::IsRecordingMode());
 }
 
+/*
+ * @tc.name: IsCommandTrackingMode
+ * @tc.desc: Test IsCommandTrackingMode in record and replay
+ * @tc.type: FUNC
+ */
+HWTEST_F(RecorRsProfileRecordTest, IsCommandTrackingMode, Level1)
+{
+    RSProfiler::testing_ = true;
+    RSProfiler::SetMode(Mode::NONE);
+    EXPECT_FALSE(RSProfiler::IsCommandTrackingMode());
+    RSProfiler::SetMode(Mode::WRITE);
+    EXPECT_TRUE(RSProfiler::IsCommandTrackingMode());
+    RSProfiler::SetMode(Mode::READ);
+    EXPECT_TRUE(RSProfiler::IsCommandTrackingMode());
+    RSProfiler::SetMode(Mode::NONE);
+}
+
 /*
  * @tc.name: RecordUpdate
  * @tc.desc: Test RecordUpdate
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "message_option.h"
+#include "message_parcel.h"
+#include "rs_profiler.h"
+#include "rs_profiler_replay_bench.h"
+#include "rs_profiler_utils.h"
+
+#include "command/rs_base_node_command.h"
+#include "command/rs_canvas_node_command.h"
+#include "modifier_ng/geometry/rs_bounds_render_modifier.h"
+#include "pipeline/rs_canvas_render_node.h"
+#include "pipeline/rs_context.h"
+#include "pipeline/rs_logical_display_render_node.h"
+#include "pipeline/rs_screen_render_node.h"
+#include "platform/ohos/transaction/zidl/rs_iclient_to_render_connection.h"
+#include "transaction/rs_marshalling_helper.h"
+#include "transaction/rs_transaction_data.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Rosen {
+namespace {
+constexpr uint32_t SCREEN_WIDTH = 64;
+constexpr uint32_t SCREEN_HEIGHT = 48;
+constexpr uint32_t FRAME_RATE = 100;
+constexpr uint32_t TRANSACTION_COUNT = 5;
+constexpr NodeId SCREEN_NODE_ID = 1;
+constexpr NodeId DISPLAY_NODE_ID = 2;
+constexpr NodeId WINDOW_NODE_ID = 3;
+constexpr PropertyId BOUNDS_PROPERTY_ID = 4;
+constexpr NodeId FIRST_ADDED_NODE_ID = 100;
+constexpr pid_t CAPTURE_PID = 1;
+const std::string CAPTURE_PATH = "/data/local/tmp/rs_profiler_replay_bench_test.ohr";
+
+// a screen with a display and a window of the screen size, marshalled like the first frame of a capture
+std::string MarshalFirstFrame()
+{
+    auto context = std::make_shared<RSContext>();
+    context->Initialize();
+    auto& nodeMap = context->GetMutableNodeMap();
+    auto screenNode = std::make_shared<RSScreenRenderNode>(SCREEN_NODE_ID, 0, context);
+    nodeMap.RegisterRenderNode(screenNode);
+    context->GetGlobalRootRenderNode()->AddChild(screenNode);
+    RSDisplayNodeConfig config;
+    auto displayNode = std::make_shared<RSLogicalDisplayRenderNode>(DISPLAY_NODE_ID, config, context);
+    nodeMap.RegisterRenderNode(displayNode);
+    screenNode->AddChild(displayNode);
+    auto windowNode = std::make_shared<RSCanvasRenderNode>(WINDOW_NODE_ID, context);
+    auto bounds = std::make_shared<RSRenderAnimatableProperty<Vector4f>>(
+        Vector4f(0.0f, 0.0f, SCREEN_WIDTH, SCREEN_HEIGHT), BOUNDS_PROPERTY_ID);
+    auto modifier = std::make_shared<ModifierNG::RSBoundsRenderModifier>();
+    modifier->AttachProperty(ModifierNG::RSPropertyType::BOUNDS, bounds);
+    windowNode->AddModifier(modifier);
+    nodeMap.RegisterRenderNode(windowNode);
+    displayNode->AddChild(windowNode);
+
+    std::stringstream stream;
+    RSProfiler::TypefaceMarshalling(stream, RSFILE_VERSION_LATEST);
+    RSProfiler::SetSubMode(SubMode::WRITE_EMUL);
+    RSProfiler::MarshalNodes(*context, stream, RSFILE_VERSION_LATEST, nullptr);
+    RSProfiler::SetSubMode(SubMode::NONE);
+    return stream.str();
+}
+
+// a commit of a transaction creating a canvas node under the window, in the layout RSProfiler::WriteRemoteRequest
+// records requests with
+std::string MarshalRequest(NodeId childId, uint32_t parcelNumber)
+{
+    auto transactionData = std::make_unique<RSTransactionData>();
+    transactionData->AddCommand(std::make_unique<RSCanvasNodeCreate>(childId, false), childId, FollowType::NONE);
+    transactionData->AddCommand(
+        std::make_unique<RSBaseNodeAddChild>(WINDOW_NODE_ID, childId, -1), WINDOW_NODE_ID, FollowType::NONE);
+    MessageParcel parcel;
+    parcel.WriteInterfaceToken(RSIClientToRenderConnection::GetDescriptor());
+    parcel.WriteInt32(0);
+    RSMarshallingHelper::MarshallingTransactionVer(parcel);
+    RSMarshallingHelper::CompatibleMarshalling(parcel, true, RSPARCELVER_ADD_NONEED);
+    parcel.WriteParcelable(transactionData.get());
+
+    std::stringstream stream;
+    const pid_t pid = CAPTURE_PID;
+    const auto code = static_cast<uint32_t>(RSIClientToRenderConnectionInterfaceCode::COMMIT_TRANSACTION);
+    const size_t dataSize = parcel.GetDataSize();
+    const int32_t flags = MessageOption::TF_ASYNC;
+    const int32_t waitTime = 0;
+    stream.write(reinterpret_cast<const char*>(&pid), sizeof(pid));
+    stream.write(reinterpret_cast<const char*>(&code), sizeof(code));
+    stream.write(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
+    stream.write(reinterpret_cast<const char*>(parcel.GetData()), dataSize);
+    stream.write(reinterpret_cast<const char*>(&flags), sizeof(flags));
+    stream.write(reinterpret_cast<const char*>(&waitTime), sizeof(waitTime));
+    stream.write(reinterpret_cast<const char*>(&parcelNumber), sizeof(parcelNumber));
+    return stream.str();
+}
+
+// one request in the middle of every frame
+bool WriteCapture(const std::string& path)
+{
+    RSFile file;
+    file.SetVersion(RSFILE_VERSION_LATEST);
+    if (!file.Create(path)) {
+        return false;
+    }
+    file.AddLayer();
+    file.AddHeaderPid(CAPTURE_PID);
+    file.AddHeaderFirstFrame(MarshalFirstFrame());
+    constexpr double halfFrame = 0.5;
+    for (uint32_t i = 0; i < TRANSACTION_COUNT; i++) {
+        const auto request = MarshalRequest(FIRST_ADDED_NODE_ID + i, i + 1);
+        file.WriteRSData((i + halfFrame) / FRAME_RATE, request.data(), request.size());
+    }
+    file.Close();
+    return true;
+}
+} // namespace
+
+class RSProfilerReplayBenchTest : public testing::Test {
+public:
+    static void SetUpTestCase() {};
+    static void TearDownTestCase() {};
+    void SetUp() override {};
+    void TearDown() override {};
+};
+
+/*
+ * @tc.name: OpenTest
+ * @tc.desc: Test that a missing capture is reported and nothing is replayed
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSProfilerReplayBenchTest, OpenTest, testing::ext::TestSize.Level1)
+{
+    RSProfilerReplayBench bench;
+    std::string error;
+    EXPECT_FALSE(bench.Open("/data/local/tmp/rs_profiler_replay_bench_not_exist.ohr", error));
+    EXPECT_FALSE(error.empty());
+    RSProfilerReplayFrameStats stats;
+    EXPECT_FALSE(bench.ReplayFrame(stats));
+    bench.Close();
+}
+
+/*
+ * @tc.name: ReplayCaptureTest
+ * @tc.desc: Test that a recorded capture is replayed frame by frame with the stats of every frame and that Close
+ *           restores the profiler state
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSProfilerReplayBenchTest, ReplayCaptureTest, testing::ext::TestSize.Level1)
+{
+    ASSERT_TRUE(WriteCapture(CAPTURE_PATH));
+    const bool profilerWasEnabled = RSProfiler::enabled_;
+    RSProfiler::enabled_ = false;
+    {
+        RSProfilerReplayBench bench;
+        std::string error;
+        ASSERT_TRUE(bench.Open(CAPTURE_PATH, error, FRAME_RATE)) << error;
+        EXPECT_TRUE(RSProfiler::enabled_);
+
+        std::vector<RSProfilerReplayFrameStats> frames;
+        RSProfilerReplayFrameStats stats;
+        while (bench.ReplayFrame(stats)) {
+            frames.push_back(stats);
+        }
+        ASSERT_EQ(frames.size(), TRANSACTION_COUNT);
+        for (uint32_t i = 0; i < TRANSACTION_COUNT; i++) {
+            EXPECT_EQ(frames[i].frame, i);
+            EXPECT_EQ(frames[i].transactionCount, 1u);
+            EXPECT_EQ(frames[i].commandCount, 2u);
+            // every transaction adds a canvas node
+            EXPECT_EQ(frames[i].nodeCount, frames[0].nodeCount + i);
+            EXPECT_EQ(frames[i].screenArea, static_cast<int64_t>(SCREEN_WIDTH * SCREEN_HEIGHT));
+            EXPECT_GE(frames[i].dirtyArea, 0);
+            EXPECT_LE(frames[i].dirtyArea, frames[i].screenArea);
+        }
+        auto summary = RSProfilerReplayBench::SummaryToString(frames);
+        EXPECT_EQ(summary.find(std::to_string(TRANSACTION_COUNT) + " frames"), 0);
+
+        bench.Close();
+        EXPECT_FALSE(RSProfiler::enabled_);
+        EXPECT_FALSE(bench.ReplayFrame(stats));
+    }
+    RSProfiler::enabled_ = profilerWasEnabled;
+    Utils::FileDelete(CAPTURE_PATH);
+}
+
+/*
+ * @tc.name: StatsToStringTest
+ * @tc.desc: Test that a frame row has a value for every column of the header and the dirty area is in percent
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSProfilerReplayBenchTest, StatsToStringTest, testing::ext::TestSize.Level1)
+{
+    RSProfilerReplayFrameStats stats;
+    stats.frame = 3;
+    stats.dirtyArea = 25;
+    stats.screenArea = 100;
+    auto header = RSProfilerReplayBench::GetStatsHeader();
+    auto row = RSProfilerReplayBench::StatsToString(stats);
+    EXPECT_EQ(std::count(header.begin(), header.end(), ','), std::count(row.begin(), row.end(), ','));
+    EXPECT_EQ(row.find("3,"), 0);
+    EXPECT_NE(row.find(",25,"), std::string::npos);
+}
+
+/*
+ * @tc.name: SummaryToStringTest
+ * @tc.desc: Test the median and p95 of the phase timings
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(RSProfilerReplayBenchTest, SummaryToStringTest, testing::ext::TestSize.Level1)
+{
+    EXPECT_EQ(RSProfilerReplayBench::SummaryToString({}).find("0 frames"), 0);
+
+    constexpr uint32_t frameCount = 100;
+    std::vector<RSProfilerReplayFrameStats> frames(frameCount);
+    for (uint32_t i = 0; i < frameCount; i++) {
+        frames[i].drawMs = frameCount - i;
+    }
+    auto summary = RSProfilerReplayBench::SummaryToString(frames);
+    EXPECT_EQ(summary.find("100 frames"), 0);
+    EXPECT_NE(summary.find("draw 50 / 95"), std::string::npos);
+}
+} // namespace OHOS::Rosen
@@ -16,10 +16,21 @@
 #ifndef COLORSPACECONVERTOR
 #define COLORSPACECONVERTOR
 
+#include <cstddef>
+#include <memory>
+
 #include "color_space.h"
 
 namespace OHOS {
 namespace ColorManager {
+enum ColorPixelFormat : uint32_t {
+    COLOR_PIXEL_FORMAT_RGBA_8888 = 0, // 8 bits per channel, red in the lowest byte
+    COLOR_PIXEL_FORMAT_RGBA_F16,      // half float per channel
+    COLOR_PIXEL_FORMAT_RGBA_1010102,  // 10 bits per color channel, red in the lowest bits, 2 bits alpha
+};
+
+struct ConvertLut;
+
 class ColorSpaceConvertor {
 public:
     ColorSpaceConvertor(const ColorSpace &src, const ColorSpace &dst, GamutMappingMode mappingMode);
@@ -42,6 +53,10 @@ public:
     Vector3 Convert(const Vector3& v) const;
     Vector3 ConvertLinear(const Vector3& v) const;
 
+    // Convert pixelCount pixels of format from src to dst, src and dst may be the same buffer, alpha is kept.
+    // The transfer functions are looked up in tables built on first use instead of a pow per channel.
+    bool ConvertPixels(const void* src, void* dst, size_t pixelCount, ColorPixelFormat format) const;
+
     static Vector3 ConvertSRGBToP3ColorSpace(const Vector3& sRGBColorValue)
     {
         return ColorSpaceConvertor::sRGBtoP3ColorSpaceConvertor.Convert(sRGBColorValue);
@@ -80,10 +95,14 @@ public:
     static ColorSpaceConvertor bt2020toSRGBColorSpaceConvertor;
 
 private:
+    std::shared_ptr<const ConvertLut> GetConvertLut() const;
+    std::shared_ptr<const ConvertLut> BuildConvertLut() const;
+
     ColorSpace srcColorSpace;
     ColorSpace dstColorSpace;
     [[maybe_unused]]GamutMappingMode mappingMode;
     Matrix3x3 transferMatrix;
+    mutable std::shared_ptr<const ConvertLut> convertLut;
 };
 }  // namespace ColorManager
 }  // namespace OHOS
@@ -15,8 +15,283 @@
 
 #include "color_space_convertor.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define COLOR_MANAGER_CONVERT_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define COLOR_MANAGER_CONVERT_SSE2
+#endif
+
 namespace OHOS {
 namespace ColorManager {
+// Transfer function tables of a convertor, the 8 and 10 bits channels are decoded exactly by code, the float
+// channels are looked up by exponent and the top mantissa bits and interpolated in between.
+struct ConvertLut {
+    class TransferLut {
+    public:
+        template<typename Func>
+        void Build(Func&& func)
+        {
+            zeroValue = func(0.0f);
+            for (uint32_t i = 0; i < table.size(); ++i) {
+                table[i] = func(FromBits(MIN_VALUE_BITS + (i << FRAC_BITS)));
+            }
+        }
+
+        // x is a linear or non-linear channel in [0, 1]
+        float Lookup(float x) const
+        {
+            if (!(x > MIN_VALUE)) {
+                // nan is taken as 0
+                float frac = x > 0.0f ? x / MIN_VALUE : 0.0f;
+                return zeroValue + (table[0] - zeroValue) * frac;
+            }
+            if (x >= 1.0f) {
+                return table.back();
+            }
+            uint32_t pos = ToBits(x) - MIN_VALUE_BITS;
+            uint32_t index = pos >> FRAC_BITS;
+            float frac = static_cast<float>(pos & FRAC_MASK) * (1.0f / (1 << FRAC_BITS));
+            return table[index] + (table[index + 1] - table[index]) * frac;
+        }
+
+    private:
+        static constexpr uint32_t OCTAVE_NUM = 20; // values below 2^-20 are interpolated from 0
+        static constexpr uint32_t STEP_BITS = 6; // 64 steps per octave
+        static constexpr uint32_t FRAC_BITS = 23 - STEP_BITS; // 23 is the mantissa bits of float
+        static constexpr uint32_t FRAC_MASK = (1 << FRAC_BITS) - 1;
+        static constexpr float MIN_VALUE = 1.0f / (1 << OCTAVE_NUM);
+        static constexpr uint32_t MIN_VALUE_BITS = (127 - OCTAVE_NUM) << 23; // 127 is the exponent bias of float
+
+        static uint32_t ToBits(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        static float FromBits(uint32_t bits)
+        {
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        float zeroValue = 0.0f;
+        std::array<float, (OCTAVE_NUM << STEP_BITS) + 1> table = {};
+    };
+
+    std::array<float, 256> decode8 = {}; // 256 codes of 8 bits
+    std::array<float, 1024> decode10 = {}; // 1024 codes of 10 bits
+    TransferLut decodeFloat;
+    TransferLut encode;
+    Matrix3x3 matrix = {};
+    float dstClampMin = 0.0f;
+    float dstClampMax = 1.0f;
+};
+
+namespace {
+constexpr size_t CONVERT_CHUNK_SIZE = 64;
+constexpr float RGB8_MAX = 255.0f;
+constexpr float RGB10_MAX = 1023.0f;
+constexpr uint32_t RGB8_MASK = 0xFF;
+constexpr uint32_t RGB10_MASK = 0x3FF;
+constexpr uint32_t RGBA8888_G_SHIFT = 8;
+constexpr uint32_t RGBA8888_B_SHIFT = 16;
+constexpr uint32_t RGBA8888_ALPHA_MASK = 0xFF000000;
+constexpr uint32_t RGBA1010102_G_SHIFT = 10;
+constexpr uint32_t RGBA1010102_B_SHIFT = 20;
+constexpr uint32_t RGBA1010102_ALPHA_MASK = 0xC0000000;
+constexpr uint32_t RGBA_F16_CHANNELS = 4;
+constexpr uint32_t RGBA_F16_ALPHA = 3;
+
+struct PixelChunk {
+    float r[CONVERT_CHUNK_SIZE];
+    float g[CONVERT_CHUNK_SIZE];
+    float b[CONVERT_CHUNK_SIZE];
+};
+
+float HalfToFloat(uint16_t half)
+{
+    uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16; // 16: sign bit from half to float
+    uint32_t exponent = (half >> 10) & 0x1F; // 10: mantissa bits of half
+    uint32_t mantissa = half & 0x3FF;
+    uint32_t bits;
+    if (exponent == 0) {
+        // zero or subnormal, mantissa * 2^-24
+        float value = static_cast<float>(mantissa) * (1.0f / (1 << 24));
+        return sign != 0 ? -value : value;
+    } else if (exponent == 0x1F) {
+        bits = sign | 0x7F800000 | (mantissa << 13); // 13: mantissa bits of float minus half
+    } else {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13); // 112: exponent bias of float minus half
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint16_t FloatToHalf(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000); // 16: sign bit from float to half
+    uint32_t absBits = bits & 0x7FFFFFFF;
+    if (absBits >= 0x7F800000) {
+        return static_cast<uint16_t>(sign | 0x7C00 | (absBits > 0x7F800000 ? 0x200 : 0)); // inf or nan
+    }
+    if (absBits >= 0x477FF000) {
+        return static_cast<uint16_t>(sign | 0x7C00); // rounds to inf
+    }
+    if (absBits < 0x38800000) {
+        // below the smallest normal half, round value * 2^24 to nearest even
+        return static_cast<uint16_t>(sign | static_cast<uint16_t>(std::nearbyint(std::fabs(value) * (1 << 24))));
+    }
+    // rebias the exponent and round the mantissa to nearest even
+    uint32_t rounded = absBits + 0xFFF + ((absBits >> 13) & 1);
+    return static_cast<uint16_t>(sign | ((rounded - 0x38000000) >> 13));
+}
+
+bool IsUnitRange(const ColorSpace& colorSpace)
+{
+    return FloatEqual(colorSpace.clampMin, 0.0f) && FloatEqual(colorSpace.clampMax, 1.0f);
+}
+
+// unpack to linear channels with the tables, or to non-linear channels when lut is nullptr
+void UnpackChunk(const void* src, size_t start, size_t count, ColorPixelFormat format, const ConvertLut* lut,
+    PixelChunk& chunk)
+{
+    if (format == COLOR_PIXEL_FORMAT_RGBA_F16) {
+        const uint16_t* pixels = static_cast<const uint16_t*>(src) + start * RGBA_F16_CHANNELS;
+        for (size_t i = 0; i < count; ++i) {
+            const uint16_t* pixel = pixels + i * RGBA_F16_CHANNELS;
+            float r = HalfToFloat(pixel[0]);
+            float g = HalfToFloat(pixel[1]);
+            float b = HalfToFloat(pixel[2]);
+            // Lookup clamps to the table range [0, 1]
+            chunk.r[i] = lut != nullptr ? lut->decodeFloat.Lookup(r) : r;
+            chunk.g[i] = lut != nullptr ? lut->decodeFloat.Lookup(g) : g;
+            chunk.b[i] = lut != nullptr ? lut->decodeFloat.Lookup(b) : b;
+        }
+        return;
+    }
+    const uint32_t* pixels = static_cast<const uint32_t*>(src) + start;
+    bool is8888 = format == COLOR_PIXEL_FORMAT_RGBA_8888;
+    uint32_t mask = is8888 ? RGB8_MASK : RGB10_MASK;
+    uint32_t gShift = is8888 ? RGBA8888_G_SHIFT : RGBA1010102_G_SHIFT;
+    uint32_t bShift = is8888 ? RGBA8888_B_SHIFT : RGBA1010102_B_SHIFT;
+    const float* table = nullptr;
+    if (lut != nullptr) {
+        table = is8888 ? lut->decode8.data() : lut->decode10.data();
+    }
+    float scale = 1.0f / (is8888 ? RGB8_MAX : RGB10_MAX);
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t r = pixels[i] & mask;
+        uint32_t g = (pixels[i] >> gShift) & mask;
+        uint32_t b = (pixels[i] >> bShift) & mask;
+        chunk.r[i] = table != nullptr ? table[r] : r * scale;
+        chunk.g[i] = table != nullptr ? table[g] : g * scale;
+        chunk.b[i] = table != nullptr ? table[b] : b * scale;
+    }
+}
+
+// multiply the linear channels by the transfer matrix and clamp them to the table range
+void ApplyMatrix(const Matrix3x3& m, PixelChunk& chunk, size_t count)
+{
+    size_t i = 0;
+#if defined(COLOR_MANAGER_CONVERT_NEON)
+    float32x4_t zero = vdupq_n_f32(0.0f);
+    float32x4_t one = vdupq_n_f32(1.0f);
+    for (; i + 4 <= count; i += 4) { // 4 lanes
+        float32x4_t r = vld1q_f32(chunk.r + i);
+        float32x4_t g = vld1q_f32(chunk.g + i);
+        float32x4_t b = vld1q_f32(chunk.b + i);
+        float32x4_t outR = vaddq_f32(vaddq_f32(vmulq_n_f32(r, m[0][0]), vmulq_n_f32(g, m[0][1])),
+            vmulq_n_f32(b, m[0][2]));
+        float32x4_t outG = vaddq_f32(vaddq_f32(vmulq_n_f32(r, m[1][0]), vmulq_n_f32(g, m[1][1])),
+            vmulq_n_f32(b, m[1][2]));
+        float32x4_t outB = vaddq_f32(vaddq_f32(vmulq_n_f32(r, m[2][0]), vmulq_n_f32(g, m[2][1])),
+            vmulq_n_f32(b, m[2][2]));
+        vst1q_f32(chunk.r + i, vminq_f32(vmaxq_f32(outR, zero), one));
+        vst1q_f32(chunk.g + i, vminq_f32(vmaxq_f32(outG, zero), one));
+        vst1q_f32(chunk.b + i, vminq_f32(vmaxq_f32(outB, zero), one));
+    }
+#elif defined(COLOR_MANAGER_CONVERT_SSE2)
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+    for (; i + 4 <= count; i += 4) { // 4 lanes
+        __m128 r = _mm_loadu_ps(chunk.r + i);
+        __m128 g = _mm_loadu_ps(chunk.g + i);
+        __m128 b = _mm_loadu_ps(chunk.b + i);
+        __m128 outR = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, _mm_set1_ps(m[0][0])), _mm_mul_ps(g, _mm_set1_ps(m[0][1]))),
+            _mm_mul_ps(b, _mm_set1_ps(m[0][2])));
+        __m128 outG = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, _mm_set1_ps(m[1][0])), _mm_mul_ps(g, _mm_set1_ps(m[1][1]))),
+            _mm_mul_ps(b, _mm_set1_ps(m[1][2])));
+        __m128 outB = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, _mm_set1_ps(m[2][0])), _mm_mul_ps(g, _mm_set1_ps(m[2][1]))),
+            _mm_mul_ps(b, _mm_set1_ps(m[2][2])));
+        _mm_storeu_ps(chunk.r + i, _mm_min_ps(_mm_max_ps(outR, zero), one));
+        _mm_storeu_ps(chunk.g + i, _mm_min_ps(_mm_max_ps(outG, zero), one));
+        _mm_storeu_ps(chunk.b + i, _mm_min_ps(_mm_max_ps(outB, zero), one));
+    }
+#endif
+    for (; i < count; ++i) {
+        Vector3 out = m * Vector3 {chunk.r[i], chunk.g[i], chunk.b[i]};
+        chunk.r[i] = std::clamp(out[0], 0.0f, 1.0f);
+        chunk.g[i] = std::clamp(out[1], 0.0f, 1.0f);
+        chunk.b[i] = std::clamp(out[2], 0.0f, 1.0f);
+    }
+}
+
+void EncodeChunk(const ConvertLut& lut, PixelChunk& chunk, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        chunk.r[i] = std::clamp(lut.encode.Lookup(chunk.r[i]), lut.dstClampMin, lut.dstClampMax);
+        chunk.g[i] = std::clamp(lut.encode.Lookup(chunk.g[i]), lut.dstClampMin, lut.dstClampMax);
+        chunk.b[i] = std::clamp(lut.encode.Lookup(chunk.b[i]), lut.dstClampMin, lut.dstClampMax);
+    }
+}
+
+uint32_t Quantize(float value, float max)
+{
+    return static_cast<uint32_t>(std::clamp(value, 0.0f, 1.0f) * max + 0.5f); // 0.5f: round to nearest
+}
+
+// pack the non-linear channels, alpha is read from src before the pixel is written
+void PackChunk(const void* src, void* dst, size_t start, size_t count, ColorPixelFormat format,
+    const PixelChunk& chunk)
+{
+    if (format == COLOR_PIXEL_FORMAT_RGBA_F16) {
+        const uint16_t* srcPixels = static_cast<const uint16_t*>(src) + start * RGBA_F16_CHANNELS;
+        uint16_t* dstPixels = static_cast<uint16_t*>(dst) + start * RGBA_F16_CHANNELS;
+        for (size_t i = 0; i < count; ++i) {
+            uint16_t alpha = srcPixels[i * RGBA_F16_CHANNELS + RGBA_F16_ALPHA];
+            uint16_t* pixel = dstPixels + i * RGBA_F16_CHANNELS;
+            pixel[0] = FloatToHalf(chunk.r[i]);
+            pixel[1] = FloatToHalf(chunk.g[i]);
+            pixel[2] = FloatToHalf(chunk.b[i]);
+            pixel[RGBA_F16_ALPHA] = alpha;
+        }
+        return;
+    }
+    const uint32_t* srcPixels = static_cast<const uint32_t*>(src) + start;
+    uint32_t* dstPixels = static_cast<uint32_t*>(dst) + start;
+    bool is8888 = format == COLOR_PIXEL_FORMAT_RGBA_8888;
+    float max = is8888 ? RGB8_MAX : RGB10_MAX;
+    uint32_t alphaMask = is8888 ? RGBA8888_ALPHA_MASK : RGBA1010102_ALPHA_MASK;
+    uint32_t gShift = is8888 ? RGBA8888_G_SHIFT : RGBA1010102_G_SHIFT;
+    uint32_t bShift = is8888 ? RGBA8888_B_SHIFT : RGBA1010102_B_SHIFT;
+    for (size_t i = 0; i < count; ++i) {
+        dstPixels[i] = (srcPixels[i] & alphaMask) | Quantize(chunk.r[i], max) |
+            (Quantize(chunk.g[i], max) << gShift) | (Quantize(chunk.b[i], max) << bShift);
+    }
+}
+} // namespace
+
 ColorSpaceConvertor::ColorSpaceConvertor(const ColorSpace &src,
     const ColorSpace &dst, GamutMappingMode mappingMode)
     : srcColorSpace(src), dstColorSpace(dst), mappingMode(mappingMode)
@@ -54,6 +329,66 @@ Vector3 ColorSpaceConvertor::ConvertLinear(const Vector3& v) const
     return dstLinear;
 }
 
+std::shared_ptr<const ConvertLut> ColorSpaceConvertor::BuildConvertLut() const
+{
+    auto lut = std::make_shared<ConvertLut>();
+    auto toLinear = [this](float v) { return srcColorSpace.ToLinear({v, v, v})[0]; };
+    for (uint32_t code = 0; code < lut->decode8.size(); ++code) {
+        lut->decode8[code] = toLinear(code / RGB8_MAX);
+    }
+    for (uint32_t code = 0; code < lut->decode10.size(); ++code) {
+        lut->decode10[code] = toLinear(code / RGB10_MAX);
+    }
+    lut->decodeFloat.Build(toLinear);
+    lut->encode.Build([this](float v) { return dstColorSpace.ToNonLinear({v, v, v})[0]; });
+    lut->matrix = transferMatrix;
+    lut->dstClampMin = dstColorSpace.clampMin;
+    lut->dstClampMax = dstColorSpace.clampMax;
+    return lut;
+}
+
+std::shared_ptr<const ConvertLut> ColorSpaceConvertor::GetConvertLut() const
+{
+    auto lut = std::atomic_load(&convertLut);
+    if (lut == nullptr) {
+        // concurrent first calls build the same tables, either of them is kept
+        lut = BuildConvertLut();
+        std::atomic_store(&convertLut, lut);
+    }
+    return lut;
+}
+
+bool ColorSpaceConvertor::ConvertPixels(const void* src, void* dst, size_t pixelCount,
+    ColorPixelFormat format) const
+{
+    if (src == nullptr || dst == nullptr || format > COLOR_PIXEL_FORMAT_RGBA_1010102) {
+        return false;
+    }
+    // the tables cover channels in [0, 1], extended ranges go through Convert pixel by pixel
+    std::shared_ptr<const ConvertLut> lut = nullptr;
+    if (IsUnitRange(srcColorSpace) && IsUnitRange(dstColorSpace)) {
+        lut = GetConvertLut();
+    }
+    PixelChunk chunk;
+    for (size_t start = 0; start < pixelCount; start += CONVERT_CHUNK_SIZE) {
+        size_t count = std::min(CONVERT_CHUNK_SIZE, pixelCount - start);
+        UnpackChunk(src, start, count, format, lut.get(), chunk);
+        if (lut != nullptr) {
+            ApplyMatrix(lut->matrix, chunk, count);
+            EncodeChunk(*lut, chunk, count);
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                Vector3 color = Convert(Vector3 {chunk.r[i], chunk.g[i], chunk.b[i]});
+                chunk.r[i] = color[0];
+                chunk.g[i] = color[1];
+                chunk.b[i] = color[2];
+            }
+        }
+        PackChunk(src, dst, start, count, format, chunk);
+    }
+    return true;
+}
+
 ColorSpaceConvertor ColorSpaceConvertor::sRGBtoP3ColorSpaceConvertor(ColorSpace(ColorSpaceName::SRGB),
     ColorSpace(ColorSpaceName::DISPLAY_P3), GamutMappingMode::GAMUT_MAP_CONSTANT);
 ColorSpaceConvertor ColorSpaceConvertor::p3toSRGBColorSpaceConvertor(ColorSpace(ColorSpaceName::DISPLAY_P3),
@@ -17,6 +17,9 @@
 #include <gtest/gtest.h>
 #include <hilog/log.h>
 #include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
 
 #include "color.h"
 #include "color_space.h"
@@ -128,6 +131,83 @@ static bool IsFinite(float x)
     return x * 0 == 0;
 }
 
+constexpr size_t BATCH_PIXEL_NUM = 4099; // not a multiple of the convert chunk
+constexpr uint32_t BENCHMARK_WIDTH = 3840;
+constexpr uint32_t BENCHMARK_HEIGHT = 2160;
+constexpr float RGB8_MAX = 255.0f;
+constexpr float RGB10_MAX = 1023.0f;
+constexpr float HALF_DELTA = 0.001f; // about one step of half float near 1.0
+constexpr uint16_t HALF_ONE = 0x3C00;
+
+static float HalfToFloat(uint16_t half)
+{
+    uint32_t exponent = (half >> 10) & 0x1F; // 10: mantissa bits of half
+    uint32_t mantissa = half & 0x3FF;
+    if (exponent == 0) {
+        return static_cast<float>(mantissa) / (1 << 24); // 24: subnormal half scale
+    }
+    uint32_t bits = ((exponent + 112) << 23) | (mantissa << 13); // 112, 23, 13: rebias half to float
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static uint32_t QuantizeChannel(float value, float max)
+{
+    return static_cast<uint32_t>(std::clamp(value, 0.0f, 1.0f) * max + 0.5f);
+}
+
+// convert packed pixels of 8 or 10 bits channels one by one with Convert and check the batch result within 1 step
+static void CheckPackedConvert(const ColorSpaceConvertor& convertor, ColorPixelFormat format)
+{
+    bool is8888 = format == COLOR_PIXEL_FORMAT_RGBA_8888;
+    uint32_t bits = is8888 ? 8 : 10; // 8, 10: bits per color channel
+    uint32_t mask = (1u << bits) - 1;
+    float max = is8888 ? RGB8_MAX : RGB10_MAX;
+    std::mt19937 random(BATCH_PIXEL_NUM);
+    std::vector<uint32_t> src(BATCH_PIXEL_NUM);
+    for (auto& pixel : src) {
+        pixel = random();
+    }
+    std::vector<uint32_t> dst(BATCH_PIXEL_NUM);
+    ASSERT_TRUE(convertor.ConvertPixels(src.data(), dst.data(), src.size(), format));
+    for (size_t i = 0; i < src.size(); ++i) {
+        Vector3 color = {(src[i] & mask) / max, ((src[i] >> bits) & mask) / max,
+            ((src[i] >> (bits * 2)) & mask) / max}; // 2: blue channel
+        Vector3 expected = convertor.Convert(color);
+        for (uint32_t channel = 0; channel < DIMES_3; ++channel) {
+            int32_t expectedCode = static_cast<int32_t>(QuantizeChannel(expected[channel], max));
+            int32_t code = static_cast<int32_t>((dst[i] >> (bits * channel)) & mask);
+            ASSERT_LE(std::abs(code - expectedCode), 1);
+        }
+        ASSERT_EQ(dst[i] >> (bits * DIMES_3), src[i] >> (bits * DIMES_3));
+    }
+
+    // in place gives the same pixels
+    ASSERT_TRUE(convertor.ConvertPixels(src.data(), src.data(), src.size(), format));
+    EXPECT_EQ(src, dst);
+}
+
+static void CheckHalfConvert(const ColorSpaceConvertor& convertor)
+{
+    constexpr uint32_t channels = 4;
+    std::mt19937 random(BATCH_PIXEL_NUM);
+    std::vector<uint16_t> src(BATCH_PIXEL_NUM * channels);
+    for (auto& channel : src) {
+        channel = static_cast<uint16_t>(random() % (HALF_ONE + 1));
+    }
+    std::vector<uint16_t> dst(src.size());
+    ASSERT_TRUE(convertor.ConvertPixels(src.data(), dst.data(), BATCH_PIXEL_NUM, COLOR_PIXEL_FORMAT_RGBA_F16));
+    for (size_t i = 0; i < BATCH_PIXEL_NUM; ++i) {
+        const uint16_t* pixel = src.data() + i * channels;
+        Vector3 expected = convertor.Convert({HalfToFloat(pixel[0]), HalfToFloat(pixel[1]), HalfToFloat(pixel[2])});
+        for (uint32_t channel = 0; channel < DIMES_3; ++channel) {
+            ASSERT_NEAR(HalfToFloat(dst[i * channels + channel]), expected[channel], HALF_DELTA);
+        }
+        ASSERT_EQ(dst[i * channels + DIMES_3], pixel[DIMES_3]);
+    }
+}
+
 class ColorManagerTest : public testing::Test {
 public:
     static constexpr HiviewDFX::HiLogLabel LOG_LABEL = {LOG_CORE, 0, "ColorManagerTest"};
@@ -1834,5 +1914,114 @@ HWTEST_F(ColorManagerTest, ToLinearLogGBranchWithNonZeroE, TestSize.Level1)
     EXPECT_NEAR(result[1], expected, 1e-5f);
     EXPECT_NEAR(result[2], expected, 1e-5f);
 }
+
+/**
+ * @tc.name: ConvertPixelsRGBA8888
+ * @tc.desc: Verify the batch conversion of RGBA8888 pixels is within one step of Convert
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ColorManagerTest, ConvertPixelsRGBA8888, TestSize.Level1)
+{
+    CheckPackedConvert(ColorSpaceConvertor::sRGBtoP3ColorSpaceConvertor, COLOR_PIXEL_FORMAT_RGBA_8888);
+    CheckPackedConvert(ColorSpaceConvertor::p3toSRGBColorSpaceConvertor, COLOR_PIXEL_FORMAT_RGBA_8888);
+    CheckPackedConvert(ColorSpaceConvertor(ColorSpace(ADOBE_RGB), ColorSpace(BT2020_PQ), GAMUT_MAP_CONSTANT),
+        COLOR_PIXEL_FORMAT_RGBA_8888);
+}
+
+/**
+ * @tc.name: ConvertPixelsRGBA1010102
+ * @tc.desc: Verify the batch conversion of RGBA1010102 pixels is within one step of Convert
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ColorManagerTest, ConvertPixelsRGBA1010102, TestSize.Level1)
+{
+    CheckPackedConvert(ColorSpaceConvertor::sRGBtoBT2020ColorSpaceConvertor, COLOR_PIXEL_FORMAT_RGBA_1010102);
+    CheckPackedConvert(ColorSpaceConvertor::bt2020toP3ColorSpaceConvertor, COLOR_PIXEL_FORMAT_RGBA_1010102);
+    CheckPackedConvert(ColorSpaceConvertor(ColorSpace(BT2020_HLG), ColorSpace(SRGB), GAMUT_MAP_CONSTANT),
+        COLOR_PIXEL_FORMAT_RGBA_1010102);
+}
+
+/**
+ * @tc.name: ConvertPixelsRGBAF16
+ * @tc.desc: Verify the batch conversion of half float pixels is close to Convert
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ColorManagerTest, ConvertPixelsRGBAF16, TestSize.Level1)
+{
+    CheckHalfConvert(ColorSpaceConvertor::sRGBtoP3ColorSpaceConvertor);
+    CheckHalfConvert(ColorSpaceConvertor::p3toBT2020ColorSpaceConvertor);
+    CheckHalfConvert(ColorSpaceConvertor(ColorSpace(DCI_P3), ColorSpace(SRGB), GAMUT_MAP_CONSTANT));
+}
+
+/**
+ * @tc.name: ConvertPixelsExtendedRange
+ * @tc.desc: Verify invalid arguments fail and color spaces clamped beyond [0, 1] are converted by Convert
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(ColorManagerTest, ConvertPixelsExtendedRange, TestSize.Level1)
+{
+    uint32_t pixel = 0xFF336699;
+    auto& convertor = ColorSpaceConvertor::sRGBtoP3ColorSpaceConvertor;
+    EXPECT_FALSE(convertor.ConvertPixels(nullptr, &pixel, 1, COLOR_PIXEL_FORMAT_RGBA_8888));
+    EXPECT_FALSE(convertor.ConvertPixels(&pixel, nullptr, 1, COLOR_PIXEL_FORMAT_RGBA_8888));
+    EXPECT_FALSE(convertor.ConvertPixels(&pixel, &pixel, 1, static_cast<ColorPixelFormat>(DIMES_3)));
+    EXPECT_TRUE(convertor.ConvertPixels(&pixel, &pixel, 0, COLOR_PIXEL_FORMAT_RGBA_8888));
+    EXPECT_EQ(pixel, 0xFF336699);
+
+    ColorSpace extended(SRGB);
+    extended.clampMax = 2.0f; // 2.0f: extended range
+    ColorSpaceConvertor extendedConvertor(extended, ColorSpace(DISPLAY_P3), GAMUT_MAP_CONSTANT);
+    uint16_t halfPixel[] = {0x4000, 0x3800, 0x0000, HALF_ONE}; // 2.0, 0.5, 0.0, 1.0
+    ASSERT_TRUE(extendedConvertor.ConvertPixels(halfPixel, halfPixel, 1, COLOR_PIXEL_FORMAT_RGBA_F16));
+    EXPECT_EQ(extendedConvertor.convertLut, nullptr);
+    Vector3 expected = extendedConvertor.Convert({2.0f, 0.5f, 0.0f});
+    for (uint32_t channel = 0; channel < DIMES_3; ++channel) {
+        EXPECT_NEAR(HalfToFloat(halfPixel[channel]), expected[channel], HALF_DELTA);
+    }
+    EXPECT_EQ(halfPixel[DIMES_3], HALF_ONE);
+}
+
+/**
+ * @tc.name: ConvertPixelsPerfTest
+ * @tc.desc: Verify the batch conversion of a 4K RGBA8888 image stays within one step of Convert pixel by pixel,
+ *           keeps the alpha and reuses the tables it built on the first call
+ * @tc.type: PERF
+ * @tc.require:
+ */
+HWTEST_F(ColorManagerTest, ConvertPixelsPerfTest, TestSize.Level2)
+{
+    ColorSpaceConvertor convertor(ColorSpace(SRGB), ColorSpace(DISPLAY_P3), GAMUT_MAP_CONSTANT);
+    std::mt19937 random(BENCHMARK_WIDTH);
+    std::vector<uint32_t> src(BENCHMARK_WIDTH * BENCHMARK_HEIGHT);
+    for (auto& pixel : src) {
+        pixel = random();
+    }
+    std::vector<uint32_t> batchDst(src.size());
+    EXPECT_EQ(convertor.convertLut, nullptr);
+    ASSERT_TRUE(convertor.ConvertPixels(src.data(), batchDst.data(), src.size(), COLOR_PIXEL_FORMAT_RGBA_8888));
+    auto convertLut = convertor.convertLut;
+    ASSERT_NE(convertLut, nullptr);
+
+    for (size_t i = 0; i < src.size(); ++i) {
+        Vector3 color = {(src[i] & 0xFF) / RGB8_MAX, ((src[i] >> 8) & 0xFF) / RGB8_MAX, // 8: green shift
+            ((src[i] >> 16) & 0xFF) / RGB8_MAX}; // 16: blue shift
+        Vector3 expected = convertor.Convert(color);
+        for (uint32_t channel = 0; channel < DIMES_3; ++channel) {
+            int32_t expectedCode = static_cast<int32_t>(QuantizeChannel(expected[channel], RGB8_MAX));
+            int32_t code = static_cast<int32_t>((batchDst[i] >> (8 * channel)) & 0xFF); // 8: bits per channel
+            ASSERT_LE(std::abs(code - expectedCode), 1);
+        }
+        ASSERT_EQ(batchDst[i] & 0xFF000000, src[i] & 0xFF000000);
+    }
+
+    std::vector<uint32_t> warmDst(src.size());
+    ASSERT_TRUE(convertor.ConvertPixels(src.data(), warmDst.data(), src.size(), COLOR_PIXEL_FORMAT_RGBA_8888));
+    EXPECT_EQ(convertor.convertLut, convertLut);
+    EXPECT_EQ(warmDst, batchDst);
+}
 }
 }